@@ -0,0 +1,237 @@
+#include "advisor.h"
+#include "simulation.h"
+#include "switches.h"
+#include "grid.h"
+#include <chrono>
+#include <csignal>
+#include <unistd.h>
+#include <sys/wait.h>
+
+// ============================================================================
+// ADVISOR.CPP - Background lookahead for switch and safety-tile toggles
+// ============================================================================
+
+int lookahead[MAX_LOOKAHEAD][LOOKAHEAD_FIELDS];
+int numLookahead = 0;
+int lookaheadTick = -1;
+int lookaheadHorizon = 0;
+
+// Child process and read end of its result pipe per candidate (-1 = none).
+static pid_t lookaheadChild[MAX_LOOKAHEAD];
+static int lookaheadPipe[MAX_LOOKAHEAD];
+static int lookaheadWorkers = 1;
+static std::chrono::steady_clock::time_point lookaheadDeadline;
+
+// Result sent by a child: delivered, crashed, wait ticks.
+const int LOOKAHEAD_RESULT_INTS = 3;
+
+// ----------------------------------------------------------------------------
+// CANDIDATE CHILD
+// ----------------------------------------------------------------------------
+// FINISHED TRAINS by state. The tick counters double count pile-ups and
+// isSimulationComplete() writes the run's metrics, so the child counts
+// states itself (slots are not reused with streaming off).
+// ----------------------------------------------------------------------------
+static void countFinishedTrains(int& delivered, int& crashed) {
+    delivered = crashed = 0;
+    for (int i = 0; i < numTrains; i++) {
+        if (trains[i][TRAIN_STATE] == TRAIN_DELIVERED) delivered++;
+        else if (trains[i][TRAIN_STATE] == TRAIN_CRASHED) crashed++;
+    }
+}
+
+// ----------------------------------------------------------------------------
+// Runs in the forked child. Worker threads, log files and the schedule file
+// belong to the real run, so the child simulates single-threaded (fused
+// tick, or phased with reservations) with logging and the heatmap off, and
+// leaves with _exit() so no inherited buffer is flushed.
+// ----------------------------------------------------------------------------
+static void runCandidateChild(int c, int fd) {
+    syncTrainPositions();
+    logLevel = LOG_OFF;
+    printGridEnabled = false;
+    fingerprintEnabled = false;
+    heatmapEnabled = false;
+    streamingSchedule = false;
+    partitionedTick = false;
+    parallelRoutes = false;
+    bitboardTick = false;
+    segmentTick = false;
+    fusedTick = (reserveHorizon == 0);
+    tickThreads = 1;
+
+    int delivered, crashed;
+    countFinishedTrains(delivered, crashed);
+    int waitTicks = totalWaitTicks;
+
+    int arg = lookahead[c][LOOKAHEAD_ARG];
+    if (lookahead[c][LOOKAHEAD_ACTION] == LOOKAHEAD_SWITCH) {
+        toggleSwitchState(arg);
+    } else if (lookahead[c][LOOKAHEAD_ACTION] == LOOKAHEAD_SAFETY) {
+        toggleSafetyTile(arg / MAX_COLS, arg % MAX_COLS);
+    }
+
+    for (int t = 0; t < lookaheadHorizon; t++) simulateOneTick();
+
+    int deliveredAfter, crashedAfter;
+    countFinishedTrains(deliveredAfter, crashedAfter);
+    int result[LOOKAHEAD_RESULT_INTS] = {deliveredAfter - delivered, crashedAfter - crashed,
+                                         totalWaitTicks - waitTicks};
+    ssize_t written = write(fd, result, sizeof(result));
+    _exit(written == (ssize_t)sizeof(result) ? 0 : 1);
+}
+
+// ----------------------------------------------------------------------------
+// LAUNCH / FINISH
+// ----------------------------------------------------------------------------
+static void launchCandidate(int c) {
+    int fds[2];
+    if (pipe(fds) != 0) {
+        lookahead[c][LOOKAHEAD_STATUS] = LOOKAHEAD_TIMED_OUT;
+        return;
+    }
+
+    pid_t child = fork();
+    if (child == 0) {
+        close(fds[0]);
+        runCandidateChild(c, fds[1]);
+    }
+    close(fds[1]);
+    if (child < 0) {
+        close(fds[0]);
+        lookahead[c][LOOKAHEAD_STATUS] = LOOKAHEAD_TIMED_OUT;
+        return;
+    }
+
+    lookaheadChild[c] = child;
+    lookaheadPipe[c] = fds[0];
+    lookahead[c][LOOKAHEAD_STATUS] = LOOKAHEAD_RUNNING;
+}
+
+// Read the result of an exited child, or kill it (kill = true).
+static void finishCandidate(int c, bool kill) {
+    if (kill) {
+        ::kill(lookaheadChild[c], SIGKILL);
+        waitpid(lookaheadChild[c], nullptr, 0);
+        lookahead[c][LOOKAHEAD_STATUS] = LOOKAHEAD_TIMED_OUT;
+    } else {
+        int result[LOOKAHEAD_RESULT_INTS];
+        if (read(lookaheadPipe[c], result, sizeof(result)) == (ssize_t)sizeof(result)) {
+            lookahead[c][LOOKAHEAD_DELIVERED] = result[0];
+            lookahead[c][LOOKAHEAD_CRASHED] = result[1];
+            lookahead[c][LOOKAHEAD_WAIT] = result[2];
+            lookahead[c][LOOKAHEAD_STATUS] = LOOKAHEAD_DONE;
+        } else {
+            lookahead[c][LOOKAHEAD_STATUS] = LOOKAHEAD_TIMED_OUT;
+        }
+    }
+    close(lookaheadPipe[c]);
+    lookaheadChild[c] = -1;
+    lookaheadPipe[c] = -1;
+}
+
+// ----------------------------------------------------------------------------
+// CANDIDATE LIST
+// ----------------------------------------------------------------------------
+static void addCandidate(int action, int arg) {
+    int c = numLookahead++;
+    lookahead[c][LOOKAHEAD_ACTION] = action;
+    lookahead[c][LOOKAHEAD_ARG] = arg;
+    lookahead[c][LOOKAHEAD_STATUS] = LOOKAHEAD_PENDING;
+    lookahead[c][LOOKAHEAD_DELIVERED] = 0;
+    lookahead[c][LOOKAHEAD_CRASHED] = 0;
+    lookahead[c][LOOKAHEAD_WAIT] = 0;
+    lookaheadChild[c] = -1;
+    lookaheadPipe[c] = -1;
+}
+
+// ----------------------------------------------------------------------------
+// START / POLL / CANCEL
+// ----------------------------------------------------------------------------
+void startLookahead(int horizonTicks, int workers, double budgetSeconds, int safetyX, int safetyY) {
+    cancelLookahead();
+
+    // Before the first fork, and again after a safety toggle dropped the
+    // tables, so the children share them instead of each building its own
+    prepareLevelData();
+
+    addCandidate(LOOKAHEAD_NOTHING, 0);
+    for (int sw = 0; sw < numSwitches; sw++) {
+        int x = switches[sw][SWITCH_X];
+        int y = switches[sw][SWITCH_Y];
+        if (isSwitchTile(x, y) && getSwitchIndex(getTile(x, y)) == sw) addCandidate(LOOKAHEAD_SWITCH, sw);
+    }
+    if (safetyX >= 0 && isTrackTile(safetyX, safetyY)) {
+        addCandidate(LOOKAHEAD_SAFETY, safetyX * MAX_COLS + safetyY);
+    }
+
+    lookaheadTick = currentTick;
+    lookaheadHorizon = horizonTicks;
+    lookaheadWorkers = (workers < 1) ? 1 : workers;
+    lookaheadDeadline = std::chrono::steady_clock::now() +
+                        std::chrono::duration_cast<std::chrono::steady_clock::duration>(
+                            std::chrono::duration<double>(budgetSeconds));
+    pollLookahead();
+}
+
+bool pollLookahead() {
+    bool expired = std::chrono::steady_clock::now() >= lookaheadDeadline;
+    int running = 0;
+
+    for (int c = 0; c < numLookahead; c++) {
+        if (lookahead[c][LOOKAHEAD_STATUS] != LOOKAHEAD_RUNNING) continue;
+        if (waitpid(lookaheadChild[c], nullptr, WNOHANG) == lookaheadChild[c]) {
+            finishCandidate(c, false);
+        } else if (expired) {
+            finishCandidate(c, true);
+        } else {
+            running++;
+        }
+    }
+
+    bool pending = false;
+    for (int c = 0; c < numLookahead; c++) {
+        if (lookahead[c][LOOKAHEAD_STATUS] != LOOKAHEAD_PENDING) continue;
+        if (expired) {
+            lookahead[c][LOOKAHEAD_STATUS] = LOOKAHEAD_TIMED_OUT;
+        } else if (running < lookaheadWorkers) {
+            launchCandidate(c);
+            if (lookahead[c][LOOKAHEAD_STATUS] == LOOKAHEAD_RUNNING) running++;
+        } else {
+            pending = true;
+        }
+    }
+    return running == 0 && !pending;
+}
+
+void cancelLookahead() {
+    for (int c = 0; c < numLookahead; c++) {
+        if (lookahead[c][LOOKAHEAD_STATUS] == LOOKAHEAD_RUNNING) finishCandidate(c, true);
+    }
+    numLookahead = 0;
+    lookaheadTick = -1;
+}
+
+// ----------------------------------------------------------------------------
+// BEST CANDIDATE
+// ----------------------------------------------------------------------------
+int getBestLookahead() {
+    int best = -1;
+    for (int c = 0; c < numLookahead; c++) {
+        const int* r = lookahead[c];
+        if (r[LOOKAHEAD_STATUS] != LOOKAHEAD_DONE) continue;
+        if (best < 0) {
+            best = c;
+            continue;
+        }
+        const int* b = lookahead[best];
+        if (r[LOOKAHEAD_CRASHED] != b[LOOKAHEAD_CRASHED]) {
+            if (r[LOOKAHEAD_CRASHED] < b[LOOKAHEAD_CRASHED]) best = c;
+        } else if (r[LOOKAHEAD_DELIVERED] != b[LOOKAHEAD_DELIVERED]) {
+            if (r[LOOKAHEAD_DELIVERED] > b[LOOKAHEAD_DELIVERED]) best = c;
+        } else if (r[LOOKAHEAD_WAIT] < b[LOOKAHEAD_WAIT]) {
+            best = c;
+        }
+    }
+    return best;
+}
@@ -0,0 +1,74 @@
+#ifndef ADVISOR_H
+#define ADVISOR_H
+
+#include "simulation_state.h"
+
+// ============================================================================
+// ADVISOR.H - Background lookahead for switch and safety-tile toggles
+// ============================================================================
+// Forks the current simulation state (copy-on-write) once per candidate
+// action: do nothing, toggle each switch, or toggle one safety tile. Each
+// child applies its action, simulates the next N ticks single-threaded with
+// logging off and reports the deliveries, crashes and wait ticks over that
+// horizon through a pipe. At most a few children run at once; children
+// still running when the latency budget runs out are killed and reported
+// as timed out. Restarting or cancelling kills every child of the previous
+// evaluation, so stale results never show up.
+//
+// With a streaming schedule, trains not read yet are left out of the
+// prediction (the schedule file belongs to the real run). POSIX only.
+// ============================================================================
+
+// ----------------------------------------------------------------------------
+// CANDIDATES
+// ----------------------------------------------------------------------------
+const int MAX_LOOKAHEAD = MAX_SWITCHES + 2;
+
+enum LookaheadAction {
+    LOOKAHEAD_NOTHING,
+    LOOKAHEAD_SWITCH,       // Toggle switch LOOKAHEAD_ARG
+    LOOKAHEAD_SAFETY        // Toggle safety tile (LOOKAHEAD_ARG / MAX_COLS, % MAX_COLS)
+};
+
+enum LookaheadStatus {
+    LOOKAHEAD_PENDING,
+    LOOKAHEAD_RUNNING,
+    LOOKAHEAD_DONE,
+    LOOKAHEAD_TIMED_OUT
+};
+
+// Candidate data: 0=action, 1=arg, 2=status, 3=delivered, 4=crashed,
+// 5=wait ticks (3-5 over the horizon, valid once DONE)
+const int LOOKAHEAD_ACTION = 0;
+const int LOOKAHEAD_ARG = 1;
+const int LOOKAHEAD_STATUS = 2;
+const int LOOKAHEAD_DELIVERED = 3;
+const int LOOKAHEAD_CRASHED = 4;
+const int LOOKAHEAD_WAIT = 5;
+const int LOOKAHEAD_FIELDS = 6;
+
+extern int lookahead[MAX_LOOKAHEAD][LOOKAHEAD_FIELDS];
+extern int numLookahead;
+extern int lookaheadTick;       // Tick the evaluation forked from (-1 = none)
+extern int lookaheadHorizon;
+
+// ----------------------------------------------------------------------------
+// CONTROL
+// ----------------------------------------------------------------------------
+// Cancel any running evaluation and start a new one from the current state,
+// between ticks. safetyX/safetyY is the safety-tile candidate (-1 = none).
+void startLookahead(int horizonTicks, int workers, double budgetSeconds, int safetyX, int safetyY);
+
+// Collect finished children, start pending ones and enforce the budget.
+// Never blocks; call once per frame. Returns true once nothing is pending
+// or running.
+bool pollLookahead();
+
+// Kill every child of the current evaluation.
+void cancelLookahead();
+
+// Best finished candidate: fewest crashes, then most deliveries, then fewest
+// wait ticks (-1 if none finished).
+int getBestLookahead();
+
+#endif
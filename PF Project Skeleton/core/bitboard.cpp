@@ -0,0 +1,492 @@
+#include "bitboard.h"
+#include "simulation_state.h"
+#include "trains.h"
+#include "switches.h"
+#include "grid.h"
+#include "io.h"
+#include "metrics.h"
+#include "heatmap.h"
+#include "halt.h"
+#include <cstdlib>
+#include <cstring>
+#include <algorithm>
+
+// ============================================================================
+// BITBOARD.CPP - Bit-parallel single-threaded tick
+// ============================================================================
+
+typedef unsigned long long BitWord;
+
+// Words per board row; tile (x, y) is bit y % 64 of word y / 64 of row x.
+const int BB_WORDS = (MAX_COLS + 63) / 64;
+
+// ----------------------------------------------------------------------------
+// TILE BOARDS (built once per level, rebuilt after a safety tile toggle)
+// ----------------------------------------------------------------------------
+// plainBits: track a train leaves in the direction it entered (no switch,
+// curve or crossing).
+BitWord trackBits[MAX_ROWS][BB_WORDS];
+BitWord plainBits[MAX_ROWS][BB_WORDS];
+BitWord safetyBits[MAX_ROWS][BB_WORDS];
+bool bitboardsReady = false;
+
+// ----------------------------------------------------------------------------
+// TICK BOARDS (only rows bbFirstRow..bbLastRow are used and cleared)
+// ----------------------------------------------------------------------------
+BitWord occupiedBits[4][MAX_ROWS][BB_WORDS];   // Planned trains by direction
+BitWord contestedBits[MAX_ROWS][BB_WORDS];     // Target of two or more trains
+BitWord fastBits[4][MAX_ROWS][BB_WORDS];       // Plain straight step allowed
+BitWord finalBits[MAX_ROWS][BB_WORDS];         // Active trains after the tick
+int bbFirstRow = 0, bbLastRow = -1;
+
+// Planned move per train, planned trains (train index order, or move order
+// when MOVING rows are logged), and the trains heading into contested tiles.
+int bbX[MAX_TRAINS], bbY[MAX_TRAINS], bbDist[MAX_TRAINS];
+int bbOrder[MAX_TRAINS];
+int numBitboardMoves = 0;
+int bbContested[MAX_TRAINS];
+unsigned long long bbContestedKey[MAX_TRAINS];
+unsigned long long bbOrderKey[MAX_TRAINS];
+
+// Positions in bbContested that crashed with a later group member, and the
+// end of each position's group.
+int bbCrashFirst[MAX_TRAINS];
+int bbGroupEnd[MAX_TRAINS];
+
+// Off-track crashes and arrivals of this tick.
+int bbCrashes[MAX_TRAINS];
+int bbArrivals[MAX_TRAINS];
+
+// ----------------------------------------------------------------------------
+// BIT HELPERS
+// ----------------------------------------------------------------------------
+static bool testBit(BitWord board[][BB_WORDS], int x, int y) {
+    return (board[x][y >> 6] >> (y & 63)) & 1ULL;
+}
+
+static void setBit(BitWord board[][BB_WORDS], int x, int y) {
+    board[x][y >> 6] |= 1ULL << (y & 63);
+}
+
+// Word w of a board row moved one tile towards higher / lower columns.
+static BitWord shiftedRight(const BitWord* row, int w) {
+    return (row[w] << 1) | (w > 0 ? row[w - 1] >> 63 : 0ULL);
+}
+
+static BitWord shiftedLeft(const BitWord* row, int w) {
+    return (row[w] >> 1) | (w + 1 < BB_WORDS ? row[w + 1] << 63 : 0ULL);
+}
+
+// ----------------------------------------------------------------------------
+// ORDERING HELPERS
+// ----------------------------------------------------------------------------
+// detectCollisions() stable-sorts moves by distance (descending), so its
+// order is (distance desc, train index asc).
+// ----------------------------------------------------------------------------
+static bool moveBefore(int a, int b) {
+    if (bbDist[a] != bbDist[b]) return bbDist[a] > bbDist[b];
+    return a < b;
+}
+
+// Sort key for (target tile, move order): tile, then distance descending,
+// then train index, packed so plain integer sorting gives the order.
+const int KEY_TRAIN_BITS = 14;    // MAX_TRAINS
+const int KEY_DIST_BITS = 10;     // Distances stay below MAX_ROWS + MAX_COLS
+const int KEY_MAX_DIST = (1 << KEY_DIST_BITS) - 1;
+
+static unsigned long long targetKey(int i) {
+    unsigned long long cell = (unsigned long long)(bbX[i] * MAX_COLS + bbY[i]);
+    unsigned long long rank = (unsigned long long)(KEY_MAX_DIST - bbDist[i]);
+    return (cell << (KEY_DIST_BITS + KEY_TRAIN_BITS)) | (rank << KEY_TRAIN_BITS) | (unsigned long long)i;
+}
+
+static bool crashFirstBefore(int a, int b) {
+    return moveBefore(bbContested[a], bbContested[b]);
+}
+
+// ----------------------------------------------------------------------------
+// RESET / BUILD TILE BOARDS
+// ----------------------------------------------------------------------------
+void resetBitboards() {
+    bitboardsReady = false;
+}
+
+static void buildTileBoards() {
+    memset(trackBits, 0, sizeof(trackBits));
+    memset(plainBits, 0, sizeof(plainBits));
+    memset(safetyBits, 0, sizeof(safetyBits));
+    memset(occupiedBits, 0, sizeof(occupiedBits));
+    memset(contestedBits, 0, sizeof(contestedBits));
+    memset(fastBits, 0, sizeof(fastBits));
+    memset(finalBits, 0, sizeof(finalBits));
+    bbFirstRow = 0;
+    bbLastRow = -1;
+
+    for (int x = 0; x < gridRows; x++) {
+        for (int y = 0; y < gridCols; y++) {
+            if (!isTrackTile(x, y)) continue;
+            setBit(trackBits, x, y);
+
+            char tile = getTile(x, y);
+            if (!isSwitchTile(x, y) && tile != '+' && tile != '/' && tile != '\\') {
+                setBit(plainBits, x, y);
+            }
+            if (isSafetyTile(x, y)) setBit(safetyBits, x, y);
+        }
+    }
+    bitboardsReady = true;
+}
+
+void prepareBitboards() {
+    if (!bitboardsReady) buildTileBoards();
+}
+
+// ----------------------------------------------------------------------------
+// CLEAR LAST TICK'S ROWS
+// ----------------------------------------------------------------------------
+static void clearTickBoards() {
+    if (bbFirstRow > bbLastRow) return;
+    size_t bytes = (bbLastRow - bbFirstRow + 1) * sizeof(contestedBits[0]);
+    for (int dir = 0; dir < 4; dir++) {
+        memset(occupiedBits[dir][bbFirstRow], 0, bytes);
+        memset(fastBits[dir][bbFirstRow], 0, bytes);
+    }
+    memset(contestedBits[bbFirstRow], 0, bytes);
+    memset(finalBits[bbFirstRow], 0, bytes);
+}
+
+// ----------------------------------------------------------------------------
+// PASS 1: SPAWN + ROUTE + SWITCH COUNTERS + OCCUPANCY
+// ----------------------------------------------------------------------------
+// Off-track crashes are logged after the pass, so all SPAWNED rows still
+// come first. Returns the number of crashes.
+// ----------------------------------------------------------------------------
+static int spawnRouteCount(int& firstRow, int& lastRow) {
+    int numCrashes = 0;
+    numBitboardMoves = 0;
+    firstRow = gridRows;
+    lastRow = -1;
+
+    for (int i = 0; i < numTrains; i++) {
+        int* train = trains[i];
+
+        if (train[TRAIN_STATE] == TRAIN_SCHEDULED && train[TRAIN_SPAWN_TICK] == currentTick) {
+            train[TRAIN_STATE] = TRAIN_ACTIVE;
+            activeTrains++;
+            noteTrainSpawned(i);
+            logTrainTrace(i, TRACE_SPAWNED);
+        }
+        if (train[TRAIN_STATE] != TRAIN_ACTIVE) continue;
+
+        int x = train[TRAIN_X];
+        int y = train[TRAIN_Y];
+        int dir = train[TRAIN_DIRECTION];
+        int nextX = x + dx[dir];
+        int nextY = y + dy[dir];
+
+        if (!isInBounds(nextX, nextY) || !testBit(trackBits, nextX, nextY)) {
+            train[TRAIN_STATE] = TRAIN_CRASHED;
+            trainsCrashed++;
+            activeTrains--;
+            bbCrashes[numCrashes++] = i;
+            continue;
+        }
+
+        bbX[i] = nextX;
+        bbY[i] = nextY;
+        bbDist[i] = abs(nextX - train[TRAIN_DEST_X]) + abs(nextY - train[TRAIN_DEST_Y]);
+        bbOrder[numBitboardMoves++] = i;
+
+        // Trains sharing a tile and direction share the target
+        if (testBit(occupiedBits[dir], x, y)) setBit(contestedBits, nextX, nextY);
+        else setBit(occupiedBits[dir], x, y);
+        firstRow = std::min(firstRow, x);
+        lastRow = std::max(lastRow, x);
+
+        // Switch counters for the tile the train is on
+        if (!testBit(plainBits, x, y) && isSwitchTile(x, y)) {
+            int switchIndex = getSwitchIndex(getTile(x, y));
+            if (switchIndex >= 0 && switchIndex < numSwitches) {
+                if (switches[switchIndex][SWITCH_MODE] == PER_DIR) {
+                    switches[switchIndex][SWITCH_COUNTER0 + dir]++;
+                } else {
+                    switches[switchIndex][SWITCH_GLOBAL_COUNTER]++;
+                }
+            }
+        }
+    }
+    return numCrashes;
+}
+
+// ----------------------------------------------------------------------------
+// CONTESTED TILES (word-parallel)
+// ----------------------------------------------------------------------------
+// Each direction's board shifted one tile is the set of tiles its trains
+// move into. A tile is contested if two shifted boards overlap (stacked
+// trains were marked while routing).
+// ----------------------------------------------------------------------------
+static void findContestedTiles() {
+    for (int x = bbFirstRow; x <= bbLastRow; x++) {
+        const BitWord* below = (x + 1 < gridRows) ? occupiedBits[DIR_UP][x + 1] : 0;
+        const BitWord* above = (x > 0) ? occupiedBits[DIR_DOWN][x - 1] : 0;
+
+        for (int w = 0; w < BB_WORDS; w++) {
+            BitWord right = shiftedRight(occupiedBits[DIR_RIGHT][x], w);
+            BitWord left = shiftedLeft(occupiedBits[DIR_LEFT][x], w);
+            BitWord up = below ? below[w] : 0ULL;
+            BitWord down = above ? above[w] : 0ULL;
+
+            contestedBits[x][w] |= (right & left) | (up & (right | left)) | (down & (right | left | up));
+        }
+    }
+}
+
+// ----------------------------------------------------------------------------
+// FAST STEPS (word-parallel)
+// ----------------------------------------------------------------------------
+// A train takes the fast step if it is alone on a plain non-safety tile and
+// its target is a plain tile no other train moves into: it moves one tile
+// and keeps its direction.
+// ----------------------------------------------------------------------------
+static BitWord openWord(int x, int w) {
+    if (x < 0 || x >= gridRows) return 0ULL;
+    return plainBits[x][w] & ~contestedBits[x][w];
+}
+
+static void findFastSteps() {
+    for (int x = bbFirstRow; x <= bbLastRow; x++) {
+        BitWord openRow[BB_WORDS];
+        for (int w = 0; w < BB_WORDS; w++) openRow[w] = openWord(x, w);
+
+        for (int w = 0; w < BB_WORDS; w++) {
+            BitWord calm = plainBits[x][w] & ~safetyBits[x][w];
+            BitWord target[4];
+            target[DIR_UP] = openWord(x - 1, w);
+            target[DIR_DOWN] = openWord(x + 1, w);
+            target[DIR_RIGHT] = shiftedLeft(openRow, w);
+            target[DIR_LEFT] = shiftedRight(openRow, w);
+
+            for (int dir = 0; dir < 4; dir++) {
+                fastBits[dir][x][w] = occupiedBits[dir][x][w] & calm & target[dir];
+            }
+        }
+    }
+}
+
+// ----------------------------------------------------------------------------
+// COLLISIONS (contested trains only)
+// ----------------------------------------------------------------------------
+// Trains are grouped by target tile and every pair in a group is resolved.
+// Waits and crash counts do not depend on the order; the CRASHED rows are
+// written afterwards in the (i, j) order of the phased all-pairs loop.
+// ----------------------------------------------------------------------------
+static void resolveCollisions() {
+    int numContested = 0;
+    for (int m = 0; m < numBitboardMoves; m++) {
+        int i = bbOrder[m];
+        if (testBit(contestedBits, bbX[i], bbY[i])) bbContestedKey[numContested++] = targetKey(i);
+    }
+    if (numContested == 0) return;
+
+    std::sort(bbContestedKey, bbContestedKey + numContested);
+    for (int c = 0; c < numContested; c++) {
+        bbContested[c] = (int)(bbContestedKey[c] & ((1ULL << KEY_TRAIN_BITS) - 1));
+    }
+
+    int numCrashFirst = 0;
+    int groupStart = 0;
+    while (groupStart < numContested) {
+        int first = bbContested[groupStart];
+        int groupEnd = groupStart + 1;
+        while (groupEnd < numContested && bbX[bbContested[groupEnd]] == bbX[first] &&
+               bbY[bbContested[groupEnd]] == bbY[first]) {
+            groupEnd++;
+        }
+
+        for (int p = groupStart; p + 1 < groupEnd; p++) {
+            int trainI = bbContested[p];
+            bbGroupEnd[p] = groupEnd;
+            bool crashed = false;
+            for (int q = p + 1; q < groupEnd; q++) {
+                int trainJ = bbContested[q];
+                noteTileConflict(bbX[trainI], bbY[trainI]);
+
+                if (bbDist[trainI] > bbDist[trainJ]) {
+                    trains[trainJ][TRAIN_WAIT_TICKS]++;
+                    noteTrainWaiting(trainJ);
+                } else if (bbDist[trainJ] > bbDist[trainI]) {
+                    trains[trainI][TRAIN_WAIT_TICKS]++;
+                    noteTrainWaiting(trainI);
+                } else {
+                    trains[trainI][TRAIN_STATE] = TRAIN_CRASHED;
+                    trains[trainJ][TRAIN_STATE] = TRAIN_CRASHED;
+                    trainsCrashed += 2;
+                    activeTrains -= 2;
+
+                    crashed = true;
+                }
+            }
+            if (crashed) bbCrashFirst[numCrashFirst++] = p;
+        }
+        groupStart = groupEnd;
+    }
+
+    if (logLevel == LOG_OFF) return;
+    std::sort(bbCrashFirst, bbCrashFirst + numCrashFirst, crashFirstBefore);
+    for (int c = 0; c < numCrashFirst; c++) {
+        int p = bbCrashFirst[c];
+        for (int q = p + 1; q < bbGroupEnd[p]; q++) {
+            if (bbDist[bbContested[q]] != bbDist[bbContested[p]]) continue;
+            logTrainTrace(bbContested[p], TRACE_CRASHED);
+            logTrainTrace(bbContested[q], TRACE_CRASHED);
+        }
+    }
+}
+
+// ----------------------------------------------------------------------------
+// PASS 2: MOVE + ARRIVALS + EMERGENCY HALT
+// ----------------------------------------------------------------------------
+// Fast steps skip the tile rules; every other train follows moveAllTrains().
+// Movement does not depend on order, so trains are moved in index order
+// unless MOVING/WAIT rows are logged. Returns the number of arrivals.
+// ----------------------------------------------------------------------------
+static int moveArriveHalt() {
+    int numArrivals = 0;
+
+    if (logLevel >= LOG_CHANGES) {
+        for (int m = 0; m < numBitboardMoves; m++) {
+            int i = bbOrder[m];
+            bbOrderKey[m] = ((unsigned long long)(KEY_MAX_DIST - bbDist[i]) << KEY_TRAIN_BITS) | (unsigned long long)i;
+        }
+        std::sort(bbOrderKey, bbOrderKey + numBitboardMoves);
+        for (int m = 0; m < numBitboardMoves; m++) {
+            bbOrder[m] = (int)(bbOrderKey[m] & ((1ULL << KEY_TRAIN_BITS) - 1));
+        }
+    }
+
+    int delayTicks = 1;
+    if (weather == WEATHER_RAIN) delayTicks = 2;
+    if (weather == WEATHER_FOG) delayTicks = 3;
+
+    for (int m = 0; m < numBitboardMoves; m++) {
+        int i = bbOrder[m];
+        int* train = trains[i];
+        if (train[TRAIN_STATE] != TRAIN_ACTIVE) continue;
+
+        bool move = true;
+        bool fast = testBit(fastBits[train[TRAIN_DIRECTION]], train[TRAIN_X], train[TRAIN_Y]);
+        if (holdForRain(i)) {
+            totalWaitTicks++;
+            noteTrainWaiting(i);
+            move = false;
+        } else if (!fast && testBit(safetyBits, train[TRAIN_X], train[TRAIN_Y])) {
+            train[TRAIN_WAIT_TICKS]++;
+            totalWaitTicks++;
+            noteTrainWaiting(i);
+            if (train[TRAIN_WAIT_TICKS] >= delayTicks) {
+                train[TRAIN_WAIT_TICKS] = 0;
+            } else {
+                move = false;
+            }
+        }
+
+        if (move) {
+            train[TRAIN_X] = bbX[i];
+            train[TRAIN_Y] = bbY[i];
+            if (!fast) {
+                train[TRAIN_DIRECTION] = getNextDirection(bbX[i], bbY[i], train[TRAIN_DIRECTION], i);
+            }
+            countTrainMove(i);
+            noteTrainMoved(i);
+        }
+        logTrainTrace(i, move ? TRACE_MOVING : TRACE_WAITING);
+
+        int x = train[TRAIN_X];
+        int y = train[TRAIN_Y];
+        if (x == train[TRAIN_DEST_X] && y == train[TRAIN_DEST_Y]) {
+            train[TRAIN_STATE] = TRAIN_DELIVERED;
+            trainsDelivered++;
+            activeTrains--;
+            bbArrivals[numArrivals++] = i;
+            continue;
+        }
+
+        if (numHaltZones > 0 && isHaltTile(x, y)) haltTrain(i);
+        setBit(finalBits, x, y);
+    }
+    return numArrivals;
+}
+
+// ----------------------------------------------------------------------------
+// SIGNAL LIGHTS
+// ----------------------------------------------------------------------------
+// Same colours as updateSignalLights(): red if a train is on a neighbour of
+// the switch, yellow if one is a tile away from a neighbour.
+// ----------------------------------------------------------------------------
+static bool isOccupied(int x, int y) {
+    return isInBounds(x, y) && testBit(finalBits, x, y);
+}
+
+static void updateBitboardSignals() {
+    for (int sw = 0; sw < numSwitches; sw++) {
+        int x = switches[sw][SWITCH_X];
+        int y = switches[sw][SWITCH_Y];
+        if (!isInBounds(x, y)) continue;
+
+        bool hasConflict = false;
+        bool hasWarning = false;
+        for (int dir = 0; dir < 4; dir++) {
+            int nextX = x + dx[dir];
+            int nextY = y + dy[dir];
+            if (!isInBounds(nextX, nextY)) continue;
+
+            if (isOccupied(nextX, nextY)) hasConflict = true;
+            for (int around = 0; around < 4; around++) {
+                if (isOccupied(nextX + dx[around], nextY + dy[around])) hasWarning = true;
+            }
+        }
+
+        SignalColor signalColor = hasConflict ? SIGNAL_RED : (hasWarning ? SIGNAL_YELLOW : SIGNAL_GREEN);
+        logSignalState(sw, signalColor);
+    }
+}
+
+// ----------------------------------------------------------------------------
+// RUN BITBOARD PHASES
+// ----------------------------------------------------------------------------
+void runBitboardPhases() {
+    if (!bitboardsReady) buildTileBoards();
+    clearTickBoards();
+
+    // Phases 1-3
+    int firstRow, lastRow;
+    int numCrashes = spawnRouteCount(firstRow, lastRow);
+    for (int c = 0; c < numCrashes; c++) {
+        logTrainTrace(bbCrashes[c], TRACE_CRASHED);
+    }
+
+    // Targets and final positions lie at most one row away
+    bbFirstRow = std::max(0, firstRow - 1);
+    bbLastRow = std::min(gridRows - 1, lastRow + 1);
+
+    // Phase 4: Queue switch flips
+    queueSwitchFlips();
+
+    // Phases 5 and 7, emergency halt
+    findContestedTiles();
+    findFastSteps();
+    resolveCollisions();
+    int numArrivals = moveArriveHalt();
+
+    // Phase 6: Apply deferred switch flips
+    applyDeferredFlips();
+
+    // Deliveries are logged in train index order, after the flips
+    std::sort(bbArrivals, bbArrivals + numArrivals);
+    for (int a = 0; a < numArrivals; a++) {
+        logTrainTrace(bbArrivals[a], TRACE_DELIVERED);
+    }
+    updateEmergencyHalt();
+
+    updateBitboardSignals();
+}
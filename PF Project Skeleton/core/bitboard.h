@@ -0,0 +1,32 @@
+#ifndef BITBOARD_H
+#define BITBOARD_H
+
+// ============================================================================
+// BITBOARD.H - Bit-parallel single-threaded tick
+// ============================================================================
+// Train occupancy is kept as one bitboard per direction (64 tiles per word,
+// one row of words per grid row). Shifting the boards by one tile gives
+// every train's target at once, so contested target tiles and the trains
+// that can take a plain straight step are found with word-wide ANDs. Only
+// trains on switches, curves, crossings or safety tiles, or heading into a
+// contested tile, go through the full per-train rules. Log rows are written
+// in the phased engine's order, so the results are identical.
+// ============================================================================
+
+// ----------------------------------------------------------------------------
+// SETUP
+// ----------------------------------------------------------------------------
+// Rebuild the track/safety boards before the next tick (new level, or a
+// safety tile was toggled).
+void resetBitboards();
+
+// Build them now instead of at the first tick (prepareLevelData()).
+void prepareBitboards();
+
+// ----------------------------------------------------------------------------
+// TICK
+// ----------------------------------------------------------------------------
+// Run phases 1-7, emergency halt and signals for one tick.
+void runBitboardPhases();
+
+#endif
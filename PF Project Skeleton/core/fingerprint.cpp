@@ -0,0 +1,147 @@
+#include "fingerprint.h"
+#include "simulation_state.h"
+#include "grid.h"
+#include "halt.h"
+
+// ============================================================================
+// FINGERPRINT.CPP - Incremental state hash
+// ============================================================================
+
+const char* tickPhaseNames[NUM_TICK_PHASES] = {
+    "spawn", "route", "counters", "queue", "move", "flip", "arrivals", "halt", "signals"
+};
+
+// Entity part of the fingerprint (XOR of the hashes below)
+static unsigned long long entityHash = 0;
+static bool entityHashReady = false;
+
+// Last hash of each train / switch, and the train state it was taken in
+static unsigned long long trainHash[MAX_TRAINS];
+static int hashedTrainState[MAX_TRAINS];
+static unsigned long long switchHash[MAX_SWITCHES];
+
+static unsigned long long phaseFingerprint[NUM_TICK_PHASES];
+
+// Key kinds, so equal fields of different entities hash differently
+const unsigned long long KIND_TRAIN = 1ULL << 56;
+const unsigned long long KIND_SWITCH = 2ULL << 56;
+const unsigned long long KIND_TILE = 3ULL << 56;
+const unsigned long long KIND_GLOBAL = 4ULL << 56;
+const unsigned long long KIND_HALT = 5ULL << 56;
+
+// ----------------------------------------------------------------------------
+// MIX (SplitMix64 finaliser)
+// ----------------------------------------------------------------------------
+static unsigned long long mix(unsigned long long x) {
+    x += 0x9E3779B97F4A7C15ULL;
+    x = (x ^ (x >> 30)) * 0xBF58476D1CE4E5B9ULL;
+    x = (x ^ (x >> 27)) * 0x94D049BB133111EBULL;
+    return x ^ (x >> 31);
+}
+
+// ----------------------------------------------------------------------------
+// ENTITY HASHES
+// ----------------------------------------------------------------------------
+static unsigned long long hashFields(unsigned long long key, const int* fields, int count) {
+    unsigned long long h = mix(key);
+    for (int f = 0; f < count; f++) {
+        h = mix(h ^ (unsigned int)fields[f]);
+    }
+    return h;
+}
+
+static void rehashTrain(int i) {
+    entityHash ^= trainHash[i];
+    trainHash[i] = hashFields(KIND_TRAIN | (unsigned int)i, trains[i], TRAIN_FIELDS);
+    hashedTrainState[i] = trains[i][TRAIN_STATE];
+    entityHash ^= trainHash[i];
+}
+
+static void rehashSwitch(int sw) {
+    entityHash ^= switchHash[sw];
+    switchHash[sw] = hashFields(KIND_SWITCH | (unsigned int)sw, switches[sw], SWITCH_FIELDS);
+    entityHash ^= switchHash[sw];
+}
+
+static unsigned long long tileKey(int x, int y) {
+    return mix(KIND_TILE | (unsigned int)(x * MAX_COLS + y));
+}
+
+// ----------------------------------------------------------------------------
+// FULL HASH (first update after a reset)
+// ----------------------------------------------------------------------------
+static void hashWholeState() {
+    entityHash = 0;
+    for (int i = 0; i < numTrains; i++) {
+        trainHash[i] = 0;
+        rehashTrain(i);
+    }
+    for (int sw = 0; sw < numSwitches; sw++) {
+        switchHash[sw] = 0;
+        rehashSwitch(sw);
+    }
+    for (int x = 0; x < gridRows; x++) {
+        for (int y = 0; y < gridCols; y++) {
+            if (isSafetyTile(x, y)) entityHash ^= tileKey(x, y);
+        }
+    }
+    entityHashReady = true;
+}
+
+// ----------------------------------------------------------------------------
+// GLOBAL HASH (tick, counters, halt zones - recomputed every update)
+// ----------------------------------------------------------------------------
+// With no zones the halt fields hash as the single emergency halt used to
+// when it was off, so fingerprints of levels without halts are unchanged.
+// ----------------------------------------------------------------------------
+static unsigned long long hashGlobals() {
+    const int globals[] = {
+        currentTick, trainsDelivered, trainsCrashed, switchFlips, totalWaitTicks,
+        numHaltZones, haltZonesStarted, haltCoveredTiles, haltedTrainTicks, haltZoneRange
+    };
+    unsigned long long hash = hashFields(KIND_GLOBAL, globals, sizeof(globals) / sizeof(globals[0]));
+    for (int z = 0; z < numHaltZones; z++) {
+        int zone = haltZoneList[z];
+        hash ^= hashFields(KIND_HALT | (unsigned int)zone, haltZones[zone], HALT_FIELDS);
+    }
+    return hash;
+}
+
+// ----------------------------------------------------------------------------
+// RESET / UPDATE
+// ----------------------------------------------------------------------------
+void resetFingerprint() {
+    entityHashReady = false;
+    for (int p = 0; p < NUM_TICK_PHASES; p++) {
+        phaseFingerprint[p] = 0;
+    }
+}
+
+// ----------------------------------------------------------------------------
+// Scheduled, delivered and crashed trains never change, so only trains that
+// are active now or were active at their last hash are rehashed.
+// ----------------------------------------------------------------------------
+void updateFingerprint(TickPhase phase) {
+    if (!entityHashReady) {
+        hashWholeState();
+    } else {
+        for (int i = 0; i < numTrains; i++) {
+            if (trains[i][TRAIN_STATE] == TRAIN_ACTIVE || hashedTrainState[i] == TRAIN_ACTIVE ||
+                trains[i][TRAIN_STATE] != hashedTrainState[i]) {
+                rehashTrain(i);
+            }
+        }
+        for (int sw = 0; sw < numSwitches; sw++) {
+            rehashSwitch(sw);
+        }
+    }
+    phaseFingerprint[phase] = entityHash ^ hashGlobals();
+}
+
+void toggleFingerprintTile(int x, int y) {
+    if (entityHashReady) entityHash ^= tileKey(x, y);
+}
+
+unsigned long long getPhaseFingerprint(TickPhase phase) {
+    return phaseFingerprint[phase];
+}
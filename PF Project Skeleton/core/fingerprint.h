@@ -0,0 +1,53 @@
+#ifndef FINGERPRINT_H
+#define FINGERPRINT_H
+
+// ============================================================================
+// FINGERPRINT.H - Incremental 64-bit hash of the simulation state
+// ============================================================================
+// The fingerprint is the XOR of one hash per train, one per switch and one
+// key per safety tile, mixed with the tick, counters and emergency halt.
+// Updating it only rehashes the entities that can have changed: active
+// trains (and trains that just left the track), the switches, and toggled
+// safety tiles. Two runs with the same fingerprint sequence went through
+// the same states.
+// ============================================================================
+
+// ----------------------------------------------------------------------------
+// CHECKPOINTS (the phased engine records one after every phase)
+// ----------------------------------------------------------------------------
+enum TickPhase {
+    PHASE_SPAWN,
+    PHASE_ROUTE,
+    PHASE_COUNTERS,
+    PHASE_QUEUE,
+    PHASE_MOVE,
+    PHASE_FLIP,
+    PHASE_ARRIVALS,
+    PHASE_HALT,
+    PHASE_SIGNALS,
+    NUM_TICK_PHASES
+};
+
+// Phase names for reports ("spawn", "route", ...).
+extern const char* tickPhaseNames[NUM_TICK_PHASES];
+
+// ----------------------------------------------------------------------------
+// UPDATES
+// ----------------------------------------------------------------------------
+// Forget the entity hashes; the next update hashes the whole state.
+void resetFingerprint();
+
+// Rehash changed entities and store the fingerprint for this phase.
+// The partitioned engine only records PHASE_SIGNALS (end of tick).
+void updateFingerprint(TickPhase phase);
+
+// A safety tile was toggled (keeps the tile part incremental).
+void toggleFingerprintTile(int x, int y);
+
+// ----------------------------------------------------------------------------
+// QUERIES
+// ----------------------------------------------------------------------------
+// Fingerprint recorded at a phase of the current tick.
+unsigned long long getPhaseFingerprint(TickPhase phase);
+
+#endif
@@ -0,0 +1,327 @@
+#include "fused.h"
+#include "simulation_state.h"
+#include "trains.h"
+#include "switches.h"
+#include "grid.h"
+#include "io.h"
+#include "metrics.h"
+#include "heatmap.h"
+#include "halt.h"
+#include <cstdlib>
+#include <algorithm>
+
+// ============================================================================
+// FUSED.CPP - Fused single-threaded tick
+// ============================================================================
+
+// Planned move per train for the current tick.
+int fusedX[MAX_TRAINS], fusedY[MAX_TRAINS], fusedDist[MAX_TRAINS];
+
+// Planned trains in move order, and for each position the next position
+// in that order with the same target tile (-1 = none).
+int fusedOrder[MAX_TRAINS];
+int fusedNextSame[MAX_TRAINS];
+int numFusedMoves = 0;
+
+// Off-track crashes (train index order) and arrivals of this tick.
+int fusedCrashes[MAX_TRAINS];
+int numFusedCrashes = 0;
+int fusedArrivals[MAX_TRAINS];
+int numFusedArrivals = 0;
+
+// Per-tile scratch: a tile belongs to the current use only if its stamp
+// matches, so the grid never needs clearing. fusedHead is the first move
+// into the tile while grouping collisions.
+int fusedStamp[MAX_ROWS][MAX_COLS];
+int fusedHead[MAX_ROWS][MAX_COLS];
+int fusedStampCounter = 0;
+
+// ----------------------------------------------------------------------------
+// KERNELS
+// ----------------------------------------------------------------------------
+// Weather and switch modes are fixed for a level, so the tick is built as a
+// template over both and one instance is picked at the first tick. Weather
+// is a WeatherType or ANY_WEATHER (read the global each time); Modes is a
+// SwitchModeMix, where SWITCHES_MIXED reads each switch's mode.
+// ----------------------------------------------------------------------------
+const int ANY_WEATHER = -1;
+
+typedef void (*FusedKernel)();
+FusedKernel fusedKernel = nullptr;
+
+template <int Weather>
+static inline bool isWeather(WeatherType type) {
+    return (Weather == ANY_WEATHER) ? weather == type : Weather == type;
+}
+
+// ----------------------------------------------------------------------------
+// MOVE ORDER
+// ----------------------------------------------------------------------------
+// detectCollisions() stable-sorts moves by distance (descending), so its
+// order is (distance desc, train index asc).
+// ----------------------------------------------------------------------------
+static bool moveBefore(int a, int b) {
+    if (fusedDist[a] != fusedDist[b]) return fusedDist[a] > fusedDist[b];
+    return a < b;
+}
+
+static bool isOccupied(int x, int y, int stamp) {
+    return isInBounds(x, y) && fusedStamp[x][y] == stamp;
+}
+
+// ----------------------------------------------------------------------------
+// PASS 1: SPAWN + ROUTE + SWITCH COUNTERS
+// ----------------------------------------------------------------------------
+// Off-track crashes are logged after the pass, so all SPAWNED rows still
+// come first.
+// ----------------------------------------------------------------------------
+template <SwitchModeMix Modes>
+static void spawnRouteCount() {
+    numFusedMoves = 0;
+    numFusedCrashes = 0;
+
+    for (int i = 0; i < numTrains; i++) {
+        int* train = trains[i];
+
+        if (train[TRAIN_STATE] == TRAIN_SCHEDULED && train[TRAIN_SPAWN_TICK] == currentTick) {
+            train[TRAIN_STATE] = TRAIN_ACTIVE;
+            activeTrains++;
+            noteTrainSpawned(i);
+            logTrainTrace(i, TRACE_SPAWNED);
+        }
+        if (train[TRAIN_STATE] != TRAIN_ACTIVE) continue;
+
+        int x = train[TRAIN_X];
+        int y = train[TRAIN_Y];
+        int dir = train[TRAIN_DIRECTION];
+        int nextX = x + dx[dir];
+        int nextY = y + dy[dir];
+
+        if (!isInBounds(nextX, nextY) || !isTrackTile(nextX, nextY)) {
+            train[TRAIN_STATE] = TRAIN_CRASHED;
+            trainsCrashed++;
+            activeTrains--;
+            fusedCrashes[numFusedCrashes++] = i;
+            continue;
+        }
+
+        fusedX[i] = nextX;
+        fusedY[i] = nextY;
+        fusedDist[i] = abs(nextX - train[TRAIN_DEST_X]) + abs(nextY - train[TRAIN_DEST_Y]);
+        fusedOrder[numFusedMoves++] = i;
+
+        // Switch counters for the tile the train is on
+        if (isSwitchTile(x, y)) {
+            int switchIndex = getSwitchIndex(getTile(x, y));
+            if (switchIndex >= 0 && switchIndex < numSwitches) {
+                if (Modes == SWITCHES_PER_DIR ||
+                    (Modes == SWITCHES_MIXED && switches[switchIndex][SWITCH_MODE] == PER_DIR)) {
+                    switches[switchIndex][SWITCH_COUNTER0 + dir]++;
+                } else {
+                    switches[switchIndex][SWITCH_GLOBAL_COUNTER]++;
+                }
+            }
+        }
+    }
+
+    for (int c = 0; c < numFusedCrashes; c++) {
+        logTrainTrace(fusedCrashes[c], TRACE_CRASHED);
+    }
+}
+
+// ----------------------------------------------------------------------------
+// COLLISIONS
+// ----------------------------------------------------------------------------
+// Moves into the same tile are chained in move order, so walking each chain
+// visits the (i, j) pairs in the same order as the phased all-pairs loop.
+// ----------------------------------------------------------------------------
+static void resolveCollisions() {
+    std::sort(fusedOrder, fusedOrder + numFusedMoves, moveBefore);
+
+    int stamp = ++fusedStampCounter;
+    for (int p = numFusedMoves - 1; p >= 0; p--) {
+        int i = fusedOrder[p];
+        int x = fusedX[i], y = fusedY[i];
+        fusedNextSame[p] = (fusedStamp[x][y] == stamp) ? fusedHead[x][y] : -1;
+        fusedStamp[x][y] = stamp;
+        fusedHead[x][y] = p;
+    }
+
+    for (int p = 0; p < numFusedMoves; p++) {
+        int trainI = fusedOrder[p];
+        for (int q = fusedNextSame[p]; q >= 0; q = fusedNextSame[q]) {
+            int trainJ = fusedOrder[q];
+            noteTileConflict(fusedX[trainI], fusedY[trainI]);
+
+            if (fusedDist[trainI] > fusedDist[trainJ]) {
+                trains[trainJ][TRAIN_WAIT_TICKS]++;
+                noteTrainWaiting(trainJ);
+            } else if (fusedDist[trainJ] > fusedDist[trainI]) {
+                trains[trainI][TRAIN_WAIT_TICKS]++;
+                noteTrainWaiting(trainI);
+            } else {
+                trains[trainI][TRAIN_STATE] = TRAIN_CRASHED;
+                trains[trainJ][TRAIN_STATE] = TRAIN_CRASHED;
+                trainsCrashed += 2;
+                activeTrains -= 2;
+
+                logTrainTrace(trainI, TRACE_CRASHED);
+                logTrainTrace(trainJ, TRACE_CRASHED);
+            }
+        }
+    }
+}
+
+// ----------------------------------------------------------------------------
+// PASS 2: MOVE + ARRIVALS + EMERGENCY HALT
+// ----------------------------------------------------------------------------
+// Same RAIN, safety-tile and weather rules as moveAllTrains(). Exit
+// directions read the switch states from before this tick's flips. Trains
+// still active afterwards mark their tile for the signal lights. Only RAIN
+// levels hold trains or start slowdowns.
+// ----------------------------------------------------------------------------
+template <int Weather>
+static int moveArriveHalt() {
+    int stamp = ++fusedStampCounter;
+    numFusedArrivals = 0;
+
+    int delayTicks = 1;
+    if (isWeather<Weather>(WEATHER_RAIN)) delayTicks = 2;
+    if (isWeather<Weather>(WEATHER_FOG)) delayTicks = 3;
+
+    for (int p = 0; p < numFusedMoves; p++) {
+        int i = fusedOrder[p];
+        int* train = trains[i];
+        if (train[TRAIN_STATE] != TRAIN_ACTIVE) continue;
+
+        bool move = true;
+        if (isWeather<Weather>(WEATHER_RAIN) && holdForRain(i)) {
+            totalWaitTicks++;
+            noteTrainWaiting(i);
+            move = false;
+        } else if (isSafetyTile(train[TRAIN_X], train[TRAIN_Y])) {
+            train[TRAIN_WAIT_TICKS]++;
+            totalWaitTicks++;
+            noteTrainWaiting(i);
+            if (train[TRAIN_WAIT_TICKS] >= delayTicks) {
+                train[TRAIN_WAIT_TICKS] = 0;
+            } else {
+                move = false;
+            }
+        }
+
+        if (move) {
+            train[TRAIN_X] = fusedX[i];
+            train[TRAIN_Y] = fusedY[i];
+            train[TRAIN_DIRECTION] = getNextDirection(fusedX[i], fusedY[i], train[TRAIN_DIRECTION], i);
+            if (isWeather<Weather>(WEATHER_RAIN)) countTrainMove(i);
+            else train[TRAIN_MOVES]++;
+            noteTrainMoved(i);
+        }
+        logTrainTrace(i, move ? TRACE_MOVING : TRACE_WAITING);
+
+        int x = train[TRAIN_X];
+        int y = train[TRAIN_Y];
+        if (x == train[TRAIN_DEST_X] && y == train[TRAIN_DEST_Y]) {
+            train[TRAIN_STATE] = TRAIN_DELIVERED;
+            trainsDelivered++;
+            activeTrains--;
+            fusedArrivals[numFusedArrivals++] = i;
+            continue;
+        }
+
+        if (numHaltZones > 0 && isHaltTile(x, y)) haltTrain(i);
+        fusedStamp[x][y] = stamp;
+    }
+    return stamp;
+}
+
+// ----------------------------------------------------------------------------
+// SIGNAL LIGHTS
+// ----------------------------------------------------------------------------
+// Same colours as updateSignalLights(), from the occupied tiles around each
+// switch instead of a scan over all trains: red if a train is on a
+// neighbour, yellow if one is a tile away from a neighbour.
+// ----------------------------------------------------------------------------
+static void updateFusedSignals(int stamp) {
+    for (int sw = 0; sw < numSwitches; sw++) {
+        int x = switches[sw][SWITCH_X];
+        int y = switches[sw][SWITCH_Y];
+        if (!isInBounds(x, y)) continue;
+
+        bool hasConflict = false;
+        bool hasWarning = false;
+        for (int dir = 0; dir < 4; dir++) {
+            int nextX = x + dx[dir];
+            int nextY = y + dy[dir];
+            if (!isInBounds(nextX, nextY)) continue;
+
+            if (isOccupied(nextX, nextY, stamp)) hasConflict = true;
+            for (int around = 0; around < 4; around++) {
+                if (isOccupied(nextX + dx[around], nextY + dy[around], stamp)) hasWarning = true;
+            }
+        }
+
+        SignalColor signalColor = hasConflict ? SIGNAL_RED : (hasWarning ? SIGNAL_YELLOW : SIGNAL_GREEN);
+        logSignalState(sw, signalColor);
+    }
+}
+
+// ----------------------------------------------------------------------------
+// FUSED KERNEL
+// ----------------------------------------------------------------------------
+template <int Weather, SwitchModeMix Modes>
+static void runFusedKernel() {
+    // Phases 1-3
+    spawnRouteCount<Modes>();
+
+    // Phase 4: Queue switch flips
+    queueSwitchFlipsFor(Modes);
+
+    // Phases 5 and 7, emergency halt
+    resolveCollisions();
+    int occupiedStamp = moveArriveHalt<Weather>();
+
+    // Phase 6: Apply deferred switch flips
+    applyDeferredFlips();
+
+    // Deliveries are logged in train index order, after the flips
+    std::sort(fusedArrivals, fusedArrivals + numFusedArrivals);
+    for (int a = 0; a < numFusedArrivals; a++) {
+        logTrainTrace(fusedArrivals[a], TRACE_DELIVERED);
+    }
+    updateEmergencyHalt();
+
+    updateFusedSignals(occupiedStamp);
+}
+
+// ----------------------------------------------------------------------------
+// SELECT KERNEL
+// ----------------------------------------------------------------------------
+template <int Weather>
+static FusedKernel kernelForModes(SwitchModeMix modes) {
+    if (modes == SWITCHES_PER_DIR) return runFusedKernel<Weather, SWITCHES_PER_DIR>;
+    if (modes == SWITCHES_GLOBAL) return runFusedKernel<Weather, SWITCHES_GLOBAL>;
+    return runFusedKernel<Weather, SWITCHES_MIXED>;
+}
+
+static FusedKernel selectFusedKernel() {
+    if (!specialisedKernels) return runFusedKernel<ANY_WEATHER, SWITCHES_MIXED>;
+
+    SwitchModeMix modes = getSwitchModeMix();
+    if (weather == WEATHER_RAIN) return kernelForModes<WEATHER_RAIN>(modes);
+    if (weather == WEATHER_FOG) return kernelForModes<WEATHER_FOG>(modes);
+    return kernelForModes<WEATHER_NORMAL>(modes);
+}
+
+void resetFusedTick() {
+    fusedKernel = nullptr;
+}
+
+// ----------------------------------------------------------------------------
+// RUN FUSED PHASES
+// ----------------------------------------------------------------------------
+void runFusedPhases() {
+    if (fusedKernel == nullptr) fusedKernel = selectFusedKernel();
+    fusedKernel();
+}
@@ -0,0 +1,32 @@
+#ifndef FUSED_H
+#define FUSED_H
+
+// ============================================================================
+// FUSED.H - Fused single-threaded tick
+// ============================================================================
+// The phased engine walks the whole train array once per phase. The fused
+// tick does all per-train work in two passes:
+//   1. spawn + route + switch counters (train index order)
+//   2. collisions + movement + arrivals + emergency halt (move order)
+// Switch flips are still queued before and applied after movement, and every
+// log row is written in the phased engine's order, so the results are
+// identical.
+//
+// The tick is compiled once per weather and switch-mode mix, and the
+// instance for the loaded level is picked at its first tick, so the
+// per-train loops carry no weather or mode branches.
+// ============================================================================
+
+// ----------------------------------------------------------------------------
+// SETUP
+// ----------------------------------------------------------------------------
+// Pick the kernel again at the next tick (new level).
+void resetFusedTick();
+
+// ----------------------------------------------------------------------------
+// TICK
+// ----------------------------------------------------------------------------
+// Run phases 1-7, emergency halt and signals for one tick.
+void runFusedPhases();
+
+#endif
@@ -1,18 +1,91 @@
 #include "grid.h"
 #include "simulation_state.h"
+#include "fingerprint.h"
+#include "bitboard.h"
+#include "segments.h"
 #include <iostream>
 #include <cstdlib>
-
-#ifdef _WIN32
-    #include <windows.h>
-#else
-    #include <unistd.h>
-#endif
+#include <cstring>
+#include <vector>
+#include <algorithm>
 
 // ============================================================================
 // GRID.CPP - Grid utilities with smooth animation
 // ============================================================================
 
+// ----------------------------------------------------------------------------
+// CHUNKED TILE STORAGE
+// ----------------------------------------------------------------------------
+static int getCellIndex(int x, int y) {
+    return ((x & (GRID_CHUNK - 1)) << GRID_CHUNK_SHIFT) | (y & (GRID_CHUNK - 1));
+}
+
+char getTile(int x, int y) {
+    return gridChunks[gridChunkSlot[x >> GRID_CHUNK_SHIFT][y >> GRID_CHUNK_SHIFT]][getCellIndex(x, y)];
+}
+
+bool isSafetyTile(int x, int y) {
+    return safetyChunks[gridChunkSlot[x >> GRID_CHUNK_SHIFT][y >> GRID_CHUNK_SHIFT]][getCellIndex(x, y)];
+}
+
+bool isHaltTile(int x, int y) {
+    return haltChunks[gridChunkSlot[x >> GRID_CHUNK_SHIFT][y >> GRID_CHUNK_SHIFT]][getCellIndex(x, y)] > 0;
+}
+
+int addHaltCover(int x, int y, int delta) {
+    return haltChunks[gridChunkSlot[x >> GRID_CHUNK_SHIFT][y >> GRID_CHUNK_SHIFT]][getCellIndex(x, y)] += delta;
+}
+
+void setTile(int x, int y, char tile) {
+    int& slot = gridChunkSlot[x >> GRID_CHUNK_SHIFT][y >> GRID_CHUNK_SHIFT];
+    if (slot == 0) {
+        if (tile == ' ') return;
+        slot = numGridChunks++;
+        memset(gridChunks[slot], ' ', sizeof(gridChunks[slot]));
+        memset(safetyChunks[slot], false, sizeof(safetyChunks[slot]));
+        memset(haltChunks[slot], 0, sizeof(haltChunks[slot]));
+    }
+    gridChunks[slot][getCellIndex(x, y)] = tile;
+}
+
+// Interleave the bits of the chunk row and column (row bits odd).
+static int getMortonCode(int chunkRow, int chunkCol) {
+    int code = 0;
+    for (int bit = 0; bit < 15; bit++) {
+        code |= ((chunkCol >> bit) & 1) << (2 * bit);
+        code |= ((chunkRow >> bit) & 1) << (2 * bit + 1);
+    }
+    return code;
+}
+
+// Slots are handed out in load order (row by row); copy them out and back
+// in curve order. Only runs at load time, before any safety tile or halt
+// zone is placed, so only the tiles are moved.
+void sortGridChunks() {
+    std::vector<std::pair<int, int> > order;    // (Morton code, chunk row * GRID_CHUNK_COLS + col)
+    for (int r = 0; r < GRID_CHUNK_ROWS; r++) {
+        for (int c = 0; c < GRID_CHUNK_COLS; c++) {
+            if (gridChunkSlot[r][c] != 0) order.push_back(std::make_pair(getMortonCode(r, c), r * GRID_CHUNK_COLS + c));
+        }
+    }
+    std::sort(order.begin(), order.end());
+
+    std::vector<char> tiles(order.size() * GRID_CHUNK_CELLS);
+    for (size_t i = 0; i < order.size(); i++) {
+        int slot = gridChunkSlot[order[i].second / GRID_CHUNK_COLS][order[i].second % GRID_CHUNK_COLS];
+        memcpy(&tiles[i * GRID_CHUNK_CELLS], gridChunks[slot], GRID_CHUNK_CELLS);
+    }
+    for (size_t i = 0; i < order.size(); i++) {
+        int slot = (int)i + 1;
+        gridChunkSlot[order[i].second / GRID_CHUNK_COLS][order[i].second % GRID_CHUNK_COLS] = slot;
+        memcpy(gridChunks[slot], &tiles[i * GRID_CHUNK_CELLS], GRID_CHUNK_CELLS);
+    }
+}
+
+// ----------------------------------------------------------------------------
+// TILE QUERIES
+// ----------------------------------------------------------------------------
+
 bool isInBounds(int x, int y) {
     return x >= 0 && x < gridRows && y >= 0 && y < gridCols;
 }
@@ -20,7 +93,7 @@ bool isInBounds(int x, int y) {
 bool isTrackTile(int x, int y) {
     if (!isInBounds(x, y)) return false;
     
-    char tile = grid[x][y];
+    char tile = getTile(x, y);
     return (tile == '-' || tile == '|' || tile == '=' || tile == '\\' || tile == '/' || 
             tile == '+' || tile == 'S' || tile == 'D' ||
             (tile >= 'A' && tile <= 'Z'));
@@ -29,7 +102,7 @@ bool isTrackTile(int x, int y) {
 bool isSwitchTile(int x, int y) {
     if (!isInBounds(x, y)) return false;
     
-    char tile = grid[x][y];
+    char tile = getTile(x, y);
     return (tile >= 'A' && tile <= 'Z' && tile != 'S' && tile != 'D');
 }
 
@@ -42,18 +115,22 @@ int getSwitchIndex(char switchChar) {
 
 bool isSpawnPoint(int x, int y) {
     if (!isInBounds(x, y)) return false;
-    return grid[x][y] == 'S';
+    return getTile(x, y) == 'S';
 }
 
 bool isDestinationPoint(int x, int y) {
     if (!isInBounds(x, y)) return false;
-    return grid[x][y] == 'D';
+    return getTile(x, y) == 'D';
 }
 
 bool toggleSafetyTile(int x, int y) {
     if (!isInBounds(x, y)) return false;
     if (!isTrackTile(x, y)) return false;
-    safetyTiles[x][y] = !safetyTiles[x][y];
+    bool& safety = safetyChunks[gridChunkSlot[x >> GRID_CHUNK_SHIFT][y >> GRID_CHUNK_SHIFT]][getCellIndex(x, y)];
+    safety = !safety;
+    toggleFingerprintTile(x, y);
+    resetBitboards();
+    rebuildSegments();
     return true;
 }
 
@@ -72,7 +149,7 @@ void printGrid() {
     // Print the railway map with trains
     for (int row = 0; row < gridRows; row++) {
         for (int col = 0; col < gridCols; col++) {
-            char tile = grid[row][col];
+            char tile = getTile(row, col);
             
             // Check if there's a train here
             bool hasActiveTrain = false;
@@ -111,11 +188,4 @@ void printGrid() {
     }
     if (!hasActive) std::cout << "None";
     std::cout << std::endl;
-    
-    // Small delay for animation
-#ifdef _WIN32
-    Sleep(800);
-#else
-    usleep(800000);
-#endif
 }
@@ -7,6 +7,25 @@
 // Functions for working with the 2D grid map.
 // ============================================================================
 
+// Tile at (x, y); ' ' where there is nothing. Needs 0 <= x < MAX_ROWS and
+// 0 <= y < MAX_COLS (not necessarily inside the loaded grid).
+char getTile(int x, int y);
+
+// Write a tile (level loading). The first non-empty tile of a chunk gives
+// the chunk a slot.
+void setTile(int x, int y, char tile);
+
+// Renumber the chunk slots in Morton order (after a level is loaded).
+void sortGridChunks();
+
+// Check if a safety tile is placed at a position (same range as getTile)
+bool isSafetyTile(int x, int y);
+
+// Check if a track tile is inside an emergency halt zone (halt.h), and
+// change its zone count (track tiles only). Same range as getTile.
+bool isHaltTile(int x, int y);
+int addHaltCover(int x, int y, int delta);
+
 // Check if a position is within grid bounds
 bool isInBounds(int x, int y);
 
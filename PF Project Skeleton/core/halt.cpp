@@ -0,0 +1,198 @@
+#include "halt.h"
+#include "grid.h"
+#include "metrics.h"
+#include "segments.h"
+#include <cstdlib>
+#include <algorithm>
+
+// ============================================================================
+// HALT.CPP - Emergency halt zones
+// ============================================================================
+
+// Expiry buckets by last tick. A zone lasting longer than the wheel shares
+// its bucket with zones of earlier rounds, so a bucket's zones are checked
+// against the tick before they are ended.
+const int HALT_WHEEL_SIZE = 256;
+
+int haltZones[MAX_HALT_ZONES][HALT_FIELDS];
+int haltZoneList[MAX_HALT_ZONES];
+int numHaltZones = 0;
+
+int haltZonesStarted = 0;
+int haltCoveredTiles = 0;
+int haltedTrainTicks = 0;
+int haltZoneRange = 3;
+
+// Position of each active zone in haltZoneList, and the free zone slots
+static int haltZonePos[MAX_HALT_ZONES];
+static int haltFreeList[MAX_HALT_ZONES];
+static int numFreeHaltZones = 0;
+
+// Trains found on a halt tile by the arrivals pass, halted in the halt phase
+static int haltCandidates[MAX_TRAINS];
+static int numHaltCandidates = 0;
+
+// Timer wheel (doubly linked per bucket)
+static int haltWheelHead[HALT_WHEEL_SIZE];
+static int haltNext[MAX_HALT_ZONES], haltPrev[MAX_HALT_ZONES];
+
+// Scheduled zones (HALTS section), by start tick, and the next one to start
+// Scheduled data: 0=start tick, 1=x, 2=y, 3=range, 4=ticks
+const int SCHED_TICK = 0;
+const int SCHED_X = 1;
+const int SCHED_Y = 2;
+const int SCHED_RANGE = 3;
+const int SCHED_TICKS = 4;
+const int SCHED_FIELDS = 5;
+
+static int scheduledHalts[MAX_SCHEDULED_HALTS][SCHED_FIELDS];
+static int numScheduledHalts = 0;
+static int scheduledHaltCursor = 0;
+
+// ----------------------------------------------------------------------------
+// RESET
+// ----------------------------------------------------------------------------
+// The per-tile counts live in grid chunks, which are cleared when a new
+// level hands them out.
+// ----------------------------------------------------------------------------
+void resetHaltZones() {
+    numHaltZones = 0;
+    numFreeHaltZones = 0;
+    for (int z = MAX_HALT_ZONES - 1; z >= 0; z--) haltFreeList[numFreeHaltZones++] = z;
+    for (int b = 0; b < HALT_WHEEL_SIZE; b++) haltWheelHead[b] = -1;
+
+    haltZonesStarted = 0;
+    haltCoveredTiles = 0;
+    haltedTrainTicks = 0;
+    numScheduledHalts = 0;
+    scheduledHaltCursor = 0;
+    numHaltCandidates = 0;
+}
+
+// Insertion keeps the schedule sorted by tick (file order within a tick).
+void scheduleHaltZone(int tick, int x, int y, int range, int ticks) {
+    if (numScheduledHalts >= MAX_SCHEDULED_HALTS) return;
+    int at = numScheduledHalts++;
+    while (at > 0 && scheduledHalts[at - 1][SCHED_TICK] > tick) {
+        for (int f = 0; f < SCHED_FIELDS; f++) scheduledHalts[at][f] = scheduledHalts[at - 1][f];
+        at--;
+    }
+    scheduledHalts[at][SCHED_TICK] = tick;
+    scheduledHalts[at][SCHED_X] = x;
+    scheduledHalts[at][SCHED_Y] = y;
+    scheduledHalts[at][SCHED_RANGE] = range;
+    scheduledHalts[at][SCHED_TICKS] = ticks;
+}
+
+// ----------------------------------------------------------------------------
+// COVERAGE
+// ----------------------------------------------------------------------------
+// Add delta to every track tile of the zone's diamond. Sleeping segment
+// trains on a newly covered tile's segment are woken, so that they are
+// checked each tick while the zone lasts.
+// ----------------------------------------------------------------------------
+static void coverZone(int zone, int delta) {
+    int cx = haltZones[zone][HALT_X];
+    int cy = haltZones[zone][HALT_Y];
+    int range = haltZones[zone][HALT_RANGE];
+
+    for (int x = std::max(0, cx - range); x <= std::min(gridRows - 1, cx + range); x++) {
+        int reach = range - abs(x - cx);
+        for (int y = std::max(0, cy - reach); y <= std::min(gridCols - 1, cy + reach); y++) {
+            if (!isTrackTile(x, y)) continue;
+            int count = addHaltCover(x, y, delta);
+            if (delta > 0 && count == 1) {
+                haltCoveredTiles++;
+                wakeSegmentTrainsAt(x, y);
+            } else if (delta < 0 && count == 0) {
+                haltCoveredTiles--;
+            }
+        }
+    }
+}
+
+// ----------------------------------------------------------------------------
+// START / STOP
+// ----------------------------------------------------------------------------
+int startHaltZone(int x, int y, int range, int ticks) {
+    if (ticks < 1 || numFreeHaltZones == 0) return -1;
+
+    int zone = haltFreeList[--numFreeHaltZones];
+    haltZones[zone][HALT_X] = x;
+    haltZones[zone][HALT_Y] = y;
+    haltZones[zone][HALT_RANGE] = std::max(0, range);
+    haltZones[zone][HALT_LAST_TICK] = currentTick + ticks - 1;
+
+    haltZonePos[zone] = numHaltZones;
+    haltZoneList[numHaltZones++] = zone;
+
+    int bucket = haltZones[zone][HALT_LAST_TICK] % HALT_WHEEL_SIZE;
+    haltPrev[zone] = -1;
+    haltNext[zone] = haltWheelHead[bucket];
+    if (haltWheelHead[bucket] >= 0) haltPrev[haltWheelHead[bucket]] = zone;
+    haltWheelHead[bucket] = zone;
+
+    coverZone(zone, 1);
+    haltZonesStarted++;
+    return zone;
+}
+
+void stopHaltZone(int zone) {
+    coverZone(zone, -1);
+
+    int last = haltZoneList[--numHaltZones];
+    haltZoneList[haltZonePos[zone]] = last;
+    haltZonePos[last] = haltZonePos[zone];
+
+    int bucket = haltZones[zone][HALT_LAST_TICK] % HALT_WHEEL_SIZE;
+    if (haltPrev[zone] >= 0) {
+        haltNext[haltPrev[zone]] = haltNext[zone];
+    } else {
+        haltWheelHead[bucket] = haltNext[zone];
+    }
+    if (haltNext[zone] >= 0) haltPrev[haltNext[zone]] = haltPrev[zone];
+
+    haltFreeList[numFreeHaltZones++] = zone;
+}
+
+void startDueHaltZones() {
+    while (scheduledHaltCursor < numScheduledHalts &&
+           scheduledHalts[scheduledHaltCursor][SCHED_TICK] <= currentTick) {
+        const int* due = scheduledHalts[scheduledHaltCursor++];
+        int ticks = due[SCHED_TICKS] - (currentTick - due[SCHED_TICK]);
+        startHaltZone(due[SCHED_X], due[SCHED_Y], due[SCHED_RANGE], ticks);
+    }
+}
+
+// ----------------------------------------------------------------------------
+// APPLY EMERGENCY HALT
+// ----------------------------------------------------------------------------
+void haltTrain(int trainIndex) {
+    trains[trainIndex][TRAIN_WAIT_TICKS] += HALT_WAIT_TICKS;
+    totalWaitTicks += HALT_WAIT_TICKS;
+    haltedTrainTicks++;
+    noteTrainWaiting(trainIndex);
+}
+
+void noteHaltCandidate(int trainIndex) {
+    haltCandidates[numHaltCandidates++] = trainIndex;
+}
+
+// Zones only change between the arrivals pass and here through the GUI,
+// which runs between ticks, so the noted trains are exactly the ones to halt.
+void applyEmergencyHalt() {
+    for (int c = 0; c < numHaltCandidates; c++) haltTrain(haltCandidates[c]);
+    numHaltCandidates = 0;
+}
+
+// ----------------------------------------------------------------------------
+// UPDATE EMERGENCY HALT
+// ----------------------------------------------------------------------------
+void updateEmergencyHalt() {
+    int zone = haltWheelHead[currentTick % HALT_WHEEL_SIZE];
+    while (zone >= 0) {
+        int next = haltNext[zone];
+        if (haltZones[zone][HALT_LAST_TICK] == currentTick) stopHaltZone(zone);
+        zone = next;
+    }
+}
@@ -0,0 +1,93 @@
+#ifndef HALT_H
+#define HALT_H
+
+#include "simulation_state.h"
+
+// ============================================================================
+// HALT.H - Emergency halt zones
+// ============================================================================
+// Any number of halt zones can be active at once. A zone covers the track
+// tiles within RANGE (Manhattan distance) of its centre for a number of
+// ticks; every active train that ends a tick on a covered tile is halted
+// (HALT_WAIT_TICKS wait ticks). Overlapping zones halt a train once.
+//
+// The zones are indexed per tile: a grid layer (haltChunks, see
+// simulation_state.h) counts the zones covering each track tile, updated
+// when a zone starts or ends, so checking a train is one lookup
+// (isHaltTile() in grid.h). The fused, bitboard and segment ticks check
+// each train in the move pass they already run; the phased and partitioned
+// engines check it in their arrivals pass and note the trains to halt, so
+// their halt phase only touches trains inside a zone. Expiry is a hashed
+// timer wheel by last tick, so each tick only the zones in its bucket are
+// looked at.
+//
+// Zones are started from the GUI (E key) or by the level's HALTS section
+// ("tick x y range ticks" per line, started at the beginning of that tick).
+// ============================================================================
+
+// ----------------------------------------------------------------------------
+// CONSTANTS
+// ----------------------------------------------------------------------------
+const int MAX_HALT_ZONES = 1024;
+const int MAX_SCHEDULED_HALTS = 1024;
+const int HALT_WAIT_TICKS = 3;              // Wait ticks per halted train per tick
+
+// Zone data: 0=centre x, 1=centre y, 2=range, 3=last tick it applies
+const int HALT_X = 0;
+const int HALT_Y = 1;
+const int HALT_RANGE = 2;
+const int HALT_LAST_TICK = 3;
+const int HALT_FIELDS = 4;
+
+// ----------------------------------------------------------------------------
+// STATE
+// ----------------------------------------------------------------------------
+// Active zones are haltZoneList[0..numHaltZones); the others are free.
+extern int haltZones[MAX_HALT_ZONES][HALT_FIELDS];
+extern int haltZoneList[MAX_HALT_ZONES];
+extern int numHaltZones;
+
+extern int haltZonesStarted;        // Zones started this run
+extern int haltCoveredTiles;        // Track tiles inside at least one zone
+extern int haltedTrainTicks;        // Train-ticks halted this run
+extern int haltZoneRange;           // Range of zones started from the GUI
+
+// ----------------------------------------------------------------------------
+// SETUP
+// ----------------------------------------------------------------------------
+// Drop every zone and the scheduled ones (new level).
+void resetHaltZones();
+
+// Add a zone to the level's schedule (HALTS section, level loading).
+void scheduleHaltZone(int tick, int x, int y, int range, int ticks);
+
+// ----------------------------------------------------------------------------
+// ZONES
+// ----------------------------------------------------------------------------
+// Start a zone now (between ticks) for the next `ticks` ticks. Returns the
+// zone, or -1 if ticks < 1 or MAX_HALT_ZONES are active.
+int startHaltZone(int x, int y, int range, int ticks);
+
+// End a zone early.
+void stopHaltZone(int zone);
+
+// Start the scheduled zones due this tick (start of the tick).
+void startDueHaltZones();
+
+// ----------------------------------------------------------------------------
+// TICK
+// ----------------------------------------------------------------------------
+// Halt a train that ended the tick on a halt tile.
+void haltTrain(int trainIndex);
+
+// Note an active train that ended the arrivals pass on a halt tile (phased
+// and partitioned engines; serial).
+void noteHaltCandidate(int trainIndex);
+
+// Halt the noted trains (phased and partitioned engines).
+void applyEmergencyHalt();
+
+// End the zones whose last tick this was.
+void updateEmergencyHalt();
+
+#endif
@@ -0,0 +1,151 @@
+#include "heatmap.h"
+#include "grid.h"
+#include <fstream>
+#include <cstring>
+#include <cmath>
+#include <algorithm>
+#include <string>
+
+// ============================================================================
+// HEATMAP.CPP - Per-tile and per-switch congestion counters
+// ============================================================================
+
+int tileHeat[HEAT_FIELDS][MAX_ROWS][MAX_COLS];
+int switchHeatFlips[MAX_SWITCHES];
+
+// Rows that may hold counts (only these are cleared on reset). Every count
+// is on the grid, so raising this to gridRows once per tick covers them.
+static int heatRows = 0;
+
+// Target size of the longer side of heatmap.ppm in pixels.
+const int HEATMAP_IMAGE_SIZE = 512;
+
+// ----------------------------------------------------------------------------
+// RESET
+// ----------------------------------------------------------------------------
+void resetHeatmap() {
+    for (int f = 0; f < HEAT_FIELDS; f++) {
+        memset(tileHeat[f], 0, heatRows * sizeof(tileHeat[f][0]));
+    }
+    heatRows = 0;
+    memset(switchHeatFlips, 0, sizeof(switchHeatFlips));
+}
+
+// ----------------------------------------------------------------------------
+// RECORDING
+// ----------------------------------------------------------------------------
+void noteHeatRows(int rows) {
+    if (rows > heatRows) heatRows = rows;
+}
+
+// The train is already at the last of the tiles; walk back along the run.
+void recordCoastHeat(int trainIndex, int moves) {
+    int x = trains[trainIndex][TRAIN_X];
+    int y = trains[trainIndex][TRAIN_Y];
+    int dir = trains[trainIndex][TRAIN_DIRECTION];
+
+    for (int m = 0; m < moves; m++) {
+        tileHeat[HEAT_OCCUPIED][x][y]++;
+        x -= dx[dir];
+        y -= dy[dir];
+    }
+}
+
+void recordCrashHeat(int trainIndex) {
+    int x = trains[trainIndex][TRAIN_X];
+    int y = trains[trainIndex][TRAIN_Y];
+    if (!isInBounds(x, y)) return;
+    tileHeat[HEAT_CRASHES][x][y]++;
+}
+
+void noteTileConflict(int x, int y) {
+    tileHeat[HEAT_CONFLICTS][x][y]++;
+}
+
+void noteSwitchFlipHeat(int switchIndex) {
+    switchHeatFlips[switchIndex]++;
+}
+
+// ----------------------------------------------------------------------------
+// QUERY
+// ----------------------------------------------------------------------------
+int getTileCongestion(int x, int y) {
+    return tileHeat[HEAT_WAITED][x][y] + tileHeat[HEAT_CONFLICTS][x][y] + tileHeat[HEAT_CRASHES][x][y];
+}
+
+void getHeatColor(int heat, int maxHeat, int& r, int& g, int& b) {
+    float t = std::sqrt(std::min(1.0f, (float)heat / maxHeat));
+    r = (int)(96 + 159 * std::min(1.0f, t * 2.0f));
+    g = (int)(255 * std::max(0.0f, std::min(1.0f, t * 2.0f - 0.5f)));
+    b = (int)(255 * std::max(0.0f, t * 2.0f - 1.5f) * 2.0f);
+}
+
+// ----------------------------------------------------------------------------
+// WRITE HEATMAP
+// ----------------------------------------------------------------------------
+// heatmap.csv: one row per track tile in grid order.
+// switch_heat.csv: one row per switch, its tile's counters plus flips.
+// heatmap.ppm: one square per tile, black off the track, dark grey on quiet
+// track, then getHeatColor() against the busiest tile.
+// ----------------------------------------------------------------------------
+static void writeHeatImage() {
+    int maxHeat = 0;
+    for (int x = 0; x < gridRows; x++) {
+        for (int y = 0; y < gridCols; y++) maxHeat = std::max(maxHeat, getTileCongestion(x, y));
+    }
+
+    int scale = std::max(1, HEATMAP_IMAGE_SIZE / std::max(1, std::max(gridRows, gridCols)));
+    int width = gridCols * scale, height = gridRows * scale;
+
+    std::ofstream image("out/heatmap.ppm", std::ios::binary);
+    image << "P6\n" << width << " " << height << "\n255\n";
+
+    std::string row(width * 3, '\0');
+    for (int x = 0; x < gridRows; x++) {
+        for (int y = 0; y < gridCols; y++) {
+            int r = 0, g = 0, b = 0;
+            int heat = getTileCongestion(x, y);
+            if (heat > 0) {
+                getHeatColor(heat, maxHeat, r, g, b);
+            } else if (isTrackTile(x, y)) {
+                r = g = b = 48;
+            }
+            for (int p = 0; p < scale; p++) {
+                int at = (y * scale + p) * 3;
+                row[at] = (char)r;
+                row[at + 1] = (char)g;
+                row[at + 2] = (char)b;
+            }
+        }
+        for (int p = 0; p < scale; p++) image.write(row.data(), row.size());
+    }
+}
+
+void writeHeatmap() {
+    std::ofstream tiles("out/heatmap.csv");
+    tiles << "X,Y,Tile,Occupied,Entered,WaitTicks,Conflicts,Crashes\n";
+    for (int x = 0; x < gridRows; x++) {
+        for (int y = 0; y < gridCols; y++) {
+            if (!isTrackTile(x, y) && getTileCongestion(x, y) == 0) continue;
+            int occupied = tileHeat[HEAT_OCCUPIED][x][y];
+            tiles << x << "," << y << "," << getTile(x, y) << "," << occupied << ","
+                  << occupied - tileHeat[HEAT_STAYED][x][y] << "," << tileHeat[HEAT_WAITED][x][y] << ","
+                  << tileHeat[HEAT_CONFLICTS][x][y] << "," << tileHeat[HEAT_CRASHES][x][y] << "\n";
+        }
+    }
+    tiles.close();
+
+    std::ofstream sw("out/switch_heat.csv");
+    sw << "Switch,X,Y,Entered,Occupied,WaitTicks,Conflicts,Flips\n";
+    for (int i = 0; i < numSwitches; i++) {
+        int x = switches[i][SWITCH_X], y = switches[i][SWITCH_Y];
+        if (!isSwitchTile(x, y) || getSwitchIndex(getTile(x, y)) != i) continue;
+        int occupied = tileHeat[HEAT_OCCUPIED][x][y];
+        sw << (char)switches[i][SWITCH_LETTER] << "," << x << "," << y << ","
+           << occupied - tileHeat[HEAT_STAYED][x][y] << "," << occupied << "," << tileHeat[HEAT_WAITED][x][y] << ","
+           << tileHeat[HEAT_CONFLICTS][x][y] << "," << switchHeatFlips[i] << "\n";
+    }
+    sw.close();
+
+    writeHeatImage();
+}
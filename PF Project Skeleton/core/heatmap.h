@@ -0,0 +1,71 @@
+#ifndef HEATMAP_H
+#define HEATMAP_H
+
+#include "simulation_state.h"
+
+// ============================================================================
+// HEATMAP.H - Per-tile and per-switch congestion counters
+// ============================================================================
+// Counters are bumped from paths that already visit the train or tile: the
+// end-of-tick metrics pass (occupancy, entries, waits, crashes), the
+// collision resolution of each engine (conflicts), segment catch-up
+// (tiles a coasting train passed) and the flip phase. Nothing is scanned
+// per tick. At the end of the run they are written as out/heatmap.csv,
+// out/switch_heat.csv and the image out/heatmap.ppm.
+// ============================================================================
+
+// ----------------------------------------------------------------------------
+// TILE COUNTERS
+// ----------------------------------------------------------------------------
+// Planes: 0=ticks a train ended on the tile, 1=of those, ticks it had not
+//         moved onto it (spawned or held), 2=ticks a train waited on it,
+//         3=contested moves into it, 4=trains that crashed on it
+// One plane per field, so the per-train occupancy count touches 4 bytes
+// per tile. Entries onto a tile are OCCUPIED - STAYED.
+const int HEAT_OCCUPIED = 0;
+const int HEAT_STAYED = 1;
+const int HEAT_WAITED = 2;
+const int HEAT_CONFLICTS = 3;
+const int HEAT_CRASHES = 4;
+const int HEAT_FIELDS = 5;
+
+extern int tileHeat[HEAT_FIELDS][MAX_ROWS][MAX_COLS];
+extern int switchHeatFlips[MAX_SWITCHES];
+
+// ----------------------------------------------------------------------------
+// RECORDING
+// ----------------------------------------------------------------------------
+// Clear the counters of the previous run.
+void resetHeatmap();
+
+// Rows the counters may be written to from now on (end of tick, before
+// the per-train counts, which recordTickMetrics() adds to the planes
+// directly).
+void noteHeatRows(int rows);
+
+// A coasting train caught up by moves tiles along its direction.
+void recordCoastHeat(int trainIndex, int moves);
+
+// A train crashed at its trains[] position.
+void recordCrashHeat(int trainIndex);
+
+// Two trains planned a move into (x, y) in the same tick.
+void noteTileConflict(int x, int y);
+
+// A switch flipped.
+void noteSwitchFlipHeat(int switchIndex);
+
+// ----------------------------------------------------------------------------
+// QUERY / REPORTS
+// ----------------------------------------------------------------------------
+// Congestion score of a tile: wait ticks + conflicts + crashes.
+int getTileCongestion(int x, int y);
+
+// Colour for a congestion score: red -> yellow -> white on a square-root
+// scale up to maxHeat (> 0).
+void getHeatColor(int heat, int maxHeat, int& r, int& g, int& b);
+
+// Write heatmap.csv, switch_heat.csv and heatmap.ppm to out/.
+void writeHeatmap();
+
+#endif
@@ -1,6 +1,11 @@
 #include "io.h"
 #include "simulation_state.h"
 #include "grid.h"
+#include "metrics.h"
+#include "heatmap.h"
+#include "rng.h"
+#include "halt.h"
+#include "policy.h"
 #include <fstream>
 #include <iostream>
 #include <sstream>
@@ -13,6 +18,38 @@
 // IO.CPP - Level I/O and logging
 // ============================================================================
 
+// Log files stay open for the whole run, so logging a row costs no
+// open/close and no allocation.
+static std::ofstream traceFile;
+static std::ofstream switchesFile;
+static std::ofstream signalsFile;
+
+// Output names for the engine's enum codes.
+static const char* traceStateNames[] = {"SPAWNED", "MOVING", "CRASHED", "DELIVERED", "WAIT"};
+static const char* signalColorNames[] = {"GREEN", "YELLOW", "RED"};
+
+// Last logged train direction / waiting flag and signal colour, for
+// LOG_CHANGES (indexed by train slot and switch index).
+static int traceDirection[MAX_TRAINS];
+static bool traceWaiting[MAX_TRAINS];
+static int lastSignal[MAX_SWITCHES];
+static bool logsFinished = false;
+
+// Level file section headers, in the order a level usually lists them.
+const char* levelSectionHeaders[NUM_LEVEL_SECTIONS] = {
+    "NAME:", "ROWS:", "COLS:", "SEED:", "JITTER:", "WEATHER:", "POLICY:", "MAP:", "SWITCHES:", "TRAINS:", "HALTS:"
+};
+
+// ----------------------------------------------------------------------------
+// IS LEVEL SECTION HEADER
+// ----------------------------------------------------------------------------
+bool isLevelSectionHeader(const std::string& line) {
+    for (int h = 0; h < NUM_LEVEL_SECTIONS; h++) {
+        if (line.find(levelSectionHeaders[h]) == 0) return true;
+    }
+    return false;
+}
+
 // ----------------------------------------------------------------------------
 // LOAD LEVEL FILE
 // ----------------------------------------------------------------------------
@@ -28,34 +65,15 @@ bool loadLevelFile(const std::string& filename) {
     std::string line;
     std::string section = "";
     int mapRowIndex = 0;
+    int droppedPoints = 0;   // S/D tiles past MAX_SPAWN_POINTS/MAX_DEST_POINTS
     
     while (std::getline(file, line)) {
         if (line.empty()) continue;
         
-        if (line.find("NAME:") == 0) {
-            section = "NAME";
-            continue;
-        } else if (line.find("ROWS:") == 0) {
-            section = "ROWS";
-            continue;
-        } else if (line.find("COLS:") == 0) {
-            section = "COLS";
-            continue;
-        } else if (line.find("SEED:") == 0) {
-            section = "SEED";
-            continue;
-        } else if (line.find("WEATHER:") == 0) {
-            section = "WEATHER";
-            continue;
-        } else if (line.find("MAP:") == 0) {
-            section = "MAP";
-            mapRowIndex = 0;
-            continue;
-        } else if (line.find("SWITCHES:") == 0) {
-            section = "SWITCHES";
-            continue;
-        } else if (line.find("TRAINS:") == 0) {
-            section = "TRAINS";
+        // A header starts a section named without its colon
+        if (isLevelSectionHeader(line)) {
+            section = line.substr(0, line.find(':'));
+            if (section == "MAP") mapRowIndex = 0;
             continue;
         }
         
@@ -63,27 +81,42 @@ bool loadLevelFile(const std::string& filename) {
         if (section == "NAME") {
             levelName = line;
         } else if (section == "ROWS") {
-            gridRows = std::stoi(line);
+            gridRows = std::min(std::stoi(line), MAX_ROWS);
         } else if (section == "COLS") {
-            gridCols = std::stoi(line);
+            gridCols = std::min(std::stoi(line), MAX_COLS);
         } else if (section == "SEED") {
             seed = std::stoi(line);
+        } else if (section == "JITTER") {
+            spawnJitter = std::max(0, std::stoi(line));
         } else if (section == "WEATHER") {
             if (line == "NORMAL") weather = WEATHER_NORMAL;
             else if (line == "RAIN") weather = WEATHER_RAIN;
             else if (line == "FOG") weather = WEATHER_FOG;
+        } else if (section == "POLICY") {
+            if (!parseSwitchPolicy(line, switchPolicy)) {
+                std::cerr << "Warning: Unknown switch policy " << line << ", keeping "
+                          << switchPolicyNames[switchPolicy] << std::endl;
+            }
         } else if (section == "MAP") {
             if (mapRowIndex < gridRows) {
                 for (int col = 0; col < std::min((int)line.length(), gridCols); col++) {
-                    grid[mapRowIndex][col] = line[col];
+                    setTile(mapRowIndex, col, line[col]);
                     
                     // Record spawn and destination points
-                    if (line[col] == 'S' && numSpawnPoints < 10) {
+                    if (line[col] == 'S') {
+                        if (numSpawnPoints == MAX_SPAWN_POINTS) {
+                            droppedPoints++;
+                            continue;
+                        }
                         spawnPoints[numSpawnPoints][SPAWN_X] = mapRowIndex;
                         spawnPoints[numSpawnPoints][SPAWN_Y] = col;
                         spawnPoints[numSpawnPoints][SPAWN_ACTIVE] = 1;
                         numSpawnPoints++;
-                    } else if (line[col] == 'D' && numDestinationPoints < 10) {
+                    } else if (line[col] == 'D') {
+                        if (numDestinationPoints == MAX_DEST_POINTS) {
+                            droppedPoints++;
+                            continue;
+                        }
                         destinationPoints[numDestinationPoints][DEST_X] = mapRowIndex;
                         destinationPoints[numDestinationPoints][DEST_Y] = col;
                         destinationPoints[numDestinationPoints][DEST_ACTIVE] = 1;
@@ -121,31 +154,74 @@ bool loadLevelFile(const std::string& filename) {
             
             numSwitches = std::max(numSwitches, switchIndex + 1);
         } else if (section == "TRAINS") {
-            std::istringstream iss(line);
-            int spawnTick, x, y, direction, colorIndex;
-            iss >> spawnTick >> x >> y >> direction >> colorIndex;
+            // A streaming schedule reads this section tick by tick instead
+            if (streamingSchedule || numTrains >= MAX_TRAINS) continue;
             
-            trains[numTrains][TRAIN_ID] = numTrains;
-            trains[numTrains][TRAIN_SPAWN_TICK] = spawnTick;
-            trains[numTrains][TRAIN_X] = x;
-            trains[numTrains][TRAIN_Y] = y;
-            trains[numTrains][TRAIN_DIRECTION] = direction;
-            trains[numTrains][TRAIN_COLOR_INDEX] = colorIndex;
-            trains[numTrains][TRAIN_STATE] = TRAIN_SCHEDULED;
-            trains[numTrains][TRAIN_WAIT_TICKS] = 0;
-            
-            // Set destination to first available destination point for now
-            if (numDestinationPoints > 0) {
-                int destIndex = colorIndex % numDestinationPoints;
-                trains[numTrains][TRAIN_DEST_X] = destinationPoints[destIndex][DEST_X];
-                trains[numTrains][TRAIN_DEST_Y] = destinationPoints[destIndex][DEST_Y];
+            if (parseTrainLine(line, numTrains, numTrains)) {
+                numTrains++;
+            } else {
+                std::cerr << "Warning: Skipping malformed train line: " << line << std::endl;
+            }
+        } else if (section == "HALTS") {
+            // Halt zone: start tick, centre x y, range, ticks
+            std::istringstream iss(line);
+            int tick, x, y, range, ticks;
+            if (iss >> tick >> x >> y >> range >> ticks) {
+                scheduleHaltZone(tick, x, y, range, ticks);
             }
-            
-            numTrains++;
         }
     }
     
     file.close();
+    sortGridChunks();
+    
+    if (droppedPoints > 0) {
+        std::cerr << "Warning: " << droppedPoints << " S/D tiles past the first " << MAX_SPAWN_POINTS << " spawn and "
+                  << MAX_DEST_POINTS << " destination points are not recorded" << std::endl;
+    }
+    
+    // Spread spawn ticks by 0..spawnJitter (same spread for the same SEED)
+    if (spawnJitter > 0) {
+        for (int i = 0; i < numTrains; i++) {
+            trains[i][TRAIN_SPAWN_TICK] += rngRange(RNG_STREAM_SPAWN, 0, trains[i][TRAIN_ID], spawnJitter + 1);
+        }
+    }
+    
+    return true;
+}
+
+// ----------------------------------------------------------------------------
+// PARSE TRAIN LINE
+// ----------------------------------------------------------------------------
+// Fill a train slot from "spawnTick x y direction colorIndex" (TRAINS
+// section or streaming schedule). Returns false, leaving the slot untouched,
+// for a malformed line: a field missing, a direction outside 0-3, a negative
+// colour or a position off the grid.
+// ----------------------------------------------------------------------------
+bool parseTrainLine(const std::string& line, int trainIndex, int trainID) {
+    std::istringstream iss(line);
+    int spawnTick, x, y, direction, colorIndex;
+    if (!(iss >> spawnTick >> x >> y >> direction >> colorIndex)) return false;
+    if (direction < 0 || direction > 3 || colorIndex < 0 || !isInBounds(x, y)) return false;
+    
+    trains[trainIndex][TRAIN_ID] = trainID;
+    trains[trainIndex][TRAIN_SPAWN_TICK] = spawnTick;
+    trains[trainIndex][TRAIN_X] = x;
+    trains[trainIndex][TRAIN_Y] = y;
+    trains[trainIndex][TRAIN_DIRECTION] = direction;
+    trains[trainIndex][TRAIN_COLOR_INDEX] = colorIndex;
+    trains[trainIndex][TRAIN_STATE] = TRAIN_SCHEDULED;
+    trains[trainIndex][TRAIN_WAIT_TICKS] = 0;
+    trains[trainIndex][TRAIN_MOVES] = 0;
+    trains[trainIndex][TRAIN_RAIN_HOLD] = 0;
+    
+    // Set destination to first available destination point for now
+    if (numDestinationPoints > 0) {
+        int destIndex = colorIndex % numDestinationPoints;
+        trains[trainIndex][TRAIN_DEST_X] = destinationPoints[destIndex][DEST_X];
+        trains[trainIndex][TRAIN_DEST_Y] = destinationPoints[destIndex][DEST_Y];
+    }
+    
     return true;
 }
 
@@ -157,28 +233,75 @@ bool loadLevelFile(const std::string& filename) {
 void initializeLogFiles() {
     system("mkdir -p out");
     
-    std::ofstream trace("out/trace.csv");
-    trace << "Tick,TrainID,X,Y,Direction,State\n";
-    trace.close();
+    if (traceFile.is_open()) traceFile.close();
+    if (switchesFile.is_open()) switchesFile.close();
+    if (signalsFile.is_open()) signalsFile.close();
+    
+    traceFile.open("out/trace.csv");
+    traceFile << "Tick,TrainID,X,Y,Direction,State\n";
     
-    std::ofstream switches_log("out/switches.csv");
-    switches_log << "Tick,Switch,Mode,State\n";
-    switches_log.close();
+    switchesFile.open("out/switches.csv");
+    switchesFile << "Tick,Switch,Mode,State\n";
+    
+    signalsFile.open("out/signals.csv");
+    signalsFile << "Tick,Switch,Signal\n";
+    
+    for (int i = 0; i < MAX_TRAINS; i++) {
+        traceDirection[i] = -1;
+        traceWaiting[i] = false;
+    }
+    for (int i = 0; i < MAX_SWITCHES; i++) lastSignal[i] = -1;
+    logsFinished = false;
+}
+
+// ----------------------------------------------------------------------------
+// FINISH LOG FILES
+// ----------------------------------------------------------------------------
+// Changes-only logs end with an END row on the last simulated tick, so the
+// expander knows how long unchanged trains and signals lasted.
+// ----------------------------------------------------------------------------
+void finishLogFiles() {
+    if (logLevel == LOG_CHANGES && !logsFinished) {
+        traceFile << currentTick - 1 << ",-1,-1,-1,-1,END\n";
+        signalsFile << currentTick - 1 << ",-,END\n";
+    }
+    logsFinished = true;
     
-    std::ofstream signals_log("out/signals.csv");
-    signals_log << "Tick,Switch,Signal\n";
-    signals_log.close();
+    traceFile.flush();
+    switchesFile.flush();
+    signalsFile.flush();
 }
 
 // ----------------------------------------------------------------------------
 // LOG TRAIN TRACE
 // ----------------------------------------------------------------------------
 // Append tick, train id, position, direction, state to trace.csv.
+// Changes-only mode skips a MOVING row when the direction is unchanged and the
+// train was not waiting, and writes one WAIT row when a train stops moving.
 // ----------------------------------------------------------------------------
-void logTrainTrace(int trainID, int x, int y, int direction, const std::string& state) {
-    std::ofstream trace("out/trace.csv", std::ios::app);
-    trace << currentTick << "," << trainID << "," << x << "," << y << "," << direction << "," << state << "\n";
-    trace.close();
+void logTrainTrace(int trainIndex, TraceState state) {
+    if (logLevel == LOG_OFF) return;
+    
+    int direction = trains[trainIndex][TRAIN_DIRECTION];
+    if (state == TRACE_MOVING || state == TRACE_WAITING) {
+        if (logLevel == LOG_EVENTS) return;
+        if (logLevel == LOG_FULL && state == TRACE_WAITING) return;
+        if (logLevel == LOG_CHANGES) {
+            bool waiting = (state == TRACE_WAITING);
+            bool changed = waiting ? !traceWaiting[trainIndex]
+                                   : (traceWaiting[trainIndex] || direction != traceDirection[trainIndex]);
+            traceWaiting[trainIndex] = waiting;
+            traceDirection[trainIndex] = direction;
+            if (!changed) return;
+        }
+    } else if (state == TRACE_SPAWNED) {
+        traceDirection[trainIndex] = direction;
+        traceWaiting[trainIndex] = false;
+    }
+    
+    traceFile << currentTick << "," << trains[trainIndex][TRAIN_ID] << "," << trains[trainIndex][TRAIN_X] << ","
+              << trains[trainIndex][TRAIN_Y] << "," << direction << ","
+              << traceStateNames[state] << "\n";
 }
 
 // ----------------------------------------------------------------------------
@@ -187,11 +310,11 @@ void logTrainTrace(int trainID, int x, int y, int direction, const std::string&
 // Append tick, switch id/mode/state to switches.csv.
 // ----------------------------------------------------------------------------
 void logSwitchState(int switchIndex) {
-    std::ofstream switches_log("out/switches.csv", std::ios::app);
-    switches_log << currentTick << "," << (char)switches[switchIndex][SWITCH_LETTER] << "," 
+    if (logLevel == LOG_OFF) return;
+    
+    switchesFile << currentTick << "," << (char)switches[switchIndex][SWITCH_LETTER] << "," 
                  << (switches[switchIndex][SWITCH_MODE] == PER_DIR ? "PER_DIR" : "GLOBAL") << ","
                  << switchStateNames[switchIndex][switches[switchIndex][SWITCH_CURRENT_STATE]] << "\n";
-    switches_log.close();
 }
 
 // ----------------------------------------------------------------------------
@@ -199,10 +322,12 @@ void logSwitchState(int switchIndex) {
 // ----------------------------------------------------------------------------
 // Append tick, switch id, signal color to signals.csv.
 // ----------------------------------------------------------------------------
-void logSignalState(int switchIndex, const std::string& color) {
-    std::ofstream signals_log("out/signals.csv", std::ios::app);
-    signals_log << currentTick << "," << (char)switches[switchIndex][SWITCH_LETTER] << "," << color << "\n";
-    signals_log.close();
+void logSignalState(int switchIndex, SignalColor color) {
+    if (logLevel < LOG_CHANGES) return;
+    if (logLevel == LOG_CHANGES && lastSignal[switchIndex] == color) return;
+    lastSignal[switchIndex] = color;
+    
+    signalsFile << currentTick << "," << (char)switches[switchIndex][SWITCH_LETTER] << "," << signalColorNames[color] << "\n";
 }
 
 // ----------------------------------------------------------------------------
@@ -216,16 +341,24 @@ void writeMetrics() {
     metrics << "=== SIMULATION METRICS ===\n";
     metrics << "Level: " << levelName << "\n";
     metrics << "Total Ticks: " << currentTick << "\n";
-    metrics << "Trains Delivered: " << trainsDelivered << "/" << numTrains << "\n";
+    // Slots are reused with a streaming schedule, so count spawned trains
+    int totalTrains = streamingSchedule ? getTrainTotal(TS_SPAWNED) : numTrains;
+    metrics << "Trains Delivered: " << trainsDelivered << "/" << totalTrains << "\n";
     metrics << "Trains Crashed: " << trainsCrashed << "\n";
     metrics << "Switch Flips: " << switchFlips << "\n";
     metrics << "Total Wait Ticks: " << totalWaitTicks << "\n";
     
-    double efficiency = (numTrains > 0) ? (double)trainsDelivered / numTrains * 100.0 : 0.0;
+    double efficiency = (totalTrains > 0) ? (double)trainsDelivered / totalTrains * 100.0 : 0.0;
     metrics << "Delivery Efficiency: " << efficiency << "%\n";
     
     double avgWait = (trainsDelivered > 0) ? (double)totalWaitTicks / trainsDelivered : 0.0;
     metrics << "Average Wait Time: " << avgWait << " ticks\n";
     
+    // Tail behaviour from the per-train table
+    writeTrainDistributions(metrics);
+    
     metrics.close();
+    
+    writeTrainTable();
+    if (heatmapEnabled) writeHeatmap();
 }
@@ -2,6 +2,7 @@
 #define IO_H
 
 #include <string>
+#include "simulation_state.h"
 
 // ============================================================================
 // IO.H - Level I/O and logging
@@ -13,20 +14,36 @@
 // Load a .lvl file.
 bool loadLevelFile(const std::string& filename);
 
+// Section headers loadLevelFile() knows ("NAME:" ... "HALTS:"), for tools
+// that rewrite level files.
+const int NUM_LEVEL_SECTIONS = 11;
+extern const char* levelSectionHeaders[NUM_LEVEL_SECTIONS];
+
+// True if the line starts one of the level sections.
+bool isLevelSectionHeader(const std::string& line);
+
+// Fill a train slot from a TRAINS line "spawnTick x y direction colorIndex".
+// Returns false, without touching the slot, if the line is malformed or the
+// train would start off the grid.
+bool parseTrainLine(const std::string& line, int trainIndex, int trainID);
+
 // ----------------------------------------------------------------------------
 // LOGGING
 // ----------------------------------------------------------------------------
 // Create/clear log files.
 void initializeLogFiles();
 
-// Append train movement to trace.csv.
-void logTrainTrace(int trainID, int x, int y, int direction, const std::string& state);
+// Append a train's row (ID, position, direction, state) to trace.csv.
+void logTrainTrace(int trainIndex, TraceState state);
 
 // Append switch state to switches.csv.
 void logSwitchState(int switchIndex);
 
 // Append signal state to signals.csv.
-void logSignalState(int switchIndex, const std::string& color);
+void logSignalState(int switchIndex, SignalColor color);
+
+// Write the END marker (changes-only logs) and flush buffered rows.
+void finishLogFiles();
 
 // Write final metrics to metrics.txt.
 void writeMetrics();
@@ -0,0 +1,385 @@
+#include "metrics.h"
+#include "simulation_state.h"
+#include "heatmap.h"
+#include "segments.h"
+#include <fstream>
+#include <ostream>
+#include <algorithm>
+
+// ============================================================================
+// METRICS.CPP - Live per-tick metrics stream and per-train statistics
+// ============================================================================
+
+// Ring buffer of recent rows.
+int metricsRing[METRICS_RING_SIZE][TS_FIELDS];
+int metricsRingHead = 0;     // Next slot to write
+int metricsRingCount = 0;    // Rows held (up to METRICS_RING_SIZE)
+int metricsPending = 0;      // Rows not yet written to disk
+
+// timeseries.csv stays open between flushes.
+static std::ofstream seriesFile;
+
+// Run totals, counted once per train (slots may be reused).
+int totalSpawned = 0, totalDelivered = 0, totalCrashed = 0;
+
+// Cumulative values at the end of the previous tick (for deltas).
+int lastSpawned = 0, lastDelivered = 0, lastCrashed = 0;
+int lastFlips = 0, lastWaitTicks = 0;
+
+// Waiting trains in the current tick.
+int waitMarkTick[MAX_TRAINS];
+int waitingThisTick = 0;
+
+// Last tick each train changed tile (for the heatmap's entries).
+int moveMarkTick[MAX_TRAINS];
+
+// Per-train statistics table.
+int trainStats[MAX_TRAINS][TSTAT_FIELDS];
+
+// trains.csv while rows are written as trains finish (streaming schedules).
+static std::ofstream trainTableFile;
+static bool trainTableStarted = false;
+
+// Trip/wait histograms of delivered trains (last bucket = overflow), with
+// exact sums and maxima per destination for averages past the last bucket.
+int tripHist[LATENCY_HIST_SIZE + 1];
+int waitHist[LATENCY_HIST_SIZE + 1];
+int destTripHist[MAX_DEST_POINTS][LATENCY_HIST_SIZE + 1];
+long long destTripSum[MAX_DEST_POINTS];
+long long destWaitSum[MAX_DEST_POINTS];
+int destTripMax[MAX_DEST_POINTS];
+int histCount = 0;
+int maxTrip = 0, maxWait = 0;
+
+// ----------------------------------------------------------------------------
+// INITIALIZE METRICS STREAM
+// ----------------------------------------------------------------------------
+// Clear the ring buffer and create timeseries.csv with its header.
+// ----------------------------------------------------------------------------
+void initializeMetricsStream() {
+    metricsRingHead = 0;
+    metricsRingCount = 0;
+    metricsPending = 0;
+    totalSpawned = totalDelivered = totalCrashed = 0;
+    lastSpawned = lastDelivered = lastCrashed = 0;
+    lastFlips = lastWaitTicks = 0;
+    waitingThisTick = 0;
+    for (int i = 0; i < MAX_TRAINS; i++) {
+        waitMarkTick[i] = -1;
+        moveMarkTick[i] = -1;
+        trainStats[i][TSTAT_SPAWN_TICK] = -1;
+        trainStats[i][TSTAT_END_TICK] = -1;
+        trainStats[i][TSTAT_MOVED] = 0;
+        trainStats[i][TSTAT_WAITED] = 0;
+    }
+    for (int b = 0; b <= LATENCY_HIST_SIZE; b++) {
+        tripHist[b] = 0;
+        waitHist[b] = 0;
+        for (int d = 0; d < MAX_DEST_POINTS; d++) destTripHist[d][b] = 0;
+    }
+    for (int d = 0; d < MAX_DEST_POINTS; d++) {
+        destTripSum[d] = 0;
+        destWaitSum[d] = 0;
+        destTripMax[d] = 0;
+    }
+    histCount = 0;
+    maxTrip = maxWait = 0;
+
+    if (trainTableFile.is_open()) trainTableFile.close();
+    trainTableStarted = false;
+    if (seriesFile.is_open()) seriesFile.close();
+    seriesFile.open("out/timeseries.csv");
+    seriesFile << "Tick,Active,Spawned,Delivered,Crashed,Waiting,Flips,WaitTicks\n";
+    seriesFile.flush();
+}
+
+// ----------------------------------------------------------------------------
+// FLUSH METRICS STREAM
+// ----------------------------------------------------------------------------
+// Append pending rows (oldest first) to timeseries.csv.
+// ----------------------------------------------------------------------------
+void flushMetricsStream() {
+    if (metricsPending == 0) return;
+    if (logLevel == LOG_OFF) {
+        metricsPending = 0;
+        return;
+    }
+
+    int slot = (metricsRingHead - metricsPending + METRICS_RING_SIZE) % METRICS_RING_SIZE;
+    for (int r = 0; r < metricsPending; r++) {
+        for (int f = 0; f < TS_FIELDS; f++) {
+            if (f > 0) seriesFile << ",";
+            seriesFile << metricsRing[slot][f];
+        }
+        seriesFile << "\n";
+        slot = (slot + 1) % METRICS_RING_SIZE;
+    }
+    seriesFile.flush();
+
+    metricsPending = 0;
+}
+
+// ----------------------------------------------------------------------------
+// NOTE TRAIN WAITING
+// ----------------------------------------------------------------------------
+// Count a train as waiting this tick (once, however many delays hit it).
+// ----------------------------------------------------------------------------
+void noteTrainWaiting(int trainIndex) {
+    if (trainIndex < 0 || trainIndex >= MAX_TRAINS) return;
+    if (waitMarkTick[trainIndex] != currentTick) {
+        waitMarkTick[trainIndex] = currentTick;
+        waitingThisTick++;
+        trainStats[trainIndex][TSTAT_WAITED]++;
+    }
+}
+
+// ----------------------------------------------------------------------------
+// NOTE TRAIN SPAWNED / MOVED
+// ----------------------------------------------------------------------------
+// Per-train table updates from the spawn and movement phases. A spawn starts
+// a fresh row (the slot may have held an earlier train).
+// ----------------------------------------------------------------------------
+void noteTrainSpawned(int trainIndex) {
+    if (trainIndex < 0 || trainIndex >= MAX_TRAINS) return;
+    trainStats[trainIndex][TSTAT_SPAWN_TICK] = currentTick;
+    trainStats[trainIndex][TSTAT_END_TICK] = -1;
+    trainStats[trainIndex][TSTAT_MOVED] = 0;
+    trainStats[trainIndex][TSTAT_WAITED] = 0;
+    totalSpawned++;
+}
+
+void noteTrainMoved(int trainIndex) {
+    if (trainIndex < 0 || trainIndex >= MAX_TRAINS) return;
+    trainStats[trainIndex][TSTAT_MOVED]++;
+    moveMarkTick[trainIndex] = currentTick;
+}
+
+void noteTrainMoves(int trainIndex, int moves) {
+    if (trainIndex < 0 || trainIndex >= MAX_TRAINS) return;
+    trainStats[trainIndex][TSTAT_MOVED] += moves;
+    if (heatmapEnabled) recordCoastHeat(trainIndex, moves);
+}
+
+// ----------------------------------------------------------------------------
+// DESTINATION INDEX of a train (-1 if it matches no destination point)
+// ----------------------------------------------------------------------------
+static int getTrainDestinationIndex(int trainIndex) {
+    for (int d = 0; d < numDestinationPoints; d++) {
+        if (destinationPoints[d][DEST_X] == trains[trainIndex][TRAIN_DEST_X] &&
+            destinationPoints[d][DEST_Y] == trains[trainIndex][TRAIN_DEST_Y]) {
+            return d;
+        }
+    }
+    return -1;
+}
+
+// ----------------------------------------------------------------------------
+// RECORD TRAIN FINISHED
+// ----------------------------------------------------------------------------
+// Close the table row and add delivered trains to the histograms.
+// ----------------------------------------------------------------------------
+static void recordTrainFinished(int trainIndex) {
+    trainStats[trainIndex][TSTAT_END_TICK] = currentTick;
+    if (trains[trainIndex][TRAIN_STATE] != TRAIN_DELIVERED) {
+        totalCrashed++;
+        recordCrashHeat(trainIndex);
+        return;
+    }
+    totalDelivered++;
+
+    int trip = currentTick - trainStats[trainIndex][TSTAT_SPAWN_TICK];
+    int wait = trainStats[trainIndex][TSTAT_WAITED];
+
+    tripHist[std::min(trip, LATENCY_HIST_SIZE)]++;
+    waitHist[std::min(wait, LATENCY_HIST_SIZE)]++;
+    histCount++;
+    maxTrip = std::max(maxTrip, trip);
+    maxWait = std::max(maxWait, wait);
+
+    int dest = getTrainDestinationIndex(trainIndex);
+    if (dest >= 0) {
+        destTripHist[dest][std::min(trip, LATENCY_HIST_SIZE)]++;
+        destTripSum[dest] += trip;
+        destWaitSum[dest] += wait;
+        destTripMax[dest] = std::max(destTripMax[dest], trip);
+    }
+}
+
+// ----------------------------------------------------------------------------
+// RECORD TICK METRICS
+// ----------------------------------------------------------------------------
+// Store this tick's counters in the ring; flush every FLUSH_INTERVAL ticks.
+// Active trains also go into the heatmap here, except coasting ones whose
+// position is behind (their tiles are counted when they catch up).
+// ----------------------------------------------------------------------------
+void recordTickMetrics() {
+    // Count train states (global counters may double count pile-ups)
+    noteHeatRows(gridRows);
+    int active = 0;
+    for (int i = 0; i < numTrains; i++) {
+        int state = trains[i][TRAIN_STATE];
+        if (state == TRAIN_ACTIVE) {
+            active++;
+            if (heatmapEnabled && (!segmentTick || !isTrainCoasting(i))) {
+                int x = trains[i][TRAIN_X], y = trains[i][TRAIN_Y];
+                tileHeat[HEAT_OCCUPIED][x][y]++;
+                if (moveMarkTick[i] != currentTick) tileHeat[HEAT_STAYED][x][y]++;
+                if (waitMarkTick[i] == currentTick) tileHeat[HEAT_WAITED][x][y]++;
+            }
+        } else if ((state == TRAIN_DELIVERED || state == TRAIN_CRASHED) && trainStats[i][TSTAT_END_TICK] < 0) {
+            recordTrainFinished(i);
+        }
+    }
+    int spawned = totalSpawned, delivered = totalDelivered, crashed = totalCrashed;
+
+    int* row = metricsRing[metricsRingHead];
+    row[TS_TICK] = currentTick;
+    row[TS_ACTIVE] = active;
+    row[TS_SPAWNED] = spawned - lastSpawned;
+    row[TS_DELIVERED] = delivered - lastDelivered;
+    row[TS_CRASHED] = crashed - lastCrashed;
+    row[TS_WAITING] = waitingThisTick;
+    row[TS_FLIPS] = switchFlips - lastFlips;
+    row[TS_WAIT_TICKS] = totalWaitTicks - lastWaitTicks;
+
+    lastSpawned = spawned;
+    lastDelivered = delivered;
+    lastCrashed = crashed;
+    lastFlips = switchFlips;
+    lastWaitTicks = totalWaitTicks;
+    waitingThisTick = 0;
+
+    metricsRingHead = (metricsRingHead + 1) % METRICS_RING_SIZE;
+    if (metricsRingCount < METRICS_RING_SIZE) metricsRingCount++;
+    metricsPending++;
+
+    if (metricsPending >= METRICS_FLUSH_INTERVAL) {
+        flushMetricsStream();
+    }
+}
+
+// ----------------------------------------------------------------------------
+// GET RECENT TICK METRIC
+// ----------------------------------------------------------------------------
+// Read a field from the ring (0 = most recent row).
+// ----------------------------------------------------------------------------
+int getRecentTickMetric(int ticksAgo, int field) {
+    if (ticksAgo < 0 || ticksAgo >= metricsRingCount) return -1;
+    if (field < 0 || field >= TS_FIELDS) return -1;
+
+    int slot = (metricsRingHead - 1 - ticksAgo + 2 * METRICS_RING_SIZE) % METRICS_RING_SIZE;
+    return metricsRing[slot][field];
+}
+
+// ----------------------------------------------------------------------------
+// GET TRAIN TOTAL
+// ----------------------------------------------------------------------------
+int getTrainTotal(int field) {
+    if (field == TS_SPAWNED) return totalSpawned;
+    if (field == TS_DELIVERED) return totalDelivered;
+    if (field == TS_CRASHED) return totalCrashed;
+    return -1;
+}
+
+// ----------------------------------------------------------------------------
+// HISTOGRAM PERCENTILE (nearest rank; overflow bucket reports the max)
+// ----------------------------------------------------------------------------
+static int getHistogramPercentile(const int* hist, int count, int percent, int maxValue) {
+    if (count == 0) return 0;
+
+    int rank = (count * percent + 99) / 100;
+    if (rank < 1) rank = 1;
+
+    int seen = 0;
+    for (int b = 0; b < LATENCY_HIST_SIZE; b++) {
+        seen += hist[b];
+        if (seen >= rank) return b;
+    }
+    return maxValue;
+}
+
+// ----------------------------------------------------------------------------
+// WRITE TRAIN DISTRIBUTIONS
+// ----------------------------------------------------------------------------
+// Append trip/wait percentiles and per-destination rows to a report.
+// ----------------------------------------------------------------------------
+void writeTrainDistributions(std::ostream& out) {
+    out << "\n=== TRIP TIME (delivered trains, ticks) ===\n";
+    out << "p50: " << getHistogramPercentile(tripHist, histCount, 50, maxTrip)
+        << "  p90: " << getHistogramPercentile(tripHist, histCount, 90, maxTrip)
+        << "  p99: " << getHistogramPercentile(tripHist, histCount, 99, maxTrip)
+        << "  max: " << maxTrip << "\n";
+
+    out << "\n=== WAIT TIME (delivered trains, ticks) ===\n";
+    out << "p50: " << getHistogramPercentile(waitHist, histCount, 50, maxWait)
+        << "  p90: " << getHistogramPercentile(waitHist, histCount, 90, maxWait)
+        << "  p99: " << getHistogramPercentile(waitHist, histCount, 99, maxWait)
+        << "  max: " << maxWait << "\n";
+
+    out << "\n=== PER DESTINATION ===\n";
+    for (int d = 0; d < numDestinationPoints; d++) {
+        int count = 0;
+        for (int b = 0; b <= LATENCY_HIST_SIZE; b++) count += destTripHist[d][b];
+
+        out << "D" << d << " (" << destinationPoints[d][DEST_X] << "," << destinationPoints[d][DEST_Y] << "): "
+            << "delivered " << count;
+        if (count > 0) {
+            out << "  avg trip " << (double)destTripSum[d] / count
+                << "  p90 trip " << getHistogramPercentile(destTripHist[d], count, 90, destTripMax[d])
+                << "  avg wait " << (double)destWaitSum[d] / count;
+        }
+        out << "\n";
+    }
+}
+
+// ----------------------------------------------------------------------------
+// WRITE TRAIN TABLE
+// ----------------------------------------------------------------------------
+// One row per train to out/trains.csv. With a streaming schedule, finished
+// trains were written by writeTrainRow() and only unfinished ones remain.
+// ----------------------------------------------------------------------------
+static void openTrainTable() {
+    // Streamed rows are kept if the table is finished more than once
+    if (streamingSchedule && trainTableStarted) {
+        trainTableFile.open("out/trains.csv", std::ios::app);
+        return;
+    }
+    trainTableFile.open("out/trains.csv");
+    trainTableFile << "TrainID,Outcome,Destination,SpawnTick,EndTick,TripTicks,MovedTicks,WaitTicks\n";
+    trainTableStarted = true;
+}
+
+static void writeTrainTableRow(int i) {
+    const char* outcome = "SCHEDULED";
+    switch (trains[i][TRAIN_STATE]) {
+        case TRAIN_ACTIVE: outcome = "ACTIVE"; break;
+        case TRAIN_DELIVERED: outcome = "DELIVERED"; break;
+        case TRAIN_CRASHED: outcome = "CRASHED"; break;
+        default: break;
+    }
+
+    int spawnTick = trainStats[i][TSTAT_SPAWN_TICK];
+    int endTick = trainStats[i][TSTAT_END_TICK];
+    int trip = (spawnTick >= 0 && endTick >= 0) ? endTick - spawnTick : -1;
+
+    trainTableFile << trains[i][TRAIN_ID] << "," << outcome << "," << getTrainDestinationIndex(i) << ","
+                   << spawnTick << "," << endTick << "," << trip << ","
+                   << trainStats[i][TSTAT_MOVED] << "," << trainStats[i][TSTAT_WAITED] << "\n";
+}
+
+void writeTrainRow(int trainIndex) {
+    if (!trainTableFile.is_open()) openTrainTable();
+    writeTrainTableRow(trainIndex);
+}
+
+void writeTrainTable() {
+    if (!trainTableFile.is_open()) openTrainTable();
+
+    for (int i = 0; i < numTrains; i++) {
+        int state = trains[i][TRAIN_STATE];
+        if (streamingSchedule && state != TRAIN_ACTIVE && state != TRAIN_SCHEDULED) continue;
+        writeTrainTableRow(i);
+    }
+
+    trainTableFile.close();
+}
@@ -0,0 +1,101 @@
+#ifndef METRICS_H
+#define METRICS_H
+
+#include <iosfwd>
+
+// ============================================================================
+// METRICS.H - Live per-tick metrics stream and per-train statistics
+// ============================================================================
+// Per-tick counters are kept in a fixed-size ring buffer and appended to
+// out/timeseries.csv in batches, so long or aborted runs still leave data.
+// Per-train trip/wait times are kept in a small table and histograms, so
+// percentiles need no pass over trace.csv.
+// ============================================================================
+
+// ----------------------------------------------------------------------------
+// TIME-SERIES CONSTANTS
+// ----------------------------------------------------------------------------
+// Row layout: 0=tick, 1=active, 2=spawned, 3=delivered, 4=crashed,
+//             5=waiting, 6=flips, 7=waitTicks
+// (spawned/delivered/crashed/flips/waitTicks are per-tick deltas)
+const int TS_TICK = 0;
+const int TS_ACTIVE = 1;
+const int TS_SPAWNED = 2;
+const int TS_DELIVERED = 3;
+const int TS_CRASHED = 4;
+const int TS_WAITING = 5;
+const int TS_FLIPS = 6;
+const int TS_WAIT_TICKS = 7;
+const int TS_FIELDS = 8;
+
+// Rows kept in memory (most recent ticks).
+const int METRICS_RING_SIZE = 256;
+
+// Pending rows are appended to disk every this many ticks.
+const int METRICS_FLUSH_INTERVAL = 64;
+
+// ----------------------------------------------------------------------------
+// PER-TRAIN STATISTICS CONSTANTS
+// ----------------------------------------------------------------------------
+// Row layout: 0=spawnTick, 1=endTick (delivered/crashed), 2=movedTicks,
+//             3=waitTicks (-1 = not yet)
+const int TSTAT_SPAWN_TICK = 0;
+const int TSTAT_END_TICK = 1;
+const int TSTAT_MOVED = 2;
+const int TSTAT_WAITED = 3;
+const int TSTAT_FIELDS = 4;
+
+// Histogram range in ticks (longer values go to an overflow bucket).
+const int LATENCY_HIST_SIZE = 2048;
+
+// ----------------------------------------------------------------------------
+// STREAM CONTROL
+// ----------------------------------------------------------------------------
+// Reset the ring buffer and write the timeseries.csv header.
+void initializeMetricsStream();
+
+// Append all pending rows to timeseries.csv.
+void flushMetricsStream();
+
+// ----------------------------------------------------------------------------
+// RECORDING
+// ----------------------------------------------------------------------------
+// Mark a train as waiting in the current tick (counted once per tick).
+void noteTrainWaiting(int trainIndex);
+
+// Record the spawn tick of a train.
+void noteTrainSpawned(int trainIndex);
+
+// Count a tick in which a train changed tile.
+void noteTrainMoved(int trainIndex);
+
+// Count several such ticks at once (a train that coasted along a segment).
+void noteTrainMoves(int trainIndex, int moves);
+
+// Record the counters for the current tick (end of tick).
+void recordTickMetrics();
+
+// ----------------------------------------------------------------------------
+// QUERY
+// ----------------------------------------------------------------------------
+// Get a field of a recent row (0 = last recorded tick), or -1 if not kept.
+int getRecentTickMetric(int ticksAgo, int field);
+
+// Run total of TS_SPAWNED, TS_DELIVERED or TS_CRASHED up to the last
+// recorded tick (one count per train, however slots are reused).
+int getTrainTotal(int field);
+
+// ----------------------------------------------------------------------------
+// REPORTS
+// ----------------------------------------------------------------------------
+// Write trip/wait percentiles and per-destination breakdown.
+void writeTrainDistributions(std::ostream& out);
+
+// Append a finished train's row to out/trains.csv before its slot is reused.
+void writeTrainRow(int trainIndex);
+
+// Write the per-train table to out/trains.csv (with a streaming schedule,
+// the rows of trains that have not finished).
+void writeTrainTable();
+
+#endif
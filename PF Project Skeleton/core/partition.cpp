@@ -0,0 +1,566 @@
+#include "partition.h"
+#include "simulation_state.h"
+#include "workers.h"
+#include "trains.h"
+#include "switches.h"
+#include "grid.h"
+#include "io.h"
+#include "metrics.h"
+#include "heatmap.h"
+#include "halt.h"
+#include <cstdlib>
+#include <algorithm>
+
+// ============================================================================
+// PARTITION.CPP - Spatially partitioned parallel tick
+// ============================================================================
+
+// Plan status per train for the current tick.
+const int PLAN_NONE = 0;
+const int PLAN_MOVE = 1;
+const int PLAN_CRASH = 2;
+
+// Strip layout: strip s covers rows [s*stripRows, (s+1)*stripRows).
+int stripCount = 1;
+int stripRows = MAX_ROWS;
+
+// Active trains grouped by strip (train index order inside a strip).
+int stripStart[MAX_STRIPS + 1];
+int stripOrder[MAX_TRAINS];
+
+// Planned move per train.
+int planStatus[MAX_TRAINS];
+int planX[MAX_TRAINS], planY[MAX_TRAINS], planDist[MAX_TRAINS];
+
+// Per-strip lists stored in the strip's own slice of stripOrder positions.
+int crashList[MAX_TRAINS];   int crashCount[MAX_STRIPS];
+int waitList[MAX_TRAINS];    int waitCount[MAX_STRIPS];
+int movedList[MAX_TRAINS];   int movedCount[MAX_STRIPS];
+int arrivalList[MAX_TRAINS]; int arrivalCount[MAX_STRIPS];
+int haltList[MAX_TRAINS];    int haltCount[MAX_STRIPS];
+
+// Per-strip switch counter increments (0-3 = PER_DIR, 4 = GLOBAL).
+int stripSwitchDelta[MAX_STRIPS][MAX_SWITCHES][5];
+int stripWaitTicks[MAX_STRIPS];
+
+// Moves grouped by the strip of their target tile.
+// targetSplit[s][k] = moves from strip s into strip s-1+k.
+int targetSplit[MAX_STRIPS][3];
+int targetStart[MAX_STRIPS + 1];
+int targetOrder[MAX_TRAINS];
+
+// Collision pair entries: position in targetOrder and end of its group.
+int pairFirst[MAX_TRAINS], pairGroupEnd[MAX_TRAINS];
+int pairCount[MAX_STRIPS];
+int pairMerged[MAX_TRAINS];
+
+// Signal colour per switch for this tick.
+int signalCode[MAX_SWITCHES];
+
+// Settings the strips were sized for (re-initialized when they change).
+int partitionThreads = 0;
+int partitionRows = 0;
+
+// ----------------------------------------------------------------------------
+// ORDERING HELPERS
+// ----------------------------------------------------------------------------
+// The phased engine stable-sorts moves by distance (descending), so its
+// global order is (distance desc, train index asc).
+// ----------------------------------------------------------------------------
+static bool rankBefore(int a, int b) {
+    if (planDist[a] != planDist[b]) return planDist[a] > planDist[b];
+    return a < b;
+}
+
+static bool targetBefore(int a, int b) {
+    int cellA = planX[a] * MAX_COLS + planY[a];
+    int cellB = planX[b] * MAX_COLS + planY[b];
+    if (cellA != cellB) return cellA < cellB;
+    return rankBefore(a, b);
+}
+
+static bool pairBefore(int a, int b) {
+    return rankBefore(targetOrder[pairFirst[a]], targetOrder[pairFirst[b]]);
+}
+
+static int getStripOfRow(int row) {
+    int strip = row / stripRows;
+    if (strip < 0) return 0;
+    if (strip >= stripCount) return stripCount - 1;
+    return strip;
+}
+
+// ----------------------------------------------------------------------------
+// INITIALIZE / SHUTDOWN
+// ----------------------------------------------------------------------------
+// Strips outnumber workers 4:1 and are dealt round-robin for balance.
+// ----------------------------------------------------------------------------
+void initializePartitionedTick(int threads) {
+    startWorkers(threads);
+
+    int rows = std::max(gridRows, 1);
+    stripCount = std::min(std::min(getWorkerCount() * 4, rows), MAX_STRIPS);
+    stripRows = (rows + stripCount - 1) / stripCount;
+    stripCount = (rows + stripRows - 1) / stripRows;
+    
+    partitionThreads = threads;
+    partitionRows = gridRows;
+}
+
+void shutdownPartitionedTick() {
+    stopWorkers();
+    partitionThreads = 0;
+}
+
+// ----------------------------------------------------------------------------
+// BUILD STRIPS (hand-off)
+// ----------------------------------------------------------------------------
+// Counting sort of active trains by current row; trains that crossed a strip
+// boundary last tick land in their new strip in train index order.
+// ----------------------------------------------------------------------------
+static void buildStrips() {
+    int counts[MAX_STRIPS + 1];
+    for (int s = 0; s <= stripCount; s++) counts[s] = 0;
+
+    for (int i = 0; i < numTrains; i++) {
+        planStatus[i] = PLAN_NONE;
+        if (trains[i][TRAIN_STATE] == TRAIN_ACTIVE) {
+            counts[getStripOfRow(trains[i][TRAIN_X]) + 1]++;
+        }
+    }
+
+    stripStart[0] = 0;
+    for (int s = 0; s < stripCount; s++) {
+        stripStart[s + 1] = stripStart[s] + counts[s + 1];
+        counts[s + 1] = stripStart[s];
+    }
+
+    for (int i = 0; i < numTrains; i++) {
+        if (trains[i][TRAIN_STATE] == TRAIN_ACTIVE) {
+            int strip = getStripOfRow(trains[i][TRAIN_X]);
+            stripOrder[counts[strip + 1]++] = i;
+        }
+    }
+}
+
+// ----------------------------------------------------------------------------
+// PARALLEL: ROUTE + COUNTERS
+// ----------------------------------------------------------------------------
+// Plan each owned train's next tile and count switch entries locally.
+// ----------------------------------------------------------------------------
+static void routeStripTask(int worker) {
+    int workers = getWorkerCount();
+
+    for (int s = worker; s < stripCount; s += workers) {
+        crashCount[s] = 0;
+        targetSplit[s][0] = targetSplit[s][1] = targetSplit[s][2] = 0;
+        for (int sw = 0; sw < numSwitches; sw++) {
+            for (int k = 0; k < 5; k++) stripSwitchDelta[s][sw][k] = 0;
+        }
+
+        for (int p = stripStart[s]; p < stripStart[s + 1]; p++) {
+            int i = stripOrder[p];
+            int x = trains[i][TRAIN_X];
+            int y = trains[i][TRAIN_Y];
+            int dir = trains[i][TRAIN_DIRECTION];
+            int nextX = x + dx[dir];
+            int nextY = y + dy[dir];
+
+            // Off-track trains crash (applied serially in index order)
+            if (!isInBounds(nextX, nextY) || !isTrackTile(nextX, nextY)) {
+                planStatus[i] = PLAN_CRASH;
+                crashList[stripStart[s] + crashCount[s]++] = i;
+                continue;
+            }
+
+            planStatus[i] = PLAN_MOVE;
+            planX[i] = nextX;
+            planY[i] = nextY;
+            planDist[i] = abs(nextX - trains[i][TRAIN_DEST_X]) + abs(nextY - trains[i][TRAIN_DEST_Y]);
+            targetSplit[s][getStripOfRow(nextX) - s + 1]++;
+
+            // Switch counters (phase 3) for trains still on track
+            if (isSwitchTile(x, y)) {
+                int switchIndex = getSwitchIndex(getTile(x, y));
+                if (switchIndex >= 0 && switchIndex < numSwitches) {
+                    if (switches[switchIndex][SWITCH_MODE] == PER_DIR) {
+                        stripSwitchDelta[s][switchIndex][dir]++;
+                    } else {
+                        stripSwitchDelta[s][switchIndex][4]++;
+                    }
+                }
+            }
+        }
+    }
+}
+
+// ----------------------------------------------------------------------------
+// SERIAL: ROUTE CRASHES, COUNTERS, TARGET OFFSETS
+// ----------------------------------------------------------------------------
+static void mergeRouteResults() {
+    // Route crashes in train index order (as the phased engine logs them)
+    int merged = 0;
+    for (int s = 0; s < stripCount; s++) {
+        for (int c = 0; c < crashCount[s]; c++) {
+            pairMerged[merged++] = crashList[stripStart[s] + c];
+        }
+    }
+    std::sort(pairMerged, pairMerged + merged);
+    for (int c = 0; c < merged; c++) {
+        int i = pairMerged[c];
+        trains[i][TRAIN_STATE] = TRAIN_CRASHED;
+        trainsCrashed++;
+        activeTrains--;
+        logTrainTrace(i, TRACE_CRASHED);
+    }
+
+    // Switch counter increments are order-independent sums
+    for (int s = 0; s < stripCount; s++) {
+        for (int sw = 0; sw < numSwitches; sw++) {
+            for (int dir = 0; dir < 4; dir++) {
+                switches[sw][SWITCH_COUNTER0 + dir] += stripSwitchDelta[s][sw][dir];
+            }
+            switches[sw][SWITCH_GLOBAL_COUNTER] += stripSwitchDelta[s][sw][4];
+        }
+    }
+
+    // Target slice t holds moves from strips t-1, t, t+1 (in that order)
+    targetStart[0] = 0;
+    for (int t = 0; t < stripCount; t++) {
+        int fromAbove = (t > 0) ? targetSplit[t - 1][2] : 0;
+        int fromBelow = (t + 1 < stripCount) ? targetSplit[t + 1][0] : 0;
+        targetStart[t + 1] = targetStart[t] + fromAbove + targetSplit[t][1] + fromBelow;
+    }
+}
+
+// ----------------------------------------------------------------------------
+// PARALLEL: SCATTER MOVES TO TARGET STRIPS
+// ----------------------------------------------------------------------------
+static void scatterTargetsTask(int worker) {
+    int workers = getWorkerCount();
+
+    for (int s = worker; s < stripCount; s += workers) {
+        int fill[3];
+        // Into s-1: after that slice's moves from s-2 and s-1
+        if (s > 0) {
+            int fromAbove = (s > 1) ? targetSplit[s - 2][2] : 0;
+            fill[0] = targetStart[s - 1] + fromAbove + targetSplit[s - 1][1];
+        } else {
+            fill[0] = 0;
+        }
+        // Into s: after moves from s-1
+        fill[1] = targetStart[s] + ((s > 0) ? targetSplit[s - 1][2] : 0);
+        // Into s+1: first
+        fill[2] = (s + 1 < stripCount) ? targetStart[s + 1] : 0;
+
+        for (int p = stripStart[s]; p < stripStart[s + 1]; p++) {
+            int i = stripOrder[p];
+            if (planStatus[i] != PLAN_MOVE) continue;
+            targetOrder[fill[getStripOfRow(planX[i]) - s + 1]++] = i;
+        }
+    }
+}
+
+// ----------------------------------------------------------------------------
+// PARALLEL: COLLISION GROUPS PER TARGET STRIP
+// ----------------------------------------------------------------------------
+// Moves into the same tile always share a target strip, so groups are local.
+// Each member except the last becomes a pair entry for the serial merge.
+// ----------------------------------------------------------------------------
+static void collisionGroupsTask(int worker) {
+    int workers = getWorkerCount();
+
+    for (int t = worker; t < stripCount; t += workers) {
+        int begin = targetStart[t];
+        int end = targetStart[t + 1];
+        pairCount[t] = 0;
+
+        std::sort(targetOrder + begin, targetOrder + end, targetBefore);
+
+        int groupStart = begin;
+        while (groupStart < end) {
+            int first = targetOrder[groupStart];
+            int groupEnd = groupStart + 1;
+            while (groupEnd < end &&
+                   planX[targetOrder[groupEnd]] == planX[first] &&
+                   planY[targetOrder[groupEnd]] == planY[first]) {
+                groupEnd++;
+            }
+
+            for (int p = groupStart; p + 1 < groupEnd; p++) {
+                pairFirst[begin + pairCount[t]] = p;
+                pairGroupEnd[begin + pairCount[t]] = groupEnd;
+                pairCount[t]++;
+            }
+            groupStart = groupEnd;
+        }
+    }
+}
+
+// ----------------------------------------------------------------------------
+// SERIAL: RESOLVE COLLISIONS
+// ----------------------------------------------------------------------------
+// Pairs are applied in the phased engine's (i, j) loop order.
+// ----------------------------------------------------------------------------
+static void resolveCollisionPairs() {
+    int merged = 0;
+    for (int t = 0; t < stripCount; t++) {
+        for (int c = 0; c < pairCount[t]; c++) {
+            pairMerged[merged++] = targetStart[t] + c;
+        }
+    }
+    if (merged == 0) return;
+
+    std::sort(pairMerged, pairMerged + merged, pairBefore);
+
+    for (int e = 0; e < merged; e++) {
+        int entry = pairMerged[e];
+        int trainI = targetOrder[pairFirst[entry]];
+
+        for (int q = pairFirst[entry] + 1; q < pairGroupEnd[entry]; q++) {
+            int trainJ = targetOrder[q];
+            noteTileConflict(planX[trainI], planY[trainI]);
+
+            if (planDist[trainI] > planDist[trainJ]) {
+                trains[trainJ][TRAIN_WAIT_TICKS]++;
+                noteTrainWaiting(trainJ);
+            } else if (planDist[trainJ] > planDist[trainI]) {
+                trains[trainI][TRAIN_WAIT_TICKS]++;
+                noteTrainWaiting(trainI);
+            } else {
+                trains[trainI][TRAIN_STATE] = TRAIN_CRASHED;
+                trains[trainJ][TRAIN_STATE] = TRAIN_CRASHED;
+                trainsCrashed += 2;
+                activeTrains -= 2;
+
+                logTrainTrace(trainI, TRACE_CRASHED);
+                logTrainTrace(trainJ, TRACE_CRASHED);
+            }
+        }
+    }
+}
+
+// ----------------------------------------------------------------------------
+// PARALLEL: MOVEMENT
+// ----------------------------------------------------------------------------
+// Same RAIN, safety-tile and weather rules as moveAllTrains().
+// ----------------------------------------------------------------------------
+static void moveStripTask(int worker) {
+    int workers = getWorkerCount();
+
+    for (int s = worker; s < stripCount; s += workers) {
+        int base = stripStart[s];
+        waitCount[s] = 0;
+        movedCount[s] = 0;
+        stripWaitTicks[s] = 0;
+
+        for (int p = stripStart[s]; p < stripStart[s + 1]; p++) {
+            int i = stripOrder[p];
+            if (planStatus[i] != PLAN_MOVE || trains[i][TRAIN_STATE] != TRAIN_ACTIVE) continue;
+
+            if (holdForRain(i)) {
+                stripWaitTicks[s]++;
+                waitList[base + waitCount[s]++] = i;
+                movedList[base + movedCount[s]++] = i;
+                continue;
+            }
+
+            if (isSafetyTile(trains[i][TRAIN_X], trains[i][TRAIN_Y])) {
+                trains[i][TRAIN_WAIT_TICKS]++;
+                stripWaitTicks[s]++;
+                waitList[base + waitCount[s]++] = i;
+
+                int delayTicks = 1;
+                if (weather == WEATHER_RAIN) delayTicks = 2;
+                if (weather == WEATHER_FOG) delayTicks = 3;
+
+                if (trains[i][TRAIN_WAIT_TICKS] < delayTicks) {
+                    movedList[base + movedCount[s]++] = i;
+                    continue;
+                }
+                trains[i][TRAIN_WAIT_TICKS] = 0;
+            }
+
+            trains[i][TRAIN_X] = planX[i];
+            trains[i][TRAIN_Y] = planY[i];
+            trains[i][TRAIN_DIRECTION] = getNextDirection(planX[i], planY[i], trains[i][TRAIN_DIRECTION], i);
+            countTrainMove(i);
+            noteTrainMoved(i);
+            movedList[base + movedCount[s]++] = i;
+        }
+
+        // Sorted for the serial log merge
+        if (logLevel >= LOG_CHANGES) {
+            std::sort(movedList + base, movedList + base + movedCount[s], rankBefore);
+        }
+    }
+}
+
+// ----------------------------------------------------------------------------
+// SERIAL: MOVEMENT RESULTS
+// ----------------------------------------------------------------------------
+// Wait counters, then MOVING rows merged across strips in global move order.
+// movedList also holds trains that were held in place (WAIT rows).
+// ----------------------------------------------------------------------------
+static void mergeMoveResults() {
+    for (int s = 0; s < stripCount; s++) {
+        totalWaitTicks += stripWaitTicks[s];
+        for (int w = 0; w < waitCount[s]; w++) {
+            noteTrainWaiting(waitList[stripStart[s] + w]);
+        }
+    }
+
+    if (logLevel < LOG_CHANGES) return;
+
+    int heads[MAX_STRIPS];
+    for (int s = 0; s < stripCount; s++) heads[s] = 0;
+
+    while (true) {
+        int best = -1;
+        for (int s = 0; s < stripCount; s++) {
+            if (heads[s] >= movedCount[s]) continue;
+            if (best < 0 || rankBefore(movedList[stripStart[s] + heads[s]], movedList[stripStart[best] + heads[best]])) {
+                best = s;
+            }
+        }
+        if (best < 0) break;
+
+        int i = movedList[stripStart[best] + heads[best]++];
+        bool moved = (trains[i][TRAIN_X] == planX[i] && trains[i][TRAIN_Y] == planY[i]);
+        logTrainTrace(i, moved ? TRACE_MOVING : TRACE_WAITING);
+    }
+}
+
+// ----------------------------------------------------------------------------
+// PARALLEL: ARRIVALS
+// ----------------------------------------------------------------------------
+static void arrivalStripTask(int worker) {
+    int workers = getWorkerCount();
+
+    for (int s = worker; s < stripCount; s += workers) {
+        arrivalCount[s] = 0;
+        haltCount[s] = 0;
+        for (int p = stripStart[s]; p < stripStart[s + 1]; p++) {
+            int i = stripOrder[p];
+            if (trains[i][TRAIN_STATE] != TRAIN_ACTIVE) continue;
+            if (trains[i][TRAIN_X] == trains[i][TRAIN_DEST_X] && trains[i][TRAIN_Y] == trains[i][TRAIN_DEST_Y]) {
+                arrivalList[stripStart[s] + arrivalCount[s]++] = i;
+            } else if (numHaltZones > 0 && isHaltTile(trains[i][TRAIN_X], trains[i][TRAIN_Y])) {
+                haltList[stripStart[s] + haltCount[s]++] = i;
+            }
+        }
+    }
+}
+
+// ----------------------------------------------------------------------------
+// SERIAL: DELIVERIES in train index order, then the trains to halt
+// ----------------------------------------------------------------------------
+static void mergeArrivals() {
+    int merged = 0;
+    for (int s = 0; s < stripCount; s++) {
+        for (int a = 0; a < arrivalCount[s]; a++) {
+            pairMerged[merged++] = arrivalList[stripStart[s] + a];
+        }
+    }
+    std::sort(pairMerged, pairMerged + merged);
+
+    for (int a = 0; a < merged; a++) {
+        int i = pairMerged[a];
+        trains[i][TRAIN_STATE] = TRAIN_DELIVERED;
+        trainsDelivered++;
+        activeTrains--;
+        logTrainTrace(i, TRACE_DELIVERED);
+    }
+
+    for (int s = 0; s < stripCount; s++) {
+        for (int h = 0; h < haltCount[s]; h++) noteHaltCandidate(haltList[stripStart[s] + h]);
+    }
+}
+
+// ----------------------------------------------------------------------------
+// PARALLEL: SIGNAL COLOURS
+// ----------------------------------------------------------------------------
+// Only strips within reach of the switch are scanned (trains started the
+// tick at most one row away from where they are now).
+// ----------------------------------------------------------------------------
+static void signalTask(int worker) {
+    int workers = getWorkerCount();
+
+    for (int sw = worker; sw < numSwitches; sw += workers) {
+        int x = switches[sw][SWITCH_X];
+        int y = switches[sw][SWITCH_Y];
+        signalCode[sw] = -1;
+        if (!isInBounds(x, y)) continue;
+
+        bool hasConflict = false;
+        bool hasWarning = false;
+        int firstStrip = getStripOfRow(x - 3);
+        int lastStrip = getStripOfRow(x + 3);
+
+        for (int dir = 0; dir < 4; dir++) {
+            int nextX = x + dx[dir];
+            int nextY = y + dy[dir];
+            if (!isInBounds(nextX, nextY)) continue;
+
+            for (int p = stripStart[firstStrip]; p < stripStart[lastStrip + 1]; p++) {
+                int j = stripOrder[p];
+                if (trains[j][TRAIN_STATE] != TRAIN_ACTIVE) continue;
+
+                int distance = abs(trains[j][TRAIN_X] - nextX) + abs(trains[j][TRAIN_Y] - nextY);
+                if (distance == 0) {
+                    hasConflict = true;
+                } else if (distance <= 1) {
+                    hasWarning = true;
+                }
+            }
+        }
+
+        signalCode[sw] = hasConflict ? SIGNAL_RED : (hasWarning ? SIGNAL_YELLOW : SIGNAL_GREEN);
+    }
+}
+
+// ----------------------------------------------------------------------------
+// RUN PARTITIONED PHASES
+// ----------------------------------------------------------------------------
+// Same phase order as simulateOneTick(); serial steps only merge results.
+// ----------------------------------------------------------------------------
+void runPartitionedPhases() {
+    if (partitionThreads != tickThreads || partitionRows != gridRows) {
+        initializePartitionedTick(tickThreads);
+    }
+    
+    // Phase 1: Spawn (serial, cheap) then hand trains to their strips
+    spawnTrainsForTick();
+    buildStrips();
+
+    // Phases 2-3: Route and count switch entries per strip
+    runOnWorkers(routeStripTask);
+    mergeRouteResults();
+
+    // Phase 4: Queue switch flips
+    queueSwitchFlips();
+
+    // Phase 5: Collisions per target strip, then movement per strip
+    runOnWorkers(scatterTargetsTask);
+    runOnWorkers(collisionGroupsTask);
+    resolveCollisionPairs();
+    runOnWorkers(moveStripTask);
+    mergeMoveResults();
+
+    // Phase 6: Apply deferred switch flips
+    applyDeferredFlips();
+
+    // Phase 7: Arrivals
+    runOnWorkers(arrivalStripTask);
+    mergeArrivals();
+
+    // Emergency halt
+    applyEmergencyHalt();
+    updateEmergencyHalt();
+
+    // Signal lights (colours in parallel, rows in switch order)
+    runOnWorkers(signalTask);
+    for (int sw = 0; sw < numSwitches; sw++) {
+        if (signalCode[sw] >= 0) logSignalState(sw, (SignalColor)signalCode[sw]);
+    }
+}
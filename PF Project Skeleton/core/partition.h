@@ -0,0 +1,33 @@
+#ifndef PARTITION_H
+#define PARTITION_H
+
+// ============================================================================
+// PARTITION.H - Spatially partitioned parallel tick
+// ============================================================================
+// The grid is split into horizontal strips. Each worker thread handles the
+// trains that start the tick in its strips (routing, counter updates,
+// movement, arrivals). Anything with a global order (logs, crashes, counters)
+// is merged serially in the same order as the phased engine, so the results
+// are identical for any thread count.
+// ============================================================================
+
+// Most strips the grid is split into.
+const int MAX_STRIPS = 256;
+
+// ----------------------------------------------------------------------------
+// SETUP
+// ----------------------------------------------------------------------------
+// Start worker threads and size the strips (done on first use or when
+// tickThreads / the level size changes).
+void initializePartitionedTick(int threads);
+
+// Stop the worker threads.
+void shutdownPartitionedTick();
+
+// ----------------------------------------------------------------------------
+// TICK
+// ----------------------------------------------------------------------------
+// Run phases 1-7, emergency halt and signals for one tick on tickThreads.
+void runPartitionedPhases();
+
+#endif
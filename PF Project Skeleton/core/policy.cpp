@@ -0,0 +1,127 @@
+#include "policy.h"
+#include "grid.h"
+#include "reach.h"
+#include <algorithm>
+#include <cctype>
+
+// ============================================================================
+// POLICY.CPP - Switch control policies
+// ============================================================================
+
+const char* switchPolicyNames[NUM_SWITCH_POLICIES] = { "COUNTERS", "ADAPTIVE" };
+
+// Trains indexed per switch per tick (4 approaches x 2 tiles, plus trains
+// sharing a tile); more are left out of the decision.
+const int MAX_APPROACH_TRAINS = 16;
+
+// Cost of a route that crashes or circles (more than any route's tiles;
+// MAX_APPROACH_TRAINS of them still fit in an int).
+const int NEVER_COST = 1 << 20;
+
+// Approach index of the current tick: train and distance per switch
+static int approachTrain[MAX_SWITCHES][MAX_APPROACH_TRAINS];
+static int approachDepth[MAX_SWITCHES][MAX_APPROACH_TRAINS];
+static int approachCount[MAX_SWITCHES];
+
+bool parseSwitchPolicy(const std::string& name, SwitchPolicy& policy) {
+    std::string upper = name;
+    std::transform(upper.begin(), upper.end(), upper.begin(), ::toupper);
+    for (int p = 0; p < NUM_SWITCH_POLICIES; p++) {
+        if (upper == switchPolicyNames[p]) {
+            policy = (SwitchPolicy)p;
+            return true;
+        }
+    }
+    return false;
+}
+
+// ----------------------------------------------------------------------------
+// INDEX APPROACHING TRAINS
+// ----------------------------------------------------------------------------
+// A train approaches a switch if the switch is the next tile ahead, or the
+// one after a plain straight tile.
+// ----------------------------------------------------------------------------
+static void noteApproach(int switchIndex, int trainIndex, int depth) {
+    if (switchIndex < 0 || switchIndex >= numSwitches) return;
+    int n = approachCount[switchIndex];
+    if (n == MAX_APPROACH_TRAINS) return;
+    approachTrain[switchIndex][n] = trainIndex;
+    approachDepth[switchIndex][n] = depth;
+    approachCount[switchIndex] = n + 1;
+}
+
+static void indexApproachingTrains() {
+    for (int sw = 0; sw < numSwitches; sw++) approachCount[sw] = 0;
+
+    for (int i = 0; i < numTrains; i++) {
+        if (trains[i][TRAIN_STATE] != TRAIN_ACTIVE) continue;
+        int dir = trains[i][TRAIN_DIRECTION];
+        int x = trains[i][TRAIN_X] + dx[dir];
+        int y = trains[i][TRAIN_Y] + dy[dir];
+        if (isSwitchTile(x, y)) {
+            noteApproach(getSwitchIndex(getTile(x, y)), i, 1);
+            continue;
+        }
+
+        char between = isInBounds(x, y) ? getTile(x, y) : ' ';
+        if (between != '-' && between != '|' && between != '=') continue;
+        x += dx[dir];
+        y += dy[dir];
+        if (isSwitchTile(x, y)) noteApproach(getSwitchIndex(getTile(x, y)), i, 2);
+    }
+}
+
+// ----------------------------------------------------------------------------
+// ENTERS NEXT TICK
+// ----------------------------------------------------------------------------
+// A flip queued now is applied after this tick's moves, so it decides the
+// exit of trains entering the switch next tick: the one two tiles out if it
+// moves now, or the one next to the switch if it is held for RAIN now.
+// ----------------------------------------------------------------------------
+static bool entersNextTick(int trainIndex, int depth) {
+    bool held = trains[trainIndex][TRAIN_RAIN_HOLD] > 0;
+    return depth == (held ? 1 : 2);
+}
+
+// ----------------------------------------------------------------------------
+// ROUTE COST
+// ----------------------------------------------------------------------------
+// Tiles a train would travel from the switch to its destination if it
+// entered heading entryDir with the switch in state (same exits as
+// getNextDirection()).
+// ----------------------------------------------------------------------------
+static int routeCost(int switchIndex, int trainIndex, int entryDir, int state) {
+    int exitDir = (state == 0) ? entryDir : (entryDir + 1) % 4;
+    int nextExit;
+    int tiles = queryReach(switches[switchIndex][SWITCH_X], switches[switchIndex][SWITCH_Y], exitDir,
+                           trains[trainIndex][TRAIN_DEST_X], trains[trainIndex][TRAIN_DEST_Y], nextExit);
+    return (tiles == REACH_NEVER) ? NEVER_COST : tiles;
+}
+
+// ----------------------------------------------------------------------------
+// QUEUE ADAPTIVE FLIPS
+// ----------------------------------------------------------------------------
+// Flip only if the other state is strictly cheaper for the trains entering
+// next tick, so a switch nobody is about to enter keeps its state.
+// ----------------------------------------------------------------------------
+void queueAdaptiveFlips() {
+    indexApproachingTrains();
+
+    for (int sw = 0; sw < numSwitches; sw++) {
+        if (approachCount[sw] == 0) continue;
+
+        int current = switches[sw][SWITCH_CURRENT_STATE];
+        int cost[2] = { 0, 0 };
+        for (int n = 0; n < approachCount[sw]; n++) {
+            int i = approachTrain[sw][n];
+            if (!entersNextTick(i, approachDepth[sw][n])) continue;
+            for (int state = 0; state < 2; state++) {
+                cost[state] += routeCost(sw, i, trains[i][TRAIN_DIRECTION], state);
+            }
+        }
+
+        if (cost[1 - current] < cost[current]) {
+            switches[sw][SWITCH_FLIP_QUEUED] = 1;
+        }
+    }
+}
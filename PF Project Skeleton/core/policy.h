@@ -0,0 +1,39 @@
+#ifndef POLICY_H
+#define POLICY_H
+
+#include "simulation_state.h"
+
+// ============================================================================
+// POLICY.H - Switch control policies
+// ============================================================================
+// Phase 4 of every engine asks the level's policy (switchPolicy, POLICY:
+// section or --policy) which switches to flip after movement:
+//
+// COUNTERS  Flip when a direction (PER_DIR) or the global counter reaches
+//           its K-value (switches.cpp). The default.
+// ADAPTIVE  Flip when the other state serves the trains about to enter the
+//           switch better. Every train heading into a switch from one or
+//           two tiles away is indexed by switch once per tick. Those that
+//           will enter it next tick (two tiles out and moving, or next to it
+//           and held for RAIN) are costed for each state: the tiles each
+//           would still travel to its destination, looked up in the
+//           reachability cache (reach.h), with a route that crashes or
+//           circles costing more than any other. K-values and counters are
+//           ignored.
+//
+// The approach window is two tiles because the segment tick keeps every
+// train within two tiles of a switch awake, so all engines see the same
+// positions.
+// ============================================================================
+
+// Policy names as written in the POLICY: section and for --policy.
+extern const char* switchPolicyNames[NUM_SWITCH_POLICIES];
+
+// Policy for a name in any case ("adaptive" = "ADAPTIVE"); false if unknown.
+bool parseSwitchPolicy(const std::string& name, SwitchPolicy& policy);
+
+// Phase 4 under SWITCH_POLICY_ADAPTIVE: set SWITCH_FLIP_QUEUED on the
+// switches to flip.
+void queueAdaptiveFlips();
+
+#endif
@@ -0,0 +1,376 @@
+#include "reach.h"
+#include "simulation_state.h"
+#include "trains.h"
+#include "grid.h"
+
+// ============================================================================
+// REACH.CPP - Switch-aware reachability cache
+// ============================================================================
+
+// States are (tile, direction) pairs keyed (x * MAX_COLS + y) * 4 + dir;
+// a node is a decision tile keyed the same way with its entry direction.
+const int NUM_STATE_KEYS = MAX_ROWS * MAX_COLS * 4;
+
+// Chain ids: chains ending at a node use the node key, chains ending in a
+// crash CRASH_CHAIN + key of their last state, closed loops of plain track
+// LOOP_CHAIN + loop number.
+const int CRASH_CHAIN = NUM_STATE_KEYS;
+const int LOOP_CHAIN = 2 * NUM_STATE_KEYS;
+const int MAX_LOOPS = NUM_STATE_KEYS / 4;
+const int CHAIN_UNSET = -1;
+const int CHAIN_BUILDING = -2;
+
+// Cached node answers (power of two). Cleared between queries when half
+// full; a query that would fill it further falls back to walking.
+const int REACH_TABLE_SIZE = 1 << 17;
+const int REACH_PENDING = -2;
+
+// ----------------------------------------------------------------------------
+// CHAINS (built once per level)
+// ----------------------------------------------------------------------------
+// chainPos: tiles to the chain's end node (or crash), or the position on a
+// loop.
+int chainOf[NUM_STATE_KEYS];
+int chainPos[NUM_STATE_KEYS];
+int loopLength[MAX_LOOPS];
+int numLoops = 0;
+bool chainsReady = false;
+
+// Walk stack while building chains and while answering a query.
+int reachStack[NUM_STATE_KEYS];
+int reachStackSteps[NUM_STATE_KEYS];
+
+// ----------------------------------------------------------------------------
+// NODE ANSWERS
+// ----------------------------------------------------------------------------
+// Valid while reachGen matches and no switch in reachMask flipped after
+// reachTime (-1 until computed). reachDist counts tiles from the node tile
+// (REACH_NEVER, or REACH_PENDING while its walk is still open).
+unsigned long long reachKey[REACH_TABLE_SIZE];
+int reachGen[REACH_TABLE_SIZE];
+int reachDist[REACH_TABLE_SIZE];
+unsigned int reachMask[REACH_TABLE_SIZE];
+int reachTime[REACH_TABLE_SIZE];
+int reachTableGen = 1;
+int reachTableUsed = 0;
+
+// Flip clock and the time each switch last flipped.
+int reachClock = 0;
+int switchFlipTime[MAX_SWITCHES];
+
+// ----------------------------------------------------------------------------
+// HELPERS
+// ----------------------------------------------------------------------------
+static int stateKey(int x, int y, int dir) {
+    return (x * MAX_COLS + y) * 4 + dir;
+}
+
+static bool isDecisionTile(int x, int y) {
+    return isSwitchTile(x, y) || getTile(x, y) == '+';
+}
+
+// Direction a train leaves (x, y) in after entering it heading dir.
+static int exitDirection(int x, int y, int dir, int destX, int destY) {
+    if (getTile(x, y) == '+') return getCrossingDirectionTo(x, y, dir, destX, destY);
+    return getNextDirection(x, y, dir, -1);
+}
+
+// ----------------------------------------------------------------------------
+// RESET / FLIPS
+// ----------------------------------------------------------------------------
+void resetReachCache() {
+    chainsReady = false;
+    reachTableGen++;
+    reachTableUsed = 0;
+}
+
+void noteSwitchFlipped(int switchIndex) {
+    if (switchIndex < 0 || switchIndex >= MAX_SWITCHES) return;
+    switchFlipTime[switchIndex] = ++reachClock;
+}
+
+// ----------------------------------------------------------------------------
+// BUILD CHAINS
+// ----------------------------------------------------------------------------
+// Plain track gives every state one successor and one predecessor, so the
+// states between decision tiles form simple paths and loops. Each unvisited
+// state is followed until a decision tile, a crash, an already built state
+// or (for a loop) itself, then the walk is numbered backwards.
+// ----------------------------------------------------------------------------
+static void buildChain(int x, int y, int dir) {
+    int depth = 0;
+    int endChain = CHAIN_UNSET, endPos = 0;
+
+    while (true) {
+        int key = stateKey(x, y, dir);
+        chainOf[key] = CHAIN_BUILDING;
+        reachStack[depth++] = key;
+
+        int nextX = x + dx[dir];
+        int nextY = y + dy[dir];
+        if (!isInBounds(nextX, nextY) || !isTrackTile(nextX, nextY)) {
+            endChain = CRASH_CHAIN + key;
+            endPos = 1;
+            break;
+        }
+        if (isDecisionTile(nextX, nextY)) {
+            endChain = stateKey(nextX, nextY, dir);
+            endPos = 1;
+            break;
+        }
+
+        int nextDir = getNextDirection(nextX, nextY, dir, -1);
+        int nextKey = stateKey(nextX, nextY, nextDir);
+        if (chainOf[nextKey] == CHAIN_BUILDING) {
+            // Back at the first state: a loop with no decision tile
+            int loop = numLoops < MAX_LOOPS ? numLoops++ : MAX_LOOPS - 1;
+            loopLength[loop] = depth;
+            for (int d = 0; d < depth; d++) {
+                chainOf[reachStack[d]] = LOOP_CHAIN + loop;
+                chainPos[reachStack[d]] = d;
+            }
+            return;
+        }
+        if (chainOf[nextKey] != CHAIN_UNSET) {
+            endChain = chainOf[nextKey];
+            endPos = chainPos[nextKey] + 1;
+            break;
+        }
+        x = nextX;
+        y = nextY;
+        dir = nextDir;
+    }
+
+    for (int d = depth - 1; d >= 0; d--) {
+        chainOf[reachStack[d]] = endChain;
+        chainPos[reachStack[d]] = endPos + (depth - 1 - d);
+    }
+}
+
+static void buildChains() {
+    for (int x = 0; x < gridRows; x++) {
+        for (int y = 0; y < gridCols; y++) {
+            for (int dir = 0; dir < 4; dir++) chainOf[stateKey(x, y, dir)] = CHAIN_UNSET;
+        }
+    }
+    numLoops = 0;
+
+    for (int x = 0; x < gridRows; x++) {
+        for (int y = 0; y < gridCols; y++) {
+            if (!isTrackTile(x, y)) continue;
+            for (int dir = 0; dir < 4; dir++) {
+                if (chainOf[stateKey(x, y, dir)] == CHAIN_UNSET) buildChain(x, y, dir);
+            }
+        }
+    }
+    chainsReady = true;
+}
+
+void prepareReachCache() {
+    if (!chainsReady) buildChains();
+}
+
+// ----------------------------------------------------------------------------
+// ARRIVAL ON A CHAIN
+// ----------------------------------------------------------------------------
+// Tiles from state key to the first visit of (destX, destY) further along
+// the same chain, or REACH_NEVER.
+// ----------------------------------------------------------------------------
+static int arrivalOnChain(int key, int destX, int destY) {
+    if (!isInBounds(destX, destY)) return REACH_NEVER;
+    int chain = chainOf[key];
+    int best = REACH_NEVER;
+
+    for (int dir = 0; dir < 4; dir++) {
+        int destKey = stateKey(destX, destY, dir);
+        if (chainOf[destKey] != chain) continue;
+
+        int steps;
+        if (chain >= LOOP_CHAIN) {
+            int length = loopLength[chain - LOOP_CHAIN];
+            steps = (chainPos[destKey] - chainPos[key] + length) % length;
+        } else {
+            steps = chainPos[key] - chainPos[destKey];
+        }
+        if (steps > 0 && (best == REACH_NEVER || steps < best)) best = steps;
+    }
+    return best;
+}
+
+// ----------------------------------------------------------------------------
+// NODE ANSWER TABLE
+// ----------------------------------------------------------------------------
+static unsigned long long nodeDestKey(int node, int destX, int destY) {
+    return ((unsigned long long)node << 20) | (unsigned long long)(destX * MAX_COLS + destY);
+}
+
+// Slot holding key, or the empty slot where it would go.
+static int findSlot(unsigned long long key) {
+    unsigned int slot = (unsigned int)((key * 0x9E3779B97F4A7C15ULL) >> 47) & (REACH_TABLE_SIZE - 1);
+    while (reachGen[slot] == reachTableGen && reachKey[slot] != key) {
+        slot = (slot + 1) & (REACH_TABLE_SIZE - 1);
+    }
+    return (int)slot;
+}
+
+static bool isFresh(int slot) {
+    if (reachGen[slot] != reachTableGen || reachTime[slot] < 0) return false;
+    for (unsigned int mask = reachMask[slot]; mask; mask &= mask - 1) {
+        if (switchFlipTime[__builtin_ctz(mask)] > reachTime[slot]) return false;
+    }
+    return true;
+}
+
+static int claimSlot(unsigned long long key) {
+    int slot = findSlot(key);
+    if (reachGen[slot] != reachTableGen) {
+        reachGen[slot] = reachTableGen;
+        reachKey[slot] = key;
+        reachDist[slot] = REACH_NEVER;
+        reachTime[slot] = -1;
+        reachTableUsed++;
+    }
+    return slot;
+}
+
+// ----------------------------------------------------------------------------
+// NODE ANSWER
+// ----------------------------------------------------------------------------
+// Follows decision tiles from node until an arrival, a crash, a fresh cached
+// answer or a node already on this walk (a loop through switches or
+// crossings), then fills in every node on the walk from the end backwards.
+// Returns REACH_PENDING if the table filled up (caller walks instead).
+// ----------------------------------------------------------------------------
+static int nodeAnswer(int node, int destX, int destY) {
+    int firstSlot = -1;
+    int depth = 0;
+    int tailDist = REACH_NEVER;
+    unsigned int tailMask = 0;
+    int loopStart = -1;
+
+    while (true) {
+        if (reachTableUsed >= REACH_TABLE_SIZE * 3 / 4) {
+            reachTableGen++;
+            reachTableUsed = 0;
+            return REACH_PENDING;
+        }
+        int slot = claimSlot(nodeDestKey(node, destX, destY));
+        if (firstSlot < 0) firstSlot = slot;
+
+        if (reachDist[slot] == REACH_PENDING) {
+            for (loopStart = 0; reachStack[loopStart] != slot; loopStart++) {}
+            break;
+        }
+        if (isFresh(slot)) {
+            tailDist = reachDist[slot];
+            tailMask = reachMask[slot];
+            break;
+        }
+
+        int tile = node / 4;
+        int x = tile / MAX_COLS, y = tile % MAX_COLS;
+        int dir = exitDirection(x, y, node % 4, destX, destY);
+        int switchIndex = isSwitchTile(x, y) ? getSwitchIndex(getTile(x, y)) : -1;
+
+        reachDist[slot] = REACH_PENDING;
+        reachMask[slot] = (switchIndex >= 0) ? 1u << switchIndex : 0u;
+        reachTime[slot] = reachClock;
+        reachStack[depth] = slot;
+
+        int key = stateKey(x, y, dir);
+        int arrival = arrivalOnChain(key, destX, destY);
+        int chain = chainOf[key];
+        if (arrival != REACH_NEVER || chain >= CRASH_CHAIN) {
+            reachStackSteps[depth++] = 0;
+            tailDist = arrival;
+            break;
+        }
+
+        reachStackSteps[depth++] = chainPos[key];
+        node = chain;
+        if (node / 4 == destX * MAX_COLS + destY) {
+            tailDist = 0;
+            break;
+        }
+    }
+
+    if (loopStart >= 0) {
+        unsigned int loopMask = 0;
+        for (int d = loopStart; d < depth; d++) loopMask |= reachMask[reachStack[d]];
+        for (int d = loopStart; d < depth; d++) {
+            reachDist[reachStack[d]] = REACH_NEVER;
+            reachMask[reachStack[d]] = loopMask;
+        }
+        depth = loopStart;
+        tailMask = loopMask;
+    }
+
+    for (int d = depth - 1; d >= 0; d--) {
+        int slot = reachStack[d];
+        if (tailDist != REACH_NEVER) tailDist += reachStackSteps[d];
+        reachDist[slot] = tailDist;
+        reachMask[slot] |= tailMask;
+        tailMask = reachMask[slot];
+    }
+    return reachDist[firstSlot];
+}
+
+// ----------------------------------------------------------------------------
+// QUERIES
+// ----------------------------------------------------------------------------
+int queryReach(int x, int y, int dir, int destX, int destY, int& nextExit) {
+    nextExit = -1;
+    if (x == destX && y == destY) return 0;
+    if (!isInBounds(x, y) || !isTrackTile(x, y)) return REACH_NEVER;
+
+    if (!chainsReady) buildChains();
+    if (reachTableUsed > REACH_TABLE_SIZE / 2) {
+        reachTableGen++;
+        reachTableUsed = 0;
+    }
+
+    int key = stateKey(x, y, dir);
+    int arrival = arrivalOnChain(key, destX, destY);
+    if (arrival != REACH_NEVER) return arrival;
+
+    int chain = chainOf[key];
+    if (chain >= CRASH_CHAIN) return REACH_NEVER;
+
+    int steps = chainPos[key];
+    int nodeX = (chain / 4) / MAX_COLS, nodeY = (chain / 4) % MAX_COLS;
+    if (nodeX == destX && nodeY == destY) return steps;
+    nextExit = exitDirection(nodeX, nodeY, chain % 4, destX, destY);
+
+    int rest = nodeAnswer(chain, destX, destY);
+    if (rest == REACH_PENDING) return walkTilesToDestination(x, y, dir, destX, destY);
+    return (rest == REACH_NEVER) ? REACH_NEVER : steps + rest;
+}
+
+int getTrainTilesToDestination(int trainIndex) {
+    if (trainIndex < 0 || trainIndex >= numTrains) return REACH_NEVER;
+    if (trains[trainIndex][TRAIN_STATE] != TRAIN_ACTIVE) return REACH_NEVER;
+    int nextExit;
+    return queryReach(trains[trainIndex][TRAIN_X], trains[trainIndex][TRAIN_Y],
+                      trains[trainIndex][TRAIN_DIRECTION],
+                      trains[trainIndex][TRAIN_DEST_X], trains[trainIndex][TRAIN_DEST_Y], nextExit);
+}
+
+// ----------------------------------------------------------------------------
+// WALK (reference)
+// ----------------------------------------------------------------------------
+// A route longer than the number of (tile, direction) states repeats one,
+// so it circles forever.
+// ----------------------------------------------------------------------------
+int walkTilesToDestination(int x, int y, int dir, int destX, int destY) {
+    if (x == destX && y == destY) return 0;
+    int limit = 4 * gridRows * gridCols;
+
+    for (int steps = 1; steps <= limit; steps++) {
+        x += dx[dir];
+        y += dy[dir];
+        if (!isInBounds(x, y) || !isTrackTile(x, y)) return REACH_NEVER;
+        if (x == destX && y == destY) return steps;
+        dir = exitDirection(x, y, dir, destX, destY);
+    }
+    return REACH_NEVER;
+}
@@ -0,0 +1,54 @@
+#ifndef REACH_H
+#define REACH_H
+
+// ============================================================================
+// REACH.H - Switch-aware reachability cache
+// ============================================================================
+// Answers "will a train at (x, y) heading dir reach (destX, destY) under the
+// current switch states, and after how many tiles" without walking the track.
+//
+// Track between switches and crossings never changes, so it is compiled once
+// per level into chains: every (tile, direction) knows how far it is to the
+// next decision tile and which one. Answers from a decision tile onwards are
+// cached per (tile, entry direction, destination) together with the set of
+// switches the route passes. Flipping a switch only invalidates the answers
+// whose route runs through it; they are recomputed the next time they are
+// asked for.
+//
+// Crossings are taken the default way (getSmartDirectionAtCrossing), so
+// --reserve steering is not reflected.
+// ============================================================================
+
+// Returned when the train would crash or circle forever.
+const int REACH_NEVER = -1;
+
+// ----------------------------------------------------------------------------
+// SETUP
+// ----------------------------------------------------------------------------
+// Drop all cached answers and chains (new level, or switch states were set
+// directly instead of through flips).
+void resetReachCache();
+
+// Invalidate the answers whose route passes a switch (called on every flip).
+void noteSwitchFlipped(int switchIndex);
+
+// Compile the chains now instead of at the first query (before forking runs
+// that will query, so they share them).
+void prepareReachCache();
+
+// ----------------------------------------------------------------------------
+// QUERIES
+// ----------------------------------------------------------------------------
+// Tiles still to travel from (x, y) heading dir to (destX, destY), or
+// REACH_NEVER. nextExit gets the direction the train will leave the next
+// switch or crossing on the way (-1 if it arrives or crashes first).
+int queryReach(int x, int y, int dir, int destX, int destY, int& nextExit);
+
+// Tiles an active train still has to travel, or REACH_NEVER. Under
+// --segments, call syncTrainPositions() first.
+int getTrainTilesToDestination(int trainIndex);
+
+// Same answer by following the track tile by tile (reference for checks).
+int walkTilesToDestination(int x, int y, int dir, int destX, int destY);
+
+#endif
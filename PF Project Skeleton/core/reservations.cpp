@@ -0,0 +1,70 @@
+#include "reservations.h"
+#include "simulation_state.h"
+
+// ============================================================================
+// RESERVATIONS.CPP - Space-time reservation table
+// ============================================================================
+
+// Slot contents: key = (x * MAX_COLS + y) * (MAX_RESERVE_HORIZON + 1) + offset
+int reserveKey[RESERVE_TABLE_SIZE];
+int reserveOwner[RESERVE_TABLE_SIZE];
+int reserveUsed[RESERVE_TABLE_SIZE];
+int numReserveUsed = 0;
+bool reserveTableReady = false;
+
+// ----------------------------------------------------------------------------
+// FIND SLOT for a key (its slot, or the empty slot where it would go)
+// ----------------------------------------------------------------------------
+static int findSlot(int key) {
+    if (!reserveTableReady) {
+        for (int s = 0; s < RESERVE_TABLE_SIZE; s++) reserveKey[s] = -1;
+        reserveTableReady = true;
+    }
+
+    unsigned int slot = ((unsigned int)key * 2654435761u) & (RESERVE_TABLE_SIZE - 1);
+    while (reserveKey[slot] != -1 && reserveKey[slot] != key) {
+        slot = (slot + 1) & (RESERVE_TABLE_SIZE - 1);
+    }
+    return (int)slot;
+}
+
+static int makeKey(int x, int y, int offset) {
+    return (x * MAX_COLS + y) * (MAX_RESERVE_HORIZON + 1) + offset;
+}
+
+// ----------------------------------------------------------------------------
+// CLEAR RESERVATIONS
+// ----------------------------------------------------------------------------
+void clearReservations() {
+    for (int u = 0; u < numReserveUsed; u++) {
+        reserveKey[reserveUsed[u]] = -1;
+    }
+    numReserveUsed = 0;
+}
+
+// ----------------------------------------------------------------------------
+// GET RESERVATION
+// ----------------------------------------------------------------------------
+int getReservation(int x, int y, int offset) {
+    int slot = findSlot(makeKey(x, y, offset));
+    return (reserveKey[slot] == -1) ? -1 : reserveOwner[slot];
+}
+
+// ----------------------------------------------------------------------------
+// SET RESERVATION
+// ----------------------------------------------------------------------------
+int setReservation(int x, int y, int offset, int trainIndex) {
+    int key = makeKey(x, y, offset);
+    int slot = findSlot(key);
+    if (reserveKey[slot] == -1) {
+        // Never fills up: at most MAX_TRAINS * MAX_RESERVE_HORIZON keys
+        reserveKey[slot] = key;
+        reserveOwner[slot] = trainIndex;
+        reserveUsed[numReserveUsed++] = slot;
+        return -1;
+    }
+
+    int previous = reserveOwner[slot];
+    reserveOwner[slot] = trainIndex;
+    return previous;
+}
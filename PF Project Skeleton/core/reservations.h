@@ -0,0 +1,30 @@
+#ifndef RESERVATIONS_H
+#define RESERVATIONS_H
+
+// ============================================================================
+// RESERVATIONS.H - Space-time reservation table (cell, tick offset) -> train
+// ============================================================================
+// Open-addressing hash table sized for MAX_TRAINS trains reserving up to
+// MAX_RESERVE_HORIZON ticks each. Used slots are remembered, so clearing
+// costs O(reservations made), not O(table size).
+// ============================================================================
+
+// Most ticks a train can reserve ahead. Only offset 1 holds trains and only
+// offset 2 steers crossing choices (planReservations()); a tile reserved
+// further ahead could only steer a choice no move ever uses.
+const int MAX_RESERVE_HORIZON = 2;
+
+// Table slots (power of two, at least twice the most reservations).
+const int RESERVE_TABLE_SIZE = 1 << 18;
+
+// Remove all reservations.
+void clearReservations();
+
+// Train holding (x, y) at tick offset, or -1.
+int getReservation(int x, int y, int offset);
+
+// Reserve (x, y) at tick offset for a train (replacing any holder).
+// Returns the previous holder, or -1.
+int setReservation(int x, int y, int offset, int trainIndex);
+
+#endif
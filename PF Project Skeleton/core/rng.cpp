@@ -0,0 +1,38 @@
+#include "rng.h"
+#include "simulation_state.h"
+
+// ============================================================================
+// RNG.CPP - Counter-based random numbers
+// ============================================================================
+
+// ----------------------------------------------------------------------------
+// MIX (SplitMix64 finaliser)
+// ----------------------------------------------------------------------------
+static unsigned long long mix(unsigned long long x) {
+    x += 0x9E3779B97F4A7C15ULL;
+    x = (x ^ (x >> 30)) * 0xBF58476D1CE4E5B9ULL;
+    x = (x ^ (x >> 27)) * 0x94D049BB133111EBULL;
+    return x ^ (x >> 31);
+}
+
+// ----------------------------------------------------------------------------
+// RNG BITS
+// ----------------------------------------------------------------------------
+// Each key part goes through its own mixing round so that nearby keys
+// (consecutive ticks or train ids) give unrelated values.
+// ----------------------------------------------------------------------------
+unsigned long long rngBits(int stream, int tick, int id) {
+    unsigned long long x = mix((unsigned long long)(unsigned int)seed ^ ((unsigned long long)stream << 32));
+    x = mix(x ^ (unsigned int)tick);
+    return mix(x ^ (unsigned int)id);
+}
+
+// ----------------------------------------------------------------------------
+// RNG RANGE
+// ----------------------------------------------------------------------------
+// Multiply-shift on the top 32 bits (no modulo bias worth caring about here).
+// ----------------------------------------------------------------------------
+int rngRange(int stream, int tick, int id, int range) {
+    unsigned long long high = rngBits(stream, tick, id) >> 32;
+    return (int)((high * (unsigned long long)range) >> 32);
+}
@@ -0,0 +1,28 @@
+#ifndef RNG_H
+#define RNG_H
+
+// ============================================================================
+// RNG.H - Counter-based random numbers keyed by (seed, stream, tick, id)
+// ============================================================================
+// Every value is a pure function of the level SEED and its key, so there is
+// no generator state to share between threads or to advance in order. The
+// same key gives the same value no matter which thread asks, in which order,
+// or whether earlier ticks were skipped.
+// ============================================================================
+
+// ----------------------------------------------------------------------------
+// STREAMS (one per kind of random decision)
+// ----------------------------------------------------------------------------
+const int RNG_STREAM_RAIN = 1;   // RAIN slowdown length (tick, train id)
+const int RNG_STREAM_SPAWN = 2;  // Spawn jitter (0, train id)
+
+// ----------------------------------------------------------------------------
+// DRAWS
+// ----------------------------------------------------------------------------
+// 64 random bits for the key (SplitMix64 mixing of seed, stream, tick, id).
+unsigned long long rngBits(int stream, int tick, int id);
+
+// Random integer in [0, range) for the key (range > 0).
+int rngRange(int stream, int tick, int id, int range);
+
+#endif
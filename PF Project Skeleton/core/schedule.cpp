@@ -0,0 +1,158 @@
+#include "schedule.h"
+#include "simulation_state.h"
+#include "io.h"
+#include "metrics.h"
+#include "rng.h"
+#include <fstream>
+#include <iostream>
+#include <sstream>
+
+// ============================================================================
+// SCHEDULE.CPP - Streaming train schedule
+// ============================================================================
+
+static std::ifstream scheduleFile;
+static std::istream* scheduleIn = nullptr;
+static bool scheduleFromLevel = false;   // Stop at the next section header
+static bool scheduleEnded = true;        // No more lines to read
+
+// Line read ahead of its tick
+static std::string pendingLine;
+static int pendingTick = 0;
+static bool hasPendingLine = false;
+static int lastTick = 0;                 // Tick of the previous line read
+static bool warnedOrder = false;         // Out-of-order warning printed
+
+static int nextTrainID = 0;
+
+// Free slots (stack) and which slots are on it
+static int freeSlots[MAX_TRAINS];
+static int numFreeSlots = 0;
+static bool slotFree[MAX_TRAINS];
+
+// ----------------------------------------------------------------------------
+// OPEN TRAIN SCHEDULE
+// ----------------------------------------------------------------------------
+bool openTrainSchedule(const std::string& source, const std::string& levelFile) {
+    if (scheduleFile.is_open()) scheduleFile.close();
+    scheduleFile.clear();
+    scheduleIn = nullptr;
+    scheduleEnded = true;
+    hasPendingLine = false;
+    lastTick = 0;
+    warnedOrder = false;
+    nextTrainID = 0;
+    numFreeSlots = 0;
+    for (int i = 0; i < MAX_TRAINS; i++) slotFree[i] = false;
+
+    scheduleFromLevel = (source == "level");
+    if (source == "-") {
+        scheduleIn = &std::cin;
+    } else {
+        scheduleFile.open(scheduleFromLevel ? levelFile.c_str() : source.c_str());
+        if (!scheduleFile.is_open()) {
+            std::cerr << "Error: Could not open train schedule: " << source << std::endl;
+            return false;
+        }
+        scheduleIn = &scheduleFile;
+    }
+
+    // The level's schedule starts after its TRAINS: header
+    if (scheduleFromLevel) {
+        std::string line;
+        while (std::getline(*scheduleIn, line) && line.find("TRAINS:") != 0) {}
+    }
+    scheduleEnded = false;
+    return true;
+}
+
+// ----------------------------------------------------------------------------
+// READ NEXT LINE (blank lines and # comments skipped)
+// ----------------------------------------------------------------------------
+static bool readNextTrainLine() {
+    while (!scheduleEnded && std::getline(*scheduleIn, pendingLine)) {
+        if (pendingLine.empty() || pendingLine[0] == '#' || pendingLine[0] == '\r') continue;
+
+        // Another level section ends the TRAINS section
+        if (scheduleFromLevel && pendingLine.find(':') != std::string::npos) break;
+
+        std::istringstream iss(pendingLine);
+        if (!(iss >> pendingTick)) continue;
+
+        // Lines are read ahead only up to the current tick, so a line after a
+        // later one spawns late; say so once rather than reorder
+        if (pendingTick < lastTick && !warnedOrder) {
+            std::cerr << "Warning: Train schedule is not in spawn-tick order (tick " << pendingTick
+                      << " after " << lastTick << "); late lines spawn when read" << std::endl;
+            warnedOrder = true;
+        }
+        lastTick = pendingTick;
+        hasPendingLine = true;
+        return true;
+    }
+    scheduleEnded = true;
+    return false;
+}
+
+// ----------------------------------------------------------------------------
+// ADMIT SCHEDULED TRAINS
+// ----------------------------------------------------------------------------
+void admitScheduledTrains() {
+    while (hasPendingLine || readNextTrainLine()) {
+        if (pendingTick > currentTick) return;
+
+        // Next free slot, claimed only once the line parses
+        int slot;
+        if (numFreeSlots > 0) {
+            slot = freeSlots[numFreeSlots - 1];
+        } else if (numTrains < MAX_TRAINS) {
+            slot = numTrains;
+        } else {
+            return;
+        }
+
+        int trainID = nextTrainID;
+        hasPendingLine = false;
+        if (!parseTrainLine(pendingLine, slot, trainID)) {
+            std::cerr << "Warning: Skipping malformed train line: " << pendingLine << std::endl;
+            continue;
+        }
+
+        nextTrainID++;
+        if (numFreeSlots > 0) {
+            numFreeSlots--;
+            slotFree[slot] = false;
+        } else {
+            numTrains++;
+        }
+
+        // Same JITTER spread as a loaded level; late lines spawn now
+        if (spawnJitter > 0) {
+            trains[slot][TRAIN_SPAWN_TICK] += rngRange(RNG_STREAM_SPAWN, 0, trainID, spawnJitter + 1);
+        }
+        if (trains[slot][TRAIN_SPAWN_TICK] < currentTick) {
+            trains[slot][TRAIN_SPAWN_TICK] = currentTick;
+        }
+    }
+}
+
+// ----------------------------------------------------------------------------
+// RELEASE FINISHED TRAINS
+// ----------------------------------------------------------------------------
+void releaseFinishedTrains() {
+    for (int i = 0; i < numTrains; i++) {
+        if (slotFree[i]) continue;
+        if (trains[i][TRAIN_STATE] != TRAIN_DELIVERED && trains[i][TRAIN_STATE] != TRAIN_CRASHED) continue;
+
+        writeTrainRow(i);
+        slotFree[i] = true;
+        freeSlots[numFreeSlots++] = i;
+    }
+}
+
+// ----------------------------------------------------------------------------
+// IS SCHEDULE EXHAUSTED
+// ----------------------------------------------------------------------------
+bool isScheduleExhausted() {
+    return !hasPendingLine && !readNextTrainLine();
+}
@@ -0,0 +1,45 @@
+#ifndef SCHEDULE_H
+#define SCHEDULE_H
+
+#include <string>
+
+// ============================================================================
+// SCHEDULE.H - Streaming train schedule with slot recycling
+// ============================================================================
+// With streamingSchedule set, trains are not loaded with the level. At the
+// start of each tick, schedule lines (TRAINS format, in spawn-tick order) up
+// to the current tick are read into free train slots, and at the end of the
+// tick the slots of delivered and crashed trains go back on a free list.
+// Train IDs count up in schedule order and never repeat, whatever slot a
+// train occupies, so memory and per-tick loops grow with the most trains
+// alive at once, not with the total.
+// ============================================================================
+
+// ----------------------------------------------------------------------------
+// SETUP
+// ----------------------------------------------------------------------------
+// Open the schedule: "level" (the TRAINS section of levelFile, read lazily),
+// "-" (stdin) or a file of TRAINS lines. Call after loadLevelFile().
+// Returns false if the source cannot be opened.
+bool openTrainSchedule(const std::string& source, const std::string& levelFile);
+
+// ----------------------------------------------------------------------------
+// PER TICK
+// ----------------------------------------------------------------------------
+// Read the trains due by this tick into free slots (start of tick). Lines
+// whose tick has passed spawn now, with a warning the first time the
+// schedule goes back in time; malformed lines are skipped with a warning. If
+// all MAX_TRAINS slots are in use, reading waits for slots to free up.
+void admitScheduledTrains();
+
+// Return the slots of trains that finished this tick (end of tick), after
+// writing their trains.csv rows.
+void releaseFinishedTrains();
+
+// ----------------------------------------------------------------------------
+// QUERIES
+// ----------------------------------------------------------------------------
+// True once every schedule line has been read into a slot.
+bool isScheduleExhausted();
+
+#endif
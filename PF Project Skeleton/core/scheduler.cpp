@@ -0,0 +1,144 @@
+#include "scheduler.h"
+#include <chrono>
+#include <thread>
+
+// ============================================================================
+// SCHEDULER.CPP - Fixed-timestep tick scheduler
+// ============================================================================
+
+typedef std::chrono::steady_clock SchedulerClock;
+
+static const double SPEED_PRESETS[] = {0.25, 0.5, 1.0, 2.0, 5.0, 10.0, 100.0, 1000.0, 0.0};
+static const int NUM_SPEED_PRESETS = sizeof(SPEED_PRESETS) / sizeof(SPEED_PRESETS[0]);
+
+static double speedMultiplier = 1.0;
+static SchedulerClock::time_point nextTickTime;   // Deadline of the next tick
+static SchedulerClock::time_point frameStart;
+static int ticksThisFrame = 0;
+
+// Achieved rate: ticks counted over a window of at least one second
+static SchedulerClock::time_point windowStart;
+static int windowTicks = 0;
+static double achievedRate = 0.0;
+
+// ----------------------------------------------------------------------------
+// TICK PERIOD at the current speed (speed > 0)
+// ----------------------------------------------------------------------------
+static SchedulerClock::duration tickPeriod() {
+    std::chrono::duration<double> seconds(1.0 / (BASE_TICK_RATE * speedMultiplier));
+    return std::chrono::duration_cast<SchedulerClock::duration>(seconds);
+}
+
+static double secondsBetween(SchedulerClock::time_point from, SchedulerClock::time_point to) {
+    return std::chrono::duration<double>(to - from).count();
+}
+
+// ----------------------------------------------------------------------------
+// RATE WINDOW
+// ----------------------------------------------------------------------------
+static void updateRateWindow(SchedulerClock::time_point now) {
+    double elapsed = secondsBetween(windowStart, now);
+    if (elapsed < 1.0) return;
+    achievedRate = windowTicks / elapsed;
+    windowTicks = 0;
+    windowStart = now;
+}
+
+// ----------------------------------------------------------------------------
+// SETUP AND SPEED
+// ----------------------------------------------------------------------------
+void initializeScheduler(double speed) {
+    SchedulerClock::time_point now = SchedulerClock::now();
+    setSimulationSpeed(speed);
+    nextTickTime = now;
+    frameStart = now;
+    windowStart = now;
+    windowTicks = 0;
+    achievedRate = 0.0;
+}
+
+void setSimulationSpeed(double speed) {
+    bool wasUnlimited = (speedMultiplier == 0.0);
+    SchedulerClock::time_point lastTick = wasUnlimited ? SchedulerClock::now() : nextTickTime - tickPeriod();
+
+    if (speed <= 0.0) speedMultiplier = 0.0;
+    else if (speed < MIN_SPEED) speedMultiplier = MIN_SPEED;
+    else if (speed > MAX_SPEED) speedMultiplier = MAX_SPEED;
+    else speedMultiplier = speed;
+
+    if (speedMultiplier > 0.0) nextTickTime = lastTick + tickPeriod();
+}
+
+void changeSimulationSpeed(int step) {
+    // Current preset: the first one at or above the speed (unlimited last)
+    int preset = NUM_SPEED_PRESETS - 1;
+    if (speedMultiplier > 0.0) {
+        for (int p = 0; p < NUM_SPEED_PRESETS - 1; p++) {
+            if (SPEED_PRESETS[p] >= speedMultiplier) {
+                preset = p;
+                break;
+            }
+        }
+    }
+    preset += step;
+    if (preset < 0) preset = 0;
+    if (preset >= NUM_SPEED_PRESETS) preset = NUM_SPEED_PRESETS - 1;
+    setSimulationSpeed(SPEED_PRESETS[preset]);
+}
+
+double getSimulationSpeed() {
+    return speedMultiplier;
+}
+
+// ----------------------------------------------------------------------------
+// FRAME LOOP
+// ----------------------------------------------------------------------------
+void beginSchedulerFrame() {
+    SchedulerClock::time_point now = SchedulerClock::now();
+    frameStart = now;
+    ticksThisFrame = 0;
+    updateRateWindow(now);
+
+    if (speedMultiplier > 0.0 && now - nextTickTime > tickPeriod() * MAX_TICKS_PER_FRAME) {
+        nextTickTime = now;
+    }
+}
+
+bool isTickDue() {
+    SchedulerClock::time_point now = SchedulerClock::now();
+
+    if (speedMultiplier == 0.0) {
+        // Unlimited: at least one tick, then until the frame time is used
+        if (ticksThisFrame > 0 && secondsBetween(frameStart, now) >= FAST_FRAME_SECONDS) return false;
+    } else {
+        if (ticksThisFrame >= MAX_TICKS_PER_FRAME || now < nextTickTime) return false;
+        nextTickTime += tickPeriod();
+    }
+
+    ticksThisFrame++;
+    windowTicks++;
+    return true;
+}
+
+void waitForNextTick() {
+    if (speedMultiplier > 0.0) {
+        std::this_thread::sleep_until(nextTickTime);
+    }
+}
+
+void holdScheduler() {
+    if (speedMultiplier > 0.0) {
+        nextTickTime = SchedulerClock::now() + tickPeriod();
+    }
+}
+
+// ----------------------------------------------------------------------------
+// RATE REPORT
+// ----------------------------------------------------------------------------
+double getTargetTickRate() {
+    return BASE_TICK_RATE * speedMultiplier;
+}
+
+double getAchievedTickRate() {
+    return achievedRate;
+}
@@ -0,0 +1,71 @@
+#ifndef SCHEDULER_H
+#define SCHEDULER_H
+
+// ============================================================================
+// SCHEDULER.H - Fixed-timestep tick scheduler (steady clock)
+// ============================================================================
+// Ticks are due at fixed deadlines (start + n / rate) on a steady clock, so
+// the tick rate does not drift with tick cost or frame time. A loop that
+// falls behind runs several ticks per frame to catch up (up to
+// MAX_TICKS_PER_FRAME; a larger backlog is dropped). The rate is
+// BASE_TICK_RATE times a speed multiplier that can change at any time;
+// speed 0 runs ticks as fast as possible.
+// ============================================================================
+
+// Ticks per second at speed x1.
+const double BASE_TICK_RATE = 2.0;
+
+// Speed multiplier range (0 = as fast as possible).
+const double MIN_SPEED = 0.25;
+const double MAX_SPEED = 1000.0;
+
+// Most ticks run in one frame while catching up.
+const int MAX_TICKS_PER_FRAME = 100;
+
+// At unlimited speed a frame runs ticks for this long (keeps the window live).
+const double FAST_FRAME_SECONDS = 1.0 / 60.0;
+
+// ----------------------------------------------------------------------------
+// SETUP AND SPEED
+// ----------------------------------------------------------------------------
+// Start the clock (first tick due now).
+void initializeScheduler(double speed);
+
+// Set the multiplier (clamped to MIN_SPEED..MAX_SPEED, 0 = unlimited).
+// Keeps the phase of the schedule: the next deadline is one new period
+// after the last tick.
+void setSimulationSpeed(double speed);
+
+// Step to the next faster (+1) or slower (-1) preset
+// (0.25, 0.5, 1, 2, 5, 10, 100, 1000, unlimited).
+void changeSimulationSpeed(int step);
+
+// Current multiplier (0 = unlimited).
+double getSimulationSpeed();
+
+// ----------------------------------------------------------------------------
+// FRAME LOOP
+// ----------------------------------------------------------------------------
+// Start a frame: drop the backlog if more than MAX_TICKS_PER_FRAME behind.
+void beginSchedulerFrame();
+
+// True if another tick is due in this frame (advances the deadline).
+bool isTickDue();
+
+// Sleep until the next tick is due (no sleep at unlimited speed).
+void waitForNextTick();
+
+// While paused: keep the next deadline one period ahead, so resuming does
+// not try to catch up the paused time.
+void holdScheduler();
+
+// ----------------------------------------------------------------------------
+// RATE REPORT
+// ----------------------------------------------------------------------------
+// Ticks per second asked for (0 = unlimited).
+double getTargetTickRate();
+
+// Ticks per second actually run (measured over the last second or so).
+double getAchievedTickRate();
+
+#endif
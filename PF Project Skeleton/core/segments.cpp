@@ -0,0 +1,676 @@
+#include "segments.h"
+#include "simulation_state.h"
+#include "trains.h"
+#include "switches.h"
+#include "grid.h"
+#include "io.h"
+#include "metrics.h"
+#include "heatmap.h"
+#include "halt.h"
+#include <cstdlib>
+#include <cstring>
+#include <algorithm>
+
+// ============================================================================
+// SEGMENTS.CPP - Segment tick (trains coast along straight segments)
+// ============================================================================
+
+typedef unsigned long long BitWord;
+
+// Segments have at least two tiles, so there are at most half as many as tiles.
+const int MAX_SEGMENTS = MAX_ROWS * MAX_COLS / 2;
+
+// Fewest ticks worth sleeping for.
+const int MIN_COAST_TICKS = 2;
+
+// Wake-up buckets by tick; longer than any segment, so a bucket only ever
+// holds trains due on the same tick.
+const int WAKE_WHEEL_SIZE = 1024;
+
+// ----------------------------------------------------------------------------
+// SEGMENT TABLE (compiled once per level, again after a safety tile toggle)
+// ----------------------------------------------------------------------------
+// segmentOf: segment of each tile (-1 = decision point or not track).
+// segDir: direction of increasing offset (DIR_RIGHT or DIR_DOWN); offset 0
+// is the first tile.
+int segmentOf[MAX_ROWS][MAX_COLS];
+int segFirstX[MAX_SEGMENTS], segFirstY[MAX_SEGMENTS];
+int segDir[MAX_SEGMENTS], segLength[MAX_SEGMENTS];
+int numSegments = 0;
+bool segmentsReady = false;
+
+// Sleeping trains on a segment all head the same way (segSleepDir), one
+// tile apart or more, so they never meet. Each keeps a lane: its offset
+// minus the distance travelled since tick 0, modulo the segment length,
+// which stays fixed while it sleeps and differs from every other sleeper's.
+// laneTrain[segLaneBase[s] + lane] is the sleeper in that lane (-1 = none).
+int segSleepers[MAX_SEGMENTS];
+int segSleepDir[MAX_SEGMENTS];
+int segLaneBase[MAX_SEGMENTS];
+int laneTrain[MAX_ROWS * MAX_COLS];
+int numLanes = 0;
+
+// ----------------------------------------------------------------------------
+// TRAIN STATE
+// ----------------------------------------------------------------------------
+// awakeBits: active trains that are not asleep, walked in train index order.
+BitWord awakeBits[MAX_TRAINS / 64];
+
+// A sleeping train is at its trains[] position after tick sleepSync and
+// wakes at the start of tick sleepWake.
+int sleepSync[MAX_TRAINS], sleepWake[MAX_TRAINS];
+int sleepSegment[MAX_TRAINS], sleepLane[MAX_TRAINS];
+int sleeperList[MAX_TRAINS], sleeperPos[MAX_TRAINS];
+int numSleepers = 0;
+int wakeHead[WAKE_WHEEL_SIZE];
+int wakeNext[MAX_TRAINS], wakePrev[MAX_TRAINS];
+
+// Trains due to spawn, by (spawn tick, train index).
+int spawnOrder[MAX_TRAINS];
+int numSpawnOrder = 0, spawnCursor = 0;
+
+// ----------------------------------------------------------------------------
+// TICK SCRATCH
+// ----------------------------------------------------------------------------
+// Planned move per train (segPlanTick marks trains planned this tick),
+// planned trains in move order and the next position with the same target.
+int segMoveX[MAX_TRAINS], segMoveY[MAX_TRAINS], segMoveDist[MAX_TRAINS];
+int segPlanTick[MAX_TRAINS];
+int segOrder[MAX_TRAINS];
+int segNextSame[MAX_TRAINS];
+int numSegmentMoves = 0;
+
+// Off-track crashes (train index order) and arrivals of this tick.
+int segCrashes[MAX_TRAINS];
+int numSegmentCrashes = 0;
+int segArrivals[MAX_TRAINS];
+int numSegmentArrivals = 0;
+
+// Per-tile scratch, valid only where the stamp matches.
+int segTileStamp[MAX_ROWS][MAX_COLS];
+int segTileHead[MAX_ROWS][MAX_COLS];
+int segStampCounter = 0;
+
+// ----------------------------------------------------------------------------
+// HELPERS
+// ----------------------------------------------------------------------------
+static void setAwake(int i, bool awake) {
+    if (awake) {
+        awakeBits[i / 64] |= 1ULL << (i % 64);
+    } else {
+        awakeBits[i / 64] &= ~(1ULL << (i % 64));
+    }
+}
+
+// detectCollisions() order: distance descending, then train index.
+static bool moveBefore(int a, int b) {
+    if (segMoveDist[a] != segMoveDist[b]) return segMoveDist[a] > segMoveDist[b];
+    return a < b;
+}
+
+static bool spawnBefore(int a, int b) {
+    if (trains[a][TRAIN_SPAWN_TICK] != trains[b][TRAIN_SPAWN_TICK]) {
+        return trains[a][TRAIN_SPAWN_TICK] < trains[b][TRAIN_SPAWN_TICK];
+    }
+    return a < b;
+}
+
+static bool isOccupied(int x, int y, int stamp) {
+    return isInBounds(x, y) && segTileStamp[x][y] == stamp;
+}
+
+static int offsetOnSegment(int segment, int x, int y) {
+    return (segDir[segment] == DIR_RIGHT) ? y - segFirstY[segment] : x - segFirstX[segment];
+}
+
+// Lane slot of a train at the given offset after the given tick, heading dir.
+static int laneSlot(int segment, int offset, int dir, int tick) {
+    int travelled = (dir == segDir[segment]) ? tick : -tick;
+    int lane = (offset - travelled) % segLength[segment];
+    if (lane < 0) lane += segLength[segment];
+    return segLaneBase[segment] + lane;
+}
+
+// ----------------------------------------------------------------------------
+// RESET
+// ----------------------------------------------------------------------------
+void resetSegments() {
+    memset(awakeBits, 0, sizeof(awakeBits));
+    for (int b = 0; b < WAKE_WHEEL_SIZE; b++) wakeHead[b] = -1;
+    for (int i = 0; i < MAX_TRAINS; i++) segPlanTick[i] = -1;
+    numSleepers = 0;
+    segmentsReady = false;
+}
+
+// ----------------------------------------------------------------------------
+// COMPILE SEGMENTS
+// ----------------------------------------------------------------------------
+// A tile can be coasted over if it is plain straight track ('-' or '=' along
+// a row, '|' along a column), not a safety tile and more than two tiles from
+// every switch tile, including repeated letters on large maps (so a sleeping
+// train never changes a signal light or what the switch policy sees). Runs
+// of such tiles along the track's own axis become segments.
+// ----------------------------------------------------------------------------
+static bool isCoastTile(int x, int y, bool alongRow, bool nearSwitch[][MAX_COLS]) {
+    if (!isInBounds(x, y) || isSafetyTile(x, y) || nearSwitch[x][y]) return false;
+    char tile = getTile(x, y);
+    return alongRow ? (tile == '-' || tile == '=') : tile == '|';
+}
+
+static void addSegment(int firstX, int firstY, int dir, int length) {
+    int s = numSegments++;
+    segFirstX[s] = firstX;
+    segFirstY[s] = firstY;
+    segDir[s] = dir;
+    segLength[s] = length;
+    segSleepers[s] = 0;
+    segLaneBase[s] = numLanes;
+    for (int k = 0; k < length; k++) {
+        segmentOf[firstX + k * dx[dir]][firstY + k * dy[dir]] = s;
+        laneTrain[numLanes++] = -1;
+    }
+}
+
+static void buildSegments() {
+    static bool nearSwitch[MAX_ROWS][MAX_COLS];
+    memset(nearSwitch, 0, sizeof(nearSwitch));
+    for (int x = 0; x < gridRows; x++) {
+        for (int y = 0; y < gridCols; y++) {
+            if (!isSwitchTile(x, y)) continue;
+            for (int ax = -2; ax <= 2; ax++) {
+                for (int ay = abs(ax) - 2; ay <= 2 - abs(ax); ay++) {
+                    if (isInBounds(x + ax, y + ay)) nearSwitch[x + ax][y + ay] = true;
+                }
+            }
+        }
+    }
+
+    numSegments = 0;
+    numLanes = 0;
+    for (int x = 0; x < gridRows; x++) {
+        for (int y = 0; y < gridCols; y++) segmentOf[x][y] = -1;
+    }
+
+    // Runs along rows
+    for (int x = 0; x < gridRows; x++) {
+        int y = 0;
+        while (y < gridCols) {
+            int length = 0;
+            while (isCoastTile(x, y + length, true, nearSwitch)) length++;
+            if (length >= 2) addSegment(x, y, DIR_RIGHT, length);
+            y += std::max(length, 1);
+        }
+    }
+
+    // Runs along columns
+    for (int y = 0; y < gridCols; y++) {
+        int x = 0;
+        while (x < gridRows) {
+            int length = 0;
+            while (isCoastTile(x + length, y, false, nearSwitch)) length++;
+            if (length >= 2) addSegment(x, y, DIR_DOWN, length);
+            x += std::max(length, 1);
+        }
+    }
+
+    // Active trains start awake; scheduled ones are spawned from a sorted list
+    memset(awakeBits, 0, sizeof(awakeBits));
+    numSpawnOrder = 0;
+    spawnCursor = 0;
+    for (int i = 0; i < numTrains; i++) {
+        if (trains[i][TRAIN_STATE] == TRAIN_ACTIVE) setAwake(i, true);
+        if (trains[i][TRAIN_STATE] == TRAIN_SCHEDULED) spawnOrder[numSpawnOrder++] = i;
+    }
+    std::sort(spawnOrder, spawnOrder + numSpawnOrder, spawnBefore);
+
+    segmentsReady = true;
+}
+
+// ----------------------------------------------------------------------------
+// SLEEP / WAKE
+// ----------------------------------------------------------------------------
+// A sleeping train moves one tile per tick without waiting, so catching up
+// is a multiply.
+// ----------------------------------------------------------------------------
+static void advanceSleeper(int i, int throughTick) {
+    int moves = throughTick - sleepSync[i];
+    if (moves <= 0) return;
+
+    int* train = trains[i];
+    int dir = train[TRAIN_DIRECTION];
+    train[TRAIN_X] += moves * dx[dir];
+    train[TRAIN_Y] += moves * dy[dir];
+    train[TRAIN_MOVES] += moves;
+    noteTrainMoves(i, moves);
+    sleepSync[i] = throughTick;
+}
+
+void syncSegmentTrains(int throughTick) {
+    for (int n = 0; n < numSleepers; n++) {
+        advanceSleeper(sleeperList[n], throughTick);
+    }
+}
+
+bool isTrainCoasting(int i) {
+    if (!segmentsReady || (awakeBits[i / 64] >> (i % 64)) & 1) return false;
+    return sleepSync[i] < currentTick;
+}
+
+static void putToSleep(int i, int segment, int lane, int ticks) {
+    sleepSync[i] = currentTick;
+    sleepWake[i] = currentTick + ticks + 1;
+    sleepSegment[i] = segment;
+    sleepLane[i] = lane;
+    segSleepers[segment]++;
+    segSleepDir[segment] = trains[i][TRAIN_DIRECTION];
+    laneTrain[lane] = i;
+    setAwake(i, false);
+
+    sleeperPos[i] = numSleepers;
+    sleeperList[numSleepers++] = i;
+
+    int bucket = sleepWake[i] % WAKE_WHEEL_SIZE;
+    wakePrev[i] = -1;
+    wakeNext[i] = wakeHead[bucket];
+    if (wakeHead[bucket] >= 0) wakePrev[wakeHead[bucket]] = i;
+    wakeHead[bucket] = i;
+}
+
+// Wake a sleeping train at its position before the current tick.
+static void wakeTrain(int i) {
+    advanceSleeper(i, currentTick - 1);
+    segSleepers[sleepSegment[i]]--;
+    laneTrain[sleepLane[i]] = -1;
+    setAwake(i, true);
+
+    int last = sleeperList[--numSleepers];
+    sleeperList[sleeperPos[i]] = last;
+    sleeperPos[last] = sleeperPos[i];
+
+    int bucket = sleepWake[i] % WAKE_WHEEL_SIZE;
+    if (wakePrev[i] >= 0) {
+        wakeNext[wakePrev[i]] = wakeNext[i];
+    } else {
+        wakeHead[bucket] = wakeNext[i];
+    }
+    if (wakeNext[i] >= 0) wakePrev[wakeNext[i]] = wakePrev[i];
+}
+
+void rebuildSegments() {
+    while (numSleepers > 0) wakeTrain(sleeperList[0]);
+    segmentsReady = false;
+}
+
+void prepareSegments() {
+    if (!segmentsReady) buildSegments();
+}
+
+// A halt zone now covers (x, y): its segment's sleepers are woken, since
+// they are no longer checked for halts while asleep.
+void wakeSegmentTrainsAt(int x, int y) {
+    if (!segmentsReady) return;
+    int segment = segmentOf[x][y];
+    if (segment < 0 || segSleepers[segment] == 0) return;
+    for (int lane = segLaneBase[segment]; lane < segLaneBase[segment] + segLength[segment]; lane++) {
+        if (laneTrain[lane] >= 0) wakeTrain(laneTrain[lane]);
+    }
+}
+
+// Timers due this tick; everyone while every tile is being traced.
+static void wakeDueTrains() {
+    if (logLevel == LOG_FULL) {
+        while (numSleepers > 0) wakeTrain(sleeperList[0]);
+        return;
+    }
+    int i = wakeHead[currentTick % WAKE_WHEEL_SIZE];
+    while (i >= 0) {
+        int next = wakeNext[i];
+        wakeTrain(i);
+        i = next;
+    }
+}
+
+// ----------------------------------------------------------------------------
+// PHASE 1: SPAWN
+// ----------------------------------------------------------------------------
+// A streamed schedule refills slots while running, so its slots are scanned.
+// ----------------------------------------------------------------------------
+static void spawnSegmentTrains() {
+    if (streamingSchedule) {
+        for (int i = 0; i < numTrains; i++) {
+            if (trains[i][TRAIN_STATE] == TRAIN_SCHEDULED && trains[i][TRAIN_SPAWN_TICK] == currentTick) {
+                trains[i][TRAIN_STATE] = TRAIN_ACTIVE;
+                activeTrains++;
+                noteTrainSpawned(i);
+                logTrainTrace(i, TRACE_SPAWNED);
+                setAwake(i, true);
+            }
+        }
+        return;
+    }
+
+    while (spawnCursor < numSpawnOrder && trains[spawnOrder[spawnCursor]][TRAIN_SPAWN_TICK] < currentTick) {
+        spawnCursor++;
+    }
+    while (spawnCursor < numSpawnOrder && trains[spawnOrder[spawnCursor]][TRAIN_SPAWN_TICK] == currentTick) {
+        int i = spawnOrder[spawnCursor++];
+        if (trains[i][TRAIN_STATE] != TRAIN_SCHEDULED) continue;
+        trains[i][TRAIN_STATE] = TRAIN_ACTIVE;
+        activeTrains++;
+        noteTrainSpawned(i);
+        logTrainTrace(i, TRACE_SPAWNED);
+        setAwake(i, true);
+    }
+}
+
+// ----------------------------------------------------------------------------
+// PHASES 2-3: ROUTE + SWITCH COUNTERS
+// ----------------------------------------------------------------------------
+// A train heading into a segment wakes the sleeper with the same target,
+// which is planned at once (its target lies inside the segment, so it cannot
+// crash off the track). That sleeper is one tile back along its heading.
+// ----------------------------------------------------------------------------
+static void planTrain(int i) {
+    int* train = trains[i];
+    segPlanTick[i] = currentTick;
+
+    int x = train[TRAIN_X];
+    int y = train[TRAIN_Y];
+    int dir = train[TRAIN_DIRECTION];
+    int nextX = x + dx[dir];
+    int nextY = y + dy[dir];
+
+    if (!isInBounds(nextX, nextY) || !isTrackTile(nextX, nextY)) {
+        train[TRAIN_STATE] = TRAIN_CRASHED;
+        trainsCrashed++;
+        activeTrains--;
+        setAwake(i, false);
+        segCrashes[numSegmentCrashes++] = i;
+        return;
+    }
+
+    segMoveX[i] = nextX;
+    segMoveY[i] = nextY;
+    segMoveDist[i] = abs(nextX - train[TRAIN_DEST_X]) + abs(nextY - train[TRAIN_DEST_Y]);
+    segOrder[numSegmentMoves++] = i;
+
+    int segment = segmentOf[nextX][nextY];
+    if (segment >= 0 && segSleepers[segment] > 0) {
+        int sleepDir = segSleepDir[segment];
+        int behind = offsetOnSegment(segment, nextX - dx[sleepDir], nextY - dy[sleepDir]);
+        int sleeper = -1;
+        if (behind >= 0 && behind < segLength[segment]) {
+            sleeper = laneTrain[laneSlot(segment, behind, sleepDir, currentTick - 1)];
+        }
+        if (sleeper >= 0) {
+            wakeTrain(sleeper);
+            planTrain(sleeper);
+        }
+    }
+
+    if (isSwitchTile(x, y)) {
+        int switchIndex = getSwitchIndex(getTile(x, y));
+        if (switchIndex >= 0 && switchIndex < numSwitches) {
+            if (switches[switchIndex][SWITCH_MODE] == PER_DIR) {
+                switches[switchIndex][SWITCH_COUNTER0 + dir]++;
+            } else {
+                switches[switchIndex][SWITCH_GLOBAL_COUNTER]++;
+            }
+        }
+    }
+}
+
+static void planAwakeTrains() {
+    numSegmentMoves = 0;
+    numSegmentCrashes = 0;
+
+    int words = (numTrains + 63) / 64;
+    for (int w = 0; w < words; w++) {
+        BitWord bits = awakeBits[w];
+        while (bits) {
+            int i = w * 64 + __builtin_ctzll(bits);
+            bits &= bits - 1;
+            if (segPlanTick[i] == currentTick) continue;
+            if (trains[i][TRAIN_STATE] != TRAIN_ACTIVE) {
+                setAwake(i, false);
+                continue;
+            }
+            planTrain(i);
+        }
+    }
+
+    for (int c = 0; c < numSegmentCrashes; c++) {
+        logTrainTrace(segCrashes[c], TRACE_CRASHED);
+    }
+}
+
+// ----------------------------------------------------------------------------
+// COLLISIONS
+// ----------------------------------------------------------------------------
+// Moves into the same tile are chained in move order, so each chain visits
+// the (i, j) pairs in the order of the phased all-pairs loop.
+// ----------------------------------------------------------------------------
+static void resolveCollisions() {
+    std::sort(segOrder, segOrder + numSegmentMoves, moveBefore);
+
+    int stamp = ++segStampCounter;
+    for (int p = numSegmentMoves - 1; p >= 0; p--) {
+        int i = segOrder[p];
+        int x = segMoveX[i], y = segMoveY[i];
+        segNextSame[p] = (segTileStamp[x][y] == stamp) ? segTileHead[x][y] : -1;
+        segTileStamp[x][y] = stamp;
+        segTileHead[x][y] = p;
+    }
+
+    for (int p = 0; p < numSegmentMoves; p++) {
+        int trainI = segOrder[p];
+        for (int q = segNextSame[p]; q >= 0; q = segNextSame[q]) {
+            int trainJ = segOrder[q];
+            noteTileConflict(segMoveX[trainI], segMoveY[trainI]);
+
+            if (segMoveDist[trainI] > segMoveDist[trainJ]) {
+                trains[trainJ][TRAIN_WAIT_TICKS]++;
+                noteTrainWaiting(trainJ);
+            } else if (segMoveDist[trainJ] > segMoveDist[trainI]) {
+                trains[trainI][TRAIN_WAIT_TICKS]++;
+                noteTrainWaiting(trainI);
+            } else {
+                trains[trainI][TRAIN_STATE] = TRAIN_CRASHED;
+                trains[trainJ][TRAIN_STATE] = TRAIN_CRASHED;
+                trainsCrashed += 2;
+                activeTrains -= 2;
+
+                logTrainTrace(trainI, TRACE_CRASHED);
+                logTrainTrace(trainJ, TRACE_CRASHED);
+            }
+        }
+    }
+}
+
+// ----------------------------------------------------------------------------
+// PHASES 5 AND 7: MOVE + ARRIVALS + EMERGENCY HALT
+// ----------------------------------------------------------------------------
+// Same rules as moveAllTrains(); trains still active afterwards mark their
+// tile for the signal lights.
+// ----------------------------------------------------------------------------
+static int moveArriveHalt() {
+    int stamp = ++segStampCounter;
+    numSegmentArrivals = 0;
+
+    int delayTicks = 1;
+    if (weather == WEATHER_RAIN) delayTicks = 2;
+    if (weather == WEATHER_FOG) delayTicks = 3;
+
+    for (int p = 0; p < numSegmentMoves; p++) {
+        int i = segOrder[p];
+        int* train = trains[i];
+        if (train[TRAIN_STATE] != TRAIN_ACTIVE) continue;
+
+        bool move = true;
+        if (holdForRain(i)) {
+            totalWaitTicks++;
+            noteTrainWaiting(i);
+            move = false;
+        } else if (isSafetyTile(train[TRAIN_X], train[TRAIN_Y])) {
+            train[TRAIN_WAIT_TICKS]++;
+            totalWaitTicks++;
+            noteTrainWaiting(i);
+            if (train[TRAIN_WAIT_TICKS] >= delayTicks) {
+                train[TRAIN_WAIT_TICKS] = 0;
+            } else {
+                move = false;
+            }
+        }
+
+        if (move) {
+            train[TRAIN_X] = segMoveX[i];
+            train[TRAIN_Y] = segMoveY[i];
+            train[TRAIN_DIRECTION] = getNextDirection(segMoveX[i], segMoveY[i], train[TRAIN_DIRECTION], i);
+            countTrainMove(i);
+            noteTrainMoved(i);
+        }
+        logTrainTrace(i, move ? TRACE_MOVING : TRACE_WAITING);
+
+        int x = train[TRAIN_X];
+        int y = train[TRAIN_Y];
+        if (x == train[TRAIN_DEST_X] && y == train[TRAIN_DEST_Y]) {
+            train[TRAIN_STATE] = TRAIN_DELIVERED;
+            trainsDelivered++;
+            activeTrains--;
+            segArrivals[numSegmentArrivals++] = i;
+            continue;
+        }
+
+        if (numHaltZones > 0 && isHaltTile(x, y)) haltTrain(i);
+        segTileStamp[x][y] = stamp;
+    }
+    return stamp;
+}
+
+// ----------------------------------------------------------------------------
+// SIGNAL LIGHTS
+// ----------------------------------------------------------------------------
+// Sleeping trains are never within two tiles of a switch, so the awake
+// trains decide every colour.
+// ----------------------------------------------------------------------------
+static void updateSegmentSignals(int stamp) {
+    for (int sw = 0; sw < numSwitches; sw++) {
+        int x = switches[sw][SWITCH_X];
+        int y = switches[sw][SWITCH_Y];
+        if (!isInBounds(x, y)) continue;
+
+        bool hasConflict = false;
+        bool hasWarning = false;
+        for (int dir = 0; dir < 4; dir++) {
+            int nextX = x + dx[dir];
+            int nextY = y + dy[dir];
+            if (!isInBounds(nextX, nextY)) continue;
+
+            if (isOccupied(nextX, nextY, stamp)) hasConflict = true;
+            for (int around = 0; around < 4; around++) {
+                if (isOccupied(nextX + dx[around], nextY + dy[around], stamp)) hasWarning = true;
+            }
+        }
+
+        SignalColor signalColor = hasConflict ? SIGNAL_RED : (hasWarning ? SIGNAL_YELLOW : SIGNAL_GREEN);
+        logSignalState(sw, signalColor);
+    }
+}
+
+// ----------------------------------------------------------------------------
+// PUT TRAINS TO SLEEP
+// ----------------------------------------------------------------------------
+// A train that just moved along a segment sleeps until it reaches the end
+// of the segment, one tile short of its destination, or (in RAIN) the move
+// before its next slowdown draw, unless the segment's sleepers head the
+// other way or one of them is on the same tile. Crashed and delivered
+// trains leave the awake set here.
+// ----------------------------------------------------------------------------
+static int coastTicks(int i, int segment) {
+    int* train = trains[i];
+    int dir = train[TRAIN_DIRECTION];
+    int first = segDir[segment];
+    if (dir != first && dir != (first + 2) % 4) return 0;
+
+    int offset = offsetOnSegment(segment, train[TRAIN_X], train[TRAIN_Y]);
+    int ticks = (dir == first) ? segLength[segment] - 1 - offset : offset;
+
+    // Destination ahead on the segment
+    int destX = train[TRAIN_DEST_X], destY = train[TRAIN_DEST_Y];
+    if (isInBounds(destX, destY) && segmentOf[destX][destY] == segment) {
+        int steps = abs(destX - train[TRAIN_X]) + abs(destY - train[TRAIN_Y]);
+        bool ahead = (destX - train[TRAIN_X]) * dx[dir] + (destY - train[TRAIN_Y]) * dy[dir] > 0;
+        if (ahead) ticks = std::min(ticks, steps - 1);
+    }
+
+    if (weather == WEATHER_RAIN) {
+        ticks = std::min(ticks, RAIN_SLOWDOWN_MOVES - 1 - train[TRAIN_MOVES] % RAIN_SLOWDOWN_MOVES);
+    }
+
+    // Stay awake to be halted on the first halt tile ahead
+    if (numHaltZones > 0) {
+        for (int k = 1; k <= ticks; k++) {
+            if (isHaltTile(train[TRAIN_X] + k * dx[dir], train[TRAIN_Y] + k * dy[dir])) return k - 1;
+        }
+    }
+    return ticks;
+}
+
+static void putTrainsToSleep() {
+    bool allowed = logLevel != LOG_FULL;
+
+    for (int p = 0; p < numSegmentMoves; p++) {
+        int i = segOrder[p];
+        int* train = trains[i];
+        if (train[TRAIN_STATE] != TRAIN_ACTIVE) {
+            setAwake(i, false);
+            continue;
+        }
+        if (!allowed || train[TRAIN_RAIN_HOLD] != 0) continue;
+        if (train[TRAIN_X] != segMoveX[i] || train[TRAIN_Y] != segMoveY[i]) continue;
+
+        int segment = segmentOf[train[TRAIN_X]][train[TRAIN_Y]];
+        if (segment < 0) continue;
+        int dir = train[TRAIN_DIRECTION];
+        if (segSleepers[segment] > 0 && segSleepDir[segment] != dir) continue;
+
+        int ticks = coastTicks(i, segment);
+        if (ticks < MIN_COAST_TICKS) continue;
+
+        int lane = laneSlot(segment, offsetOnSegment(segment, train[TRAIN_X], train[TRAIN_Y]), dir, currentTick);
+        if (laneTrain[lane] >= 0) continue;
+        putToSleep(i, segment, lane, ticks);
+    }
+}
+
+// ----------------------------------------------------------------------------
+// RUN SEGMENT PHASES
+// ----------------------------------------------------------------------------
+void runSegmentPhases() {
+    if (!segmentsReady) buildSegments();
+    wakeDueTrains();
+
+    // Phases 1-3
+    spawnSegmentTrains();
+    planAwakeTrains();
+
+    // Phase 4: Queue switch flips
+    queueSwitchFlips();
+
+    // Phases 5 and 7, emergency halt
+    resolveCollisions();
+    int occupiedStamp = moveArriveHalt();
+
+    // Phase 6: Apply deferred switch flips
+    applyDeferredFlips();
+
+    // Deliveries are logged in train index order, after the flips
+    std::sort(segArrivals, segArrivals + numSegmentArrivals);
+    for (int a = 0; a < numSegmentArrivals; a++) {
+        logTrainTrace(segArrivals[a], TRACE_DELIVERED);
+    }
+    updateEmergencyHalt();
+
+    updateSegmentSignals(occupiedStamp);
+    putTrainsToSleep();
+}
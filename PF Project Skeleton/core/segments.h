@@ -0,0 +1,51 @@
+#ifndef SEGMENTS_H
+#define SEGMENTS_H
+
+// ============================================================================
+// SEGMENTS.H - Segment tick (trains coast along straight segments)
+// ============================================================================
+// The grid is compiled into segments: maximal straight runs of plain '-',
+// '=' or '|' track between decision points (switches and the tiles within
+// two of them, crossings, curves, safety tiles, spawns and destinations).
+// A train moving along a segment is put to sleep as (segment, offset) until
+// it reaches the end of the segment or its destination; trains following
+// each other down a segment can all sleep. Sleeping trains take no per-tick
+// work, and any other train heading into a sleeper's next tile wakes it
+// first, so the results are identical to the phased engine.
+//
+// Positions of sleeping trains in trains[] are brought up to date only on
+// demand (see syncTrainPositions() in simulation.h). With --log full every
+// train is stepped each tick so that each tile still gets its trace row.
+// ============================================================================
+
+// ----------------------------------------------------------------------------
+// SETUP
+// ----------------------------------------------------------------------------
+// Drop all segment state before the next tick (new level).
+void resetSegments();
+
+// Wake every train and compile the segments again before the next tick (a
+// safety tile was toggled).
+void rebuildSegments();
+
+// Compile them now instead of at the first tick (prepareLevelData()).
+void prepareSegments();
+
+// Wake the sleepers of the segment through (x, y) before the next tick (a
+// halt zone now covers the tile).
+void wakeSegmentTrainsAt(int x, int y);
+
+// ----------------------------------------------------------------------------
+// TICK
+// ----------------------------------------------------------------------------
+// Run phases 1-7, emergency halt and signals for one tick.
+void runSegmentPhases();
+
+// Advance sleeping trains in trains[] to their position after throughTick.
+void syncSegmentTrains(int throughTick);
+
+// True for a sleeping train whose trains[] position is from before the
+// current tick.
+bool isTrainCoasting(int trainIndex);
+
+#endif
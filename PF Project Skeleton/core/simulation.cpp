@@ -4,6 +4,16 @@
 #include "switches.h"
 #include "grid.h"
 #include "io.h"
+#include "metrics.h"
+#include "partition.h"
+#include "fused.h"
+#include "bitboard.h"
+#include "segments.h"
+#include "reach.h"
+#include "heatmap.h"
+#include "fingerprint.h"
+#include "schedule.h"
+#include "halt.h"
 #include <cstdlib>
 #include <ctime>
 #include <iostream>
@@ -22,45 +32,113 @@ void initializeSimulation() {
     
     // Initialize logging
     initializeLogFiles();
+    initializeMetricsStream();
+    resetFingerprint();
+    resetFusedTick();
+    resetBitboards();
+    resetSegments();
+    resetReachCache();
+    resetHeatmap();
+    resetHaltZones();
     
     std::cout << "Simulation initialized successfully!" << std::endl;
 }
 
+// ----------------------------------------------------------------------------
+// PHASE CHECKPOINT
+// ----------------------------------------------------------------------------
+// Record the state fingerprint after a phase (tools/verify).
+// ----------------------------------------------------------------------------
+static void checkpoint(TickPhase phase) {
+    if (fingerprintEnabled) {
+        updateFingerprint(phase);
+    }
+}
+
 // ----------------------------------------------------------------------------
 // SIMULATE ONE TICK
 // ----------------------------------------------------------------------------
 
 void simulateOneTick() {
-    // Phase 1: Spawn trains scheduled for this tick
-    spawnTrainsForTick();
-    
-    // Phase 2: Determine routes for all active trains
-    determineAllRoutes();
-    
-    // Phase 3: Update switch counters based on train entries
-    updateSwitchCounters();
-    
-    // Phase 4: Queue switch flips when counters reach K-values
-    queueSwitchFlips();
-    
-    // Phase 5: Move trains and handle collisions
-    moveAllTrains();
-    
-    // Phase 6: Apply deferred switch flips
-    applyDeferredFlips();
+    // Streaming schedule: read the trains due by this tick into free slots
+    if (streamingSchedule) {
+        admitScheduledTrains();
+    }
     
-    // Phase 7: Check for arrivals at destination points
-    checkArrivals();
+    // Halt zones from the level's HALTS section that start this tick
+    startDueHaltZones();
+    
+    if (partitionedTick && reserveHorizon == 0) {
+        // Phases 1-7, halt and signals split into grid strips across threads
+        // (reservation planning is serial and uses the phased engine)
+        runPartitionedPhases();
+        checkpoint(PHASE_SIGNALS);
+    } else if (bitboardTick && reserveHorizon == 0) {
+        // Phases 1-7, halt and signals with word-parallel straight steps
+        runBitboardPhases();
+        checkpoint(PHASE_SIGNALS);
+    } else if (segmentTick && reserveHorizon == 0) {
+        // Phases 1-7, halt and signals; trains on straight segments sleep
+        // until their end
+        runSegmentPhases();
+        if (fingerprintEnabled) syncSegmentTrains(currentTick);
+        checkpoint(PHASE_SIGNALS);
+    } else if (fusedTick && reserveHorizon == 0) {
+        // Phases 1-7, halt and signals in two passes over the trains
+        runFusedPhases();
+        checkpoint(PHASE_SIGNALS);
+    } else {
+        // Phase 1: Spawn trains scheduled for this tick
+        spawnTrainsForTick();
+        checkpoint(PHASE_SPAWN);
+    
+        // Phase 2: Determine routes for all active trains
+        determineAllRoutes();
+        checkpoint(PHASE_ROUTE);
+    
+        // Phase 3: Update switch counters based on train entries
+        updateSwitchCounters();
+        checkpoint(PHASE_COUNTERS);
+    
+        // Phase 4: Queue switch flips when counters reach K-values
+        queueSwitchFlips();
+        checkpoint(PHASE_QUEUE);
+    
+        // Phase 5: Move trains and handle collisions
+        moveAllTrains();
+        checkpoint(PHASE_MOVE);
+    
+        // Phase 6: Apply deferred switch flips
+        applyDeferredFlips();
+        checkpoint(PHASE_FLIP);
+    
+        // Phase 7: Check for arrivals at destination points
+        checkArrivals();
+        checkpoint(PHASE_ARRIVALS);
+    
+        // Halt trains inside the active halt zones and expire zones
+        applyEmergencyHalt();
+        updateEmergencyHalt();
+        checkpoint(PHASE_HALT);
+    
+        // Update signal lights for visualization
+        updateSignalLights();
+        checkpoint(PHASE_SIGNALS);
+    }
     
-    // Apply emergency halt effects if active
-    applyEmergencyHalt();
-    updateEmergencyHalt();
+    // Record per-tick counters to the metrics stream
+    recordTickMetrics();
     
-    // Update signal lights for visualization
-    updateSignalLights();
+    // Streaming schedule: finished trains give their slots back
+    if (streamingSchedule) {
+        releaseFinishedTrains();
+    }
     
     // Print current grid state to terminal
-    printGrid();
+    if (printGridEnabled) {
+        if (segmentTick) syncSegmentTrains(currentTick);
+        printGrid();
+    }
     
     // Increment tick counter
     currentTick++;
@@ -86,6 +164,14 @@ bool isSimulationComplete() {
         }
     }
     
+    // Streaming schedule: slots are reused, so finished trains come from the
+    // run totals, and unread schedule lines are still to come
+    if (streamingSchedule) {
+        delivered = getTrainTotal(TS_DELIVERED);
+        crashed = getTrainTotal(TS_CRASHED);
+        if (!isScheduleExhausted()) scheduledTrains++;
+    }
+    
     // Update global counters
     activeTrains = actualActive;
     trainsDelivered = delivered;
@@ -103,6 +189,40 @@ bool isSimulationComplete() {
     std::cout << "  Delivered: " << delivered << std::endl;
     std::cout << "  Crashed: " << crashed << std::endl;
     std::cout << "  Total ticks: " << currentTick << std::endl;
+    flushMetricsStream();
+    finishLogFiles();
     writeMetrics();
     return true;
 }
+
+// ----------------------------------------------------------------------------
+// SHUTDOWN SIMULATION
+// ----------------------------------------------------------------------------
+
+void shutdownSimulation() {
+    // Save whatever the run produced so far (Ctrl+C / ESC)
+    syncTrainPositions();
+    flushMetricsStream();
+    finishLogFiles();
+    writeMetrics();
+}
+
+// ----------------------------------------------------------------------------
+// SYNC TRAIN POSITIONS
+// ----------------------------------------------------------------------------
+void syncTrainPositions() {
+    if (segmentTick) syncSegmentTrains(currentTick - 1);
+}
+
+// ----------------------------------------------------------------------------
+// PREPARE LEVEL DATA
+// ----------------------------------------------------------------------------
+// Same engine choice as simulateOneTick(). Every engine queries the
+// reachability chains under the adaptive policy.
+// ----------------------------------------------------------------------------
+void prepareLevelData() {
+    if (switchPolicy == SWITCH_POLICY_ADAPTIVE) prepareReachCache();
+    if (partitionedTick || reserveHorizon != 0) return;
+    if (bitboardTick) prepareBitboards();
+    else if (segmentTick) prepareSegments();
+}
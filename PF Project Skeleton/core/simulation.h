@@ -17,10 +17,24 @@ void simulateOneTick();
 // Initialize the simulation after loading a level.
 void initializeSimulation();
 
+// Build the selected engine's tables derived from the level (bitboards,
+// segments, and the reachability chains under the adaptive policy) now
+// rather than at the first tick. Call after loadLevelFile()
+// and before forking runs of the same level: the tables are then shared
+// copy-on-write and each run only owns the pages it writes.
+void prepareLevelData();
+
 // ----------------------------------------------------------------------------
 // UTILITY
 // ----------------------------------------------------------------------------
 // True if all trains are delivered or crashed.
 bool isSimulationComplete();
 
+// Flush streams and write metrics when a run is stopped early.
+void shutdownSimulation();
+
+// Bring trains[] up to date between ticks; the segment tick only moves
+// sleeping trains when asked (GUI drawing, checksums).
+void syncTrainPositions();
+
 #endif
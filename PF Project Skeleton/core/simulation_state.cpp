@@ -8,8 +8,11 @@
 // ----------------------------------------------------------------------------
 // GRID
 // ----------------------------------------------------------------------------
-char grid[MAX_ROWS][MAX_COLS];
-bool safetyTiles[MAX_ROWS][MAX_COLS];
+char gridChunks[MAX_GRID_CHUNKS][GRID_CHUNK_CELLS];
+bool safetyChunks[MAX_GRID_CHUNKS][GRID_CHUNK_CELLS];
+int haltChunks[MAX_GRID_CHUNKS][GRID_CHUNK_CELLS];
+int gridChunkSlot[GRID_CHUNK_ROWS][GRID_CHUNK_COLS];
+int numGridChunks = 1;
 int gridRows = 0, gridCols = 0;
 
 // ----------------------------------------------------------------------------
@@ -29,9 +32,9 @@ int numSwitches = 0;
 // ----------------------------------------------------------------------------
 // SPAWN AND DESTINATION POINTS
 // ----------------------------------------------------------------------------
-int spawnPoints[10][SPAWN_FIELDS];
+int spawnPoints[MAX_SPAWN_POINTS][SPAWN_FIELDS];
 int numSpawnPoints = 0;
-int destinationPoints[10][DEST_FIELDS];
+int destinationPoints[MAX_DEST_POINTS][DEST_FIELDS];
 int numDestinationPoints = 0;
 
 // ----------------------------------------------------------------------------
@@ -39,9 +42,28 @@ int numDestinationPoints = 0;
 // ----------------------------------------------------------------------------
 std::string levelName;
 int seed = 0;
+int spawnJitter = 0;
 WeatherType weather = WEATHER_NORMAL;
+SwitchPolicy switchPolicy = SWITCH_POLICY_COUNTERS;
 int currentTick = 0;
 
+// ----------------------------------------------------------------------------
+// RUN OPTIONS
+// ----------------------------------------------------------------------------
+bool printGridEnabled = true;
+LogLevel logLevel = LOG_FULL;
+bool partitionedTick = false;
+bool parallelRoutes = false;
+bool fusedTick = false;
+bool bitboardTick = false;
+bool segmentTick = false;
+bool specialisedKernels = true;
+int tickThreads = 1;
+int reserveHorizon = 0;
+bool fingerprintEnabled = false;
+bool heatmapEnabled = true;
+bool streamingSchedule = false;
+
 // ----------------------------------------------------------------------------
 // METRICS
 // ----------------------------------------------------------------------------
@@ -50,13 +72,6 @@ int trainsCrashed = 0;
 int switchFlips = 0;
 int totalWaitTicks = 0;
 
-// ----------------------------------------------------------------------------
-// EMERGENCY HALT
-// ----------------------------------------------------------------------------
-bool emergencyHaltActive = false;
-int emergencyHaltTicks = 0;
-int emergencyHaltX = 0, emergencyHaltY = 0, emergencyHaltRange = 3;
-
 // ============================================================================
 // INITIALIZE SIMULATION STATE
 // ============================================================================
@@ -66,9 +81,10 @@ int emergencyHaltX = 0, emergencyHaltY = 0, emergencyHaltRange = 3;
 // Called before loading a new level.
 // ----------------------------------------------------------------------------
 void initializeSimulationState() {
-    // Clear grid
-    memset(grid, ' ', sizeof(grid));
-    memset(safetyTiles, false, sizeof(safetyTiles));
+    // Clear grid (chunk slots are cleared when they are handed out again)
+    memset(gridChunkSlot, 0, sizeof(gridChunkSlot));
+    memset(gridChunks[0], ' ', sizeof(gridChunks[0]));
+    numGridChunks = 1;
     gridRows = gridCols = 0;
     
     // Reset trains
@@ -83,15 +99,15 @@ void initializeSimulationState() {
     // Clear spawn/destination points
     numSpawnPoints = 0;
     numDestinationPoints = 0;
-    for (int i = 0; i < 10; i++) {
-        spawnPoints[i][SPAWN_ACTIVE] = 0;
-        destinationPoints[i][DEST_ACTIVE] = 0;
-    }
+    for (int i = 0; i < MAX_SPAWN_POINTS; i++) spawnPoints[i][SPAWN_ACTIVE] = 0;
+    for (int i = 0; i < MAX_DEST_POINTS; i++) destinationPoints[i][DEST_ACTIVE] = 0;
     
     // Reset simulation parameters
     levelName.clear();
     seed = 0;
+    spawnJitter = 0;
     weather = WEATHER_NORMAL;
+    switchPolicy = SWITCH_POLICY_COUNTERS;
     currentTick = 0;
     
     // Reset metrics
@@ -99,9 +115,4 @@ void initializeSimulationState() {
     trainsCrashed = 0;
     switchFlips = 0;
     totalWaitTicks = 0;
-    
-    // Reset emergency halt
-    emergencyHaltActive = false;
-    emergencyHaltTicks = 0;
-    emergencyHaltX = emergencyHaltY = 0;
 }
@@ -7,13 +7,21 @@
 // SIMULATION_STATE.H - Global constants and state
 // ============================================================================
 // Global constants and arrays used by the game.
+//
+// Level data (grid, spawn and destination points, switch positions and
+// modes, name, seed, weather) is only written by loadLevelFile().
+// Everything else is per-run state: trains, counters, switch states and
+// K-values (tools/optimise_switches varies them) and safety tiles. Runs of
+// one level are forked from a process that loaded it (tools/optimise_switches,
+// the lookahead advisor), so the level data and the tables derived from it
+// (prepareLevelData() in simulation.h) are shared copy-on-write.
 // ============================================================================
 
 // ----------------------------------------------------------------------------
 // GRID CONSTANTS
 // ----------------------------------------------------------------------------
-const int MAX_ROWS = 50;
-const int MAX_COLS = 100;
+const int MAX_ROWS = 512;
+const int MAX_COLS = 512;
 
 // Directions: 0=UP, 1=RIGHT, 2=DOWN, 3=LEFT
 const int DIR_UP = 0;
@@ -28,7 +36,7 @@ const int dy[4] = {0, 1, 0, -1};
 // ----------------------------------------------------------------------------
 // TRAIN CONSTANTS
 // ----------------------------------------------------------------------------
-const int MAX_TRAINS = 100;
+const int MAX_TRAINS = 16384;
 
 enum TrainState {
     TRAIN_SCHEDULED,
@@ -37,9 +45,33 @@ enum TrainState {
     TRAIN_CRASHED
 };
 
+// Trace row states (names are only written out in io.cpp)
+enum TraceState {
+    TRACE_SPAWNED,
+    TRACE_MOVING,
+    TRACE_CRASHED,
+    TRACE_DELIVERED,
+    TRACE_WAITING    // Changes-only logs: train stopped moving
+};
+
+// ----------------------------------------------------------------------------
+// LOG LEVELS
+// ----------------------------------------------------------------------------
+// OFF: no CSV rows. EVENTS: spawns, crashes, deliveries, switch flips.
+// CHANGES: events + train rows on direction change or wait start/end, and
+// signal rows on colour change (tools/expand_log rebuilds the FULL files).
+// FULL: every train move and every signal every tick.
+enum LogLevel {
+    LOG_OFF,
+    LOG_EVENTS,
+    LOG_CHANGES,
+    LOG_FULL
+};
+
 // Train data represented as parallel arrays
 // Index mapping: 0=id, 1=spawnTick, 2=x, 3=y, 4=direction, 5=colorIndex, 
-//                6=destinationX, 7=destinationY, 8=state, 9=waitTicks
+//                6=destinationX, 7=destinationY, 8=state, 9=waitTicks,
+//                10=moves, 11=rainHoldTicks
 const int TRAIN_ID = 0;
 const int TRAIN_SPAWN_TICK = 1;
 const int TRAIN_X = 2;
@@ -50,7 +82,9 @@ const int TRAIN_DEST_X = 6;
 const int TRAIN_DEST_Y = 7;
 const int TRAIN_STATE = 8;
 const int TRAIN_WAIT_TICKS = 9;
-const int TRAIN_FIELDS = 10;
+const int TRAIN_MOVES = 10;
+const int TRAIN_RAIN_HOLD = 11;
+const int TRAIN_FIELDS = 12;
 
 // ----------------------------------------------------------------------------
 // SWITCH CONSTANTS
@@ -87,6 +121,13 @@ const int SWITCH_FIELDS = 16;
 // Helper arrays for switch state names (separate from int arrays)
 extern std::string switchStateNames[MAX_SWITCHES][2];
 
+// How phase 4 decides which switches to flip (policy.h)
+enum SwitchPolicy {
+    SWITCH_POLICY_COUNTERS,
+    SWITCH_POLICY_ADAPTIVE,
+    NUM_SWITCH_POLICIES
+};
+
 // ----------------------------------------------------------------------------
 // WEATHER CONSTANTS
 // ----------------------------------------------------------------------------
@@ -96,6 +137,11 @@ enum WeatherType {
     WEATHER_FOG
 };
 
+// RAIN: every RAIN_SLOWDOWN_MOVES-th move is followed by 0..RAIN_MAX_HOLD
+// held ticks (drawn per train and tick from the SEED).
+const int RAIN_SLOWDOWN_MOVES = 5;
+const int RAIN_MAX_HOLD = 2;
+
 // ----------------------------------------------------------------------------
 // SIGNAL CONSTANTS
 // ----------------------------------------------------------------------------
@@ -108,8 +154,25 @@ enum SignalColor {
 // ----------------------------------------------------------------------------
 // GLOBAL STATE: GRID
 // ----------------------------------------------------------------------------
-extern char grid[MAX_ROWS][MAX_COLS];
-extern bool safetyTiles[MAX_ROWS][MAX_COLS];
+// Tiles are stored in GRID_CHUNK x GRID_CHUNK chunks (row-major inside a
+// chunk). Only chunks holding a non-empty tile get a slot in the pool; the
+// directory maps every chunk of the map to its slot, and empty chunks all
+// map to slot 0, which stays blank. Slots are numbered along a Morton curve
+// of the chunk coordinates once the level is loaded, so chunks that are
+// near on the map are near in memory. Read and write tiles through
+// getTile(), setTile(), isSafetyTile() and isHaltTile() in grid.h.
+const int GRID_CHUNK_SHIFT = 5;
+const int GRID_CHUNK = 1 << GRID_CHUNK_SHIFT;               // 32 x 32 tiles
+const int GRID_CHUNK_CELLS = GRID_CHUNK * GRID_CHUNK;
+const int GRID_CHUNK_ROWS = (MAX_ROWS + GRID_CHUNK - 1) / GRID_CHUNK;
+const int GRID_CHUNK_COLS = (MAX_COLS + GRID_CHUNK - 1) / GRID_CHUNK;
+const int MAX_GRID_CHUNKS = GRID_CHUNK_ROWS * GRID_CHUNK_COLS + 1;
+
+extern char gridChunks[MAX_GRID_CHUNKS][GRID_CHUNK_CELLS];      // Level data
+extern bool safetyChunks[MAX_GRID_CHUNKS][GRID_CHUNK_CELLS];    // Per run (toggled in the GUI)
+extern int haltChunks[MAX_GRID_CHUNKS][GRID_CHUNK_CELLS];       // Per run: halt zones covering each tile
+extern int gridChunkSlot[GRID_CHUNK_ROWS][GRID_CHUNK_COLS];     // Directory (0 = empty chunk)
+extern int numGridChunks;                                       // Slots in use, including slot 0
 extern int gridRows, gridCols;
 
 // ----------------------------------------------------------------------------
@@ -134,7 +197,10 @@ const int SPAWN_Y = 1;
 const int SPAWN_ACTIVE = 2;
 const int SPAWN_FIELDS = 3;
 
-extern int spawnPoints[10][SPAWN_FIELDS];
+// Most S tiles recorded (generated 512x512 networks have about 170).
+const int MAX_SPAWN_POINTS = 256;
+
+extern int spawnPoints[MAX_SPAWN_POINTS][SPAWN_FIELDS];
 extern int numSpawnPoints;
 
 // ----------------------------------------------------------------------------
@@ -146,7 +212,10 @@ const int DEST_Y = 1;
 const int DEST_ACTIVE = 2;
 const int DEST_FIELDS = 3;
 
-extern int destinationPoints[10][DEST_FIELDS];
+// Most D tiles recorded (generated 512x512 networks have about 230).
+const int MAX_DEST_POINTS = 256;
+
+extern int destinationPoints[MAX_DEST_POINTS][DEST_FIELDS];
 extern int numDestinationPoints;
 
 // ----------------------------------------------------------------------------
@@ -154,9 +223,28 @@ extern int numDestinationPoints;
 // ----------------------------------------------------------------------------
 extern std::string levelName;
 extern int seed;
+extern int spawnJitter;         // Max extra spawn ticks per train (JITTER:)
 extern WeatherType weather;
+extern SwitchPolicy switchPolicy;   // POLICY: (or --policy)
 extern int currentTick;
 
+// ----------------------------------------------------------------------------
+// GLOBAL STATE: RUN OPTIONS
+// ----------------------------------------------------------------------------
+extern bool printGridEnabled;   // Print the grid to the terminal every tick
+extern LogLevel logLevel;       // Which trace/switch/signal/timeseries rows to write
+extern bool partitionedTick;    // Split each tick into grid strips on threads
+extern bool parallelRoutes;     // Route phase on the work-stealing pool
+extern bool fusedTick;          // Two-pass single-threaded tick (fused.h)
+extern bool bitboardTick;       // Bit-parallel single-threaded tick (bitboard.h)
+extern bool segmentTick;        // Trains coast along straight segments (segments.h)
+extern bool specialisedKernels; // Fused tick built for the level's weather/switch modes (fused.h)
+extern int tickThreads;         // Worker threads for parallel phases
+extern int reserveHorizon;      // Space-time reservation look-ahead in ticks (0 = off)
+extern bool fingerprintEnabled; // Hash the state after every phase (tools/verify)
+extern bool heatmapEnabled;     // Per-tile congestion counters (heatmap.h)
+extern bool streamingSchedule;  // Trains read tick by tick into reused slots (schedule.h)
+
 // ----------------------------------------------------------------------------
 // GLOBAL STATE: METRICS
 // ----------------------------------------------------------------------------
@@ -165,13 +253,6 @@ extern int trainsCrashed;
 extern int switchFlips;
 extern int totalWaitTicks;
 
-// ----------------------------------------------------------------------------
-// GLOBAL STATE: EMERGENCY HALT
-// ----------------------------------------------------------------------------
-extern bool emergencyHaltActive;
-extern int emergencyHaltTicks;
-extern int emergencyHaltX, emergencyHaltY, emergencyHaltRange;
-
 // ----------------------------------------------------------------------------
 // INITIALIZATION FUNCTION
 // ----------------------------------------------------------------------------
@@ -2,6 +2,9 @@
 #include "simulation_state.h"
 #include "grid.h"
 #include "io.h"
+#include "reach.h"
+#include "heatmap.h"
+#include "policy.h"
 
 // ============================================================================
 // SWITCHES.CPP - Switch management
@@ -20,7 +23,7 @@ void updateSwitchCounters() {
             int y = trains[i][TRAIN_Y];
             
             if (isSwitchTile(x, y)) {
-                int switchIndex = getSwitchIndex(grid[x][y]);
+                int switchIndex = getSwitchIndex(getTile(x, y));
                 if (switchIndex >= 0 && switchIndex < numSwitches) {
                     // Increment counter based on switch mode
                     if (switches[switchIndex][SWITCH_MODE] == PER_DIR) {
@@ -40,13 +43,16 @@ void updateSwitchCounters() {
 // ----------------------------------------------------------------------------
 // QUEUE SWITCH FLIPS
 // ----------------------------------------------------------------------------
-// Queue flips when counters hit K.
+// Queue flips when counters hit K (SWITCH_POLICY_COUNTERS; the adaptive
+// policy is in policy.cpp). Modes fixes the counter mode for a level whose
+// switches all use one; SWITCHES_MIXED reads it per switch.
 // ----------------------------------------------------------------------------
-void queueSwitchFlips() {
+template <SwitchModeMix Modes>
+static void queueFlips() {
     for (int i = 0; i < numSwitches; i++) {
         bool shouldFlip = false;
         
-        if (switches[i][SWITCH_MODE] == PER_DIR) {
+        if (Modes == SWITCHES_PER_DIR || (Modes == SWITCHES_MIXED && switches[i][SWITCH_MODE] == PER_DIR)) {
             // Check if any direction counter reached its K-value
             for (int dir = 0; dir < 4; dir++) {
                 if (switches[i][SWITCH_COUNTER0 + dir] >= switches[i][SWITCH_K0 + dir]) {
@@ -68,6 +74,33 @@ void queueSwitchFlips() {
     }
 }
 
+void queueSwitchFlips() {
+    if (switchPolicy == SWITCH_POLICY_ADAPTIVE) queueAdaptiveFlips();
+    else queueFlips<SWITCHES_MIXED>();
+}
+
+void queueSwitchFlipsFor(SwitchModeMix modes) {
+    if (switchPolicy == SWITCH_POLICY_ADAPTIVE) queueAdaptiveFlips();
+    else if (modes == SWITCHES_PER_DIR) queueFlips<SWITCHES_PER_DIR>();
+    else if (modes == SWITCHES_GLOBAL) queueFlips<SWITCHES_GLOBAL>();
+    else queueFlips<SWITCHES_MIXED>();
+}
+
+// ----------------------------------------------------------------------------
+// SWITCH MODE MIX
+// ----------------------------------------------------------------------------
+// A level without switches counts as PER_DIR (nothing is ever counted).
+// ----------------------------------------------------------------------------
+SwitchModeMix getSwitchModeMix() {
+    int perDir = 0;
+    for (int i = 0; i < numSwitches; i++) {
+        if (switches[i][SWITCH_MODE] == PER_DIR) perDir++;
+    }
+    if (perDir == numSwitches) return SWITCHES_PER_DIR;
+    if (perDir == 0) return SWITCHES_GLOBAL;
+    return SWITCHES_MIXED;
+}
+
 // ----------------------------------------------------------------------------
 // APPLY DEFERRED FLIPS
 // ----------------------------------------------------------------------------
@@ -80,6 +113,8 @@ void applyDeferredFlips() {
             switches[i][SWITCH_CURRENT_STATE] = 1 - switches[i][SWITCH_CURRENT_STATE];
             switches[i][SWITCH_FLIP_QUEUED] = 0;
             switchFlips++;
+            noteSwitchFlipped(i);
+            noteSwitchFlipHeat(i);
             
             // Log the switch flip
             logSwitchState(i);
@@ -99,7 +134,7 @@ void updateSignalLights() {
         
         if (!isInBounds(x, y)) continue;
         
-        std::string signalColor = "GREEN"; // Default to green
+        SignalColor signalColor = SIGNAL_GREEN; // Default to green
         
         // Check if there are trains nearby that could cause conflicts
         bool hasConflict = false;
@@ -128,11 +163,11 @@ void updateSignalLights() {
         
         // Determine signal color
         if (hasConflict) {
-            signalColor = "RED";
+            signalColor = SIGNAL_RED;
         } else if (hasWarning) {
-            signalColor = "YELLOW";
+            signalColor = SIGNAL_YELLOW;
         } else {
-            signalColor = "GREEN";
+            signalColor = SIGNAL_GREEN;
         }
         
         // Log signal state
@@ -149,6 +184,8 @@ void toggleSwitchState(int switchIndex) {
     if (switchIndex >= 0 && switchIndex < numSwitches) {
         switches[switchIndex][SWITCH_CURRENT_STATE] = 1 - switches[switchIndex][SWITCH_CURRENT_STATE];
         switchFlips++;
+        noteSwitchFlipped(switchIndex);
+        noteSwitchFlipHeat(switchIndex);
         logSwitchState(switchIndex);
     }
 }
@@ -14,9 +14,23 @@ void updateSwitchCounters();
 // ----------------------------------------------------------------------------
 // FLIP QUEUE
 // ----------------------------------------------------------------------------
-// Queue flips when counters reach K.
+// Queue flips under the level's switch policy (policy.h): by default when
+// counters reach K.
 void queueSwitchFlips();
 
+// Which counter modes a level's switches use (fixed once it is loaded).
+enum SwitchModeMix {
+    SWITCHES_PER_DIR,
+    SWITCHES_GLOBAL,
+    SWITCHES_MIXED
+};
+
+SwitchModeMix getSwitchModeMix();
+
+// queueSwitchFlips() without the per-switch mode branch when all switches
+// share one mode.
+void queueSwitchFlipsFor(SwitchModeMix modes);
+
 // ----------------------------------------------------------------------------
 // DEFERRED FLIP
 // ----------------------------------------------------------------------------
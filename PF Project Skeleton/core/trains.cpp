@@ -3,6 +3,12 @@
 #include "grid.h"
 #include "switches.h"
 #include "io.h"
+#include "metrics.h"
+#include "heatmap.h"
+#include "workers.h"
+#include "rng.h"
+#include "reservations.h"
+#include "halt.h"
 #include <cstdlib>
 #include <cmath>
 #include <algorithm>
@@ -25,6 +31,24 @@ int numPlannedMoves = 0;
 // Previous positions (to detect switch entry).
 int prevX[MAX_TRAINS], prevY[MAX_TRAINS];
 
+// Work-stealing route phase: chunk c covers trains [c*ROUTE_CHUNK, (c+1)*ROUTE_CHUNK)
+// and fills the same slice of these buffers, so each slice has one writer.
+const int ROUTE_CHUNK = 256;
+const int MAX_ROUTE_CHUNKS = (MAX_TRAINS + ROUTE_CHUNK - 1) / ROUTE_CHUNK;
+int chunkMoves[MAX_TRAINS][PLANNED_FIELDS];
+int chunkMoveCount[MAX_ROUTE_CHUNKS];
+int chunkCrashes[MAX_TRAINS];
+int chunkCrashCount[MAX_ROUTE_CHUNKS];
+
+// Exit direction per planned move (computed in parallel before moving).
+int plannedDirection[MAX_TRAINS];
+
+// Reservation planning (per train index): exit direction chosen while
+// reserving, and whether the train's next tile was already taken.
+int reservedDirection[MAX_TRAINS];
+bool reserveHeld[MAX_TRAINS];
+int reserveOrder[MAX_TRAINS];
+
 // ----------------------------------------------------------------------------
 // SPAWN TRAINS FOR CURRENT TICK
 // ----------------------------------------------------------------------------
@@ -35,16 +59,49 @@ void spawnTrainsForTick() {
         if (trains[i][TRAIN_STATE] == TRAIN_SCHEDULED && trains[i][TRAIN_SPAWN_TICK] == currentTick) {
             trains[i][TRAIN_STATE] = TRAIN_ACTIVE;
             activeTrains++;
+            noteTrainSpawned(i);
             
             // Store previous position
             prevX[i] = trains[i][TRAIN_X];
             prevY[i] = trains[i][TRAIN_Y];
             
-            logTrainTrace(trains[i][TRAIN_ID], trains[i][TRAIN_X], trains[i][TRAIN_Y], trains[i][TRAIN_DIRECTION], "SPAWNED");
+            logTrainTrace(i, TRACE_SPAWNED);
         }
     }
 }
 
+// ----------------------------------------------------------------------------
+// PLAN NEXT TILE for a train (read-only)
+// ----------------------------------------------------------------------------
+// Next tile and its distance to the destination; false if off track.
+// ----------------------------------------------------------------------------
+static bool planNextTile(int trainIndex, int& nextX, int& nextY, int& distance) {
+    // Calculate next position based on current direction
+    nextX = trains[trainIndex][TRAIN_X] + dx[trains[trainIndex][TRAIN_DIRECTION]];
+    nextY = trains[trainIndex][TRAIN_Y] + dy[trains[trainIndex][TRAIN_DIRECTION]];
+    
+    // Check if next position is valid
+    if (!isInBounds(nextX, nextY) || !isTrackTile(nextX, nextY)) {
+        return false;
+    }
+    
+    // Calculate distance to destination for priority system
+    distance = abs(nextX - trains[trainIndex][TRAIN_DEST_X]) + abs(nextY - trains[trainIndex][TRAIN_DEST_Y]);
+    return true;
+}
+
+// ----------------------------------------------------------------------------
+// CRASH OFF TRACK
+// ----------------------------------------------------------------------------
+// Train would go off track - crash it.
+// ----------------------------------------------------------------------------
+static void crashTrainOffTrack(int trainIndex) {
+    trains[trainIndex][TRAIN_STATE] = TRAIN_CRASHED;
+    trainsCrashed++;
+    activeTrains--;
+    logTrainTrace(trainIndex, TRACE_CRASHED);
+}
+
 // ----------------------------------------------------------------------------
 // DETERMINE NEXT POSITION for a train
 // ----------------------------------------------------------------------------
@@ -55,23 +112,12 @@ bool determineNextPosition(int trainIndex) {
     prevX[trainIndex] = trains[trainIndex][TRAIN_X];
     prevY[trainIndex] = trains[trainIndex][TRAIN_Y];
     
-    // Calculate next position based on current direction
-    int nextX = trains[trainIndex][TRAIN_X] + dx[trains[trainIndex][TRAIN_DIRECTION]];
-    int nextY = trains[trainIndex][TRAIN_Y] + dy[trains[trainIndex][TRAIN_DIRECTION]];
-    
-    // Check if next position is valid
-    if (!isInBounds(nextX, nextY) || !isTrackTile(nextX, nextY)) {
-        // Train would go off track - crash it
-        trains[trainIndex][TRAIN_STATE] = TRAIN_CRASHED;
-        trainsCrashed++;
-        activeTrains--;
-        logTrainTrace(trains[trainIndex][TRAIN_ID], trains[trainIndex][TRAIN_X], trains[trainIndex][TRAIN_Y], trains[trainIndex][TRAIN_DIRECTION], "CRASHED");
+    int nextX, nextY, distance;
+    if (!planNextTile(trainIndex, nextX, nextY, distance)) {
+        crashTrainOffTrack(trainIndex);
         return false;
     }
     
-    // Calculate distance to destination for priority system
-    int distance = abs(nextX - trains[trainIndex][TRAIN_DEST_X]) + abs(nextY - trains[trainIndex][TRAIN_DEST_Y]);
-    
     // Add to planned moves for collision detection
     if (numPlannedMoves < MAX_TRAINS) {
         plannedMoves[numPlannedMoves][PLANNED_TRAIN_IDX] = trainIndex;
@@ -92,7 +138,7 @@ bool determineNextPosition(int trainIndex) {
 int getNextDirection(int x, int y, int currentDir, int trainIndex) {
     if (!isInBounds(x, y)) return currentDir;
     
-    char tile = grid[x][y];
+    char tile = getTile(x, y);
     
     // Handle switches
     if (isSwitchTile(x, y)) {
@@ -143,9 +189,15 @@ int getNextDirection(int x, int y, int currentDir, int trainIndex) {
 // ----------------------------------------------------------------------------
 // SMART ROUTING AT CROSSING - Route train to its matched destination
 // ----------------------------------------------------------------------------
-// Choose best direction at '+' toward destination.
+// Choose best direction at '+' toward destination. The choice depends only
+// on the destination, so it can be asked for without a train (reach.h).
 // ----------------------------------------------------------------------------
 int getSmartDirectionAtCrossing(int x, int y, int currentDir, int trainIndex) {
+    return getCrossingDirectionTo(x, y, currentDir,
+                                  trains[trainIndex][TRAIN_DEST_X], trains[trainIndex][TRAIN_DEST_Y]);
+}
+
+int getCrossingDirectionTo(int x, int y, int currentDir, int destX, int destY) {
     // Simple approach for easy level: find the direction that gets closest to destination
     int bestDirection = currentDir;
     int bestDistance = 999;
@@ -156,7 +208,7 @@ int getSmartDirectionAtCrossing(int x, int y, int currentDir, int trainIndex) {
         
         // Check if this direction is valid
         if (isInBounds(nextX, nextY) && isTrackTile(nextX, nextY)) {
-            int distance = abs(nextX - trains[trainIndex][TRAIN_DEST_X]) + abs(nextY - trains[trainIndex][TRAIN_DEST_Y]);
+            int distance = abs(nextX - destX) + abs(nextY - destY);
             if (distance < bestDistance) {
                 bestDistance = distance;
                 bestDirection = dir;
@@ -167,6 +219,46 @@ int getSmartDirectionAtCrossing(int x, int y, int currentDir, int trainIndex) {
     return bestDirection;
 }
 
+// ----------------------------------------------------------------------------
+// ROUTE CHUNK (worker task)
+// ----------------------------------------------------------------------------
+// Plan one chunk of trains into that chunk's slice of the buffers.
+// ----------------------------------------------------------------------------
+static void routeChunkTask(int, int chunk) {
+    int begin = chunk * ROUTE_CHUNK;
+    int end = std::min(begin + ROUTE_CHUNK, numTrains);
+    chunkMoveCount[chunk] = 0;
+    chunkCrashCount[chunk] = 0;
+    
+    for (int i = begin; i < end; i++) {
+        if (trains[i][TRAIN_STATE] != TRAIN_ACTIVE) continue;
+        
+        prevX[i] = trains[i][TRAIN_X];
+        prevY[i] = trains[i][TRAIN_Y];
+        
+        int nextX, nextY, distance;
+        if (!planNextTile(i, nextX, nextY, distance)) {
+            chunkCrashes[begin + chunkCrashCount[chunk]++] = i;
+            continue;
+        }
+        
+        int* move = chunkMoves[begin + chunkMoveCount[chunk]++];
+        move[PLANNED_TRAIN_IDX] = i;
+        move[PLANNED_NEXT_X] = nextX;
+        move[PLANNED_NEXT_Y] = nextY;
+        move[PLANNED_DISTANCE] = distance;
+    }
+}
+
+// ----------------------------------------------------------------------------
+// ENSURE WORKERS match tickThreads
+// ----------------------------------------------------------------------------
+static void ensureRouteWorkers() {
+    if (getWorkerCount() != tickThreads) {
+        startWorkers(tickThreads);
+    }
+}
+
 // ----------------------------------------------------------------------------
 // DETERMINE ALL ROUTES (PHASE 2)
 // ----------------------------------------------------------------------------
@@ -175,6 +267,27 @@ int getSmartDirectionAtCrossing(int x, int y, int currentDir, int trainIndex) {
 void determineAllRoutes() {
     numPlannedMoves = 0;  // Clear planned moves
     
+    if (parallelRoutes) {
+        // Plan chunks on the work-stealing pool, then merge in train order
+        ensureRouteWorkers();
+        int numChunks = (numTrains + ROUTE_CHUNK - 1) / ROUTE_CHUNK;
+        runChunksOnWorkers(numChunks, routeChunkTask);
+        
+        for (int chunk = 0; chunk < numChunks; chunk++) {
+            int begin = chunk * ROUTE_CHUNK;
+            for (int c = 0; c < chunkCrashCount[chunk]; c++) {
+                crashTrainOffTrack(chunkCrashes[begin + c]);
+            }
+            for (int m = 0; m < chunkMoveCount[chunk]; m++) {
+                for (int k = 0; k < PLANNED_FIELDS; k++) {
+                    plannedMoves[numPlannedMoves][k] = chunkMoves[begin + m][k];
+                }
+                numPlannedMoves++;
+            }
+        }
+        return;
+    }
+    
     for (int i = 0; i < numTrains; i++) {
         if (trains[i][TRAIN_STATE] == TRAIN_ACTIVE) {
             determineNextPosition(i);
@@ -182,15 +295,155 @@ void determineAllRoutes() {
     }
 }
 
+// ----------------------------------------------------------------------------
+// PLAN DIRECTIONS CHUNK (worker task)
+// ----------------------------------------------------------------------------
+// Exit direction for each planned move; switches do not change mid-phase.
+// ----------------------------------------------------------------------------
+static void planDirectionsTask(int, int chunk) {
+    int begin = chunk * ROUTE_CHUNK;
+    int end = std::min(begin + ROUTE_CHUNK, numPlannedMoves);
+    
+    for (int m = begin; m < end; m++) {
+        int i = plannedMoves[m][PLANNED_TRAIN_IDX];
+        if (trains[i][TRAIN_STATE] != TRAIN_ACTIVE) continue;
+        plannedDirection[m] = getNextDirection(plannedMoves[m][PLANNED_NEXT_X], plannedMoves[m][PLANNED_NEXT_Y],
+                                               trains[i][TRAIN_DIRECTION], i);
+    }
+}
+
+// ----------------------------------------------------------------------------
+// EXIT DIRECTION for a planned move (precomputed when planned in parallel
+// or while reserving)
+// ----------------------------------------------------------------------------
+static int exitDirection(int moveIndex, int trainIndex, int nextX, int nextY) {
+    if (reserveHorizon > 0) return reservedDirection[trainIndex];
+    if (parallelRoutes) return plannedDirection[moveIndex];
+    return getNextDirection(nextX, nextY, trains[trainIndex][TRAIN_DIRECTION], trainIndex);
+}
+
+// ----------------------------------------------------------------------------
+// PREDICT EXIT DIRECTION on entering (x, y) at tick offset
+// ----------------------------------------------------------------------------
+// Like getNextDirection(), but at a crossing the closest exit that no other
+// train has reserved for the following tick wins.
+// ----------------------------------------------------------------------------
+static int predictExitDirection(int x, int y, int currentDir, int trainIndex, int offset) {
+    if (getTile(x, y) != '+' || offset + 1 > std::min(reserveHorizon, MAX_RESERVE_HORIZON)) {
+        return getNextDirection(x, y, currentDir, trainIndex);
+    }
+    
+    int bestDirection = -1;
+    int bestDistance = 999;
+    for (int dir = 0; dir < 4; dir++) {
+        int nextX = x + dx[dir];
+        int nextY = y + dy[dir];
+        if (!isInBounds(nextX, nextY) || !isTrackTile(nextX, nextY)) continue;
+        
+        int holder = getReservation(nextX, nextY, offset + 1);
+        if (holder >= 0 && holder != trainIndex) continue;
+        
+        int distance = abs(nextX - trains[trainIndex][TRAIN_DEST_X]) + abs(nextY - trains[trainIndex][TRAIN_DEST_Y]);
+        if (distance < bestDistance) {
+            bestDistance = distance;
+            bestDirection = dir;
+        }
+    }
+    
+    // Every exit reserved: same choice as without reservations
+    if (bestDirection < 0) return getSmartDirectionAtCrossing(x, y, currentDir, trainIndex);
+    return bestDirection;
+}
+
+static bool reserveBefore(int a, int b) {
+    if (plannedMoves[a][PLANNED_DISTANCE] != plannedMoves[b][PLANNED_DISTANCE]) {
+        return plannedMoves[a][PLANNED_DISTANCE] > plannedMoves[b][PLANNED_DISTANCE];
+    }
+    return plannedMoves[a][PLANNED_TRAIN_IDX] < plannedMoves[b][PLANNED_TRAIN_IDX];
+}
+
+// ----------------------------------------------------------------------------
+// PLAN RESERVATIONS
+// ----------------------------------------------------------------------------
+// Offset 1 (the move about to happen) is binding: one train enters a tile
+// per tick, in the same priority order as detectCollisions(), and the others
+// wait instead of moving in behind it (or crashing on equal distance).
+// Offset 2 is first come first served and only steers the crossing choice
+// of the move about to happen, so trains route around each other. Holding never blocks another train, so
+// the highest-priority train for every tile always moves (no deadlock).
+// ----------------------------------------------------------------------------
+void planReservations() {
+    int horizon = std::min(reserveHorizon, MAX_RESERVE_HORIZON);
+    clearReservations();
+    
+    for (int m = 0; m < numPlannedMoves; m++) {
+        reserveHeld[plannedMoves[m][PLANNED_TRAIN_IDX]] = false;
+        reserveOrder[m] = m;
+    }
+    std::sort(reserveOrder, reserveOrder + numPlannedMoves, reserveBefore);
+    
+    for (int r = 0; r < numPlannedMoves; r++) {
+        int m = reserveOrder[r];
+        int i = plannedMoves[m][PLANNED_TRAIN_IDX];
+        int x = plannedMoves[m][PLANNED_NEXT_X];
+        int y = plannedMoves[m][PLANNED_NEXT_Y];
+        int holder = getReservation(x, y, 1);
+        if (holder >= 0 && holder != i) {
+            reserveHeld[i] = true;
+            continue;
+        }
+        setReservation(x, y, 1, i);
+        
+        // Follow the predicted path, reserving free tiles
+        int dir = predictExitDirection(x, y, trains[i][TRAIN_DIRECTION], i, 1);
+        reservedDirection[i] = dir;
+        for (int offset = 2; offset <= horizon; offset++) {
+            if (x == trains[i][TRAIN_DEST_X] && y == trains[i][TRAIN_DEST_Y]) break;
+            x += dx[dir];
+            y += dy[dir];
+            if (!isInBounds(x, y) || !isTrackTile(x, y)) break;
+            
+            if (getReservation(x, y, offset) < 0) setReservation(x, y, offset, i);
+            dir = predictExitDirection(x, y, dir, i, offset);
+        }
+    }
+    
+    // Held trains sit out this tick's movement
+    int kept = 0;
+    for (int m = 0; m < numPlannedMoves; m++) {
+        int i = plannedMoves[m][PLANNED_TRAIN_IDX];
+        if (reserveHeld[i]) {
+            totalWaitTicks++;
+            noteTrainWaiting(i);
+            logTrainTrace(i, TRACE_WAITING);
+            continue;
+        }
+        for (int k = 0; k < PLANNED_FIELDS; k++) plannedMoves[kept][k] = plannedMoves[m][k];
+        kept++;
+    }
+    numPlannedMoves = kept;
+}
+
 // ----------------------------------------------------------------------------
 // MOVE ALL TRAINS (PHASE 5)
 // ----------------------------------------------------------------------------
 // Move trains; resolve collisions and apply effects.
 // ----------------------------------------------------------------------------
 void moveAllTrains() {
+    // Hold trains whose next tile another train has reserved
+    if (reserveHorizon > 0) {
+        planReservations();
+    }
+    
     // First detect and resolve collisions
     detectCollisions();
     
+    // Read-only part: exit directions on the work-stealing pool
+    if (parallelRoutes && reserveHorizon == 0) {
+        ensureRouteWorkers();
+        runChunksOnWorkers((numPlannedMoves + ROUTE_CHUNK - 1) / ROUTE_CHUNK, planDirectionsTask);
+    }
+    
     // Then move all non-crashed trains
     for (int moveIndex = 0; moveIndex < numPlannedMoves; moveIndex++) {
         int i = plannedMoves[moveIndex][PLANNED_TRAIN_IDX];
@@ -198,10 +451,18 @@ void moveAllTrains() {
         int nextY = plannedMoves[moveIndex][PLANNED_NEXT_Y];
         
         if (trains[i][TRAIN_STATE] == TRAIN_ACTIVE) {
+            if (holdForRain(i)) {
+                totalWaitTicks++;
+                noteTrainWaiting(i);
+                logTrainTrace(i, TRACE_WAITING);
+                continue;
+            }
+            
             // Check for safety tiles that cause delays
-            if (safetyTiles[trains[i][TRAIN_X]][trains[i][TRAIN_Y]]) {
+            if (isSafetyTile(trains[i][TRAIN_X], trains[i][TRAIN_Y])) {
                 trains[i][TRAIN_WAIT_TICKS]++;
                 totalWaitTicks++;
+                noteTrainWaiting(i);
                 
                 // Apply weather effects
                 int delayTicks = 1; // Normal delay
@@ -214,22 +475,53 @@ void moveAllTrains() {
                     // Move the train
                     trains[i][TRAIN_X] = nextX;
                     trains[i][TRAIN_Y] = nextY;
-                    trains[i][TRAIN_DIRECTION] = getNextDirection(nextX, nextY, trains[i][TRAIN_DIRECTION], i);
+                    trains[i][TRAIN_DIRECTION] = exitDirection(moveIndex, i, nextX, nextY);
+                    countTrainMove(i);
+                    noteTrainMoved(i);
                     
-                    logTrainTrace(trains[i][TRAIN_ID], trains[i][TRAIN_X], trains[i][TRAIN_Y], trains[i][TRAIN_DIRECTION], "MOVING");
+                    logTrainTrace(i, TRACE_MOVING);
+                } else {
+                    logTrainTrace(i, TRACE_WAITING);
                 }
             } else {
                 // Move the train normally
                 trains[i][TRAIN_X] = nextX;
                 trains[i][TRAIN_Y] = nextY;
-                trains[i][TRAIN_DIRECTION] = getNextDirection(nextX, nextY, trains[i][TRAIN_DIRECTION], i);
+                trains[i][TRAIN_DIRECTION] = exitDirection(moveIndex, i, nextX, nextY);
+                countTrainMove(i);
+                noteTrainMoved(i);
                 
-                logTrainTrace(trains[i][TRAIN_ID], trains[i][TRAIN_X], trains[i][TRAIN_Y], trains[i][TRAIN_DIRECTION], "MOVING");
+                logTrainTrace(i, TRACE_MOVING);
             }
         }
     }
 }
 
+// ----------------------------------------------------------------------------
+// HOLD FOR RAIN
+// ----------------------------------------------------------------------------
+// Use up one tick of a RAIN slowdown; the caller counts the wait.
+// ----------------------------------------------------------------------------
+bool holdForRain(int trainIndex) {
+    if (trains[trainIndex][TRAIN_RAIN_HOLD] == 0) return false;
+    trains[trainIndex][TRAIN_RAIN_HOLD]--;
+    return true;
+}
+
+// ----------------------------------------------------------------------------
+// COUNT TRAIN MOVE
+// ----------------------------------------------------------------------------
+// The slowdown length only depends on (seed, tick, train id), so it is the
+// same for every engine and thread count.
+// ----------------------------------------------------------------------------
+void countTrainMove(int trainIndex) {
+    trains[trainIndex][TRAIN_MOVES]++;
+    if (weather == WEATHER_RAIN && trains[trainIndex][TRAIN_MOVES] % RAIN_SLOWDOWN_MOVES == 0) {
+        trains[trainIndex][TRAIN_RAIN_HOLD] = rngRange(RNG_STREAM_RAIN, currentTick, trains[trainIndex][TRAIN_ID],
+                                                       RAIN_MAX_HOLD + 1);
+    }
+}
+
 // ----------------------------------------------------------------------------
 // DETECT COLLISIONS WITH PRIORITY SYSTEM
 // ----------------------------------------------------------------------------
@@ -259,12 +551,15 @@ void detectCollisions() {
                 
                 int trainI = plannedMoves[i][PLANNED_TRAIN_IDX];
                 int trainJ = plannedMoves[j][PLANNED_TRAIN_IDX];
+                noteTileConflict(plannedMoves[i][PLANNED_NEXT_X], plannedMoves[i][PLANNED_NEXT_Y]);
                 
                 // Higher distance train (i) gets priority, lower distance train (j) waits
                 if (plannedMoves[i][PLANNED_DISTANCE] > plannedMoves[j][PLANNED_DISTANCE]) {
                     trains[trainJ][TRAIN_WAIT_TICKS]++;
+                    noteTrainWaiting(trainJ);
                 } else if (plannedMoves[j][PLANNED_DISTANCE] > plannedMoves[i][PLANNED_DISTANCE]) {
                     trains[trainI][TRAIN_WAIT_TICKS]++;
+                    noteTrainWaiting(trainI);
                 } else {
                     // Equal distance - both crash
                     trains[trainI][TRAIN_STATE] = TRAIN_CRASHED;
@@ -272,14 +567,8 @@ void detectCollisions() {
                     trainsCrashed += 2;
                     activeTrains -= 2;
                     
-                    logTrainTrace(trains[trainI][TRAIN_ID], 
-                                trains[trainI][TRAIN_X], 
-                                trains[trainI][TRAIN_Y], 
-                                trains[trainI][TRAIN_DIRECTION], "CRASHED");
-                    logTrainTrace(trains[trainJ][TRAIN_ID], 
-                                trains[trainJ][TRAIN_X], 
-                                trains[trainJ][TRAIN_Y], 
-                                trains[trainJ][TRAIN_DIRECTION], "CRASHED");
+                    logTrainTrace(trainI, TRACE_CRASHED);
+                    logTrainTrace(trainJ, TRACE_CRASHED);
                 }
             }
         }
@@ -299,41 +588,11 @@ void checkArrivals() {
                 trainsDelivered++;
                 activeTrains--;
                 
-                logTrainTrace(trains[i][TRAIN_ID], trains[i][TRAIN_X], trains[i][TRAIN_Y], trains[i][TRAIN_DIRECTION], "DELIVERED");
+                logTrainTrace(i, TRACE_DELIVERED);
+            } else if (numHaltZones > 0 && isHaltTile(trains[i][TRAIN_X], trains[i][TRAIN_Y])) {
+                noteHaltCandidate(i);
             }
         }
     }
 }
 
-// ----------------------------------------------------------------------------
-// APPLY EMERGENCY HALT
-// ----------------------------------------------------------------------------
-// Apply halt to trains in the active zone.
-// ----------------------------------------------------------------------------
-void applyEmergencyHalt() {
-    if (!emergencyHaltActive) return;
-    
-    for (int i = 0; i < numTrains; i++) {
-        if (trains[i][TRAIN_STATE] == TRAIN_ACTIVE) {
-            int distance = abs(trains[i][TRAIN_X] - emergencyHaltX) + abs(trains[i][TRAIN_Y] - emergencyHaltY);
-            if (distance <= emergencyHaltRange) {
-                trains[i][TRAIN_WAIT_TICKS] += 3; // Halt for 3 ticks
-                totalWaitTicks += 3;
-            }
-        }
-    }
-}
-
-// ----------------------------------------------------------------------------
-// UPDATE EMERGENCY HALT
-// ----------------------------------------------------------------------------
-// Decrement timer and disable when done.
-// ----------------------------------------------------------------------------
-void updateEmergencyHalt() {
-    if (emergencyHaltActive) {
-        emergencyHaltTicks--;
-        if (emergencyHaltTicks <= 0) {
-            emergencyHaltActive = false;
-        }
-    }
-}
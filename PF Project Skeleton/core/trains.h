@@ -26,12 +26,26 @@ int getNextDirection(int x, int y, int currentDir, int trainIndex);
 // Choose best direction at a crossing.
 int getSmartDirectionAtCrossing(int x, int y, int currentDir, int trainIndex);
 
+// Same choice for any train heading to (destX, destY).
+int getCrossingDirectionTo(int x, int y, int currentDir, int destX, int destY);
+
 // ----------------------------------------------------------------------------
 // TRAIN MOVEMENT
 // ----------------------------------------------------------------------------
 // Move trains and handle collisions (Phase 5).
 void moveAllTrains();
 
+// Reserve the next reserveHorizon tiles of every planned move in priority
+// order and hold trains whose next tile is taken (before detectCollisions).
+void planReservations();
+
+// True if a RAIN slowdown holds the train this tick (uses up one tick of
+// it); the caller counts the wait.
+bool holdForRain(int trainIndex);
+
+// Count a move and start a RAIN slowdown after every 5th move.
+void countTrainMove(int trainIndex);
+
 // ----------------------------------------------------------------------------
 // COLLISION DETECTION
 // ----------------------------------------------------------------------------
@@ -44,13 +58,4 @@ void detectCollisions();
 // Mark trains that reached destinations.
 void checkArrivals();
 
-// ----------------------------------------------------------------------------
-// EMERGENCY HALT
-// ----------------------------------------------------------------------------
-// Apply emergency halt in active zone.
-void applyEmergencyHalt();
-
-// Update emergency halt timer.
-void updateEmergencyHalt();
-
 #endif
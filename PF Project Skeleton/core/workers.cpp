@@ -0,0 +1,195 @@
+#include "workers.h"
+#include <thread>
+#include <mutex>
+#include <condition_variable>
+#include <atomic>
+#include <cstdlib>
+
+// ============================================================================
+// WORKERS.CPP - Persistent worker threads (fork-join and work stealing)
+// ============================================================================
+
+static std::thread workerThreads[MAX_WORKERS];
+static std::mutex workerMutex;
+static std::condition_variable workerWake;
+static std::condition_variable workerDone;
+
+static void (*workerTask)(int) = nullptr;
+static int workerCount = 1;
+static int workerGeneration = 0;   // Bumped for every runOnWorkers call
+static int workersBusy = 0;        // Helpers still running the current task
+static bool workersStopping = false;
+static bool exitHookInstalled = false;
+
+// Work-stealing chunk ranges: worker w owns chunks [head, tail), packed as
+// (head << 32 | tail) in one atomic. Stride 8 keeps each on its own cache line.
+const int RANGE_STRIDE = 8;
+static std::atomic<unsigned long long> chunkRanges[MAX_WORKERS * RANGE_STRIDE];
+static void (*chunkTask)(int, int) = nullptr;
+
+// ----------------------------------------------------------------------------
+// WORKER LOOP
+// ----------------------------------------------------------------------------
+// Wait for a new generation, run the task, report completion.
+// ----------------------------------------------------------------------------
+static void workerLoop(int workerIndex) {
+    int seenGeneration = 0;
+    
+    while (true) {
+        void (*task)(int) = nullptr;
+        {
+            std::unique_lock<std::mutex> lock(workerMutex);
+            while (!workersStopping && workerGeneration == seenGeneration) {
+                workerWake.wait(lock);
+            }
+            if (workersStopping) return;
+            seenGeneration = workerGeneration;
+            task = workerTask;
+        }
+        
+        task(workerIndex);
+        
+        {
+            std::lock_guard<std::mutex> lock(workerMutex);
+            workersBusy--;
+            if (workersBusy == 0) workerDone.notify_one();
+        }
+    }
+}
+
+// ----------------------------------------------------------------------------
+// START / STOP
+// ----------------------------------------------------------------------------
+
+void startWorkers(int count) {
+    stopWorkers();
+    
+    if (count < 1) count = 1;
+    if (count > MAX_WORKERS) count = MAX_WORKERS;
+    
+    // Joinable threads must not outlive main()
+    if (!exitHookInstalled) {
+        atexit(stopWorkers);
+        exitHookInstalled = true;
+    }
+    
+    workersStopping = false;
+    workerGeneration = 0;
+    workerCount = count;
+    for (int i = 1; i < workerCount; i++) {
+        workerThreads[i] = std::thread(workerLoop, i);
+    }
+}
+
+void stopWorkers() {
+    {
+        std::lock_guard<std::mutex> lock(workerMutex);
+        workersStopping = true;
+    }
+    workerWake.notify_all();
+    
+    for (int i = 1; i < workerCount; i++) {
+        if (workerThreads[i].joinable()) workerThreads[i].join();
+    }
+    workerCount = 1;
+}
+
+int getWorkerCount() {
+    return workerCount;
+}
+
+// ----------------------------------------------------------------------------
+// RUN ON WORKERS
+// ----------------------------------------------------------------------------
+// Caller runs worker 0, helpers run 1..count-1; returns when all are done.
+// ----------------------------------------------------------------------------
+void runOnWorkers(void (*task)(int workerIndex)) {
+    if (workerCount == 1) {
+        task(0);
+        return;
+    }
+    
+    {
+        std::lock_guard<std::mutex> lock(workerMutex);
+        workerTask = task;
+        workersBusy = workerCount - 1;
+        workerGeneration++;
+    }
+    workerWake.notify_all();
+    
+    task(0);
+    
+    std::unique_lock<std::mutex> lock(workerMutex);
+    while (workersBusy > 0) {
+        workerDone.wait(lock);
+    }
+}
+
+// ----------------------------------------------------------------------------
+// CHUNK RANGE HELPERS
+// ----------------------------------------------------------------------------
+static unsigned long long packRange(int head, int tail) {
+    return ((unsigned long long)(unsigned int)head << 32) | (unsigned int)tail;
+}
+
+// Owner takes from the front of its own range.
+static bool popOwnChunk(int worker, int& chunk) {
+    std::atomic<unsigned long long>& range = chunkRanges[worker * RANGE_STRIDE];
+    unsigned long long current = range.load();
+    while (true) {
+        int head = (int)(current >> 32);
+        int tail = (int)(current & 0xffffffffULL);
+        if (head >= tail) return false;
+        if (range.compare_exchange_weak(current, packRange(head + 1, tail))) {
+            chunk = head;
+            return true;
+        }
+    }
+}
+
+// Thieves take from the back of the next non-empty range.
+static bool stealChunk(int thief, int& chunk) {
+    for (int offset = 1; offset < workerCount; offset++) {
+        int victim = (thief + offset) % workerCount;
+        std::atomic<unsigned long long>& range = chunkRanges[victim * RANGE_STRIDE];
+        unsigned long long current = range.load();
+        while (true) {
+            int head = (int)(current >> 32);
+            int tail = (int)(current & 0xffffffffULL);
+            if (head >= tail) break;
+            if (range.compare_exchange_weak(current, packRange(head, tail - 1))) {
+                chunk = tail - 1;
+                return true;
+            }
+        }
+    }
+    return false;
+}
+
+static void chunkWorkerTask(int workerIndex) {
+    int chunk = 0;
+    while (popOwnChunk(workerIndex, chunk) || stealChunk(workerIndex, chunk)) {
+        chunkTask(workerIndex, chunk);
+    }
+}
+
+// ----------------------------------------------------------------------------
+// RUN CHUNKS ON WORKERS
+// ----------------------------------------------------------------------------
+// Even initial split, then work stealing until every chunk has run.
+// ----------------------------------------------------------------------------
+void runChunksOnWorkers(int numChunks, void (*task)(int workerIndex, int chunk)) {
+    if (workerCount == 1) {
+        for (int chunk = 0; chunk < numChunks; chunk++) task(0, chunk);
+        return;
+    }
+    
+    chunkTask = task;
+    for (int w = 0; w < workerCount; w++) {
+        int head = (int)((long long)numChunks * w / workerCount);
+        int tail = (int)((long long)numChunks * (w + 1) / workerCount);
+        chunkRanges[w * RANGE_STRIDE].store(packRange(head, tail));
+    }
+    
+    runOnWorkers(chunkWorkerTask);
+}
@@ -0,0 +1,30 @@
+#ifndef WORKERS_H
+#define WORKERS_H
+
+// ============================================================================
+// WORKERS.H - Persistent worker threads (fork-join and work stealing)
+// ============================================================================
+// A fixed set of threads that run one task function per call and then wait
+// for the next. The calling thread takes part as worker 0.
+// Chunked jobs start with an even split of chunks per worker; a worker that
+// runs out steals chunks from the back of another worker's range.
+// ============================================================================
+
+const int MAX_WORKERS = 64;
+
+// Start the pool with this many workers (including the calling thread).
+void startWorkers(int count);
+
+// Stop and join all worker threads.
+void stopWorkers();
+
+// Number of workers in the pool (1 when not started).
+int getWorkerCount();
+
+// Run task(workerIndex) on every worker and wait until all return.
+void runOnWorkers(void (*task)(int workerIndex));
+
+// Run task(workerIndex, chunk) for chunks 0..numChunks-1 with work stealing.
+void runChunksOnWorkers(int numChunks, void (*task)(int workerIndex, int chunk));
+
+#endif
@@ -0,0 +1,46 @@
+# tick spawn route counters queue move flip arrivals halt signals
+0 5cdc65d964b02850 5cdc65d964b02850 5cdc65d964b02850 5cdc65d964b02850 7d98515636eb4b29 7d98515636eb4b29 7d98515636eb4b29 7d98515636eb4b29 7d98515636eb4b29
+1 84ac6d95638c6870 84ac6d95638c6870 84ac6d95638c6870 84ac6d95638c6870 a8d75d8498b3c926 a8d75d8498b3c926 a8d75d8498b3c926 a8d75d8498b3c926 a8d75d8498b3c926
+2 2a8e8efa040f9e2a 2a8e8efa040f9e2a 2a8e8efa040f9e2a 2a8e8efa040f9e2a 008e25988db4af5a 008e25988db4af5a 008e25988db4af5a 008e25988db4af5a 008e25988db4af5a
+3 6de7fb0f0d731c32 6de7fb0f0d731c32 6de7fb0f0d731c32 6de7fb0f0d731c32 611057956bf054d7 611057956bf054d7 611057956bf054d7 611057956bf054d7 611057956bf054d7
+4 4a1dd6b12ee80b65 4a1dd6b12ee80b65 d0357417d5967b63 d0357417d5967b63 96a2fd8e3384c1cd 96a2fd8e3384c1cd 96a2fd8e3384c1cd 96a2fd8e3384c1cd 96a2fd8e3384c1cd
+5 14b9b21910323932 14b9b21910323932 161387b51052e6c4 161387b51052e6c4 3719792989cb96c4 3719792989cb96c4 3719792989cb96c4 3719792989cb96c4 3719792989cb96c4
+6 5003f3775bea0ccd 5003f3775bea0ccd 5003f3775bea0ccd 5003f3775bea0ccd eef1b115a3589c02 eef1b115a3589c02 eef1b115a3589c02 eef1b115a3589c02 eef1b115a3589c02
+7 2e88e128609b0623 2e88e128609b0623 2e88e128609b0623 2e88e128609b0623 3d5f95141ec08cce 3d5f95141ec08cce 3d5f95141ec08cce 3d5f95141ec08cce 3d5f95141ec08cce
+8 038109ebf6b4803d 038109ebf6b4803d 038109ebf6b4803d 038109ebf6b4803d 011398f57285742f 011398f57285742f 011398f57285742f 011398f57285742f 011398f57285742f
+9 2da83c16dc3df6c6 2da83c16dc3df6c6 2da83c16dc3df6c6 2da83c16dc3df6c6 ecdfb1ae8107e448 ecdfb1ae8107e448 ecdfb1ae8107e448 ecdfb1ae8107e448 ecdfb1ae8107e448
+10 83489015d25fb2ca 83489015d25fb2ca 83489015d25fb2ca 83489015d25fb2ca e1ab073354bb0ae6 e1ab073354bb0ae6 e1ab073354bb0ae6 e1ab073354bb0ae6 e1ab073354bb0ae6
+11 e9dca590413cbfc1 e9dca590413cbfc1 e9dca590413cbfc1 e9dca590413cbfc1 61e49f009dc53db5 61e49f009dc53db5 61e49f009dc53db5 61e49f009dc53db5 61e49f009dc53db5
+12 66255cd62801bebb 66255cd62801bebb 908a90ed78c0abc0 908a90ed78c0abc0 dfc28c8286300812 dfc28c8286300812 dfc28c8286300812 dfc28c8286300812 dfc28c8286300812
+13 e962aa1439d675f7 e962aa1439d675f7 f736f846b095fd5a f736f846b095fd5a 39f7e58fd2cbf91b 39f7e58fd2cbf91b 39f7e58fd2cbf91b 39f7e58fd2cbf91b 39f7e58fd2cbf91b
+14 338d7c83eeb45c1a 338d7c83eeb45c1a aa519044a613e01b 03e8311148ab3593 2d770e26b14b50ae e7c089b6c2115d62 e7c089b6c2115d62 e7c089b6c2115d62 e7c089b6c2115d62
+15 e319dc4702bc3c1c e319dc4702bc3c1c c11b18c6eacbbbc7 c11b18c6eacbbbc7 e13c209e41d929c9 e13c209e41d929c9 e13c209e41d929c9 e13c209e41d929c9 e13c209e41d929c9
+16 14bf82a0026db9e8 14bf82a0026db9e8 40ff91ff2fdf8772 40ff91ff2fdf8772 cf13ca6fc5f68ff7 cf13ca6fc5f68ff7 cf13ca6fc5f68ff7 cf13ca6fc5f68ff7 cf13ca6fc5f68ff7
+17 2dedaa1c2d366f1e 2dedaa1c2d366f1e 2dedaa1c2d366f1e 2dedaa1c2d366f1e 6fc7248292850bb8 6fc7248292850bb8 6fc7248292850bb8 6fc7248292850bb8 6fc7248292850bb8
+18 28695beca5a4aa20 28695beca5a4aa20 28695beca5a4aa20 28695beca5a4aa20 dadf3e5706526366 dadf3e5706526366 dadf3e5706526366 dadf3e5706526366 dadf3e5706526366
+19 3f6d044fe84920c9 3f6d044fe84920c9 3f6d044fe84920c9 3f6d044fe84920c9 f87f7bcca28688a1 f87f7bcca28688a1 f87f7bcca28688a1 f87f7bcca28688a1 f87f7bcca28688a1
+20 84368fa6ca019f9d 84368fa6ca019f9d 5458bf9319150c90 5458bf9319150c90 c309373f90a8c455 c309373f90a8c455 c309373f90a8c455 c309373f90a8c455 c309373f90a8c455
+21 8f549578b4d694b8 8f549578b4d694b8 4afef50e0e47ec3d 4afef50e0e47ec3d 96a657dbe6ab61b8 96a657dbe6ab61b8 96a657dbe6ab61b8 96a657dbe6ab61b8 96a657dbe6ab61b8
+22 82237d4f9773adaf 82237d4f9773adaf fd7b35ed74b08c56 77e8010ff3667826 5ce25a5707e6c090 8c9135c9de4b95d2 8c9135c9de4b95d2 8c9135c9de4b95d2 8c9135c9de4b95d2
+23 d3c9283a5d383c60 d3c9283a5d383c60 3ced7de61062b8f8 3ced7de61062b8f8 4a59dac5ab52126c 4a59dac5ab52126c 4a59dac5ab52126c 4a59dac5ab52126c 4a59dac5ab52126c
+24 1c89ece5b776e1ab 59ef8532f3ab7730 187030d2e343594c 40c6122fea904d23 4a9d70f1f3d19f8f e4fb5c61316d016e e4fb5c61316d016e e4fb5c61316d016e e4fb5c61316d016e
+25 cfec26f59dbd3a66 cfec26f59dbd3a66 6f9a461d66c941d2 6f9a461d66c941d2 91211a985d32bb55 91211a985d32bb55 91211a985d32bb55 91211a985d32bb55 91211a985d32bb55
+26 d2a311568c856036 d2a311568c856036 d2a311568c856036 d2a311568c856036 f903a79cc29f1337 f903a79cc29f1337 f903a79cc29f1337 f903a79cc29f1337 f903a79cc29f1337
+27 b0d5b9ca65b1fa94 b0d5b9ca65b1fa94 b0d5b9ca65b1fa94 b0d5b9ca65b1fa94 8e4d4844870d2c78 8e4d4844870d2c78 8e4d4844870d2c78 8e4d4844870d2c78 8e4d4844870d2c78
+28 25c34a07520eb455 25c34a07520eb455 25c34a07520eb455 25c34a07520eb455 2e1c8078e998ce01 2e1c8078e998ce01 2e1c8078e998ce01 2e1c8078e998ce01 2e1c8078e998ce01
+29 a6ced9eb6137e6f3 a6ced9eb6137e6f3 a6ced9eb6137e6f3 a6ced9eb6137e6f3 72020b38503e2156 72020b38503e2156 72020b38503e2156 72020b38503e2156 72020b38503e2156
+30 f8d6fc43accb822f f8d6fc43accb822f f8d6fc43accb822f f8d6fc43accb822f 61b20a68bd978ef0 61b20a68bd978ef0 61b20a68bd978ef0 61b20a68bd978ef0 61b20a68bd978ef0
+31 0bd3bc63b9f284a5 0bd3bc63b9f284a5 0bd3bc63b9f284a5 0bd3bc63b9f284a5 8b32993db4c36cf1 8b32993db4c36cf1 7be787017e2c3a6c 7be787017e2c3a6c 7be787017e2c3a6c
+32 86e70049ce556548 86e70049ce556548 86e70049ce556548 86e70049ce556548 ea4ed74eefb979b3 ea4ed74eefb979b3 ea4ed74eefb979b3 ea4ed74eefb979b3 ea4ed74eefb979b3
+33 35c29952f3d5a2ac cba325ed1fbfdd87 cba325ed1fbfdd87 cba325ed1fbfdd87 b2d00cdb62dc38a6 b2d00cdb62dc38a6 b2d00cdb62dc38a6 b2d00cdb62dc38a6 b2d00cdb62dc38a6
+34 d7906e48c214a8ed 249ad75d6e60422d 249ad75d6e60422d 249ad75d6e60422d bf6f2380776f6050 bf6f2380776f6050 bf6f2380776f6050 bf6f2380776f6050 bf6f2380776f6050
+35 d1791337ce76ef37 c682d08f5e4d79d1 c682d08f5e4d79d1 c682d08f5e4d79d1 659f3d0c2139565c 659f3d0c2139565c 659f3d0c2139565c 659f3d0c2139565c 659f3d0c2139565c
+36 79c6d3c361df640c 79c6d3c361df640c bb0c0b1ff152bc59 45ffc4bfb33f68c3 00014edfee5d8fa1 abce4ad12ca1125b abce4ad12ca1125b abce4ad12ca1125b abce4ad12ca1125b
+37 30d1439eb72c995a 30d1439eb72c995a 30d1439eb72c995a 30d1439eb72c995a 7e9deb313207fd65 7e9deb313207fd65 7e9deb313207fd65 7e9deb313207fd65 7e9deb313207fd65
+38 40f5d0e94b0e184f 40f5d0e94b0e184f 40f5d0e94b0e184f 40f5d0e94b0e184f aad9fbcd12b50c98 aad9fbcd12b50c98 aad9fbcd12b50c98 aad9fbcd12b50c98 aad9fbcd12b50c98
+39 d57c054ce3fdf296 d57c054ce3fdf296 d57c054ce3fdf296 d57c054ce3fdf296 16e11333dd848594 16e11333dd848594 16e11333dd848594 16e11333dd848594 16e11333dd848594
+40 1447690bbb49894d 1447690bbb49894d 1447690bbb49894d 1447690bbb49894d 4a65291412d9514e 4a65291412d9514e 4a65291412d9514e 4a65291412d9514e 4a65291412d9514e
+41 d32306b11fc9fdab d32306b11fc9fdab d32306b11fc9fdab d32306b11fc9fdab b38c30a6ac0d8647 b38c30a6ac0d8647 b38c30a6ac0d8647 b38c30a6ac0d8647 b38c30a6ac0d8647
+42 604010d8f72bbe16 604010d8f72bbe16 604010d8f72bbe16 604010d8f72bbe16 542c79538ea92cfc 542c79538ea92cfc c83cb7d372851008 c83cb7d372851008 c83cb7d372851008
+43 d8dd7a30271f696d d8dd7a30271f696d d8dd7a30271f696d d8dd7a30271f696d df5ac55417937177 df5ac55417937177 df5ac55417937177 df5ac55417937177 df5ac55417937177
+44 0bdeb36026e36186 daa1f85dfd81ca9d daa1f85dfd81ca9d daa1f85dfd81ca9d daa1f85dfd81ca9d daa1f85dfd81ca9d daa1f85dfd81ca9d daa1f85dfd81ca9d daa1f85dfd81ca9d
@@ -0,0 +1,7 @@
+# tick spawn route counters queue move flip arrivals halt signals
+0 7e6d42f1642e174b 3b1f2a4c592d6e5d 3b1f2a4c592d6e5d 3b1f2a4c592d6e5d 3b1f2a4c592d6e5d 3b1f2a4c592d6e5d 3b1f2a4c592d6e5d 3b1f2a4c592d6e5d 3b1f2a4c592d6e5d
+1 0330bf7c1960aaa7 0330bf7c1960aaa7 0330bf7c1960aaa7 0330bf7c1960aaa7 0330bf7c1960aaa7 0330bf7c1960aaa7 0330bf7c1960aaa7 0330bf7c1960aaa7 0330bf7c1960aaa7
+2 7cf42ee370f1a471 7cf42ee370f1a471 7cf42ee370f1a471 7cf42ee370f1a471 7cf42ee370f1a471 7cf42ee370f1a471 7cf42ee370f1a471 7cf42ee370f1a471 7cf42ee370f1a471
+3 c61d225718b0c763 c61d225718b0c763 c61d225718b0c763 c61d225718b0c763 c61d225718b0c763 c61d225718b0c763 c61d225718b0c763 c61d225718b0c763 c61d225718b0c763
+4 2face23cac71e2c0 2face23cac71e2c0 2face23cac71e2c0 2face23cac71e2c0 2face23cac71e2c0 2face23cac71e2c0 2face23cac71e2c0 2face23cac71e2c0 2face23cac71e2c0
+5 9d85b7a1fb69dcc8 ca349dd6a7e04371 ca349dd6a7e04371 ca349dd6a7e04371 ca349dd6a7e04371 ca349dd6a7e04371 ca349dd6a7e04371 ca349dd6a7e04371 ca349dd6a7e04371
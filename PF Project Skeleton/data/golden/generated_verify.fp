@@ -0,0 +1,272 @@
+# tick spawn route counters queue move flip arrivals halt signals
+0 29b3565bb107fa1b 29b3565bb107fa1b 29b3565bb107fa1b 29f104a04bf204aa 2b2678aee700189e b37f92f6e339645a b37f92f6e339645a b37f92f6e339645a b37f92f6e339645a
+1 8b7b9cbbfeace618 8b7b9cbbfeace618 8b7b9cbbfeace618 1b8afb8ef6a2602b 7a723febd7c495b2 402fec98db20d12d 402fec98db20d12d 402fec98db20d12d 402fec98db20d12d
+2 5820222c9896fdbd 5820222c9896fdbd 5820222c9896fdbd 586270d76263030c 02acf6605805b3ba be5ebc9569711ffc be5ebc9569711ffc be5ebc9569711ffc be5ebc9569711ffc
+3 549acfc4bf670250 549acfc4bf670250 549acfc4bf670250 c46ba8f1b7698463 53304d5dc1cfc47c fdf759871fadbeaa fdf759871fadbeaa fdf759871fadbeaa fdf759871fadbeaa
+4 627fee45e57c8565 627fee45e57c8565 627fee45e57c8565 623dbcbe1f897bd4 5c3106ba4c9a1ab7 9a42cbb8c2d7bf23 9a42cbb8c2d7bf23 9a42cbb8c2d7bf23 9a42cbb8c2d7bf23
+5 d37d50f4a109ddb5 d37d50f4a109ddb5 d37d50f4a109ddb5 438c37c1a9075b86 c86f858d256e69d9 477b2e885e66d30b 477b2e885e66d30b 477b2e885e66d30b 477b2e885e66d30b
+6 8da88ba4aa505a0d 8da88ba4aa505a0d 8da88ba4aa505a0d 8dead95f50a5a4bc d1736e674dcae951 a35eef30c6998ebb a35eef30c6998ebb a35eef30c6998ebb a35eef30c6998ebb
+7 f6ccb95438140ce7 f6ccb95438140ce7 f6ccb95438140ce7 663dde61301a8ad4 7c759cc957b37f3d 979084a200e08535 979084a200e08535 979084a200e08535 979084a200e08535
+8 80cddf86140c29b5 80cddf86140c29b5 372cbff64bf86c0e 376eed0db10d92bf 6ddc4db6d397838a 1b28edd2ae87f577 1b28edd2ae87f577 1b28edd2ae87f577 1b28edd2ae87f577
+9 ae3cc7a820ca42dc ae3cc7a820ca42dc 5e50b42cc1ac543a cea1d319c9a2d209 11de2bd64d780390 9fb07a2812b6b249 9fb07a2812b6b249 9fb07a2812b6b249 9fb07a2812b6b249
+10 05e1c8479067f4d5 05e1c8479067f4d5 05e1c8479067f4d5 05a39abc6a920a64 faa559d22cabab49 d84cb423be273242 d84cb423be273242 d84cb423be273242 d84cb423be273242
+11 465cf9ae8a0995f2 465cf9ae8a0995f2 465cf9ae8a0995f2 d6ad9e9b820713c1 adf15932ef641b55 c65a932fbead7bfe c65a932fbead7bfe c65a932fbead7bfe c65a932fbead7bfe
+12 14d305271b1c8612 14d305271b1c8612 44a862504ce3e831 5cd8be49b1672082 1935501080e4c723 96442ac2dc6d58b8 96442ac2dc6d58b8 96442ac2dc6d58b8 96442ac2dc6d58b8
+13 0e03c51cd6e2ffde 0e03c51cd6e2ffde 0e03c51cd6e2ffde 9ef2a229deec79ed 716f985557f10d75 124d1818974f21b4 124d1818974f21b4 124d1818974f21b4 124d1818974f21b4
+14 28e1bbd0916c335a 28e1bbd0916c335a 28e1bbd0916c335a 28a3e92b6b99cdeb acf6457d69ff09f4 0e7341858b5a96ce 8ccc4d9c4dda238e 8ccc4d9c4dda238e 8ccc4d9c4dda238e
+15 67e2f1e1561d1b16 67e2f1e1561d1b16 67e2f1e1561d1b16 f71396d45e139d25 66379f4c036c2aa3 3a3a3490da39910c 3a3a3490da39910c 3a3a3490da39910c 3a3a3490da39910c
+16 abd70e9c4b81d79c abd70e9c4b81d79c 12c6042b6cdd2521 128456d09628db90 5ba2a1b86f725df2 a2945325ecab35d3 a2945325ecab35d3 a2945325ecab35d3 a2945325ecab35d3
+17 e05229292f6cbe03 e05229292f6cbe03 45588388480ae810 97fbb2b445f1d2a1 959388ea3994909f d534c49c0ef56f70 d534c49c0ef56f70 d534c49c0ef56f70 d534c49c0ef56f70
+18 50d478d134914b03 50d478d134914b03 58241ba44a2356fe 5866495fb0d6a84f b2d98093165d6626 86216b9e202b042b 86216b9e202b042b 86216b9e202b042b 86216b9e202b042b
+19 87c5c2455d24fee9 87c5c2455d24fee9 87c5c2455d24fee9 1734a570552a78da 928f55452d719e0f 90403a8c1c983ac2 937ebe464e0faa00 937ebe464e0faa00 937ebe464e0faa00
+20 add68a728fbca272 add68a728fbca272 f949e90f26d49c35 f47399f202f670ff a7aa71f889312b28 bcf5eed20e78b7fc bcf5eed20e78b7fc bcf5eed20e78b7fc bcf5eed20e78b7fc
+21 bacbb2a39a55a6b3 bacbb2a39a55a6b3 5efa6694c40a70fc ce0b01a1cc04f6cf 8ba4d5b0f2c56fb9 002a475a7d42527a 002a475a7d42527a 002a475a7d42527a 002a475a7d42527a
+22 efb0e809e92d6e9d efb0e809e92d6e9d efb0e809e92d6e9d eff2baf213d8902c f08703044c30f807 1989d438cf5f050c 1989d438cf5f050c 1989d438cf5f050c 1989d438cf5f050c
+23 40ba7c27e649340e 40ba7c27e649340e 40ba7c27e649340e d04b1b12ee47b23d 8d505676823bc5d4 5b69a8a7d692237f 5b69a8a7d692237f 5b69a8a7d692237f 5b69a8a7d692237f
+24 1a9a731b4be22d56 1a9a731b4be22d56 68282f0e1c0452de 686a7df5e6f1ac6f 3e996a6f8a72c792 635bc034d6d0f6f0 635bc034d6d0f6f0 635bc034d6d0f6f0 635bc034d6d0f6f0
+25 6f618a11cf1b0687 6f618a11cf1b0687 bebcfb8ff1371d78 45151fec2e4233b2 ab29f67362af2958 aceb268eb747df73 aceb268eb747df73 aceb268eb747df73 aceb268eb747df73
+26 010a0afa96370c62 010a0afa96370c62 e7d4da6847492ca6 ffa40671bacde415 2598f3af1e03d996 1f9602cd7b06439d 1f9602cd7b06439d 1f9602cd7b06439d 1f9602cd7b06439d
+27 5332268b5e94c3e3 5332268b5e94c3e3 3b4969f1596b5ea8 abb80ec45165d89b 4292b796fe737138 a37848ea27ecb6ab a37848ea27ecb6ab a37848ea27ecb6ab a37848ea27ecb6ab
+28 1495c7812d93a039 1495c7812d93a039 44893b820af65f39 b3a7dfdc87fdf4b8 42bfb88172dda721 888b815ec8919f47 888b815ec8919f47 888b815ec8919f47 888b815ec8919f47
+29 dd07f1ac7ce8a263 dd07f1ac7ce8a263 8cff00c67fc0895e 5de6765fc8cdfda6 69f568f8205277c8 088f204c78135677 088f204c78135677 088f204c78135677 088f204c78135677
+30 2a86cb8636b4eb19 95b20faa35fb1b88 2daf3cdb0edd7fd1 2ded6e20f4288160 bf7d2e5d7a4d92bb c291e49c690fc795 c291e49c690fc795 c291e49c690fc795 c291e49c690fc795
+31 2b30db77614ad282 2b30db77614ad282 9cd1bb073ebe9739 0c20dc3236b0110a a1715088133334af 2673888c74e3c966 2673888c74e3c966 2673888c74e3c966 2673888c74e3c966
+32 aa81b71d66fb9bb1 aa81b71d66fb9bb1 9d1f75c6f92d9a9e fe3fca8a6f36c1b6 2fe0ef1d1ad61a28 e7e66a92faf05bcd 7d03c6d73df68fe1 7d03c6d73df68fe1 7d03c6d73df68fe1
+33 9b950e8ba6cc7a0b 9b950e8ba6cc7a0b 5773720e316936a4 89515888c0854cc3 a7b53da5e9e12e50 6459b3b437a91d59 6459b3b437a91d59 6459b3b437a91d59 6459b3b437a91d59
+34 fd4f236a5059641c fd4f236a5059641c fd4f236a5059641c fd0d7191aaac9aad 609bd4fca981933b 15d5263dc9cacf58 15d5263dc9cacf58 15d5263dc9cacf58 15d5263dc9cacf58
+35 e840c9cd33c74867 e840c9cd33c74867 19a9f1a87acda76d 8958969d72c3215e e5a3b4afb889dac8 0503cee1b38a7cbe 0503cee1b38a7cbe 0503cee1b38a7cbe 0503cee1b38a7cbe
+36 47da3832c9b39052 47da3832c9b39052 f41b51880e025446 abfea284f14a3b83 f93f4fb9b034a6c4 d28c370750219495 d28c370750219495 d28c370750219495 d28c370750219495
+37 acc56ece7740f605 acc56ece7740f605 37b398d8c568a353 82113404c2bc55c9 addef8f4e5c72022 0143c3c355040ad2 0143c3c355040ad2 0143c3c355040ad2 0143c3c355040ad2
+38 22696e00aefc9364 22696e00aefc9364 f25109ecdfe6fa8c f2135b172513043d 92ebb6e2a9b6d8a7 ba66abdf4b776eb7 ba66abdf4b776eb7 ba66abdf4b776eb7 ba66abdf4b776eb7
+39 68bb88bb29e20418 20dd93822ac1d08c 3acf4367bc7d2389 9ff05411119d459f 35ea7cc4adae9498 af6a1971ec6c149c af6a1971ec6c149c af6a1971ec6c149c af6a1971ec6c149c
+40 3c170325f3d4b3f2 3c170325f3d4b3f2 84a8471be9238d24 bea1b22fba48f0f3 f5cec957799cd45d 3c9ab89e93fcfdd3 3bdf978cf109d1f6 3bdf978cf109d1f6 3bdf978cf109d1f6
+41 30595f5426d1d400 30595f5426d1d400 51fb0a5b17b3cc36 4a211364af2f9d9e c740b4dbb5c2755f 91a6385d0e86bf50 8ba1eb72c9f50b7f 8ba1eb72c9f50b7f 8ba1eb72c9f50b7f
+42 a1ab65f71b6097a1 a1ab65f71b6097a1 7415102ccb4b732d 745742d731be8d9c 6f53300005c0fa47 60d8eb141ee7ae2b 60d8eb141ee7ae2b 60d8eb141ee7ae2b 60d8eb141ee7ae2b
+43 d9fed11367c2bce7 d9fed11367c2bce7 22cd30954eed9c4d 76a59e8546c07ae6 73a56d48de25424b c4519f154d9b9525 c4519f154d9b9525 c4519f154d9b9525 c4519f154d9b9525
+44 a735192a65e53c64 a735192a65e53c64 0989816c1cd155b3 22cd3ca5c86fc218 ce56218a9aa49a8f 7f2bd91c09008498 ddf688de37978815 ddf688de37978815 ddf688de37978815
+45 4afd79620898d1a3 4afd79620898d1a3 3366218ab426b646 a5b16d2820c3c0d6 cd2d05742b0636be 804a85b875caee4a 804a85b875caee4a 804a85b875caee4a 804a85b875caee4a
+46 da90ee5f079b4b89 da90ee5f079b4b89 628ddd2e3cbd2fd0 62cf8fd5c648d161 a575f689a8c15dc9 7b130ff9f27d090e a9c845dd069992d8 a9c845dd069992d8 a9c845dd069992d8
+47 8ac9db757673b7ea 8ac9db757673b7ea c5626fa278eee418 5593089770e0622b c0298ed931c53896 0d3529557d768e98 0d3529557d768e98 0d3529557d768e98 0d3529557d768e98
+48 5987b87a10e4b9da 5987b87a10e4b9da a83b5bcb1c6b6a5d 4e77abc1fb803698 cd594e75e6d7fed5 e6351cb9448802f9 521ce1d5515f2f21 521ce1d5515f2f21 521ce1d5515f2f21
+49 3e5d766034ec8f93 3e5d766034ec8f93 a0f44234fd72d92d 6b8e87b01068b051 820228e0d72a979f fb9b62f6855274f4 d9fffb424ce494a9 d9fffb424ce494a9 d9fffb424ce494a9
+50 f462f2552aa164aa f462f2552aa164aa 6fadce9b926b98c0 213cd1d3917c9a25 53708a44be5dda6f 7aa33c18791099fa 7aa33c18791099fa 7aa33c18791099fa 7aa33c18791099fa
+51 29ec41db6d6ceeb8 29ec41db6d6ceeb8 e9b121f18c7c8978 4c8e3687219cef6e e3bd0c98ad43b0f4 6721ffeb4f77718b 6721ffeb4f77718b 6721ffeb4f77718b 6721ffeb4f77718b
+52 8428acd98408f71b 8428acd98408f71b 707bc5d01c34a7df 4a7230e44f5fda08 a1a429a4f1150da4 8946f17c45f4fb2c 8946f17c45f4fb2c 8946f17c45f4fb2c 8946f17c45f4fb2c
+53 f28f20a41f5fd9a9 f28f20a41f5fd9a9 518c6353ec118abe 48f591c42068ebfe 7e13474eb9477792 72c0da3a37ef18a0 72c0da3a37ef18a0 72c0da3a37ef18a0 72c0da3a37ef18a0
+54 e6c4ad200345835b fdd694aa6f8570c0 96d0ebe38d31269c 9692b91877c4d82d aa2b50538dadb985 b03943f73795ab43 e2ee1a8999f36aff e2ee1a8999f36aff e2ee1a8999f36aff
+55 e5915828e55ef508 e5915828e55ef508 9f83e0dfff5292f7 17400908f02d22c6 124309e59dabb051 853e7cbba28eebcc 33ece77f8c448b51 33ece77f8c448b51 33ece77f8c448b51
+56 bc7865efd1ff0a78 bc7865efd1ff0a78 be9ad69801a02021 1f212aa373b8c328 50c365d1a6ec366a aa665e826f94fdef aa665e826f94fdef aa665e826f94fdef aa665e826f94fdef
+57 a5ee0f07537e7a24 a5ee0f07537e7a24 1f54fe862f89d9b5 f507f4b339f1589b c578df74b1713683 e64a7bc466bc5d2f 0e9e5e61b47f3b21 0e9e5e61b47f3b21 0e9e5e61b47f3b21
+58 7d98c2994c87d18a 43bb8ee1e2ddb84a d33acd762a3ad658 811b9780e5af8c34 99fcb535fc10fc63 32aa9969cfdbcb8b 32aa9969cfdbcb8b 32aa9969cfdbcb8b 32aa9969cfdbcb8b
+59 01a4e2b0bc8be9ab ba9fb1cb5191215b f2b1560b8ac5f2ea bebcbce11338b5d5 fb32e745794e3dbb 0de577eec9ddb596 3b5ad7026c0601b0 3b5ad7026c0601b0 3b5ad7026c0601b0
+60 58ee839d27c45b28 58ee839d27c45b28 37ac34720c5c0786 79d2b32cfcf1a9cb d01b7ee92ceed1b9 fef4a5267e6c5768 fef4a5267e6c5768 fef4a5267e6c5768 fef4a5267e6c5768
+61 0b34a37f7d51d366 82213adb0e8e9e61 9b076d183ced7a29 0bf60a2d34e3fc1a 32c49bdb2a4c30b1 427b82c015e01fd8 427b82c015e01fd8 427b82c015e01fd8 427b82c015e01fd8
+62 e4c643d4b3e67114 e4c643d4b3e67114 1f028bfcc7566c24 24a907342052e764 829922705c559a96 22de4958b45f2a87 fe11567c4c6883cd fe11567c4c6883cd fe11567c4c6883cd
+63 2324ed8bfb67deb5 2324ed8bfb67deb5 8d963178ec210efd 1d67564de42f88ce 4f490b3abd54606a 5645fff6b0ef536a 5645fff6b0ef536a 5645fff6b0ef536a 5645fff6b0ef536a
+64 6c965069d358db90 6c965069d358db90 c898055baa4902fc b4fab79948cc1abd 75e4b6f91f723781 d404159b8129faf0 971fc64875ff84e2 971fc64875ff84e2 971fc64875ff84e2
+65 c440d031d2b77666 c440d031d2b77666 0e7fb7e2cff06895 ec3febd6ca8c1fc2 22f43c356f3041a1 ee4115ca5e5de709 ee4115ca5e5de709 ee4115ca5e5de709 ee4115ca5e5de709
+66 f9b24220686488ed f9b24220686488ed 2d44bdbee76895cb fc610e4cc8f9eb49 770adf17096d752b da9518d4e45f3247 a2c6638b397d18a2 a2c6638b397d18a2 a2c6638b397d18a2
+67 e56bac05d671cd59 e56bac05d671cd59 816a8a761977eae7 b513bfe3b546df36 bd8ee43ea7761e6a b151b74e5780a81f b151b74e5780a81f b151b74e5780a81f b151b74e5780a81f
+68 26933cdcb37f07b2 26933cdcb37f07b2 d91e3885967c7f86 bc3e7d7b9ea64bec 301abc38937702bf 0187041775eac07a e2d5b03daff8e098 e2d5b03daff8e098 e2d5b03daff8e098
+69 79663107075a09dc 79663107075a09dc f553a5f2042d2b6b b517f889b4dbfe6f 64ebcec7309a5da6 6be829ac638c17e2 32d2fc37c52e74ab 32d2fc37c52e74ab 32d2fc37c52e74ab
+70 d364bac44056f26b d364bac44056f26b aa74a2520a04b913 aa36f0a9f0f147a2 dbaf4f7e2fe37770 f231305b71112225 f231305b71112225 f231305b71112225 f231305b71112225
+71 ca0557ffc687741c ca0557ffc687741c bd02569707f6e24a 419b74213d68da9f 2cd6032cc8cb4c28 30689ad2397a2c67 30689ad2397a2c67 30689ad2397a2c67 30689ad2397a2c67
+72 4480df2e96a6b6b6 4480df2e96a6b6b6 d160e051b36756f2 b43b288e35eea423 30f4f9edaee6cba0 81f714fb445d3c2f 8e9e6195b12f2ac1 8e9e6195b12f2ac1 8e9e6195b12f2ac1
+73 3a84062334aa5c46 3a84062334aa5c46 46e6e3a0e68592b1 8297c2d4b36931e6 afbe64c2b9537803 78104443b7323159 78104443b7323159 78104443b7323159 78104443b7323159
+74 edf230a45f3d98fc cd0ef158732ce416 55e335cfd0fc51cf 1edb815956f903ca 11b84f513f8ce901 16412395a26ea5c9 74bd9dcc47b4444f 74bd9dcc47b4444f 74bd9dcc47b4444f
+75 1fa417b3bb557c8b 7b9c37e33e3d4691 d2ee765e408c9416 d6aedb0fdde63cc1 637537f088160e7c c93ad4b3d8aad7a8 1fc9085857c0f405 1fc9085857c0f405 1fc9085857c0f405
+76 0717fb1b6af18774 0717fb1b6af18774 a5eecacb206211cc b428a02f7e589844 44412e06caf98f92 d81aa1bb3da495e3 d81aa1bb3da495e3 d81aa1bb3da495e3 d81aa1bb3da495e3
+77 edee763ce5ff19c5 edee763ce5ff19c5 11eeaf4265669c47 251f18f93cd6c749 447b9e3ae90ca5ed 49160a097449b4dd 6768d7d65d27ec4a 6768d7d65d27ec4a 6768d7d65d27ec4a
+78 d0c44d36ecd2f906 8d5a540e45d126e1 ab6aeb6a7b4e28f4 ab28b99181bbd645 9a58aa111f9daacb 72a8b981397f745f e422e2aae2275d3b e422e2aae2275d3b e422e2aae2275d3b
+79 852e249d3b63e1ff 0dee82859d815ddc 9244ea25b46ba204 b5f01756838a0d27 f7255bf2fe104821 ab403daa2aa828c4 13dc9a41970ccd6e 13dc9a41970ccd6e 13dc9a41970ccd6e
+80 8777b46a89cbd7a5 8777b46a89cbd7a5 48157088cacbb75c aaaf91a38fcebcd7 9fdaa5ee8ac8bd97 aa7901c608c573bb 0863939a6cbd38d3 0863939a6cbd38d3 0863939a6cbd38d3
+81 15c17387c2ddd204 15c17387c2ddd204 976eaed5e76e07f3 3dd46e2f46fe02a6 7cae6d89359b845d cf75042e43ef9ede d2f9428c379de263 d2f9428c379de263 d2f9428c379de263
+82 227c7b1ce062c4e0 cfe23dc46fd8eb9f 5bfd6bee527b0313 5a55cdc918e39e52 50264a8ba561f22a 9630fa3612a2d1eb b89da8a2df371223 b89da8a2df371223 b89da8a2df371223
+83 58093e2ced8552b9 c28887b1e873bc86 6e04da4cf341cbec b5779acc9d762c5c 23e1887e68dbacbf 05088bef37253532 05088bef37253532 05088bef37253532 05088bef37253532
+84 cafceb21cf962dd2 cafceb21cf962dd2 2a313149a226160f f7d30786a7c7d77e 9233f70cebd5667d 05921d7c04a485b6 05921d7c04a485b6 05921d7c04a485b6 05921d7c04a485b6
+85 909394d027994e39 909394d027994e39 6c22835c29af3344 4dfffab6b58e2322 6c968458c7ad841f e344079ad25dc0ca 475b7e1cdab51e56 475b7e1cdab51e56 475b7e1cdab51e56
+86 4980ab52ce9b6200 4980ab52ce9b6200 b8d34154ba19e1b8 1acdc4a27486d3f7 d97b9d524656c5e4 1cfea40ccc2a9911 66c865b55383f926 66c865b55383f926 66c865b55383f926
+87 6351084b4b2951ca 8b993ae34a0a0e08 a26e37fb958ea9cf 329f50ce9d802ffc 451a40626415c95f 965d8e7b1abf037c 9d890c43d9b9306b 9d890c43d9b9306b 9d890c43d9b9306b
+88 5bd46ae4510fba96 5bd46ae4510fba96 f4678348b517d5ac 2f3ac41da9d8f6e6 7ea0b1e9b4f6f9ff 6a3a67a673dfa082 db924b1ee9a55cb4 db924b1ee9a55cb4 db924b1ee9a55cb4
+89 a970e2e919adabad a970e2e919adabad 8bf13577b2e095cf 800f2d6265e5d44d f1849a1b3ddac7f8 8437d1c930fbfd4c e17213b125351612 e17213b125351612 e17213b125351612
+90 d4c5afadcb88d6fb d4c5afadcb88d6fb b3dbaa56ef4feb2f cf69b6ffae77a0e9 a9929d8d0dfbe4ea 5a9d7a91060d31c7 c293529718320733 c293529718320733 c293529718320733
+91 c0d8d41b75ebf498 645ee828dcaca272 f52edb5e605014d2 65dfbc6b685e92e1 30842f02530a3b2a f616cbcc276d2e25 d365940bd5d09a9b d365940bd5d09a9b d365940bd5d09a9b
+92 25a9fdd668cdec66 25a9fdd668cdec66 a6e9b42f445993ef bc85ff5565c73914 4852ed6a6835d47d 8ade0ca687bfab47 8ade0ca687bfab47 8ade0ca687bfab47 8ade0ca687bfab47
+93 760f68c7a39508b5 760f68c7a39508b5 62b4ca965b7f1427 d3f100b9fe91b2e4 90771a635664a805 b16c1cb0a476d394 098afc4158bdf7ad 098afc4158bdf7ad 098afc4158bdf7ad
+94 20752e990336265a a44d3589066ed24f 641244663c910f6c ad0a883e9dea9ca9 b2a1e09d6a4e9c31 a766c17ef2db043b 8f239b16a4b192b0 8f239b16a4b192b0 8f239b16a4b192b0
+95 2d71655b7760c8e8 2d71655b7760c8e8 7647b69b262a45ea 87667bb41f315f57 cc12bd2036a70472 994d0527291ba9ec b367d24bed405436 b367d24bed405436 b367d24bed405436
+96 f2656e258c8b1dd3 90518364eed5d37d 2058760545f24faf 12c001eda9f18756 e9d247380a7d895e 5943c107897af45f 3503fd900d1fa8ac 3503fd900d1fa8ac 3503fd900d1fa8ac
+97 1ae6de82575dadd6 1ae6de82575dadd6 0c8bc85ad407cc46 ee5910afac61c5d6 1e6b13fb8be998df 7f30341161372910 7f30341161372910 7f30341161372910 7f30341161372910
+98 e0ade95e7668b442 40788cabeb79453b 8c0d738192e21644 6e7761e36ff08f2a 999af4349c98811f fb539ea831655b05 3b9671313f5be8e3 3b9671313f5be8e3 3b9671313f5be8e3
+99 9d73fa3f038db96e 9d73fa3f038db96e fe1ac1a2b59582a2 d8589d299edc1223 195e30fb4483c947 edb6e06c6adc762c d5db79e616e3ce58 d5db79e616e3ce58 d5db79e616e3ce58
+100 ec4c6057a1772237 aac8c04d80656405 a6b094a654cff84a 1adb8fa5dca525aa 6c1249ba084ddb52 2323524b6268ed8e 5df4f133843479de 5df4f133843479de 5df4f133843479de
+101 c30d9f6c98880f50 c30d9f6c98880f50 654be67c94e236ea d29b52ad8da58cc2 56424ae0c1824903 7980abb53f45ea88 7980abb53f45ea88 7980abb53f45ea88 7980abb53f45ea88
+102 814ee16ae29cd428 402de09a2fdcb7dc 2e481e378a6a71c6 93bb2ea6ab74f277 589c97b16c811176 d99dc770f6bc6d55 f93e9b71fd88e4ba f93e9b71fd88e4ba f93e9b71fd88e4ba
+103 12477747f80cc4cc 12477747f80cc4cc 8ab43eaec222f497 b7103a26f2254db0 5998c91861ecd3f2 7a9d7f26183cbd0c e71761abfdd48c44 e71761abfdd48c44 e71761abfdd48c44
+104 283ac30f9d51f597 283ac30f9d51f597 00e7c98f84d7c517 9eafa43205874e05 1c88060901764c45 39fbf65e0eecda38 39fbf65e0eecda38 39fbf65e0eecda38 39fbf65e0eecda38
+105 23c1cdcab97bed98 e99d9ee767cb254d 1a2c18390e0f05d3 b6045086b0c08cd1 72d6bd696139a57e 213a983fdc636766 2667e77b05d740be 2667e77b05d740be 2667e77b05d740be
+106 3d95cb05616b3164 3d95cb05616b3164 f87fc23da95dc736 de9f76eaff90a729 e9418a4a2f173401 ebecde0b44aa08e8 4da49ddd5893cecb 4da49ddd5893cecb 4da49ddd5893cecb
+107 2e7a25ccc1239da3 2e7a25ccc1239da3 54fe4303a0ddd14f 656cb05b0fcd585c 81911c6c35ceeeb6 b7307a1b4fcc4fe9 5a9a81fc31bdded3 5a9a81fc31bdded3 5a9a81fc31bdded3
+108 61f80474c120c64b 769f8353500c3818 e00da566e87374f4 c16f424781e65be2 70ff1db90c91ebe6 e89985ce6f43da3a 25d826ce766bd565 25d826ce766bd565 25d826ce766bd565
+109 4503d646518b41c2 f13830b1818d7f93 aac058a6388bbd2b 3a313f9330853b18 99cc321ddd6f70bd 9ac81c87c75422b1 234da70bdeefe16c 234da70bdeefe16c 234da70bdeefe16c
+110 c13fdb19046f392d c13fdb19046f392d 65afa2402c23bc51 784ee26d165f6862 ef75d2286b098ed1 8b443103ee33ab02 fb21bb44bf5af95c fb21bb44bf5af95c fb21bb44bf5af95c
+111 7e9b0d1eee2277de 312d481df7469c2f 752826834aff4989 4830a3821fd637a5 dfccdf2a0e342f9b 20582b012987b4e0 7f597e1267861c73 7f597e1267861c73 7f597e1267861c73
+112 1c8454f2bc1bfb52 a847b3c168746f27 90e898e27117b7ad 90aaca198be2491c 4475122f6511ee7d ca0fc31fc8cec6f1 ca0fc31fc8cec6f1 ca0fc31fc8cec6f1 ca0fc31fc8cec6f1
+113 13795929ed04ab66 13795929ed04ab66 511c605aa4cbffb3 3da1d9bcaba03412 72f67c8c34d980b8 f1ca8e652e477933 f12a16826d579ba4 f12a16826d579ba4 f12a16826d579ba4
+114 79d15f12fb427df5 79d15f12fb427df5 4614f97444a994c4 27c547fab3e2d95d bc9f24f38fb8eefa 46e9ab6d0ad17829 b53d2ae35e1759af b53d2ae35e1759af b53d2ae35e1759af
+115 f20674f10955c7cc f20674f10955c7cc bd1c6a9e46a82f09 2ded0dab4ea6a93a 5fa75f0c4b33c7f6 b3d8d57cda5d23fc ad4ab3aa47c86904 ad4ab3aa47c86904 ad4ab3aa47c86904
+116 79c3c79f4fe1088b 79c3c79f4fe1088b bb86b51c809751a4 e8e2bbacb23fd5b4 cecf5aed6e94910b 6dd917f3950e03f0 a990e1610768c2f9 a990e1610768c2f9 a990e1610768c2f9
+117 30a6b9639730977a ad667d6d4631f545 bdea6fcfa15f002a 2d1b08faa9518619 3002a50529e6e2d6 abd803a4f969b7d8 abd803a4f969b7d8 abd803a4f969b7d8 abd803a4f969b7d8
+118 7f8644aa20caa646 7f8644aa20caa646 189f342a38ce221a 18dd66d1c23bdcab 0bd885e1f4cf4209 cca35a730f4a89ef 5b9d089fe3f31960 5b9d089fe3f31960 5b9d089fe3f31960
+119 9d2c5cc132af0ff9 3c03c12347cfcf66 54efe2a3aa06f6da ff0c4350329d8732 a6fa5c8c408ca606 cb304d2e70c3514a 99b16f9e218e6da8 99b16f9e218e6da8 99b16f9e218e6da8
+120 282d9fe2220c3efb bb387cbc961d7f71 7494aaacea977fc9 c5487203042eeccb 310d38e22b2383d9 f4135130f0077b89 b1f76bd0cb8b96ef b1f76bd0cb8b96ef b1f76bd0cb8b96ef
+121 68e03538e93a3a57 68e03538e93a3a57 a2430166f81d71be dc0f38b04697080c 0dcd45f838e0430e 32bc405f6dcc4bf7 addd2f76abebee10 addd2f76abebee10 addd2f76abebee10
+122 3b7201242051492a bfb6b80f5261c795 0999a85b65aa6ddb 6aa04aeb4b9ba62f 7bf6210658c93b4e 049952173f318408 96c1dda913dddc4d 96c1dda913dddc4d 96c1dda913dddc4d
+123 7202ac3b95f838a9 7202ac3b95f838a9 5b2e506aa54108b1 fe11471c08a16ea7 06756339de0e15f3 45307161179e9014 e15bf573c905efd2 e15bf573c905efd2 e15bf573c905efd2
+124 e37a4e0d0ac83720 4633a46e1d39dc06 1a1b6191d1584435 1a59336a2badba84 e059999987fde6d8 71c1f9385fed713f 6093c5e06d710489 6093c5e06d710489 6093c5e06d710489
+125 b098a178b006fe4a b098a178b006fe4a a8112023c5f34e43 bec7e10360f69bdc c680d87119b520d0 19b55f6dd14da1a3 18cd312590315e2d 18cd312590315e2d 18cd312590315e2d
+126 abb581f91324b7d8 abb581f91324b7d8 2fd9a4b7044c57fd 2f9bf64cfeb9a94c 079ca03d5b7884d5 bd6585fae62243ef 7426ad9c1d0ad6f4 7426ad9c1d0ad6f4 7426ad9c1d0ad6f4
+127 5300d1bd89562925 5300d1bd89562925 8e9ae2fa1ca1eb15 1e6b85cf14af6d26 39a7553d1c736c1e 5465339d3593d3b8 0ade83fabec36146 0ade83fabec36146 0ade83fabec36146
+128 f86f1c1e5fd2a712 412e921715d6361d a764d834e10efae5 b4a715b5fa03061e 059e83b3f352ade7 f9eb4dad522fbccd 728b643fe0cec7d8 728b643fe0cec7d8 728b643fe0cec7d8
+129 c85b475656f815c0 447d6221e085d144 8c152dc1d9ea9a29 4bcbf54cc8c80544 8b5ef4e24e28117a b41f872b87747388 b41f872b87747388 b41f872b87747388 b41f872b87747388
+130 c389f14d55a03262 c389f14d55a03262 9ee05ed4492bc122 912b62de0d1301de 9307c54d575bd1c2 a33cd4bea904b570 9db2a1a51692713b 9db2a1a51692713b 9db2a1a51692713b
+131 f15ad57195dbf039 98dd4f88cc0098b6 f656cfd0f885a5ac 7e952607f7fa159d 1e13ae38d8fc1c00 ff7bdb1682ec17fa 53a57c219525086a 53a57c219525086a 53a57c219525086a
+132 dcc7917d070ae1d2 81397717e4a7fdd0 93084af64e26d9ec b2a663232a0ab157 6349d06b51f41ccf bd2ae8964d168254 ebe05998872c4d8b ebe05998872c4d8b ebe05998872c4d8b
+133 d3f12b203085393b 952bbf61efbd02f2 2fc55648b36884c2 7cd22773224755b2 2ee773ac9e2d7d13 f5cb147bc2adc5ee 5f05768c7943624d 5f05768c7943624d 5f05768c7943624d
+134 f3d350817339201b f3d350817339201b f3d350817339201b f391027a89ccdeaa 2cd0bd5c06e170ff e153911f001404fb 1b6b3e64a28a2c5f 1b6b3e64a28a2c5f 1b6b3e64a28a2c5f
+135 bd097c441f1de98d 4f9b280ed9f3d8ca 960f3d1550ec374a 006578cb6e17e772 cdd76ad3b1595fb7 3bb240c64624bbf6 cd260eb6b937cb59 cd260eb6b937cb59 cd260eb6b937cb59
+136 4d2477cfc617bf46 56f8fae5a2d1e909 1039931d30ca09d1 d67eef558ce448fb f9f39a1aaa4d9a31 ec947097218e3113 ec947097218e3113 ec947097218e3113 ec947097218e3113
+137 ad9ac7f78dab9d21 ad9ac7f78dab9d21 4b4417655cd5bde5 c387feb253aa0dd4 e4cc9932a753a8e5 bd393d44bfafe2cf a98b74fe88314ce8 a98b74fe88314ce8 a98b74fe88314ce8
+138 1a8794013fc6652b b6c72b1c68d579bd 2322e3ce63e286b5 38726d5183ae7bfd 9f1bc4c6452f3e36 986f27c15dddf9e0 346e74c46484411b 346e74c46484411b 346e74c46484411b
+139 ba99d6e8088cdfd8 ba99d6e8088cdfd8 788c26fee69d4c70 e4bc02cd7d8341fe 3ff36fe9bfef029e 150519fe64f72caf 150519fe64f72caf 150519fe64f72caf 150519fe64f72caf
+140 0dfa0abe150e1278 0dfa0abe150e1278 0dfa0abe150e1278 0db85845effbecc9 1d9e167b9dc9f168 b240a59fab93f3c2 b240a59fab93f3c2 b240a59fab93f3c2 b240a59fab93f3c2
+141 2f6e232ef40d7773 de03a983df7c6195 d2064be381659f3e 89a4587a4ca3152f 271166f92e2c3df4 b9f51d857b755347 b9f51d857b755347 b9f51d857b755347 b9f51d857b755347
+142 e30ad6e45f96e74e f0384d98042e6b47 c761f7a10057d211 c723a55afaa22ca0 520f861dc3c3d62e 2772cda20d3451b5 2772cda20d3451b5 2772cda20d3451b5 2772cda20d3451b5
+143 861ba39da0e7d5ca 861ba39da0e7d5ca 5406dfb7d9dd8125 dfe564e6cb6a04ef 7264cb9c8f9c5091 cf56df1e9f8bfc3d dfcf167192f60409 dfcf167192f60409 dfcf167192f60409
+144 968dd5aca3ec7dea 987e15f240ea99db 9ee723d0d9ff525c 5d8f594bf2037433 69f5d316d0350d17 e3e816bd1e7dc6e7 8e64d04292532dc5 8e64d04292532dc5 8e64d04292532dc5
+145 f17fd50e240dd905 5e1b7abb8f68203e eeffaa92cfeba26a 7e0ecda7c7e52459 630148ccfc56f0c1 56046900369346d1 56046900369346d1 56046900369346d1 56046900369346d1
+146 b13ba9972ad2f7e2 b13ba9972ad2f7e2 b13ba9972ad2f7e2 b179fb6cd0270953 31e75e3695975a51 0acff266874e0f0c 38c504de3df32fdb 38c504de3df32fdb 38c504de3df32fdb
+147 c710567e9e8181d2 d648bed5d08e4072 1e753374112735a7 8e8454411929b394 acce60eb19145b57 62303957bc327047 62303957bc327047 62303957bc327047 62303957bc327047
+148 f39351290c3b0f6b d396c1b61c1e6f29 6477a1c643ea2a92 6435f33db91fd423 ded99737d55f347d cb651305dffbb383 cb651305dffbb383 cb651305dffbb383 cb651305dffbb383
+149 f468a8f539bb8885 f468a8f539bb8885 79da4cad5ddfae82 f239f7fc4f682b48 49f1e22773b4b0a6 510fd279bd036a0b 0648d0446def23bc 0648d0446def23bc 0648d0446def23bc
+150 b131e03aa9da8f6d b131e03aa9da8f6d b131e03aa9da8f6d b173b2c1532f71dc 9adcd275c3baf0bc bc0879358b1ef1a6 ebc00e00dbd40349 ebc00e00dbd40349 ebc00e00dbd40349
+151 c0ab68d59514f4bf c0ab68d59514f4bf 97d441de08566d1b 8c2b958d0a74cfb7 3f9017499fcd7521 769e84ff1e1a6aad 00dc978b1142c588 00dc978b1142c588 00dc978b1142c588
+152 ad809427336c2d96 ad809427336c2d96 ad809427336c2d96 adc2c6dcc999d327 e756ffab579a6a29 78ca0e217da1b956 78ca0e217da1b956 78ca0e217da1b956 78ca0e217da1b956
+153 0a9780033daaf5f3 861905ae5abfd038 895a07f878ae97e2 19ab60cd70a011d1 a0348761c1fdd2ce 72b1bcee276828b2 8772274d883a6a6c 8772274d883a6a6c 8772274d883a6a6c
+154 03fb330b82f39685 03fb330b82f39685 ba1bcab6cc7a0326 77faf131668a36a4 5a0306dc61bedaf1 04e7bf52243dad79 394356bccca2a38d 394356bccca2a38d 394356bccca2a38d
+155 f390303cc0949059 f390303cc0949059 f390303cc0949059 63615709c89a166a 6194144e56e4fd43 d7c71ba043823d22 d7c71ba043823d22 d7c71ba043823d22 d7c71ba043823d22
+156 88cf1610dcc72c56 88cf1610dcc72c56 3df787c273068d6f 3db5d53989f373de 72cefcc4783db60c 44164af08ae6b07d 2393fae1e7e30c38 2393fae1e7e30c38 2393fae1e7e30c38
+157 651853281336e83a 651853281336e83a 19afd5b284f43264 f9118961fb7ce72c 6ff3e8dcf253a6fb e09333905371a130 e09333905371a130 e09333905371a130 e09333905371a130
+158 afe9d13f28837e9e afe9d13f28837e9e 0ab69eb705c1dd1d 9bb4805cf87ab642 ca52e2f91fc03bbd 5ae1db5ce5c1da2f 5ae1db5ce5c1da2f 5ae1db5ce5c1da2f 5ae1db5ce5c1da2f
+159 61c45c6ccaf71b6e 61c45c6ccaf71b6e e67341b0c5347c29 76822685cd3afa1a 91813adeae30ba73 927b8f042b805080 927b8f042b805080 927b8f042b805080 927b8f042b805080
+160 c848523efdeb1f32 0b9b3b4b04a5281e a4cad3bc02c4eafb a4888147f831144a 907fbd21418051b5 7ce58cc8bd9307d0 aea7061aebd196ce aea7061aebd196ce aea7061aebd196ce
+161 d6bbc6707ba1d89c d6bbc6707ba1d89c 306516e2aadff858 b8a6ff35a5a04869 f29bad7a2e470a77 2666738532645ddb 760aa87f74679ed2 760aa87f74679ed2 760aa87f74679ed2
+162 8addd4138f8e940b 8addd4138f8e940b 8addd4138f8e940b 8a9f86e8757b6aba 03fbda8f40abfd5c e9a9aad65cd3473c e9a9aad65cd3473c e9a9aad65cd3473c e9a9aad65cd3473c
+163 9383dc8d4e640069 9383dc8d4e640069 b7d0ed40c2b20e61 27218a75cabc8852 5b35eb3a0a023cac 13d41e795447830a 64d7829bd62db0ae 64d7829bd62db0ae 64d7829bd62db0ae
+164 4716acf6484a085a 4716acf6484a085a 4716acf6484a085a 4754fe0db2bff6eb 2ae1a971a9e8094e a19640ca2b7cdd5f a19640ca2b7cdd5f a19640ca2b7cdd5f a19640ca2b7cdd5f
+165 c0fb7c40bd1e5666 c0fb7c40bd1e5666 c0fb7c40bd1e5666 500a1b75b510d055 8b43034ad40e9331 b1de5e33347bfe3a b1de5e33347bfe3a b1de5e33347bfe3a b1de5e33347bfe3a
+166 b37e32b8d997504e b37e32b8d997504e b37e32b8d997504e b33c60432362aeff 12919692c0363893 bcb85ebd6d8861c3 bcb85ebd6d8861c3 bcb85ebd6d8861c3 bcb85ebd6d8861c3
+167 7f94ee6f58235be8 7f94ee6f58235be8 77e1222a21b82fd0 656ac639d5b75f47 824ed32582c8d548 cb3d582c221191e9 cb3d582c221191e9 cb3d582c221191e9 cb3d582c221191e9
+168 d3a09c8d243dfb2e d3a09c8d243dfb2e d3a09c8d243dfb2e d3e2ce76dec8059f 6a8f2d08eb82efed 2ff43cf2319309d3 2ff43cf2319309d3 2ff43cf2319309d3 2ff43cf2319309d3
+169 6b4c8d17ddb22b40 6b4c8d17ddb22b40 6b4c8d17ddb22b40 fbbdea22d5bcad73 56fb7c48f5d663a3 9cefe71be7f451e8 9cefe71be7f451e8 9cefe71be7f451e8 9cefe71be7f451e8
+170 4787bc2e23cea674 4787bc2e23cea674 09e4914bf5f73a4f 72f6a0e5649d5765 2627a7168b80cc72 47a8a31846a15d54 47a8a31846a15d54 47a8a31846a15d54 47a8a31846a15d54
+171 927a92f92d706312 927a92f92d706312 28eaf4536972368c 17a7f8cddea2a8f9 50e8d280ec62395a ab9e112b1b1cd26d ab9e112b1b1cd26d ab9e112b1b1cd26d ab9e112b1b1cd26d
+172 6274a723c9b07896 6274a723c9b07896 d18971aa4f9e4fc8 d1cb2351b56bb179 bf1e5a6fbde6bd9f bdab3842215767b6 bdab3842215767b6 bdab3842215767b6 bdab3842215767b6
+173 58b3a93bb6410e1a 6587ef7332b1552f 6587ef7332b1552f f57688463abfd31c 0a83b38c30817c91 342e2a3ee0bc8047 342e2a3ee0bc8047 342e2a3ee0bc8047 342e2a3ee0bc8047
+174 735f07912c6f5f73 735f07912c6f5f73 735f07912c6f5f73 731d556ad69aa1c2 5fff91f9abf541ca 45a59eef06e25303 45a59eef06e25303 45a59eef06e25303 45a59eef06e25303
+175 e0363589fcbcaa41 e0363589fcbcaa41 877e0ad9f998a0d1 178f6decf19626e2 61ba1c1df760e646 b3428d4ddb3ab2d0 b3428d4ddb3ab2d0 b3428d4ddb3ab2d0 b3428d4ddb3ab2d0
+176 d4edb3115e5909b2 d4edb3115e5909b2 48008d2542a1bbf9 4842dfdeb8544548 1f0ffa69f54cac62 a4afae03417dec02 a4afae03417dec02 a4afae03417dec02 a4afae03417dec02
+177 6b8c67d404806f49 6b8c67d404806f49 6b8c67d404806f49 fb7d00e10c8ee97a dd3cbc1c996ad2ed b147fc118b84775b b147fc118b84775b b147fc118b84775b b147fc118b84775b
+178 0b05495ce58314fa 0b05495ce58314fa 9fa67779c12ad15a 9fe425823bdf2feb fc10d20883bd7ccb 48f160da0e517b8a 48f160da0e517b8a 48f160da0e517b8a 48f160da0e517b8a
+179 3246e8e92adc9027 3246e8e92adc9027 903307407664c99d 00c260757e6a4fae dc26690dfdeb9b4f 1b3abcffa2a402b7 1b3abcffa2a402b7 1b3abcffa2a402b7 1b3abcffa2a402b7
+180 c239a1df0a7556ea c239a1df0a7556ea b2c95a10bc1f367c b28b08eb46eac8cd d70a03a42979fbbc 1ba6439a396590d8 1ba6439a396590d8 1ba6439a396590d8 1ba6439a396590d8
+181 aa5cdcba7dd0458e b0bc9deebc9ba839 b0bc9deebc9ba839 204dfadbb4952e0a 6d919ee43f07312c eef4b19792b53d65 eef4b19792b53d65 eef4b19792b53d65 eef4b19792b53d65
+182 97bc0b5476299cf8 97bc0b5476299cf8 97bc0b5476299cf8 97fe59af8cdc6249 2b080f1e0f086097 f0cf88965b3a034e f0cf88965b3a034e f0cf88965b3a034e f0cf88965b3a034e
+183 4f5cd5d8f7c20799 4f5cd5d8f7c20799 14d33680da55a5b8 88e312b3414ba836 60912292dcc97001 f5d2ed75baf521be f5d2ed75baf521be f5d2ed75baf521be f5d2ed75baf521be
+184 8f061d9f7355665e 8f061d9f7355665e 8f061d9f7355665e 8f444f6489a098ef 01b557b8c58fea21 06bcf80036fda7f4 06bcf80036fda7f4 06bcf80036fda7f4 06bcf80036fda7f4
+185 b2bb53b216cb3e64 9c22ccc0d242ad8d 9c22ccc0d242ad8d 0cd3abf5da4c2bbe b8fd8092ed5f5d8a ca88e6bac5cdd8c6 785032e5d73dc62f 785032e5d73dc62f 785032e5d73dc62f
+186 a0c11233a28222f4 a0c11233a28222f4 a0c11233a28222f4 a08340c85877dc45 6bb4aca1a2dda092 ff7ef6090089adc0 ff7ef6090089adc0 ff7ef6090089adc0 ff7ef6090089adc0
+187 81b43e84074916f2 81b43e84074916f2 81b43e84074916f2 114559b10f4790c1 277caaa92fa7d663 a7a0c1a4d30a48ea a7a0c1a4d30a48ea a7a0c1a4d30a48ea a7a0c1a4d30a48ea
+188 4b32ceb095d4d870 4b32ceb095d4d870 3d4fc3c5aafb29c8 3d0d913e500ed779 33fc062a11b330d2 4c06ef64bbc9ae15 c964640456e35b72 c964640456e35b72 c964640456e35b72
+189 4cdbeea5135f0751 413411417078c4ca 413411417078c4ca d1c57674787642f9 0d1777659b9f2584 68b16190326d7c4f 68b16190326d7c4f 68b16190326d7c4f 68b16190326d7c4f
+190 4efef3a5bfe7c2be 4efef3a5bfe7c2be 4efef3a5bfe7c2be 4ebca15e45123c0f a6b18f32efd2397e 10b32d1617ba3bea 10b32d1617ba3bea 10b32d1617ba3bea 10b32d1617ba3bea
+191 29d8ef97b221f1af 29d8ef97b221f1af 29d8ef97b221f1af b92988a2ba2f779c a330260439d1fc26 0020ea758b5db49f 0020ea758b5db49f 0020ea758b5db49f 0020ea758b5db49f
+192 f2aa2893adab189c f2aa2893adab189c f2aa2893adab189c f2e87a68575ee62d badc6c16546733f3 5d9e18b43787069d 5d9e18b43787069d 5d9e18b43787069d 5d9e18b43787069d
+193 0fe1912372fd50b0 0fe1912372fd50b0 0fe1912372fd50b0 9f10f6167af3d683 21c99bda068b50d9 9325c1eadd5f32ed 9325c1eadd5f32ed 9325c1eadd5f32ed 9325c1eadd5f32ed
+194 26c4c0792d55fb92 26c4c0792d55fb92 d14ef0e2585d5b0c d10ca219a2a8a5bd 5adb3810c8684ed1 ea5e26ca6d741f38 ea5e26ca6d741f38 ea5e26ca6d741f38 ea5e26ca6d741f38
+195 4e2f2e6383f4d267 4e2f2e6383f4d267 4e2f2e6383f4d267 dede49568bfa5454 edc113180e1991b9 d9f2dd3cbe5f930d d9f2dd3cbe5f930d d9f2dd3cbe5f930d d9f2dd3cbe5f930d
+196 2b45116b0770e173 2b45116b0770e173 2b45116b0770e173 2b074390fd851fc2 6f67b1cab4041303 0ec590b3cc4de7d4 0ec590b3cc4de7d4 0ec590b3cc4de7d4 0ec590b3cc4de7d4
+197 b969274f31c122db b969274f31c122db b969274f31c122db 2998407a39cfa4e8 4ddd9e48c154ecc3 dcdf463cb41087af dcdf463cb41087af dcdf463cb41087af dcdf463cb41087af
+198 f98b166f3c4abc53 f98b166f3c4abc53 576ff5e5c2521714 8b9c7e497aed9053 92e006cffc9743cc df2d2904bd18ff83 df2d2904bd18ff83 df2d2904bd18ff83 df2d2904bd18ff83
+199 b65e1b8f9a17f0c4 b65e1b8f9a17f0c4 b65e1b8f9a17f0c4 26af7cba921976f7 b6004208d9383086 a925f0338bed3961 a925f0338bed3961 a925f0338bed3961 a925f0338bed3961
+200 65b2eb1729950dca 65b2eb1729950dca 65b2eb1729950dca 65f0b9ecd360f37b fffc9d4857de41d7 acee14196f6da0cb 45f92d39c5d806d6 45f92d39c5d806d6 45f92d39c5d806d6
+201 bf7242ceaab1d7e5 bf7242ceaab1d7e5 bf7242ceaab1d7e5 2f8325fba2bf51d6 040ffc43fe8d4554 99bd7e953a05e6b7 99bd7e953a05e6b7 99bd7e953a05e6b7 99bd7e953a05e6b7
+202 4523be614fbf1d7b 4523be614fbf1d7b 4523be614fbf1d7b 4561ec9ab54ae3ca 4c912a70eda8cb27 b7338d8b38e4f85f b7338d8b38e4f85f b7338d8b38e4f85f b7338d8b38e4f85f
+203 31a5e14520b41f6d 31a5e14520b41f6d 31a5e14520b41f6d a154867028ba995e c1947914c2d1603f 1545a6a207c2b7f3 1545a6a207c2b7f3 1545a6a207c2b7f3 1545a6a207c2b7f3
+204 b39e828f64159322 b39e828f64159322 e55c958149aa81ad e51ec77ab35f7f1c 20d65983194c4b9f a7e27df8c5dab514 a7e27df8c5dab514 a7e27df8c5dab514 a7e27df8c5dab514
+205 a2ff1775f0a03c48 a2ff1775f0a03c48 a2ff1775f0a03c48 320e7040f8aeba7b 7440d6e5565cf70b 41c911f900825aed 41c911f900825aed 41c911f900825aed 41c911f900825aed
+206 887dc9e5b62060d1 887dc9e5b62060d1 887dc9e5b62060d1 883f9b1e4cd59e60 d141e25eb08fc9cf fc696d73952d47e4 fc696d73952d47e4 fc696d73952d47e4 fc696d73952d47e4
+207 0ded62851d8d2612 0ded62851d8d2612 0ded62851d8d2612 9d1c05b01583a021 fb64d3efbdd98c93 1eae29eaaa343b89 1eae29eaaa343b89 1eae29eaaa343b89 1eae29eaaa343b89
+208 0b5e9fa141ac4fba 0b5e9fa141ac4fba 6d94e701d1c17945 6078c82cbf388408 279b97e7a2587c78 9e58eea01b8a7e38 9e58eea01b8a7e38 9e58eea01b8a7e38 9e58eea01b8a7e38
+209 f8fc1f7fb7e802cf f8fc1f7fb7e802cf f8fc1f7fb7e802cf 680d784abfe684fc d100d46b3f17755d cdbd46c36209a185 cdbd46c36209a185 cdbd46c36209a185 cdbd46c36209a185
+210 07ae118d2bb440d0 07ae118d2bb440d0 07ae118d2bb440d0 07ec4376d141be61 82433dbffc99e3b7 814fc84af59f7bf4 814fc84af59f7bf4 814fc84af59f7bf4 814fc84af59f7bf4
+211 97103afaf41d77d9 97103afaf41d77d9 97103afaf41d77d9 07e15dcffc13f1ea 20fb60f3c213a948 046989057c5db0d1 046989057c5db0d1 046989057c5db0d1 046989057c5db0d1
+212 653f73c8ec7bedf7 653f73c8ec7bedf7 653f73c8ec7bedf7 657d2133168e1346 aa727761439b8589 36cb11081506f986 36cb11081506f986 36cb11081506f986 36cb11081506f986
+213 12bc894a20710c0a 12bc894a20710c0a 12bc894a20710c0a 824dee7f287f8a39 097045dc10305c61 d12ee8591416114c d12ee8591416114c d12ee8591416114c d12ee8591416114c
+214 ed45d298f85b4615 ed45d298f85b4615 ed45d298f85b4615 ed07806302aeb8a4 3a102feb1b5d1eb7 081bc6f07f06fd39 081bc6f07f06fd39 081bc6f07f06fd39 081bc6f07f06fd39
+215 a63c2aaed15c60e3 a63c2aaed15c60e3 a63c2aaed15c60e3 36cd4d9bd952e6d0 d8428c4b3515fab4 6e9ff95037d24162 6e9ff95037d24162 6e9ff95037d24162 6e9ff95037d24162
+216 86757b17fdd54e0a 86757b17fdd54e0a 86757b17fdd54e0a 863729ec0720b0bb 44af94afaa2c25f6 8914d473bb9efc15 8914d473bb9efc15 8914d473bb9efc15 8914d473bb9efc15
+217 d0de584d3402874d d0de584d3402874d d0de584d3402874d 402f3f783c0c017e 513a0bdc2a4aa503 39349d95db664af8 39349d95db664af8 39349d95db664af8 39349d95db664af8
+218 c7d383ef9a7d1e01 c7d383ef9a7d1e01 c7d383ef9a7d1e01 c791d1146088e0b0 eba913ffe1e2a5cc f469c1ed5c7d929a f469c1ed5c7d929a f469c1ed5c7d929a f469c1ed5c7d929a
+219 addaf0fc4429186b addaf0fc4429186b addaf0fc4429186b 3d2b97c94c279e58 d1fd24194c6a3f42 5ab5a3cd1d9d74cc 5ab5a3cd1d9d74cc 5ab5a3cd1d9d74cc 5ab5a3cd1d9d74cc
+220 50e231e08ee8e66e 50e231e08ee8e66e 50e231e08ee8e66e 50a0631b741d18df ad52c83ca3ef45fd 18023439f76a61a2 18023439f76a61a2 18023439f76a61a2 18023439f76a61a2
+221 b57f30ff9a992bac b57f30ff9a992bac b57f30ff9a992bac 258e57ca9297ad9f 3e3d35f4ab970fff a5265a0acaa85b5d a5265a0acaa85b5d a5265a0acaa85b5d a5265a0acaa85b5d
+222 15144245416ddd19 15144245416ddd19 15144245416ddd19 155610bebb9823a8 a81dd0aa661d3da9 1640af20ea028a97 1640af20ea028a97 1640af20ea028a97 1640af20ea028a97
+223 e6ab002d831e9e86 e6ab002d831e9e86 e6ab002d831e9e86 765a67188b1018b5 e65cc4a7b708473b 9f22d50ee6445222 9f22d50ee6445222 9f22d50ee6445222 9f22d50ee6445222
+224 121358889924324a 121358889924324a 121358889924324a 12510a7363d1ccfb ef93e3512afc8b82 97ceb9b07f96fb3a 97ceb9b07f96fb3a 97ceb9b07f96fb3a 97ceb9b07f96fb3a
+225 4fa0353c259d032d 4fa0353c259d032d 84867a23d67dfba0 14771d16de737d93 120ba1031ece9d78 cc7664ac9cf9be43 cc7664ac9cf9be43 cc7664ac9cf9be43 cc7664ac9cf9be43
+226 6d5c123b95230e88 6d5c123b95230e88 6d5c123b95230e88 6d1e40c06fd6f039 ec3585f94e51223c 65eb59341d37c8d7 65eb59341d37c8d7 65eb59341d37c8d7 65eb59341d37c8d7
+227 daa64dd2171e12a4 daa64dd2171e12a4 daa64dd2171e12a4 4a572ae71f109497 6b5eeb153310d4d5 3ba18412c62424dc 3ba18412c62424dc 3ba18412c62424dc 3ba18412c62424dc
+228 91d626532e9ce575 91d626532e9ce575 91d626532e9ce575 919474a8d4691bc4 d083ffe32ad4d776 43af89501002a497 43af89501002a497 43af89501002a497 43af89501002a497
+229 13d334b98a77a779 13d334b98a77a779 13d334b98a77a779 8322538c8279214a 7b0d891e1e9d6660 478a3c50139dc519 478a3c50139dc519 478a3c50139dc519 478a3c50139dc519
+230 0d8a00199c27d177 0d8a00199c27d177 0d8a00199c27d177 0dc852e266d22fc6 26d4827539abf242 d8e1cf5b3dea6efc d8e1cf5b3dea6efc d8e1cf5b3dea6efc d8e1cf5b3dea6efc
+231 df8cb3447e15f88a df8cb3447e15f88a df8cb3447e15f88a 4f7dd471761b7eb9 cdd8226e0b645750 b2144ae28ab2c845 b2144ae28ab2c845 b2144ae28ab2c845 b2144ae28ab2c845
+232 7132b4688a2d3506 7132b4688a2d3506 7132b4688a2d3506 7170e69370d8cbb7 5109ec21d489b20c 7f60005814bd7912 7f60005814bd7912 7f60005814bd7912 7f60005814bd7912
+233 e43152db2c617240 e43152db2c617240 c091ab13a28c69aa 5060cc26aa82ef99 3cb371c941eef680 4c69959d90300b5d 4c69959d90300b5d 4c69959d90300b5d 4c69959d90300b5d
+234 5a3d293454031769 5a3d293454031769 5a3d293454031769 5a7f7bcfaef6e9d8 62ae689bb3b37798 af2e3bb2e675f71e af2e3bb2e675f71e af2e3bb2e675f71e af2e3bb2e675f71e
+235 c2305f997e8b3624 c2305f997e8b3624 c2305f997e8b3624 52c138ac7685b017 8d2488936508f958 0c74a88fe15dfb4d 0c74a88fe15dfb4d 0c74a88fe15dfb4d 0c74a88fe15dfb4d
+236 4bd6c98a2840d766 4bd6c98a2840d766 4bd6c98a2840d766 4b949b71d2b529d7 044849de76dcb127 dfe9a62835a6f281 dfe9a62835a6f281 dfe9a62835a6f281 dfe9a62835a6f281
+237 a6573ce8e7841b43 a6573ce8e7841b43 a6573ce8e7841b43 36a65bddef8a9d70 2ff9b8bf0dee2f24 4e7ac5f74a5da97a 4e7ac5f74a5da97a 4e7ac5f74a5da97a 4e7ac5f74a5da97a
+238 b3165492e54ee03f b3165492e54ee03f b3165492e54ee03f b35406691fbb1e8e 282ce285ba6bc3d6 32fdc31c07e4f827 32fdc31c07e4f827 32fdc31c07e4f827 32fdc31c07e4f827
+239 4237f9664fa4274b 4237f9664fa4274b 4237f9664fa4274b d2c69e5347aaa178 5c2ca2e2590418e5 3fc47d3d7bd2b581 3fc47d3d7bd2b581 3fc47d3d7bd2b581 3fc47d3d7bd2b581
+240 eba59785fa47a1f8 eba59785fa47a1f8 eba59785fa47a1f8 ebe7c57e00b25f49 5b1194fe88be9b3f 6b170a793ffc3c94 6b170a793ffc3c94 6b170a793ffc3c94 6b170a793ffc3c94
+241 6e1d9bd3e3003deb 6e1d9bd3e3003deb 6e1d9bd3e3003deb feecfce6eb0ebbd8 bf62b77d12e1b972 8ca61f7c5bd51c14 8ca61f7c5bd51c14 8ca61f7c5bd51c14 8ca61f7c5bd51c14
+242 72178f2890f9c32f 72178f2890f9c32f 72178f2890f9c32f 7255ddd36a0c3d9e 5b8faa2d2c3f5c74 0a34945814b73d75 0a34945814b73d75 0a34945814b73d75 0a34945814b73d75
+243 db8be437c6fce712 db8be437c6fce712 db8be437c6fce712 4b7a8302cef26121 818882bb36644b35 0f192d707f67b5b8 0f192d707f67b5b8 0f192d707f67b5b8 0f192d707f67b5b8
+244 1f4e66d680a2a163 1f4e66d680a2a163 1f4e66d680a2a163 1f0c342d7a575fd2 ad11750ced6757cc d951e5993c7c4860 d951e5993c7c4860 d951e5993c7c4860 d951e5993c7c4860
+245 4ac485aa47a71231 4ac485aa47a71231 4ac485aa47a71231 da35e29f4fa99402 9e1c5f58c7f6802b deae48c1b6e62efd deae48c1b6e62efd deae48c1b6e62efd deae48c1b6e62efd
+246 294d05179cec7c1a 294d05179cec7c1a 294d05179cec7c1a 290f57ec661982ab f16743cec4fa1075 42ff82251d15b087 42ff82251d15b087 42ff82251d15b087 42ff82251d15b087
+247 155a999c63febb9c 155a999c63febb9c 155a999c63febb9c 85abfea96bf03daf ac9a23e46106414c f586e7bfd8d43c7f f586e7bfd8d43c7f f586e7bfd8d43c7f f586e7bfd8d43c7f
+248 1ac0c4226f53319b 1ac0c4226f53319b 1ac0c4226f53319b 1a8296d995a6cf2a e2a49d5a2d1c1e88 96eeca3e8b643476 96eeca3e8b643476 96eeca3e8b643476 96eeca3e8b643476
+249 6b12038fd4fcefb4 6b12038fd4fcefb4 dcced6cbd9befd15 0a822410b1f1e3c7 bdf7f1a498d6ef4d 0db1870dc69e4a25 0db1870dc69e4a25 0db1870dc69e4a25 0db1870dc69e4a25
+250 d694c8c039dca0d0 d694c8c039dca0d0 d694c8c039dca0d0 d6d69a3bc3295e61 a55839317a3df41a 801186d80a7e2799 801186d80a7e2799 801186d80a7e2799 801186d80a7e2799
+251 92563680f39b0e5c 92563680f39b0e5c 92563680f39b0e5c 02a751b5fb95886f 144f28c248b437f0 4f34870babc85814 4f34870babc85814 4f34870babc85814 4f34870babc85814
+252 8a153ae79d84676c 8a153ae79d84676c 8a153ae79d84676c 8a57681c677199dd 40dd51d2bd989a85 3bd0238179b772e3 3bd0238179b772e3 3bd0238179b772e3 3bd0238179b772e3
+253 8efcd81102395898 8efcd81102395898 8efcd81102395898 1e0dbf240a37deab 220582d17e960774 3f00c6a495255326 3f00c6a495255326 3f00c6a495255326 3f00c6a495255326
+254 184afd5384702a68 184afd5384702a68 184afd5384702a68 1808afa87e85d4d9 92d45f607f2b9f14 1067d1fa9a20ea2f 1067d1fa9a20ea2f 1067d1fa9a20ea2f 1067d1fa9a20ea2f
+255 ead431a2d8e4461f ead431a2d8e4461f ead431a2d8e4461f 7a255697d0eac02c 48cab73043ddc687 2416fed82cccff9f 2416fed82cccff9f 2416fed82cccff9f 2416fed82cccff9f
+256 350e2d4c66acc836 350e2d4c66acc836 350e2d4c66acc836 354c7fb79c593687 dba3135989f92ccb 5ac526dc206e5d27 5ac526dc206e5d27 5ac526dc206e5d27 5ac526dc206e5d27
+257 a35c41aed3aeabf4 a35c41aed3aeabf4 f7fa2f5ed979f065 403f31ff44087dfc 43c4228be6ab403f d206cc86c6d1bf08 d206cc86c6d1bf08 d206cc86c6d1bf08 d206cc86c6d1bf08
+258 bdd70a24600a03fe bdd70a24600a03fe bdd70a24600a03fe bd9558df9afffd4f 9d6547019864f4cd 77f41441d42f83eb 77f41441d42f83eb 77f41441d42f83eb 77f41441d42f83eb
+259 fbe6be3654ab6ba0 fbe6be3654ab6ba0 fbe6be3654ab6ba0 6b17d9035ca5ed93 af57f647340fbc46 d21773b825325516 d21773b825325516 d21773b825325516 d21773b825325516
+260 6627fd1633e0d517 6627fd1633e0d517 6627fd1633e0d517 6665afedc9152ba6 8f3ddd94e0e4dfec e24626926ba8825f e24626926ba8825f e24626926ba8825f e24626926ba8825f
+261 cbec21b19da26bb6 cbec21b19da26bb6 cbec21b19da26bb6 5b1d468495aced85 6459c72c9f7cefe1 032c0697a467ecd5 032c0697a467ecd5 032c0697a467ecd5 032c0697a467ecd5
+262 f4e2a22cb1cb4f01 f4e2a22cb1cb4f01 f4e2a22cb1cb4f01 f4a0f0d74b3eb1b0 0bd7c0feb67ecd82 a4a24f5764a83159 a4a24f5764a83159 a4a24f5764a83159 a4a24f5764a83159
+263 c1a9e9501adba6ec c1a9e9501adba6ec c1a9e9501adba6ec 51588e6512d520df 4006d0fd1772528d 5b755766f69b3155 5b755766f69b3155 5b755766f69b3155 5b755766f69b3155
+264 d5ea63495c1e95cd d5ea63495c1e95cd d5ea63495c1e95cd d5a831b2a6eb6b7c 76eca5d43befdb40 6694555ac6021995 6694555ac6021995 6694555ac6021995 6694555ac6021995
+265 544784c9ed41c55d 544784c9ed41c55d 544784c9ed41c55d c4b6e3fce54f436e 72a3cfd43df6dfe1 f1364197f7b89b05 f1364197f7b89b05 f1364197f7b89b05 f1364197f7b89b05
+266 b294a6eb7c2b5a30 b294a6eb7c2b5a30 b294a6eb7c2b5a30 b2d6f41086dea481 bded1961a010a94e 136d9026a776a8fc 136d9026a776a8fc 136d9026a776a8fc 136d9026a776a8fc
+267 2da1c6bec15cf1e7 2da1c6bec15cf1e7 2da1c6bec15cf1e7 bd50a18bc95277d4 74a6fe321e55bde9 ad9415a6dabffdbe ad9415a6dabffdbe ad9415a6dabffdbe ad9415a6dabffdbe
+268 d192a3747f45d116 d192a3747f45d116 d192a3747f45d116 d1d0f18f85b02fa7 63a1722d1bd14e34 f17d5f0318b74061 f17d5f0318b74061 f17d5f0318b74061 f17d5f0318b74061
+269 1ab6e5331b801681 1ab6e5331b801681 1ab6e5331b801681 8a478206138e90b2 1785deab8ace25b3 470c28ea238ddc95 470c28ea238ddc95 470c28ea238ddc95 470c28ea238ddc95
+270 9a8a5984ce377e02 9a8a5984ce377e02 9a8a5984ce377e02 9ac80b7f34c280b3 d7508e54868b4932 53f2b6c7da25ac19 d1031d96b09058f8 d1031d96b09058f8 d1031d96b09058f8
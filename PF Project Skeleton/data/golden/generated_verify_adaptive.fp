@@ -0,0 +1,213 @@
+# tick spawn route counters queue move flip arrivals halt signals
+0 29b3565bb107fa1b 29b3565bb107fa1b 29b3565bb107fa1b 29b3565bb107fa1b 2b642a551df5e62f 2b642a551df5e62f 2b642a551df5e62f 2b642a551df5e62f 2b642a551df5e62f
+1 5733809f5996da07 5733809f5996da07 5733809f5996da07 5733809f5996da07 36cb44fa78f02f9e 36cb44fa78f02f9e 36cb44fa78f02f9e 36cb44fa78f02f9e 36cb44fa78f02f9e
+2 b4929784e44c7892 b4929784e44c7892 b4929784e44c7892 b4929784e44c7892 ee5c1133de2ac824 ee5c1133de2ac824 ee5c1133de2ac824 ee5c1133de2ac824 ee5c1133de2ac824
+3 8335cfa45eed7b4c 8335cfa45eed7b4c 8335cfa45eed7b4c 8335cfa45eed7b4c 146e2a08284b3b53 146e2a08284b3b53 146e2a08284b3b53 146e2a08284b3b53 146e2a08284b3b53
+4 2ac056bc4b0b8239 2ac056bc4b0b8239 2ac056bc4b0b8239 2ac056bc4b0b8239 9a7e8692d2c432e9 9a7e8692d2c432e9 9a7e8692d2c432e9 9a7e8692d2c432e9 9a7e8692d2c432e9
+5 c22b393a21e7f58c c22b393a21e7f58c c22b393a21e7f58c c22b393a21e7f58c 96d7bdad9ee4760a 96d7bdad9ee4760a 96d7bdad9ee4760a 96d7bdad9ee4760a 96d7bdad9ee4760a
+6 28f679549072e7da 28f679549072e7da 28f679549072e7da 28f679549072e7da d7dc31df56204bbe d7dc31df56204bbe d7dc31df56204bbe d7dc31df56204bbe d7dc31df56204bbe
+7 e77c0f81651590d1 e77c0f81651590d1 e77c0f81651590d1 e77c0f81651590d1 bff1649581ad31a9 bff1649581ad31a9 bff1649581ad31a9 bff1649581ad31a9 bff1649581ad31a9
+8 0db6f8277bd007a8 0db6f8277bd007a8 0db6f8277bd007a8 44bbc627f22b54d5 fb3f1a9566c46928 60f2c8ea7b52d946 60f2c8ea7b52d946 60f2c8ea7b52d946 60f2c8ea7b52d946
+9 b470ecfefaa7566a b470ecfefaa7566a 441c9f7a1bc1408c 441c9f7a1bc1408c a1f598e168dcd1eb a1f598e168dcd1eb a1f598e168dcd1eb a1f598e168dcd1eb a1f598e168dcd1eb
+10 c7d4255d647a274b c7d4255d647a274b 43b800137312c76e 5859a51661330bf3 9c4e16a7fd3bf646 eacd56ffb10a30b1 eacd56ffb10a30b1 eacd56ffb10a30b1 eacd56ffb10a30b1
+11 c66b85d971a36031 c66b85d971a36031 c66b85d971a36031 c66b85d971a36031 f4338dbee61eb5e8 f4338dbee61eb5e8 f4338dbee61eb5e8 f4338dbee61eb5e8 f4338dbee61eb5e8
+12 622991e602127c86 622991e602127c86 84f74174d36c5c42 84f74174d36c5c42 7654872e1ecc50ef 7654872e1ecc50ef 7654872e1ecc50ef 7654872e1ecc50ef 7654872e1ecc50ef
+13 7dc638bc9a17ead8 7dc638bc9a17ead8 7dc638bc9a17ead8 7dc638bc9a17ead8 fe76aa7273a999ec fe76aa7273a999ec fe76aa7273a999ec fe76aa7273a999ec fe76aa7273a999ec
+14 b20e6c67854ad1dc b20e6c67854ad1dc 04abdb8203cb9f3b 11b9d6d9bd99b7bb 4413780a4c49ad47 8987e3b639e43ebb 8987e3b639e43ebb 8987e3b639e43ebb 8987e3b639e43ebb
+15 121d56393fc182ce 121d56393fc182ce 121d56393fc182ce 121d56393fc182ce f588e77bdb064dbc f588e77bdb064dbc 6e104cfcf5bde216 6e104cfcf5bde216 6e104cfcf5bde216
+16 459e37119e827342 459e37119e827342 296c6545e9f0c0a1 296c6545e9f0c0a1 3b571a7130cb95af 3b571a7130cb95af 3b571a7130cb95af 3b571a7130cb95af 3b571a7130cb95af
+17 eb34dfbc56ee9a3a eb34dfbc56ee9a3a eb34dfbc56ee9a3a eb34dfbc56ee9a3a aac1fd7865152a3c aac1fd7865152a3c aac1fd7865152a3c aac1fd7865152a3c aac1fd7865152a3c
+18 b9fe79e9f97f8267 b9fe79e9f97f8267 5a4c3accee916b1d 557931005c8eea7b be971ec91d84a120 871bacfdf608494b 871bacfdf608494b 871bacfdf608494b 871bacfdf608494b
+19 bc07374cd88c2315 bc07374cd88c2315 c7c2f13198308ee4 c7c2f13198308ee4 125d0039b2a71922 125d0039b2a71922 125d0039b2a71922 125d0039b2a71922 125d0039b2a71922
+20 796c9cab73f097b3 796c9cab73f097b3 d14359c8dbdfa11a d14359c8dbdfa11a 20200b2a13b73993 20200b2a13b73993 99a832316b6884e8 99a832316b6884e8 99a832316b6884e8
+21 8fa904e43dbfebed 8fa904e43dbfebed d6c0373a66bb42af d6c0373a66bb42af 45b51d608f1e23b6 45b51d608f1e23b6 45b51d608f1e23b6 45b51d608f1e23b6 45b51d608f1e23b6
+22 6f449b7f66d2cfe4 6f449b7f66d2cfe4 6f449b7f66d2cfe4 6f449b7f66d2cfe4 69459662ad416762 69459662ad416762 69459662ad416762 69459662ad416762 69459662ad416762
+23 3fe035ae9d877b90 3fe035ae9d877b90 3fe035ae9d877b90 3fe035ae9d877b90 2f42a7655e9309a9 2f42a7655e9309a9 2f42a7655e9309a9 2f42a7655e9309a9 2f42a7655e9309a9
+24 f2ae829b9fef29ad f2ae829b9fef29ad 234282f096cea44c 234282f096cea44c 0d799db61e090457 0d799db61e090457 0d799db61e090457 0d799db61e090457 0d799db61e090457
+25 298b744110f68fca 298b744110f68fca fdbc8609e91fef54 fdbc8609e91fef54 ff44e2970b2e1caa ff44e2970b2e1caa ff44e2970b2e1caa ff44e2970b2e1caa ff44e2970b2e1caa
+26 589c796af6915efd 589c796af6915efd 7e820f8ce6feb39c 0a8d41261e00ccbb e1c8e37d62edb6f2 41ecaa730a4cadeb 5beb8860af15124a 5beb8860af15124a 5beb8860af15124a
+27 5a3a4ea59efa2428 5a3a4ea59efa2428 5a3a4ea59efa2428 5a3a4ea59efa2428 9d7a5aaff026da77 9d7a5aaff026da77 9d7a5aaff026da77 9d7a5aaff026da77 9d7a5aaff026da77
+28 7037926508ae7010 7037926508ae7010 7037926508ae7010 7037926508ae7010 9f6fc99e3d0805e3 9f6fc99e3d0805e3 9f6fc99e3d0805e3 9f6fc99e3d0805e3 9f6fc99e3d0805e3
+29 70d7da883182a473 70d7da883182a473 ef5b6427ef9f4c54 e1c66f33226e2789 6c15de863bf93395 23fde2633a1558a0 23fde2633a1558a0 23fde2633a1558a0 23fde2633a1558a0
+30 4ea27d4530b1d1d6 4ea27d4530b1d1d6 35fc9c4c0637f77f 35fc9c4c0637f77f fa5c2fdae413edc5 fa5c2fdae413edc5 fa5c2fdae413edc5 fa5c2fdae413edc5 fa5c2fdae413edc5
+31 7b5095a5b247cad2 7b5095a5b247cad2 1d63107f4a87464c 1d63107f4a87464c 2474b2a94c7b213c 2474b2a94c7b213c 2474b2a94c7b213c 2474b2a94c7b213c 2474b2a94c7b213c
+32 dbde087d53a90d41 dbde087d53a90d41 dbde087d53a90d41 236210a7e6d869b8 ffe9c8d9c9dd564b d3132b160a06304c d3132b160a06304c d3132b160a06304c d3132b160a06304c
+33 2472df64dba7ecc1 2472df64dba7ecc1 ab74248e760531d0 ab74248e760531d0 7aa0065b81f18868 7aa0065b81f18868 7aa0065b81f18868 7aa0065b81f18868 7aa0065b81f18868
+34 00077b869aedd9d0 00077b869aedd9d0 22e8e79a7bd1d7f4 22e8e79a7bd1d7f4 1d52e56b9e4b0ee9 1d52e56b9e4b0ee9 1d52e56b9e4b0ee9 1d52e56b9e4b0ee9 1d52e56b9e4b0ee9
+35 3d50196d8a158fef 3d50196d8a158fef 733334085c2c13d4 d9e62b2df835f072 96d5eaa5f4a443b3 be6c10e0d7f6ecab be6c10e0d7f6ecab be6c10e0d7f6ecab be6c10e0d7f6ecab
+36 1156f3b1c204961a 1156f3b1c204961a 1156f3b1c204961a 1156f3b1c204961a 4b7dd2b1eba1c529 4b7dd2b1eba1c529 4b7dd2b1eba1c529 4b7dd2b1eba1c529 4b7dd2b1eba1c529
+37 8912a270b0745afa 8912a270b0745afa 306667dfe4a737b5 af58f3b3c6c118ed 01014c12979f2377 a5d12e2be8277c42 cf884efcb2af4e1a cf884efcb2af4e1a cf884efcb2af4e1a
+38 f60fb577fabbfe78 f60fb577fabbfe78 6f892f4f4606d877 a900f3fb83df58e0 2bfc2e89ec19aeb5 89855f9e2c34dcae 89855f9e2c34dcae 89855f9e2c34dcae 89855f9e2c34dcae
+39 6e53099fa0409e5d 6e53099fa0409e5d 6bb327305c2b1c86 6bb327305c2b1c86 bb01b104c16dd3a2 bb01b104c16dd3a2 bb01b104c16dd3a2 bb01b104c16dd3a2 bb01b104c16dd3a2
+40 51b6f138b17f711f 51b6f138b17f711f 517a6dd8a41d2059 4ea761686d222154 b0f0c42509815e8f daff2fc80949a2df daff2fc80949a2df daff2fc80949a2df daff2fc80949a2df
+41 796a1f55610e05b6 796a1f55610e05b6 f0de12f323a26c92 876fc6eaad931a7c 5ee32b7db6e6ff6c 9e73f90c26239b8e 9e73f90c26239b8e 9e73f90c26239b8e 9e73f90c26239b8e
+42 8947d008b0936e8b 8947d008b0936e8b 6bc9b59e7b8c33ee 6bc9b59e7b8c33ee f959def944e38d35 f959def944e38d35 f959def944e38d35 f959def944e38d35 f959def944e38d35
+43 26adbc53a2461d3a 26adbc53a2461d3a d45c8c1ffabf4387 98edda0c877e3c7d 7b669d86b746d04c 29a4047e7311b081 e34b8c6f603a6617 e34b8c6f603a6617 e34b8c6f603a6617
+44 f1794564b1305e4b f1794564b1305e4b bf53013764230ae8 b3c2ff0b2534f858 6e33d7c61e4f13ab 80585c107738cbda 80585c107738cbda 80585c107738cbda 80585c107738cbda
+45 43405e758712a4c7 43405e758712a4c7 a84b60ca8cc8a75e d1119c56ae2949e0 7032bf12aa1fb6a5 0ff904424fe1fb53 0ff904424fe1fb53 0ff904424fe1fb53 0ff904424fe1fb53
+46 33e54874373dcf76 33e54874373dcf76 0255e47f4602b256 0255e47f4602b256 85a227ca948652ce 85a227ca948652ce 85a227ca948652ce 85a227ca948652ce 85a227ca948652ce
+47 18a663f5bae47947 18a663f5bae47947 da99089b49029f97 da99089b49029f97 86b25e13d5e673a5 86b25e13d5e673a5 86b25e13d5e673a5 86b25e13d5e673a5 86b25e13d5e673a5
+48 690b54a0e102c0f0 690b54a0e102c0f0 7b8a72eecd860a42 2fcb599c3a7f631d 697c36f5a142e8a2 a2b3bf4ae5ded899 71b6cd1f4af508c4 71b6cd1f4af508c4 71b6cd1f4af508c4
+49 3a55a4bf7fbb9662 3a55a4bf7fbb9662 12e702af8d136598 72a92a833bd41c99 cb5e0794b0771045 7bdba49365efccf5 7bdba49365efccf5 7bdba49365efccf5 7bdba49365efccf5
+50 85c96fa944f429f4 85c96fa944f429f4 5de797c3653e2b25 5de797c3653e2b25 f4aa13c232836694 f4aa13c232836694 b2bef2db30af6a4f b2bef2db30af6a4f b2bef2db30af6a4f
+51 b30f8a9d7325827b b30f8a9d7325827b b210e0a64af8872f b210e0a64af8872f cb88f962ee15a72d cb88f962ee15a72d cb88f962ee15a72d cb88f962ee15a72d cb88f962ee15a72d
+52 78372040a2bf3c32 78372040a2bf3c32 0486049b3ac777a0 956db42149cfa7e3 b304bcc77766c9b7 4eabd6f74b6375d9 7540b695fe5fc8ae 7540b695fe5fc8ae 7540b695fe5fc8ae
+53 46e35f0f636e1c9d 46e35f0f636e1c9d e81e0ad8f9977dcf 745375c264fc6d51 13ec2e956e039415 7de2a08d8f0218eb 7de2a08d8f0218eb 7de2a08d8f0218eb 7de2a08d8f0218eb
+54 ea7a9dd3285cc05c ea7a9dd3285cc05c dc6b54785a5a0b7d 3b210363987cea3c fdb80b2102e9b7d6 8da2e396f463531f 8da2e396f463531f 8da2e396f463531f 8da2e396f463531f
+55 165842af3cda2bba 165842af3cda2bba 955d6073f2a25761 cd8c0ba0f602ed31 100812622b151048 13a857dbfd4d7741 13a857dbfd4d7741 13a857dbfd4d7741 13a857dbfd4d7741
+56 efd0e75807290bad efd0e75807290bad c59654ce8069821e c59654ce8069821e e83f1922db3aab4a e83f1922db3aab4a 2db46f6538fa0d36 2db46f6538fa0d36 2db46f6538fa0d36
+57 016d7bfff3f46668 016d7bfff3f46668 22b579e20e4a6790 22b579e20e4a6790 d1fb91eb5092de5d d1fb91eb5092de5d b635577a786fe2c3 b635577a786fe2c3 b635577a786fe2c3
+58 60c77b27cba8f370 60c77b27cba8f370 690ec8061f624711 690ec8061f624711 1546b4e20f611c20 1546b4e20f611c20 1546b4e20f611c20 1546b4e20f611c20 1546b4e20f611c20
+59 5685319c16ae381e 5685319c16ae381e 9760fe6c7a60c3c3 41c56187e01398ba 6789a72320cd44a9 f1e23b9f1afe3cb1 f1e23b9f1afe3cb1 f1e23b9f1afe3cb1 f1e23b9f1afe3cb1
+60 028fd1df27ac000c 028fd1df27ac000c 7171e072eb085e37 bb0a81f260315b3d 8d65e0a806cd8277 4524eefb23669269 4524eefb23669269 4524eefb23669269 4524eefb23669269
+61 d120fdee2c827de0 d120fdee2c827de0 6e233494cb571b06 6e233494cb571b06 91fd980251265517 91fd980251265517 6fbaa8d3464b4d9c 6fbaa8d3464b4d9c 6fbaa8d3464b4d9c
+62 a7ae3378fb52f44a a7ae3378fb52f44a 9f5466a16e0109c1 fa131ff35af5d2e0 0f6938985da3a6b7 4827648afeeb1863 4827648afeeb1863 4827648afeeb1863 4827648afeeb1863
+63 07bbc8507473ae91 07bbc8507473ae91 9a1e2f012f68735c c18313be44867d3f 4efe5c56cf1c0b9e 2bc7e96141c3a9a7 2bc7e96141c3a9a7 2bc7e96141c3a9a7 2bc7e96141c3a9a7
+64 f8c1e70f31b46aca f8c1e70f31b46aca 5a9a0dca46bd0415 13682fb06b83714b a6501fe45d654984 f3bd6db16476c2bc f3bd6db16476c2bc f3bd6db16476c2bc f3bd6db16476c2bc
+65 bfcf5a5f40be2141 bfcf5a5f40be2141 e57753fcf59fa14c e57753fcf59fa14c f327b9267f02f614 f327b9267f02f614 5caeb80467c1ab57 5caeb80467c1ab57 5caeb80467c1ab57
+66 f2c1e8a3987a63d5 f2c1e8a3987a63d5 e75e13fc5931c3d1 5da8156dbbf1654e 84352cd3e6f847f9 387de0c5a75ad2a2 b819b64587734b27 b819b64587734b27 b819b64587734b27
+67 5a43737f90fa8e5b 5a43737f90fa8e5b 80d4f2de9d656bc0 80d4f2de9d656bc0 e7433fbea065186a e7433fbea065186a 831f474449da1b92 831f474449da1b92 831f474449da1b92
+68 6aafb0a4b4b06b2c 6aafb0a4b4b06b2c de418165a3a7cf81 de418165a3a7cf81 8afc4296239944a8 8afc4296239944a8 993a0b11d12f4cb4 993a0b11d12f4cb4 993a0b11d12f4cb4
+69 de347b790c794311 de347b790c794311 97e0dc187b360837 ae2e912cd426a828 d701cc9b97a478f0 a7b1f717b2679a9d 34fb97fb60c67fdd 34fb97fb60c67fdd 34fb97fb60c67fdd
+70 ddf95737b5aa3b5f ddf95737b5aa3b5f 901d4ca9ea6f0d7b 3928ec3962b0d935 44519086ccf6232f bd49d1748e8ba68e 2f83d735e610bb61 2f83d735e610bb61 2f83d735e610bb61
+71 0c75511be4ea7886 0c75511be4ea7886 cb781ef84f6fe122 730f7b2ddb8e28f5 cfdba8c95a83c255 f39d4c29931dc37d e9116430c8c7d670 e9116430c8c7d670 e9116430c8c7d670
+72 7c668a010144232e 7c668a010144232e 915261ee7de38067 625ab66c178941d5 b67aff2b9a730bb1 53b57649c4a47b3f 53b57649c4a47b3f 53b57649c4a47b3f 53b57649c4a47b3f
+73 10e1b526ec98d5d7 10e1b526ec98d5d7 2af3ee5e19af4296 a8d600a5c4fa6d3d 63f749b0bba613c8 f2148370253ea7a2 38f44e136bbe9284 38f44e136bbe9284 38f44e136bbe9284
+74 7298cd36869fe1d6 7298cd36869fe1d6 b2ac5b1723d2731d b2ac5b1723d2731d 11e544ce93888e3e 11e544ce93888e3e 11e544ce93888e3e 11e544ce93888e3e 11e544ce93888e3e
+75 2f5851fa2bb2d279 2f5851fa2bb2d279 a15fca88be9fe98b aeda86ae22b9dea9 8edada7276027f04 54a28804fb54db83 54a28804fb54db83 54a28804fb54db83 54a28804fb54db83
+76 33b5aa8996c7338b 33b5aa8996c7338b b208bf29862175d0 b5016d97e5e339e3 2b277d6ffc491820 52d1de8103b708ee 275e38b4f0f9b912 275e38b4f0f9b912 275e38b4f0f9b912
+77 217eef69e4f9ad20 217eef69e4f9ad20 920aec7d86846cea 1dc929c938022be1 32967eaacebc536f 68b5d4ea1063cdba 68b5d4ea1063cdba 68b5d4ea1063cdba 68b5d4ea1063cdba
+78 1f54cee267a16c9d 1f54cee267a16c9d acf1ad7a07000ed7 acf1ad7a07000ed7 57cd264107e9cd02 57cd264107e9cd02 57cd264107e9cd02 57cd264107e9cd02 57cd264107e9cd02
+79 5ed2da75567ae26a 5ed2da75567ae26a f00fd80afe58e6fc f00fd80afe58e6fc 52b446031cce5784 52b446031cce5784 16ca102cc218d08a 16ca102cc218d08a 16ca102cc218d08a
+80 0e7ce2a261ece9e1 0e7ce2a261ece9e1 977c1a0b15fe195d 977c1a0b15fe195d d9a743d65fe3f6fb d9a743d65fe3f6fb d9a743d65fe3f6fb d9a743d65fe3f6fb d9a743d65fe3f6fb
+81 b7a475bea0f13dbf b7a475bea0f13dbf 7834f644a2b7bc80 7834f644a2b7bc80 e5fece40f0e3a507 e5fece40f0e3a507 6d0b62c8530078fc 6d0b62c8530078fc 6d0b62c8530078fc
+82 eb5fea323a6c7109 eb5fea323a6c7109 d74d820e994dd0a1 02998d3fbe68546a dec3643551e849ba 3f94849648cdccbe c10483ba8da8aaa9 c10483ba8da8aaa9 c10483ba8da8aaa9
+83 5110c3d27a2858ff 5110c3d27a2858ff f4eda4258b2902b0 c213af818199e419 cb975afb07901553 62d9e7050feab1fe 62d9e7050feab1fe 62d9e7050feab1fe 62d9e7050feab1fe
+84 53cf871e009ac608 53cf871e009ac608 e5a90fba287ba5dc e5a90fba287ba5dc 8e0e030b1117cec2 8e0e030b1117cec2 8e0e030b1117cec2 8e0e030b1117cec2 8e0e030b1117cec2
+85 2e5a95ef60c663c9 2e5a95ef60c663c9 3ed6beff6b87dfdb c77269068a1d520d 0c121ad0ba0917d0 5c0958660a75a9f6 b7137f57942a195a b7137f57942a195a b7137f57942a195a
+86 a7d06f8085dbd520 a7d06f8085dbd520 ab9a06787736b8e6 71a81a7a1b85892b 6f8c25f000d64fab a007ddd0d8b73f31 4770930280fc46a5 4770930280fc46a5 4770930280fc46a5
+87 42c5358e72506744 42c5358e72506744 3d8c2b35286fc193 dd02e2d4e55e8986 c843307f3d701e1f d14f3cfe21bd6eb8 d14f3cfe21bd6eb8 d14f3cfe21bd6eb8 d14f3cfe21bd6eb8
+88 ef7024d4a51dd53f ef7024d4a51dd53f 9ad8743b68466ce0 a4d39e0239b516de 5b109fdf72b67699 69818d79c313a50d 63d7cee609d0f5e4 63d7cee609d0f5e4 63d7cee609d0f5e4
+89 f38e7108d472c7d3 f38e7108d472c7d3 765f1c2d5292b4dd 765f1c2d5292b4dd f79476180477969d f79476180477969d aa60e51669b13c44 aa60e51669b13c44 aa60e51669b13c44
+90 e635c9576d16dcc2 e635c9576d16dcc2 bd4020740bc1bc72 bd4020740bc1bc72 dd8baf83c2335450 dd8baf83c2335450 fce1d7d858a31b06 fce1d7d858a31b06 fce1d7d858a31b06
+91 e3983d98d29e5f6e e3983d98d29e5f6e f82bbd26f32e6499 f82bbd26f32e6499 91315c64ed1ba252 91315c64ed1ba252 d0eb3cbb0388c580 d0eb3cbb0388c580 d0eb3cbb0388c580
+92 d9af23fa6d4f5f89 e5fb9f5cc30c90c5 4b3eff0059577ebf ffbab4739661b57e d89597aa5532da5e 163dc301c19ea713 4b3248516db405d6 4b3248516db405d6 4b3248516db405d6
+93 0a3805044f4ae26e 0a3805044f4ae26e e82ae2fc14e1a167 87e0c62ca1cc81ad cc153f5ed8408492 89cd0869b1d1029d af5a8be22b8bff29 af5a8be22b8bff29 af5a8be22b8bff29
+94 0a4fd1770c262cb2 0a4fd1770c262cb2 b13d28be82a0ba82 b13d28be82a0ba82 d2df6aec90298084 d2df6aec90298084 7a18de1f4e24319f 7a18de1f4e24319f 7a18de1f4e24319f
+95 cd122941599274fc 602ba25a7b92be28 c2b34153b1c6c31d c2b34153b1c6c31d bac5cf1a7e386a30 bac5cf1a7e386a30 4745642d0ee5e585 4745642d0ee5e585 4745642d0ee5e585
+96 de1fd9280be46e7f de1fd9280be46e7f b1d64207f194bdb0 b1d64207f194bdb0 faba642065b27ef7 faba642065b27ef7 322f38a477ff205d 322f38a477ff205d 322f38a477ff205d
+97 1a36eaa861f923e2 1a36eaa861f923e2 d5e213695b7f284d d5e213695b7f284d b84bad43e3fdb71b b84bad43e3fdb71b b84bad43e3fdb71b b84bad43e3fdb71b b84bad43e3fdb71b
+98 6c5068053611a741 6c5068053611a741 2ab6078bd20cfac9 645f18392826aca4 3856204e704672db 57ad12cf07757684 df48b2b3f0c8ea8a df48b2b3f0c8ea8a df48b2b3f0c8ea8a
+99 7c420cbf93fcaa80 7c420cbf93fcaa80 bcc6c6a628dd30c1 bcc6c6a628dd30c1 0e487ab56d902079 0e487ab56d902079 0e487ab56d902079 0e487ab56d902079 0e487ab56d902079
+100 bb7c7a0fdadc1c41 bb7c7a0fdadc1c41 e7d81d02b1c87432 ed7260f96e6dea0d 62c33eb1279cdd99 d4cc5f839d287dbe ac4368b692756cc7 ac4368b692756cc7 ac4368b692756cc7
+101 9b45e7c3affa2214 9b45e7c3affa2214 88fc250bbea5cd11 88fc250bbea5cd11 eac270438a903dcc eac270438a903dcc 60fb9f0fbb5bb290 60fb9f0fbb5bb290 60fb9f0fbb5bb290
+102 2d4ea79697c9e271 2d4ea79697c9e271 436ea9c7278886ed 295a006a48638271 1713ce4f8230c002 6cd5f51b822ba4a0 7b5b03d6a6edea5f 7b5b03d6a6edea5f 7b5b03d6a6edea5f
+103 f5bd4f78c114cc3c f5bd4f78c114cc3c b7a56060a5f19641 b7a56060a5f19641 45a18f7715ee8bda 45a18f7715ee8bda 45a18f7715ee8bda 45a18f7715ee8bda 45a18f7715ee8bda
+104 12c4a14c276647b7 12c4a14c276647b7 e94d2e486e284f9f a74ceea62d5d8178 2a6ee0ea13f50f8f 160de61a7bab9e8d 15b923978f6f1e8a 15b923978f6f1e8a 15b923978f6f1e8a
+105 85b8279185eac80c e93ba05d20c0cc7f 11829b36a985fff3 11829b36a985fff3 fc1b8fa999b9330d fc1b8fa999b9330d 145f9abd8824ad54 145f9abd8824ad54 145f9abd8824ad54
+106 e2c0e61e6887bcc7 e2c0e61e6887bcc7 73c821e8d1bf9e9a 999e8c7162304907 8c49ecfd2f1e3450 b5b31862dbc6e86c aedab5b8f55fa18b aedab5b8f55fa18b aedab5b8f55fa18b
+107 0128a3f546c12857 0128a3f546c12857 595f407930b793be 595f407930b793be 48722f04ce1db5f5 48722f04ce1db5f5 cd4ccdff4c0a8150 cd4ccdff4c0a8150 cd4ccdff4c0a8150
+108 bccf3549cbd704ff bccf3549cbd704ff f5bc994e2b62b568 8b4f5f2bd07b080e 0dd68ee90729da0c baf50ab09ab4c469 925d02818896de3e 925d02818896de3e 925d02818896de3e
+109 77dbb946aa29d83c 77dbb946aa29d83c a2f674b90b9dfd07 a2f674b90b9dfd07 33a1bc0974d85353 33a1bc0974d85353 d68c49b022f3563e d68c49b022f3563e d68c49b022f3563e
+110 2ef885f2bde980f9 2ef885f2bde980f9 88d2107fcd227ae7 88d2107fcd227ae7 56e6f4a5128217c6 56e6f4a5128217c6 bcf23ad03adce80a bcf23ad03adce80a bcf23ad03adce80a
+111 2c4ccc7078ed5aa4 2c4ccc7078ed5aa4 e5a3fd4fcec9d24e e5a3fd4fcec9d24e 933ef3669863115e 933ef3669863115e 933ef3669863115e 933ef3669863115e 933ef3669863115e
+112 2acd0aab04378aa9 2acd0aab04378aa9 66983f1372bc2f86 66983f1372bc2f86 ecac6bfc814e1c56 ecac6bfc814e1c56 43f35cf459b1710d 43f35cf459b1710d 43f35cf459b1710d
+113 1eea46f246de89aa 1eea46f246de89aa 236d7513f68b34b9 7d1013d22ff85cfa 334d588abe7f677e b20ecdf25f9a84c7 d05a0cb0b2324583 d05a0cb0b2324583 d05a0cb0b2324583
+114 1300f0d8143fa5fe 1300f0d8143fa5fe 670fdbcad66e2824 8ccc8114e97d4624 e3494637e6a42b86 fb63d3ad2ab5d232 fb63d3ad2ab5d232 fb63d3ad2ab5d232 fb63d3ad2ab5d232
+115 60d7a1dcad4f08da 60d7a1dcad4f08da 4ef3231e553edff3 4ef3231e553edff3 f36f6d77fc7a8145 f36f6d77fc7a8145 ecac41ee8648ac23 ecac41ee8648ac23 ecac41ee8648ac23
+116 5f9aeefe85df24e0 5f9aeefe85df24e0 07064f3834a2c4ed c61e39af0fc0332c f9b8087a6a1a26c5 fef629b249d16185 fef629b249d16185 fef629b249d16185 fef629b249d16185
+117 5eba7c77c49391be 5eba7c77c49391be b2a7d30e3fe89a1d f30b7fa688e90741 c88a0236c1266d2b 1b2c4b166a0568e9 67e988e88d8a5382 67e988e88d8a5382 67e988e88d8a5382
+118 01d4ac086009ab5d 9c84d2890bbf8fe8 bc2e1aa70aed51c8 9773222eb6115562 2590a621a1e86500 7c8cca444129ff02 aa08c2b06922237f aa08c2b06922237f aa08c2b06922237f
+119 1f0e28749b2997c7 1f0e28749b2997c7 8597d5c78d05db77 8597d5c78d05db77 0ea3939bbde23cc3 0ea3939bbde23cc3 36d96530d821a81d 36d96530d821a81d 36d96530d821a81d
+120 49ca476464e199a8 49ca476464e199a8 bf352e5f37964ccf 53ae63034a7a4e0d f0e30002963b5cae 2ea37e9c4c71e047 2ea37e9c4c71e047 2ea37e9c4c71e047 2ea37e9c4c71e047
+121 5758e8d6fe576451 5758e8d6fe576451 9d519f729edecc5b 9d519f729edecc5b 55c85183f67621f9 55c85183f67621f9 7d46a7bdf1a62fe8 7d46a7bdf1a62fe8 7d46a7bdf1a62fe8
+122 0c16b054157b97b5 0c16b054157b97b5 db6b3fd1b94b7ba6 db6b3fd1b94b7ba6 c10e931973d159f8 c10e931973d159f8 c10e931973d159f8 c10e931973d159f8 c10e931973d159f8
+123 e524b1c873662f16 e524b1c873662f16 0a952dbd733c3594 0a952dbd733c3594 1799fe78eb662ca5 1799fe78eb662ca5 7a32a46af6ffa736 7a32a46af6ffa736 7a32a46af6ffa736
+124 2b9fbba10319f3c7 2b9fbba10319f3c7 d22dd8a938cb935d d22dd8a938cb935d bd9e0f6747d3f557 bd9e0f6747d3f557 3758152bfe3480ad 3758152bfe3480ad 3758152bfe3480ad
+125 452fd01fc329347e 452fd01fc329347e 2d51c467f2dbcfc5 07a31a3cf6d011ac cecaa5aa61fb203f 6ae9fd89c82dff16 c2f30d5c9d8d2a64 c2f30d5c9d8d2a64 c2f30d5c9d8d2a64
+126 029c0624ac778105 029c0624ac778105 f4f077a4e5e9d8d1 f4f077a4e5e9d8d1 e3ba79b01e431e2d e3ba79b01e431e2d b7e8299b63b70cb9 b7e8299b63b70cb9 b7e8299b63b70cb9
+127 570426f4ce8f9abb 570426f4ce8f9abb dbe942529788c78c 387697ab55658241 d7ac1c79963ecb2b 78d1df19ecab292d f41d35077df87f76 f41d35077df87f76 f41d35077df87f76
+128 f4b40a754d2af977 f4b40a754d2af977 52b193fc6b6486c7 c90aeee7c5fc8ebb e60e701f7c07cfa2 6ec8e65320976ca7 3a1d75301457ddda 3a1d75301457ddda 3a1d75301457ddda
+129 eb0e81f88e359671 b0f85392f8770452 aaba0aa1e52afc4b aaba0aa1e52afc4b 6844b4f577419002 6844b4f577419002 2b93940c1b75c79c 2b93940c1b75c79c 2b93940c1b75c79c
+130 8b7e6eb62a6c7903 8b7e6eb62a6c7903 88f8eac6601ef6f7 88f8eac6601ef6f7 ab87c7e6a1f2b890 ab87c7e6a1f2b890 f047cd06f7ed2467 f047cd06f7ed2467 f047cd06f7ed2467
+131 2a98a86e23d4bbd2 2a98a86e23d4bbd2 2a98a86e23d4bbd2 79e1cb95fbaa4772 e2ae582d382811b0 37940f709f1f0dad 780b7073c59cb4de 780b7073c59cb4de 780b7073c59cb4de
+132 31949df675b167b1 44b37aa2564ef91c 350cf3b8583bc13d 350cf3b8583bc13d bd93d0c676f8cd80 bd93d0c676f8cd80 c41815dc7a82d701 c41815dc7a82d701 c41815dc7a82d701
+133 01afdaf098f21f3b 9e4f9ce774265f1e 54811e7a0d2e7b52 4ac62c50f4cb37d0 f6c8b5809dc5d6d1 3e28b35311015418 9427baffc6e5bd95 9427baffc6e5bd95 9427baffc6e5bd95
+134 92b61a9417c0e851 92b61a9417c0e851 9d2919775323db82 9d2919775323db82 6ccc64609b1d6145 6ccc64609b1d6145 56c88711783d821c 56c88711783d821c 56c88711783d821c
+135 1c058f0fb23f0a64 c45a694230c19056 e9b3b12dd85588a2 1a1e2b69c82c405b 59cba721bf0b60e9 b2cdadc376ebf452 2967e804a8b2a665 2967e804a8b2a665 2967e804a8b2a665
+136 4993ac3712385e24 4993ac3712385e24 e8388eae3132948c e8388eae3132948c 78ff6082911ab263 78ff6082911ab263 3a2e4a3da13e2d7b 3a2e4a3da13e2d7b 3a2e4a3da13e2d7b
+137 76e5901cf26e5251 76e5901cf26e5251 b4c1bf979f4c10bc b4c1bf979f4c10bc ce55a50035cd861a ce55a50035cd861a 41a22be8b935b6b3 41a22be8b935b6b3 41a22be8b935b6b3
+138 dcac0ebbeaa84a8f dcac0ebbeaa84a8f 0d2ee0e7c4b2b162 54f1d42edc2748e1 69c3369aeba6451b fc22a68ee5a862be e48bf3a69620b9d7 e48bf3a69620b9d7 e48bf3a69620b9d7
+139 dfa0c1b35f2407ab dfa0c1b35f2407ab 49b46ae4b92f480d 5d18d660d0254c86 301ccc205df0d0de ed2b58967c03d035 248d7164aa1f3e25 248d7164aa1f3e25 248d7164aa1f3e25
+140 b0635067b3221756 b0635067b3221756 b7d622a68fb8fb45 9ecaacc9eb9a6a11 a2eec5892ac9671f 25921a91d2bda74a 5cbe47e3a399b07c 5cbe47e3a399b07c 5cbe47e3a399b07c
+141 6b612e62745c5096 6b612e62745c5096 8388b87141b902b2 5b2096461e76f285 d80fda61ead7d2ca dd1ccd5525ae8003 56e19e1e95a8de96 56e19e1e95a8de96 56e19e1e95a8de96
+142 77b532409b38ad68 77b532409b38ad68 77b532409b38ad68 df6ed1ef23097861 d2d88257df255239 567ed50b7f376ff0 ee478b1eab86177d ee478b1eab86177d ee478b1eab86177d
+143 1f996749706f2cbc 1aa08da84617fe89 12967f4cd5aaa12a 766762ae29bec5fd 73b5967c296aed1c 493f2624b9f6bca2 045eafec15208679 045eafec15208679 045eafec15208679
+144 9a8106f2d23a0e36 9a8106f2d23a0e36 fe821e918acf4a76 61f9003f7f45fcd2 a5fc63c76174f142 ec7e44d8026c0076 ec7e44d8026c0076 ec7e44d8026c0076 ec7e44d8026c0076
+145 05b481e03fb774fd 05b481e03fb774fd 5c552126179c4c5b 20a29db8bd43b767 be01637ae1438379 0da0140b82d5ba28 3856c3e53ea2e91c 3856c3e53ea2e91c 3856c3e53ea2e91c
+146 9e92895d47783bac 9e92895d47783bac f331c71f40697713 b8449f9312dd89c1 b22fea7047f412f4 1f3c7ddbd14e0951 0af670df9c93a269 0af670df9c93a269 0af670df9c93a269
+147 7210448f4ae54d01 7210448f4ae54d01 0bb4a1f7b1a2eeed 0bb4a1f7b1a2eeed 895cd72bfc0d8ccb 895cd72bfc0d8ccb bb0f45520613e717 bb0f45520613e717 bb0f45520613e717
+148 d7093dbf6eaa4570 d7093dbf6eaa4570 d7093dbf6eaa4570 cb2c01905762febe 043f66b2e5f46614 4c4e9ccf55034f35 4c4e9ccf55034f35 4c4e9ccf55034f35 4c4e9ccf55034f35
+149 087b3c73b5e644ac 087b3c73b5e644ac 398fe8baf99c5a46 398fe8baf99c5a46 9870ecb8e0a23960 9870ecb8e0a23960 9870ecb8e0a23960 9870ecb8e0a23960 9870ecb8e0a23960
+150 5431f0d976d128dc 6165e296214a4c2a 1b8622b490f01770 7e55b1f6b77cd003 65095ec0e347ed59 feb581603ac5a960 33b9547adb4bd8d6 33b9547adb4bd8d6 33b9547adb4bd8d6
+151 ad3b3f40e0f0143a ad3b3f40e0f0143a b786ba4c7280840a b786ba4c7280840a e1fe6cde0091d87a e1fe6cde0091d87a 7d4cd3cd09128d50 7d4cd3cd09128d50 7d4cd3cd09128d50
+152 b0caac9d41f8df73 96b2e7818a1a276b d3e794306e35d58e d3e794306e35d58e 33a74bce6fc69290 33a74bce6fc69290 8449e1b5e08fc4db 8449e1b5e08fc4db 8449e1b5e08fc4db
+153 20ecad7fb872dd36 ede82c61fd3e47d3 4c842f9f8710144e 4c842f9f8710144e 4286bae666723b9c 4286bae666723b9c e650dbff6834459b e650dbff6834459b e650dbff6834459b
+154 ed6f4077335f0fc5 ed6f4077335f0fc5 891fa83a9d3afcb8 891fa83a9d3afcb8 33a8eed1fc0d4195 33a8eed1fc0d4195 33a8eed1fc0d4195 33a8eed1fc0d4195 33a8eed1fc0d4195
+155 d7c6e08857d9ec1b d7c6e08857d9ec1b 4c626f9e9bce639d 4c626f9e9bce639d fa18a196101f2a57 fa18a196101f2a57 fa18a196101f2a57 fa18a196101f2a57 fa18a196101f2a57
+156 6c913918cc1f779b 6c913918cc1f779b 815ac065a646b9bb 815ac065a646b9bb d29f372c9b8ae432 d29f372c9b8ae432 d29f372c9b8ae432 d29f372c9b8ae432 d29f372c9b8ae432
+157 c3ef13694831bfb9 c3ef13694831bfb9 38730da270023c19 38730da270023c19 cae3811afe81146d cae3811afe81146d 0944bb66fe57203d 0944bb66fe57203d 0944bb66fe57203d
+158 b9973fabfd359006 b9973fabfd359006 b9973fabfd359006 edc38b9b322b2fd2 804f3fe6623d144f eb87e7b917d17f0d a3cfb488c0dd196f a3cfb488c0dd196f a3cfb488c0dd196f
+159 ee57946703ec9eab 7d1b341f46ca5d42 6c49d2c53a1e5fde 2ca2dd9c03c70e04 8a0d0b781cd6da6e e836a38881cf473b e836a38881cf473b e836a38881cf473b e836a38881cf473b
+160 138da5b6bc7765d5 138da5b6bc7765d5 7c4ec30dccb76871 580174d33f6b7632 bd6d1d90a4a173c2 f7c6635c7cfeb6b8 f7c6635c7cfeb6b8 f7c6635c7cfeb6b8 f7c6635c7cfeb6b8
+161 b4665315b102b0d6 b4665315b102b0d6 5a9ab315d62cf109 5a9ab315d62cf109 4b22726701f66612 4b22726701f66612 4b22726701f66612 4b22726701f66612 4b22726701f66612
+162 138abefe91eb6d4d 138abefe91eb6d4d 151b46f09dc6e38e 151b46f09dc6e38e 4f6e80b82332a14c 4f6e80b82332a14c fb595e978631208e fb595e978631208e fb595e978631208e
+163 82412da28a7362af 62710162d63ac764 d33e94d67d998313 d33e94d67d998313 0da779ad00eaa71a 0da779ad00eaa71a 0da779ad00eaa71a 0da779ad00eaa71a 0da779ad00eaa71a
+164 2ee93fc67d3d0e06 2ee93fc67d3d0e06 2ee93fc67d3d0e06 2ee93fc67d3d0e06 abd821fd939f2096 abd821fd939f2096 abd821fd939f2096 abd821fd939f2096 abd821fd939f2096
+165 5cebce3145bb217f fc1be08b5c2f3b75 e8046cc7032c62eb e8046cc7032c62eb 19925aefbb39dbb8 19925aefbb39dbb8 19925aefbb39dbb8 19925aefbb39dbb8 19925aefbb39dbb8
+166 7b600273ae7a86b3 7b600273ae7a86b3 7b600273ae7a86b3 7b600273ae7a86b3 b6ffc350887701c8 b6ffc350887701c8 b6ffc350887701c8 b6ffc350887701c8 b6ffc350887701c8
+167 7ef2332a85de9920 7ef2332a85de9920 7ef2332a85de9920 7ef2332a85de9920 6f7c6214352ba360 6f7c6214352ba360 6cbf09d38725b3a3 6cbf09d38725b3a3 6cbf09d38725b3a3
+168 5e7f6344ada7b8cd 5e7f6344ada7b8cd 5e7f6344ada7b8cd 5e7f6344ada7b8cd 239e91535c84b26b 239e91535c84b26b 239e91535c84b26b 239e91535c84b26b 239e91535c84b26b
+169 d7e31b5bfe183eee 8261ee2bcdf9ca7c 8261ee2bcdf9ca7c 8261ee2bcdf9ca7c 55ce57d961d4844c 55ce57d961d4844c 55ce57d961d4844c 55ce57d961d4844c 55ce57d961d4844c
+170 f4843e51d271b19f f4843e51d271b19f f4843e51d271b19f f4843e51d271b19f bd4aa382f673a2b9 bd4aa382f673a2b9 bd4aa382f673a2b9 bd4aa382f673a2b9 bd4aa382f673a2b9
+171 0de0dcca3b618cdf 0de0dcca3b618cdf 0de0dcca3b618cdf 0de0dcca3b618cdf 60c70585e16f3237 60c70585e16f3237 a80c47397c3ca91e a80c47397c3ca91e a80c47397c3ca91e
+172 007c6de2f05f0947 007c6de2f05f0947 b9279b0d14e5da3e b9279b0d14e5da3e 60b0afc388e5e0b7 60b0afc388e5e0b7 60b0afc388e5e0b7 60b0afc388e5e0b7 60b0afc388e5e0b7
+173 97525417e30282ce 97525417e30282ce 97525417e30282ce 97525417e30282ce 73682064e95c9d02 73682064e95c9d02 4993ce46d0141827 4993ce46d0141827 4993ce46d0141827
+174 df2434fc2154bd56 df2434fc2154bd56 df2434fc2154bd56 df2434fc2154bd56 813f65abcbdd8fce 813f65abcbdd8fce 813f65abcbdd8fce 813f65abcbdd8fce 813f65abcbdd8fce
+175 86c1d62970207a97 86c1d62970207a97 86c1d62970207a97 86c1d62970207a97 86972f92bd651e57 86972f92bd651e57 51b6ab3d2eb3e2c4 51b6ab3d2eb3e2c4 51b6ab3d2eb3e2c4
+176 8cffd1ea26e0a687 8cffd1ea26e0a687 e2c89036edb7503d e2c89036edb7503d 12296f28896fec0b 12296f28896fec0b 12296f28896fec0b 12296f28896fec0b 12296f28896fec0b
+177 c921b803e987ab38 c921b803e987ab38 c921b803e987ab38 c921b803e987ab38 360b4708ab003d59 360b4708ab003d59 360b4708ab003d59 360b4708ab003d59 360b4708ab003d59
+178 6d8b0f69f3cdf76e 6d8b0f69f3cdf76e 6d8b0f69f3cdf76e 6d8b0f69f3cdf76e 22f2c830f96fab26 22f2c830f96fab26 22f2c830f96fab26 22f2c830f96fab26 22f2c830f96fab26
+179 241c9359f6a34e55 241c9359f6a34e55 241c9359f6a34e55 241c9359f6a34e55 ebeee2023bde1117 ebeee2023bde1117 ebeee2023bde1117 ebeee2023bde1117 ebeee2023bde1117
+180 662e22162048b5b5 662e22162048b5b5 662e22162048b5b5 662e22162048b5b5 9d2ac42cac8ae2a2 9d2ac42cac8ae2a2 9d2ac42cac8ae2a2 9d2ac42cac8ae2a2 9d2ac42cac8ae2a2
+181 a34ea853d67acfbb a34ea853d67acfbb a34ea853d67acfbb a34ea853d67acfbb e33bd469e614acd8 e33bd469e614acd8 e33bd469e614acd8 e33bd469e614acd8 e33bd469e614acd8
+182 efff1433aca907aa efff1433aca907aa efff1433aca907aa efff1433aca907aa 65d298ed04298984 65d298ed04298984 65d298ed04298984 65d298ed04298984 65d298ed04298984
+183 6af2c83ee0b05324 6af2c83ee0b05324 a68ff5dc9bc76f89 a68ff5dc9bc76f89 061a9433599fd1f6 061a9433599fd1f6 061a9433599fd1f6 061a9433599fd1f6 061a9433599fd1f6
+184 f7ae931cf655db50 f7ae931cf655db50 14503e5b6011725a 14503e5b6011725a 21840b0f11004d59 21840b0f11004d59 21840b0f11004d59 21840b0f11004d59 21840b0f11004d59
+185 7e74edb821b27cd5 7e74edb821b27cd5 7e74edb821b27cd5 7e74edb821b27cd5 c2aea5ac2fd3770c c2aea5ac2fd3770c c2aea5ac2fd3770c c2aea5ac2fd3770c c2aea5ac2fd3770c
+186 9b0f8f4993beb48e 9b0f8f4993beb48e 9b0f8f4993beb48e 9b0f8f4993beb48e 37ca6f76e8e8042e 37ca6f76e8e8042e 37ca6f76e8e8042e 37ca6f76e8e8042e 37ca6f76e8e8042e
+187 df09704109fb3b8f df09704109fb3b8f df09704109fb3b8f df09704109fb3b8f 7321c323e6c69a9d 7321c323e6c69a9d 7321c323e6c69a9d 7321c323e6c69a9d 7321c323e6c69a9d
+188 5de98fc37ed41e09 5de98fc37ed41e09 5de98fc37ed41e09 5de98fc37ed41e09 4cfeb3f6be3f7908 4cfeb3f6be3f7908 4cfeb3f6be3f7908 4cfeb3f6be3f7908 4cfeb3f6be3f7908
+189 f054bdd1ab73d1ef f054bdd1ab73d1ef f054bdd1ab73d1ef f054bdd1ab73d1ef b499188d8a687bb9 b499188d8a687bb9 b499188d8a687bb9 b499188d8a687bb9 b499188d8a687bb9
+190 3164d65e75dffb33 3164d65e75dffb33 3164d65e75dffb33 3164d65e75dffb33 417ab98fa25b8491 417ab98fa25b8491 417ab98fa25b8491 417ab98fa25b8491 417ab98fa25b8491
+191 da9a3b7b6b613750 da9a3b7b6b613750 da9a3b7b6b613750 da9a3b7b6b613750 0c082827ca8f957f 0c082827ca8f957f 0c082827ca8f957f 0c082827ca8f957f 0c082827ca8f957f
+192 5838a2121f74993f 5838a2121f74993f 5838a2121f74993f 5838a2121f74993f 267b95fd62d1fb19 267b95fd62d1fb19 267b95fd62d1fb19 267b95fd62d1fb19 267b95fd62d1fb19
+193 5497a15c3ebf0b90 5497a15c3ebf0b90 5497a15c3ebf0b90 5497a15c3ebf0b90 e9fa10e7988c7c0d e9fa10e7988c7c0d e9fa10e7988c7c0d e9fa10e7988c7c0d e9fa10e7988c7c0d
+194 5c7ed0b58ba7d13f 5c7ed0b58ba7d13f 5c7ed0b58ba7d13f 5c7ed0b58ba7d13f cdd6dc8415f3149d cdd6dc8415f3149d cdd6dc8415f3149d cdd6dc8415f3149d cdd6dc8415f3149d
+195 a99865295ebaa79b a99865295ebaa79b a99865295ebaa79b a99865295ebaa79b 0482d50468083c2f 0482d50468083c2f 0482d50468083c2f 0482d50468083c2f 0482d50468083c2f
+196 406dff449e9cdba7 406dff449e9cdba7 d3ae06ca304294ec d3ae06ca304294ec 1b7d59c43b2cfc59 1b7d59c43b2cfc59 1b7d59c43b2cfc59 1b7d59c43b2cfc59 1b7d59c43b2cfc59
+197 4355eb56d917f96d 4355eb56d917f96d 4355eb56d917f96d 4355eb56d917f96d d80a239ef788be54 d80a239ef788be54 d80a239ef788be54 d80a239ef788be54 d80a239ef788be54
+198 d04f54636be0fad3 d04f54636be0fad3 d04f54636be0fad3 d04f54636be0fad3 43a9afe5b3402afd 43a9afe5b3402afd 43a9afe5b3402afd 43a9afe5b3402afd 43a9afe5b3402afd
+199 700fd5903d4ede13 700fd5903d4ede13 700fd5903d4ede13 700fd5903d4ede13 745f3cb70cdd21b1 745f3cb70cdd21b1 7886ab7489afe603 7886ab7489afe603 7886ab7489afe603
+200 d481f7a3ba0d03b3 d481f7a3ba0d03b3 d481f7a3ba0d03b3 d481f7a3ba0d03b3 4f33042d698a6d00 4f33042d698a6d00 4f33042d698a6d00 4f33042d698a6d00 4f33042d698a6d00
+201 603e4ea8bad169e3 603e4ea8bad169e3 603e4ea8bad169e3 603e4ea8bad169e3 736f21ad152ff852 736f21ad152ff852 736f21ad152ff852 736f21ad152ff852 736f21ad152ff852
+202 b7e05424bfd2b07c b7e05424bfd2b07c b7e05424bfd2b07c b7e05424bfd2b07c cc657f0281902888 cc657f0281902888 cc657f0281902888 cc657f0281902888 cc657f0281902888
+203 372b18f32fff2287 372b18f32fff2287 372b18f32fff2287 372b18f32fff2287 17db0534c9904e79 17db0534c9904e79 17db0534c9904e79 17db0534c9904e79 17db0534c9904e79
+204 5b23e35097b52570 5b23e35097b52570 5b23e35097b52570 5b23e35097b52570 8c29b119aab7423b 8c29b119aab7423b 8c29b119aab7423b 8c29b119aab7423b 8c29b119aab7423b
+205 b888c4f59a733ffc b888c4f59a733ffc b888c4f59a733ffc b888c4f59a733ffc 2fb5781e7124fb3c 2fb5781e7124fb3c 2fb5781e7124fb3c 2fb5781e7124fb3c 2fb5781e7124fb3c
+206 fb306d86490fd619 fb306d86490fd619 fb306d86490fd619 fb306d86490fd619 336038cc802ddf63 336038cc802ddf63 336038cc802ddf63 336038cc802ddf63 336038cc802ddf63
+207 0d75267f22ae6e73 0d75267f22ae6e73 0d75267f22ae6e73 0d75267f22ae6e73 2ec55ab56ea24f5e 2ec55ab56ea24f5e 2ec55ab56ea24f5e 2ec55ab56ea24f5e 2ec55ab56ea24f5e
+208 a87b70543c5d8d26 a87b70543c5d8d26 a87b70543c5d8d26 a87b70543c5d8d26 8971f16dab243d7e 8971f16dab243d7e 8971f16dab243d7e 8971f16dab243d7e 8971f16dab243d7e
+209 50adfbbd52171106 50adfbbd52171106 50adfbbd52171106 50adfbbd52171106 5c220289042f5c40 5c220289042f5c40 5c220289042f5c40 5c220289042f5c40 5c220289042f5c40
+210 e0765f7b9e6ee7d0 e0765f7b9e6ee7d0 e0765f7b9e6ee7d0 e0765f7b9e6ee7d0 fd9f528042f64136 fd9f528042f64136 fd9f528042f64136 fd9f528042f64136 fd9f528042f64136
+211 cd4b877d716972d9 cd4b877d716972d9 cd4b877d716972d9 cd4b877d716972d9 e307effa9a2602da e307effa9a2602da 0abfce0519ee33ac 0abfce0519ee33ac 0abfce0519ee33ac
@@ -0,0 +1,272 @@
+# tick spawn route counters queue move flip arrivals halt signals
+0 29b3565bb107fa1b 29b3565bb107fa1b 29b3565bb107fa1b 29f104a04bf204aa 2b2678aee700189e b37f92f6e339645a b37f92f6e339645a b37f92f6e339645a b37f92f6e339645a
+1 8b7b9cbbfeace618 8b7b9cbbfeace618 8b7b9cbbfeace618 1b8afb8ef6a2602b 7a723febd7c495b2 402fec98db20d12d 402fec98db20d12d 402fec98db20d12d 402fec98db20d12d
+2 5820222c9896fdbd 5820222c9896fdbd 5820222c9896fdbd 586270d76263030c 02acf6605805b3ba be5ebc9569711ffc be5ebc9569711ffc be5ebc9569711ffc be5ebc9569711ffc
+3 549acfc4bf670250 549acfc4bf670250 549acfc4bf670250 c46ba8f1b7698463 53304d5dc1cfc47c fdf759871fadbeaa fdf759871fadbeaa fdf759871fadbeaa fdf759871fadbeaa
+4 627fee45e57c8565 627fee45e57c8565 627fee45e57c8565 623dbcbe1f897bd4 5c3106ba4c9a1ab7 9a42cbb8c2d7bf23 9a42cbb8c2d7bf23 9a42cbb8c2d7bf23 9a42cbb8c2d7bf23
+5 7b36b8b86bc1e609 7b36b8b86bc1e609 7b36b8b86bc1e609 ebc7df8d63cf603a 60246dc1efa65265 b3a813f48a82dfa0 b3a813f48a82dfa0 b3a813f48a82dfa0 b3a813f48a82dfa0
+6 a001ef4d17529bc5 a001ef4d17529bc5 a001ef4d17529bc5 a043bdb6eda76574 fcda0a8ef0c82899 794f012eff6f22a3 794f012eff6f22a3 794f012eff6f22a3 794f012eff6f22a3
+7 48a65265ded94622 48a65265ded94622 48a65265ded94622 d8573550d6d7c011 c21f77f8b17e35f8 5fa2a375333e0d60 5fa2a375333e0d60 5fa2a375333e0d60 5fa2a375333e0d60
+8 54c91e867032b796 54c91e867032b796 e3287ef62fc6f22d e36a2c0dd5330c9c b9d88cb6b7a91da9 302c0b64cb97d2ff 302c0b64cb97d2ff 302c0b64cb97d2ff 302c0b64cb97d2ff
+9 a87f0af96523417c a87f0af96523417c 5813797d8445579a c8e21e488c4bd1a9 179de68708910030 ac4621f12aee9c70 ac4621f12aee9c70 ac4621f12aee9c70 ac4621f12aee9c70
+10 2395cd5473377b51 2395cd5473377b51 2395cd5473377b51 23d79faf89c285e0 dcd15cc1cffb24cd adc903077ef56b3a adc903077ef56b3a adc903077ef56b3a adc903077ef56b3a
+11 387686d72c03c3b4 387686d72c03c3b4 387686d72c03c3b4 a887e1e2240d4587 d3db264b496e4d13 b2b64db85f3004e2 b2b64db85f3004e2 b2b64db85f3004e2 b2b64db85f3004e2
+12 3776ab74303b77f0 3776ab74303b77f0 670dcc0367c419d3 7f7d101a9a40d160 3a90fe43abc336c1 73d8e2cc0dd9c4e1 73d8e2cc0dd9c4e1 3ea72f82f2c2ff2a 3ea72f82f2c2ff2a
+13 564dec9feb511950 564dec9feb511950 564dec9feb511950 c6bc8baae35f9f63 ff108a2c194371d9 1f8c36244aef6a0a 1f8c36244aef6a0a 0e14cad156f5ac64 0e14cad156f5ac64
+14 adbf39fdd6327ffd adbf39fdd6327ffd adbf39fdd6327ffd adfd6b062cc7814c 22f15099b6e1f411 569b6029be4445f6 f1bb5c10ca62ae2e c0cb9213c35e8882 c0cb9213c35e8882
+15 df6e2495be096302 df6e2495be096302 df6e2495be096302 4f9f43a0b607e531 03cd30b33962b9dd 9289b6c638fdcb55 9289b6c638fdcb55 78d98c61cd90dfdd 78d98c61cd90dfdd
+16 e19b0c1721940e5f e19b0c1721940e5f 588a06a006c8fce2 58c8545bfc3d0253 39a150d9a9a37e45 3c05c46fbfa12103 3c05c46fbfa12103 2dc3113b6b4b6cd3 2dc3113b6b4b6cd3
+17 799d0311e89eaf5b 799d0311e89eaf5b dc97a9b08ff8f948 0e34988c8203c3f9 763e48d7b73fe953 4774f043bb93930c 4774f043bb93930c 7d1b570a947e836b 7d1b570a947e836b
+18 c808c98b5d65750c c808c98b5d65750c c0f8aafe23d768f1 c0baf805d9229640 820da01bc3a2e744 60ef82a72d00cb80 60ef82a72d00cb80 2dcc37dac9fcaf0f 2dcc37dac9fcaf0f
+19 63525ec59c1ebf52 63525ec59c1ebf52 63525ec59c1ebf52 f3a339f094103961 db1ebfd80e2a424f ad78bb0374daab99 c4f16abce4c6a48a e204fb785621685f e204fb785621685f
+20 cc0653f72d35b2ff cc0653f72d35b2ff 9899308a845d8cb8 95a34077a07f6072 348e21eef48aedff aeca451edd8c3888 aeca451edd8c3888 42b9033f5f7fa73a 42b9033f5f7fa73a
+21 8657b1d3f82fe77a 8657b1d3f82fe77a 626665e4a6703135 f29702d1ae7eb706 32926b30dac13d92 770c7f195544fca4 770c7f195544fca4 f69e6f595ec113c4 f69e6f595ec113c4
+22 30888ff0d8926e24 30888ff0d8926e24 30888ff0d8926e24 30cadd0b22679095 70297eff89516bbe 23eefb608852d503 23eefb608852d503 765539170802a033 765539170802a033
+23 f1f11c19db057d02 f1f11c19db057d02 f1f11c19db057d02 61007b2cd30bfb31 76765bb9122461b9 2d738ebc8b32bd5d 2d738ebc8b32bd5d 060d3aee5aa25d2f 060d3aee5aa25d2f
+24 8b7c89b7439a2f64 8b7c89b7439a2f64 f9ced5a2147c50ec f98c8759ee89ae5d 3436e4249d28e9f5 4b735cfc5e44d671 4b735cfc5e44d671 e18afdba3a13450f e18afdba3a13450f
+25 83d0baf1d1a13351 83d0baf1d1a13351 520dcb6fef8d28ae a9a42f0c30f80664 b22fe48f8ade95d9 948e7bbd9af7d6fe 948e7bbd9af7d6fe 6e1f7d0f7f1a86a7 6e1f7d0f7f1a86a7
+26 1bf1bdd77fabb7c5 1bf1bdd77fabb7c5 fd2f6d45aed59701 e55fb15c53515fb2 2ad5a7d913145d6c a7f9cda84dd72f5a a7f9cda84dd72f5a 59a9457a5aff31c9 59a9457a5aff31c9
+27 7b7750c50a45cd4f 7b7750c50a45cd4f 130c1fbf0dba5004 83fd788a05b4d637 18db716b698e5b6c f328863f3f47aced f328863f3f47aced 3b591b09ed84956c 3b591b09ed84956c
+28 a288ec870420bf3f a288ec870420bf3f f29410842345403f 05baf4daae4eebbe dd717d066556c387 7d1901631f661961 7d1901631f661961 1d0d502ea22f49aa 1d0d502ea22f49aa
+29 7eedc9a67d54c470 7eedc9a67d54c470 2f1538cc7e7cef4d fe0c4e55c9719bb5 6a1a8737ed8f1e92 ceda280fe18924fd ceda280fe18924fd 843173539cf443b7 843173539cf443b7
+30 c06f950c3dbd2c4c c682243782eeb318 7e9f1746b9c8d741 7edd45bd433d29f0 32625201b6e7d6de d89df72f87feebb0 d89df72f87feebb0 b0d7feeeb13f13c0 b0d7feeeb13f13c0
+31 5464f72f0c13027f 5464f72f0c13027f e385975f53e747c4 7374f06a5be9c1f7 9980332751062dc1 44d10dae5bb76ff6 44d10dae5bb76ff6 9fb5a9236cda755f 9fb5a9236cda755f
+32 9335e17adbc50881 9335e17adbc50881 a4ab23a1441309ae c78b9cedd2085286 014394dc029f9631 bf11eaeee37f374e 21aae7965a115d50 aec70023b69e71fc aec70023b69e71fc
+33 baf60fcac851c512 baf60fcac851c512 7610734f5ff489bd a83259c9ae18f3da 7ffedd45e42c4e98 a5674c95fe0d3c88 a5674c95fe0d3c88 c7aa52a0d0636f23 c7aa52a0d0636f23
+34 c60ae49c5221e9b2 c60ae49c5221e9b2 c60ae49c5221e9b2 c648b667a8d41703 715aef00260932e5 3b538e2c103e6ab9 3b538e2c103e6ab9 a07f18fed48fdd45 a07f18fed48fdd45
+35 309196bf3c1fd854 309196bf3c1fd854 c178aeda7515375e 5189c9ef7d1bb16d 5d30ed31937dc530 9a6311d8659245ec 9a6311d8659245ec 0e61dfe690f91839 0e61dfe690f91839
+36 525191d9a6949168 525191d9a6949168 e190f8636125557c be750b6f9e6d3ab9 2c8c53bf3e688a76 822a7376fb7cafbe 822a7376fb7cafbe 05bb723023f38a6a 05bb723023f38a6a
+37 421bf01aca9fe467 421bf01aca9fe467 d96d060c78b7b131 6ccfaad07f6347ab bd31782e41ccc18c 914d2843b68bea2e 914d2843b68bea2e ee09c3d701800da4 ee09c3d701800da4
+38 ed8d8da7a7fcc081 ed8d8da7a7fcc081 3db5ea4bd6e6a969 3df7b8b02c1357d8 5dc12aeb4aa5b9d5 91dea2a9bd3cb75b 91dea2a9bd3cb75b b292892b120a9bc6 b292892b120a9bc6
+39 ab386938378a3afe a09be965f6c682c3 ba893980607a71c6 1fb62ef6cd9a17d0 7dc26bd74013552f b9133e644c6fbd3e b9133e644c6fbd3e 250b18d681bbde42 250b18d681bbde42
+40 74593d6f6b1345d8 74593d6f6b1345d8 cce6795171e47b0e f6ef8c65228f06d9 32e7c18ad2668b0b 169ded28922cce17 a2038e2139d12406 291e6efff2e88b40 291e6efff2e88b40
+41 827c02b33a366501 827c02b33a366501 e3de57bc0b547d37 f8044e83b3c82c9f 007bea250a630888 bf3327e439ad3d45 8e6da3f046ca3ba0 f892fed90dcb8b29 f892fed90dcb8b29
+42 f32b8a4ee40438b7 f32b8a4ee40438b7 2695ff95342fdc3b 26d7ad6eceda228a 7d80e1b0af02df05 616f5d51dfb38598 616f5d51dfb38598 aa669a02fa40e35b aa669a02fa40e35b
+43 56b8a382c7d9badd 56b8a382c7d9badd ad8b4204eef69a77 f9e3ec14e6db7cdc c0bcca42ff0b2409 af12c1c388f0001b af12c1c388f0001b 5aa9a409a97e892b 5aa9a409a97e892b
+44 302c698ade55a136 302c698ade55a136 9e90f1cca761c8e1 b5d44c0573df5f4a 0812ab20dfa5084e 39ad2c89569d6e48 97fc3a7580cf243f 407cefc5e1da0e7a 407cefc5e1da0e7a
+45 bcdcbadd41125cdb bcdcbadd41125cdb c547e235fdac3b3e 5390ae9769494dae 8a1ef981f2c7f6ca 726889f9fbf22195 726889f9fbf22195 59ca322bc0a3b283 59ca322bc0a3b283
+46 b772ccd0063f722f b772ccd0063f722f 0f6fffa13d191676 0f2dad5ac7ece8c7 cc5668c11d343e78 bbdc4d34dad42905 6a1551febdac2489 7650dc1241b4a8c7 7650dc1241b4a8c7
+47 b2aced2405d120cc b2aced2405d120cc fd0759f30b4c733e 6df63ec60342f50d f208040c61cf0f92 b0ab6862e94a01fd b0ab6862e94a01fd 408d3d756a0a0a78 408d3d756a0a0a78
+48 8d145c4b3b2bc8e9 8d145c4b3b2bc8e9 7ca8bffa37a41b6e 9ae44ff0d04f47ab 16b7373649d9269b ff2ecfd49c860bac 1881586fb2373b14 3e03b801dff5364f 3e03b801dff5364f
+49 6b1f68f216b5d380 6b1f68f216b5d380 f5b65ca6df2b853e 3ecc99223231ec42 0af37cb87207b147 3eece03b2588cae0 c8b7c35eabae8846 c7d4519ace5e8f71 c7d4519ace5e8f71
+50 6e77ed8f9107aa04 6e77ed8f9107aa04 f5b8d14129cd566e bb29ce092ada548b b903cf185f12ea17 101ac9f160d2882f 101ac9f160d2882f ed27597e4a9814c1 ed27597e4a9814c1
+51 e7b18a3d10da23a4 e7b18a3d10da23a4 27ecea17f1ca4464 82d3fd615c2a2272 1e0f235e1518a271 96dcbdd9fb232c5b 96dcbdd9fb232c5b fbd355699837f831 fbd355699837f831
+52 6b9b0c790700db2f 6b9b0c790700db2f 9fc865709f3c8beb a5c19044cc57f63c 056488e21727371a c7a9d55914aaf680 c7a9d55914aaf680 a5e1794d17d66d18 a5e1794d17d66d18
+53 4f7760c686797678 4f7760c686797678 ec7423317537256f f50dd1a6b94e442f 1922d2808b14c2bb 724091e2a48444de 724091e2a48444de 925df0cf8413af4e 925df0cf8413af4e
+54 f133838d42550f11 835957213de391ad e85f2868df57c7f1 e81d7a9325a23940 22da200e64fa9179 3e06e431b68cd328 04970f20cc8f58f8 0df826cf67b37ef8 0df826cf67b37ef8
+55 7385548da9875ac3 7385548da9875ac3 0997ec7ab38b3d3c 815405adbcf48d0d 6ac604e25da78b0a 6fd2f55c13048f20 b5a63c1e05426eef 6a795bffe0c8ed7b 6a795bffe0c8ed7b
+56 1289e0e05e30f4bf 1289e0e05e30f4bf 106b53978e6fdee6 b1d0afacfc773def 0043edc19cdba524 4748641731c3bd9f 4748641731c3bd9f 603e10a3ba42112a 603e10a3ba42112a
+57 35ea6e7a1fea0539 35ea6e7a1fea0539 8f509ffb631da6a8 650395ce75652786 a7ce24a34172053a 710c6fa0d3552c23 8e734b09ce60ae98 911ae0ad72ea6d99 911ae0ad72ea6d99
+58 53914c93e0aa70c4 39bce18394aa3e99 a93da2145c4d508b fb1cf8e293d80ae7 da7032eb7fb43d2b a2f635ebd76f8e9b a2f635ebd76f8e9b 893e5df612cb0090 893e5df612cb0090
+59 c6a14bd76fe266d9 e806b82af196f46c a0285fea2ac227dd ec25b500b33f60e2 1e1078173231a579 d8bc03385d3c8b94 de4f76db353eeb7b 54520e00493dc6f0 54520e00493dc6f0
+60 a7b5840dddd42a36 a7b5840dddd42a36 c8f733e2f64c7698 8689b4bc06e1d8d5 de2ffac0450fffd9 8519991a9f3aebf4 8519991a9f3aebf4 c2b85f8d97469e27 c2b85f8d97469e27
+61 9af03024f00a584a 26c9151c754b46dd 3fef42df4728a295 af1e25ea4f2624a6 750afd95d0c11777 defbfd5230c69c91 defbfd5230c69c91 5994d9c8877de392 5994d9c8877de392
+62 8ec591031029d683 8ec591031029d683 7501592b6499cbb3 4eaad5e3839d40f3 3ca95528820dade9 4ebde1b43b401b7a 69c467b36b50052d 6b467adc39ded228 6b467adc39ded228
+63 33e04227431be3af 33e04227431be3af 9d529ed4545d33e7 0da3f9e15c53b5d4 ee9840432f3f0f64 51ddc7ed217fb85a 51ddc7ed217fb85a 8ef9878b05dd5b1a 8ef9878b05dd5b1a
+64 f1a6525b6ab50b09 f1a6525b6ab50b09 55a8076913a4d265 29cab5abf121ca24 31ee1b88cf6cc903 8221c16770b0f765 ec49b5cea985d363 c144b393a1040c4d c144b393a1040c4d
+65 4f8aa306cd36cdd0 4f8aa306cd36cdd0 85b5c4d5d071d323 67f598e1d50da474 fb219e31c38ff637 bed1e792763c2bdb bed1e792763c2bdb 889dacde5464fb84 889dacde5464fb84
+66 1d758d838c9c3523 1d758d838c9c3523 c983721d03902805 18a6c1ef2c015687 27e3735d0a5be6f3 b33d27e2d36b4423 45fb05907d0652ed 9e54fdaa8214ddbe 9e54fdaa8214ddbe
+67 907577d093179c1d 907577d093179c1d f47451a35c11bba3 c00d6436f0208e72 f898d96eab50773b 15f593e2ca04027b 15f593e2ca04027b 960038d9a994addf 960038d9a994addf
+68 9b571f2cf659a743 9b571f2cf659a743 64da1b75d35adf77 01fa5e8bdb80eb1d 246a73eb114f2d01 25e24ff3b4e38870 7634df3121cf9739 2bc473a1bd2d98d2 2bc473a1bd2d98d2
+69 6dd5ab74b5ae9f48 6dd5ab74b5ae9f48 e1e03f81b6d9bdff a1a462fa062f68fb e89037b4482cfe70 49ed1bd97a045776 5ea78f69d46c2748 4fa6eefa4f942909 4fa6eefa4f942909
+70 5f6d799bfbd70ec3 5f6d799bfbd70ec3 267d610db18545bb 263f33f64b70bb0a e4d02bd82165b30f 471d9b260596c062 471d9b260596c062 5f5569ea34123c46 5f5569ea34123c46
+71 22f6eab933b262db 22f6eab933b262db 55f1ebd1f2c3f48d a968c967c85dcc58 75aa69f1b13b5f81 2e0868ab5f94d62f 2e0868ab5f94d62f c5e0c3cec868bffb c5e0c3cec868bffb
+72 6bc8f406ff14662d 6bc8f406ff14662d fe28cb79dad58669 9b7303a65c5c74b8 46a0ac3cf1617f07 0f9c16474287d28e 179e6c6e0f5c6f0c 5f94bf550b7b2897 5f94bf550b7b2897
+73 cd6b5373dd8f5533 cd6b5373dd8f5533 b109b6f00fa09bc4 757897845a4c3893 a0682d583bdabc7e 77904ca51e274b23 77904ca51e274b23 623eb67f0506d37b 623eb67f0506d37b
+74 923e8cbbc7b2b49d b22ec14bea500db5 2ac305dc4980b86c 61fbb14acf85ea69 d1fde8d5cb779070 24da2c04ad14ef11 fb914c563626b42b 5d547a6cc65a4058 5d547a6cc65a4058
+75 a71c1ffa7f9f6bc8 b6ad0f876889eebe 1fdf4e3a16383c39 1b9fe36b8b5294ee 977a90f3c23fc7b5 7c749487df728c09 12e29d22f3c170d2 c19357b89d581309 c19357b89d581309
+76 9ca383382ab61c1a 9ca383382ab61c1a 3e5ab2e860258aa2 2f9cd80c3e1f032a 3887c80521a87b24 ad6490dc186577d7 ad6490dc186577d7 bd7f9a003442ed3a bd7f9a003442ed3a
+77 027f65a6a9f9636b 027f65a6a9f9636b fe7fbcd82960e6e9 ca8e0b6370d0bde7 9dca6c910f6db651 eb36acc33c525fb4 307f0139fa189704 5c85c82e2badd0ab 5c85c82e2badd0ab
+78 cc3be738ef7b8a97 4f08c6cc89d759b8 693879a8b74857ad 697a2b534dbda91c 3ada2364dfdb3ab8 dcf5397c961146c9 2a5d46886c8abe2d 08dfca27b5d3c0ed 08dfca27b5d3c0ed
+79 c2243d24b8f861b1 f2b6cf980eec77fe 6d1ca73827068826 4aa85a4b10e72705 7b0b1d149c2b1097 5e1f9054723581b2 7cd1e4ea67f83f01 bbdc4bb527843c91 bbdc4bb527843c91
+80 140f62a79febc6cb 140f62a79febc6cb db6da645dceba632 39d7476e99eeadb9 79629b394b6b3852 019966b454eb95e6 1d27b288f420a051 57ab61d73154d11a 57ab61d73154d11a
+81 01d06244c5b1a2db 01d06244c5b1a2db 837fbf16e002772c 29c57fec41927279 61b3b81cbfa9c5b7 522ea0d2d79f07d3 240cd9324f99b656 b0bf51b48ab83508 b0bf51b48ab83508
+82 b239f88adb1ae600 133a07dcf59d6d9e 872551f6c83e8512 868df7d182a61853 f90e3b7dfd305c91 cacac20b3a0e10b4 355d3a69a496465e 0509683eda6fb463 0509683eda6fb463
+83 409ccde512c10d41 0de56b9adbd09f4d a1693667c0e2e827 7a1a76e7aed50f97 2b2a1614ec3ee92d 97e62119fab2c835 97e62119fab2c835 0e709d9eaa2d6f12 0e709d9eaa2d6f12
+84 4adb2bc192339cca 4adb2bc192339cca aa16f1a9ff83a717 77f4c766fa626666 8071cc181a6ed10a 5c152a01cdd1ea15 5c152a01cdd1ea15 d872d371bbb2318c d872d371bbb2318c
+85 7623fd5968883def 7623fd5968883def 8a92ead566be4092 ab4f933ffa9f50f4 e9cd09e057718fad cb20908826a583c6 0cb3855cdceea813 4a9e8489a48dde00 4a9e8489a48dde00
+86 8a729c081ecee484 8a729c081ecee484 7b21760e6a4c673c d93ff3f8a4d35573 916afc732e25e0be b8b73b2bf1822283 704cc813ac201208 5b0365d466bc9258 5b0365d466bc9258
+87 05d95a10a06024ab 5c3cdadd513926e2 75cbd7c58ebd8125 e53ab0f086b30716 a9d92b41eb27ca62 7ff2e029aed18665 ada5d823786ae8f5 1f5af1b81e3a860c 1f5af1b81e3a860c
+88 90911fa56b0ad216 90911fa56b0ad216 3f22f6098f12bd2c e47fb15c93dd9e66 429341b3f11a0d15 c6953caccbc5104e 7fb0409e9c80aaef f5336cd64f70436b f5336cd64f70436b
+89 f44a14dc4ab7963b f44a14dc4ab7963b d6cbc342e1faa859 dd35db5736ffe9db 0d31135932cafabb 0a39d41ad6e5a216 aa77117bb72fb143 0ea10336b552f5f3 0ea10336b552f5f3
+90 aad3d6029dcc26a8 aad3d6029dcc26a8 cdcdd3f9b90b1b7c b17fcf50f83350ba d1462b97b2c8206e b98fe9d95cd917bf ed450ad67753ed1b 33fcb608c5761336 33fcb608c5761336
+91 76f8541b927b8add 0dd0453b24f1aeff 9ca0764d980d185f 0c51117890039e6c 566b8bdda77dfe06 95afa276d1f4186c ff98f2dfb8d3ee57 11480df5693ff2f2 11480df5693ff2f2
+92 1d3aaae0487bc5d5 1d3aaae0487bc5d5 9e7ae31964efba5c 8416a863457110a7 489bc953e5f7cc24 1a4b233555f27548 1a4b233555f27548 5ca97e8b912b11cb 5ca97e8b912b11cb
+93 de22b2802f72f311 de22b2802f72f311 ca9910d1d798ef83 7bdcdafe72764940 a505550b70610fed 9fcfa01875b6308a d34f264fc681c157 916dc4f76c67702c 916dc4f76c67702c
+94 c1b51c14ffcb40b9 af049df339a4a5ff 6f5bec1c035b78dc a6432044a220eb19 a3af9731996688c1 5ab195bd710abac3 6be8f2499b8154ca 78fa600904d68515 78fa600904d68515
+95 b82f164fed26e479 b82f164fed26e479 e319c58fbc6c697b 123808a0857773c6 4fc9cd5a249eb71d ef84f7e1facbdff7 124472408e6bb818 dc1118e554f39b58 dc1118e554f39b58
+96 e38aacceb12108bd de64f51678429df4 6e6d0077d3650126 5cf5779f3f66c9df f5844d610798eeed 636bcc09640dffab 5dd80200971693b7 bbe358605efdd88b bbe358605efdd88b
+97 58a799fa9137e762 58a799fa9137e762 4eca8f22126d86f2 ac1857d76a0b8f62 12b09dc84f1002ab f2534f79acf88d35 f2534f79acf88d35 002a1b327086798a 002a1b327086798a
+98 6915fff44a91d555 356b361be5806956 f91ec9319c1b3a29 1b64db536109a347 4f719a75f7cf850d 3dee146d77ccc6a9 726363a65717d40a 8dd5605b0e0d727b 8dd5605b0e0d727b
+99 f328e4fd0516ff64 f328e4fd0516ff64 9041df60b30ec4a8 b60383eb98475429 f0de3a709b1b96e9 74dddc50fe54ba7b 991743c612932ede ceaeb1ac520f0a75 ceaeb1ac520f0a75
+100 9c9eae78c809c039 ac42ee56ef2cad6b a03ababd3b863124 1c51a1beb3ececc4 9eb7eeb94b1f69cc ce7dfe2b51e1f2e5 bfebc55a4ff61fee 25b64ac5397a2221 25b64ac5397a2221
+101 406725e56914c835 406725e56914c835 e6215cf5657ef18f 51f1e8247c394ba7 ae92e9c7ed5871f0 325c25c11a1654d2 325c25c11a1654d2 4985dea164dedb66 4985dea164dedb66
+102 c2f8c184b2af18f2 8922a71d80a7a794 e74759b02511618e 5ab46921040fe23f 5c0f9b3b42d922ad 2fed819831fd6e19 e6bda7ff1b70f13d 79e9becb7bd641b6 79e9becb7bd641b6
+103 c4ac16248c90e02b c4ac16248c90e02b 5c5f5fcdb6bed070 61fb5b4586b96957 4265f18996f2f035 d17e3dfecedb5774 359a07db520bad0e 4ef10d86ee3fa552 4ef10d86ee3fa552
+104 08dc235b1624bae0 08dc235b1624bae0 200129db0fa28a60 be4944668ef20172 680348d161db9539 61ee77b249b5dd80 61ee77b249b5dd80 1f205f98c7b3d3db 1f205f98c7b3d3db
+105 3e6577449a8f9a34 474154a569fb1563 b4f0d27b003f35fd 18d89ac4bef0bcff 7471fbd736ac5849 0d16d1e6ed132362 b86e4e6f7f9b1f67 087fcf68c353423e 087fcf68c353423e
+106 72241129f7425d70 72241129f7425d70 b7ce18113f74ab22 912eacc669b9cb3d 04ba71f89cfffd5a 9243758d2a2c64a8 f4a6737a7b4c8519 f1a8a11f395585e5 f1a8a11f395585e5
+107 c2c363d80665fbf8 c2c363d80665fbf8 b8470517679bb714 89d5f64fc88b3e07 fb7f3fe1dc3a31b0 c92a4787f62809d6 d60e8c8ee5fff1b7 793dc17591aed0bd 793dc17591aed0bd
+108 224d96d1ec0e9f98 dd82d8c7b3643afc 4b10fef20b1b7610 6a7219d3628e5906 6a544b07589bcfab 1ec3017faeafcd7e 5bb46caafc0c7242 d894c83191312809 d894c83191312809
+109 f4beab61f9641ba9 6861269083c113c6 33994e873ac7d17e a36829b232c9574d f995c4306005d277 11bb7db8dc94aa80 71584bd9460e294d 837ec27ebb00f6b9 837ec27ebb00f6b9
+110 fad2fec65114bf89 fad2fec65114bf89 5e42879f79583af5 43a3c7b24324eec6 698f0a13d291eaf8 835fd6500412ba98 16856ba35b6b6bb4 dbbdc208411eadbd dbbdc208411eadbd
+111 d73e2f92fb1b7ee9 9c3a1adea7778dad d83f74401ace580b e527f1414fe72627 e993be1a5f72caa0 b9111b24a2fb5d33 0e51645f5fd7cc13 60ba143d8283e13b 60ba143d8283e13b
+112 d7d7dc880ed8d927 0d6e8ffc72a81d7d 35c1a4df6bcbc5f7 3583f624913e3b46 5203e8dbd9a59aaf 04056f4bdef8246c 04056f4bdef8246c 32592d225aa238b9 32592d225aa238b9
+113 22b988e7255c5c33 22b988e7255c5c33 60dcb1946c9308e6 0c61087263f8c347 930bf624f25853ca 372c26ae0a839a71 6bf83e66dd86fe14 9e14a166c050eed8 9e14a166c050eed8
+114 7a81ce724cbb3d73 7a81ce724cbb3d73 45446814f350d442 2495d69a041b99db f796aff6f2073b0d 1ee5e67d6531437c 7b37a1ea9316b14b c28b0eda3870a22f c28b0eda3870a22f
+115 1ca44d4d2e637c20 1ca44d4d2e637c20 53be5322619e94e5 c34f3417699012d6 2af5f779841abbe6 66c20a59c67114a2 a049a45b1458e8e1 a049a45b1458e8e1 a049a45b1458e8e1
+116 79ea7474d8dab7b7 79ea7474d8dab7b7 bbaf06f717acee98 e8cb084725046a88 259089a82f9272f6 2b44bec189b1c214 66fdccbdc13fc707 66fdccbdc13fc707 66fdccbdc13fc707
+117 64e1f8fc0ba5412c 35b62ecf131bdab9 253a3c6df4752fd6 b5cb5b58fc7ba9e5 a00a4b8d03d7e14c 899ace8073beecf4 899ace8073beecf4 899ace8073beecf4 899ace8073beecf4
+118 5a1e69ff83721ac9 5a1e69ff83721ac9 3d07197f9b769e95 3d454b8461836024 8431df78511c434a edcb50f413dec541 5354b638c1b55650 5354b638c1b55650 5354b638c1b55650
+119 9086e6dc0dc15616 fb69a50e7b46e42f 9385868e968fdd93 3866277d0e14ac7b d4f00a4fb58130bc e3f902df28a74a88 ccf22142ea89670b ccf22142ea89670b ccf22142ea89670b
+120 0ce06be7f6182364 32c3323b1264f21d fd6fe42b6eeef2a5 4cb33c84805761a7 0691967b9697a8cf 98ce6715e96e8089 7124aa87a1b1bebd 7124aa87a1b1bebd 7124aa87a1b1bebd
+121 3fabf9c537de0fcd 3fabf9c537de0fcd f508cd9b26f94424 8b44f44d98733d96 8f7d964a2d84628f d964163ee371598a 2f9b0f39ec05e533 2f9b0f39ec05e533 2f9b0f39ec05e533
+122 8913b486a0a092db 3e82f10fc8094449 88ade15bffc2ee07 eb9403ebd1f325f3 db0b93e8e7df4503 d834859743993a1e 6b43bf0b515b6c72 6b43bf0b515b6c72 6b43bf0b515b6c72
+123 a70b5eff181c880e a70b5eff181c880e 8e27a2ae28a5b816 2b18b5d88545de00 a851189a401a1a51 ffc146f5707460f5 3e9c7c7996ae9cba 3e9c7c7996ae9cba 3e9c7c7996ae9cba
+124 9738c7b5305f9603 58f8251b4b472159 04d0e0e48726b96a 0492b21f7dd347db 3b9db3ab2b038de2 0066d09c5d570ba0 5b516157dfc04a27 5b516157dfc04a27 5b516157dfc04a27
+125 308b6d6bc089c05e 308b6d6bc089c05e 2802ec30b57c7057 3ed42d101079a5c8 02f2a9e77d138d1e 35e4074dc2c2c858 de2704193a827c17 de2704193a827c17 de2704193a827c17
+126 e5bf78572f7bfe77 e5bf78572f7bfe77 61d35d1938131e52 61910fe2c2e6e0e3 a94a095e252cdb92 ef6d880be00963fb 12ac867839f78376 12ac867839f78376 12ac867839f78376
+127 9f30abfc057a1da6 9f30abfc057a1da6 42aa98bb908ddf96 d25bff8e988359a5 3bc767c9fb9c3fef a4e31ee712d8bdd3 b8cd9d499267778d b8cd9d499267778d b8cd9d499267778d
+128 f71220ed88d77dad 526446d3c57fb052 b42e0cf031a77caa a7edc1712aaa8051 107f927ad145871e 73624bcb78e21aee d4b3071db944870e d4b3071db944870e d4b3071db944870e
+129 9b4aa2f466cc91e2 f5e959fe3fbb4e72 3d81161e06d4051f fa5fce9317f69a72 8140dc9dc45e8afd 62a3194e22458fdc 62a3194e22458fdc 62a3194e22458fdc 62a3194e22458fdc
+130 09df48996fa5fc61 09df48996fa5fc61 54b6e700732e0f21 5b7ddb0a3716cfdd d3fae1af8e2460e9 d145381cdd9f7dc1 f0fa3ce484a48b5b f0fa3ce484a48b5b f0fa3ce484a48b5b
+131 cc6cd33795de019f 59ef84eb17f72745 376404b323721a5f bfa7ed642c0daa6e 2da969d6c1db8661 bcf5f36c3d6599a6 7e8f5cb12c18f9f1 7e8f5cb12c18f9f1 7e8f5cb12c18f9f1
+132 90cb776dee0be05a 8ce7fbc2fae870d9 9ed6c623506954e5 bf78eff634453c5e d65e845d63106e13 8ad46857844f8d48 4d847bfe48e89d34 4d847bfe48e89d34 4d847bfe48e89d34
+133 bb909f792c4285c0 90df2ca9c96bf068 2a31c58095be7658 7926b4bb0491a728 46c215f6392ba142 1defc9d9f9e69e33 e92a7f82c6b6f4d0 e92a7f82c6b6f4d0 e92a7f82c6b6f4d0
+134 c634f1d2b3472200 c634f1d2b3472200 c634f1d2b3472200 c676a32949b2dcb1 c3fac5cfe8da74ef 33264410744abcdd 37e90e56371be4ab 37e90e56371be4ab 37e90e56371be4ab
+135 5a0d76f29ae05040 b01ed6d0ce27327b 698ac3cb4738ddfb ffe0861579c30dc3 f63265d2ef8ea983 610c2cbc6f9e4d46 5ae1653e12714cb3 5ae1653e12714cb3 5ae1653e12714cb3
+136 c18e34a36ed9250a bf733d9610eda89c f9b2546e82f64844 3ff528263ed8096e dfe70f00bedc081a 3e51bd0e9ca3718e 3e51bd0e9ca3718e 3e51bd0e9ca3718e 3e51bd0e9ca3718e
+137 4ab30dcf448e6474 4ab30dcf448e6474 ac6ddd5d95f044b0 24ae348a9a8ff481 328dc2d29e959a08 66db191b97399e84 0eda3cf7b204b389 0eda3cf7b204b389 0eda3cf7b204b389
+138 0abfc8f8127cc1e8 91d608b4237c6a0d 0433c066284b9505 1f634ef9c807684d b0333a0944e8c96e a6169cb6283faf2e 2cbdbb157bbc8d76 2cbdbb157bbc8d76 2cbdbb157bbc8d76
+139 3a4279742be212e9 3a4279742be212e9 f8578962c5f38141 6467ad515eed8ccf 81e8fd7549cde581 df9962160a423d3c df9962160a423d3c df9962160a423d3c df9962160a423d3c
+140 6c5a297f3b58d5ae 6c5a297f3b58d5ae 6c5a297f3b58d5ae 6c187b84c1ad2b1f c31e2f9692bea5c7 3bbc0083fe81c94b 3bbc0083fe81c94b 3bbc0083fe81c94b 3bbc0083fe81c94b
+141 c7d53a42d7158bcc 41bf6c71a5627a2c 4dba8e11fb7b8487 16189d8836bd0e96 b4dcf84b26325583 d6cff10177ad965d d6cff10177ad965d d6cff10177ad965d d6cff10177ad965d
+142 453cfac5dd91056d 6b881da69b6f562d 5cd1a79f9f16ef7b 5c93f56465e311ca 9e69ed6fb9d76aa4 2e17065755c026d5 2e17065755c026d5 2e17065755c026d5 2e17065755c026d5
+143 a369329b28f0bdd1 a369329b28f0bdd1 71744eb151cae93e fa97f5e0437d6cf4 a9e6489341aa0aed 8ec8a85f0e346a16 1cd3eb7cb6710bd0 1cd3eb7cb6710bd0 1cd3eb7cb6710bd0
+144 1085c6791e781b11 8e0d6fe34097b561 889459c1d9827ee6 4bfc235af27e5889 6604c176714f3208 c3a8b0d83661e856 a27df7dc876b7f1c a27df7dc876b7f1c a27df7dc876b7f1c
+145 134a749518f82fb5 1e60b9abf2183617 ae846982b29bb443 3e750eb7ba953270 06d847d7bb28beaa c4d053b72bd23f4c c4d053b72bd23f4c c4d053b72bd23f4c c4d053b72bd23f4c
+146 b4ac12f781a5a84c b4ac12f781a5a84c b4ac12f781a5a84c b4ee400c7b5056fd 7f1f8df27083820b b1cad1f0c1843e25 699d7cbc48252eba 699d7cbc48252eba 699d7cbc48252eba
+147 3065b68158ffcf1c 811a93c417fa4f71 49271e65d6533aa4 d9d67950de5dbc97 cb3099be87376f60 eefd26603468d1a1 eefd26603468d1a1 eefd26603468d1a1 eefd26603468d1a1
+148 76d9a3dd2b6b939e b64fca16e7bcec29 01aeaa66b848a992 01ecf89d42bd5723 44952bf06e52b878 3b3b792b60ee4e6a 3b3b792b60ee4e6a 3b3b792b60ee4e6a 3b3b792b60ee4e6a
+149 7d690139b9a64b42 7d690139b9a64b42 f0dbe561ddc26d45 7b385e30cf75e88f 646ebc031e38bcaa e0eb3feb9963915c 3da60f695b81e0af 3da60f695b81e0af 3da60f695b81e0af
+150 48c563817f8a3a69 48c563817f8a3a69 48c563817f8a3a69 4887317a857fc4d8 cf0c7c9fddfc5ee1 b60d452b3adf00ed aa8dad945da8f376 aa8dad945da8f376 aa8dad945da8f376
+151 4760a1605f6278b1 4760a1605f6278b1 101f886bc220e115 0be05c38c00243b9 cc484b25a0d56a3b 54f4e734e47c48db 69abc289132821fa 69abc289132821fa 69abc289132821fa
+152 fe1a784eae1dc3a2 fe1a784eae1dc3a2 fe1a784eae1dc3a2 fe582ab554e83d13 8da751119320674c 5b3cbd62ce164848 5b3cbd62ce164848 5b3cbd62ce164848 5b3cbd62ce164848
+153 64dfe18e3d0099f4 02131f6b00214e4e 0d501d3d22300994 9da17a082a3e8fa7 b92915724889a3e7 cac2fa787cc7713c c46e5b97923277c7 c46e5b97923277c7 c46e5b97923277c7
+154 1e658dc6c4c26910 1e658dc6c4c26910 a785747b8a4bfcb3 6a644ffc20bbc931 5a166a0cddc318ce 20b9f4750f638874 5637d4102bb0da7b 5637d4102bb0da7b 5637d4102bb0da7b
+155 13064e348397eaf7 13064e348397eaf7 13064e348397eaf7 83f729018b996cc4 97844586e310d643 5b1e68a2b8620ef4 5b1e68a2b8620ef4 5b1e68a2b8620ef4 5b1e68a2b8620ef4
+156 8d5a0c1db7d17ed7 8d5a0c1db7d17ed7 38629dcf1810dfee 3820cf34e2e5215f 92649916b2d31fa5 d2b638f6c04dad8f 7aacae77782119be 7aacae77782119be 7aacae77782119be
+157 003411490f830c2b 003411490f830c2b 7c8397d39841d675 9c3dcb00e7c9033d 8e7810e418f2dfa4 d2bd7e579199df46 d2bd7e579199df46 d2bd7e579199df46 d2bd7e579199df46
+158 dfce280feec841ed dfce280feec841ed 7a916787c38ae26e eb93796c3e318931 5cb02e5275a6e2be 535bc09dc94e03a0 535bc09dc94e03a0 535bc09dc94e03a0 535bc09dc94e03a0
+159 061e6a6f507fc288 061e6a6f507fc288 81a977b35fbca5cf 1158108657b223fc 9171da25d00e87db b3d52dd2bfb9ff57 b3d52dd2bfb9ff57 b3d52dd2bfb9ff57 b3d52dd2bfb9ff57
+160 22767a428a19250c 65f979c333bf72fb caa8913435deb01e caeac3cfcf2b4eaf e9eb705a3de46934 12e884433b99d69b 86970389d351fd0a 86970389d351fd0a 86970389d351fd0a
+161 6cb5ee8a0cbc054d 6cb5ee8a0cbc054d 8a6b3e18ddc22589 02a8d7cfd2bd95b8 5f5ccf4e70578071 829cae106e8f6d8c 0f5233e30e99bbc1 0f5233e30e99bbc1 0f5233e30e99bbc1
+162 4d30ca0902ac62cf 4d30ca0902ac62cf 4d30ca0902ac62cf 4d7298f2f8599c7e 8e89e6b36d1701c7 62cc8eaa4f6648a1 62cc8eaa4f6648a1 62cc8eaa4f6648a1 62cc8eaa4f6648a1
+163 325725ae654f03d7 325725ae654f03d7 16041463e9990ddf 86f57356e1978bec 0a1b81645c05ac83 be21ed78388c1a11 6109b95fd65a6bdd 6109b95fd65a6bdd 6109b95fd65a6bdd
+164 54171c97141eb73c 54171c97141eb73c 54171c97141eb73c 54554e6ceeeb498d 3db3cea89375b7d6 86ad24f66ed233b2 86ad24f66ed233b2 86ad24f66ed233b2 86ad24f66ed233b2
+165 47cdb386cbcb4667 47cdb386cbcb4667 47cdb386cbcb4667 d73cd4b3c3c5c054 3597c702c4aa33c1 58397420eb31ee13 58397420eb31ee13 58397420eb31ee13 58397420eb31ee13
+166 c933883cad17886a c933883cad17886a c933883cad17886a c971dac757e276db 65b229da611a76de b68b5e47c68825a5 b68b5e47c68825a5 b68b5e47c68825a5 b68b5e47c68825a5
+167 dc0f9107dd329538 dc0f9107dd329538 d47a5d42a4a9e100 c6f1b95150a69197 04021a06d1d96289 9cff07cf05a85295 9cff07cf05a85295 9cff07cf05a85295 9cff07cf05a85295
+168 f0b2eeddc8ac5625 f0b2eeddc8ac5625 f0b2eeddc8ac5625 f0f0bc263259a894 b6871f5c1df4fd10 c52df8910ec65a08 c52df8910ec65a08 c52df8910ec65a08 c52df8910ec65a08
+169 9486aadb17d583c4 9486aadb17d583c4 9486aadb17d583c4 0477cdee1fdb05f7 85719299b5bab73c 74a4fda486c4ffc3 74a4fda486c4ffc3 74a4fda486c4ffc3 74a4fda486c4ffc3
+170 ed03d5609bf37876 ed03d5609bf37876 a360f8054dcae44d d872c9abdca08967 85752054f13e262d e7d6b848893c9d81 e7d6b848893c9d81 e7d6b848893c9d81 e7d6b848893c9d81
+171 d1a2967ab89cffe2 d1a2967ab89cffe2 6b32f0d0fc9eaa7c 547ffc4e4b4e3409 2b81d9088f14b97f 537eb133ba2c8123 537eb133ba2c8123 537eb133ba2c8123 537eb133ba2c8123
+172 a3e48c515a169f5b a3e48c515a169f5b 10195ad8dc38a805 105b082326cd56b4 75c30e9320e3b5be fa9ef7d23865edc0 fa9ef7d23865edc0 fa9ef7d23865edc0 fa9ef7d23865edc0
+173 9fb961a6a5a559ca 95b45847f167816b 95b45847f167816b 05453f72f9690758 0f8ff15a210559ba 9dd1c65a5f4ace7d 9dd1c65a5f4ace7d 9dd1c65a5f4ace7d 9dd1c65a5f4ace7d
+174 442a2ec8ea3a7038 442a2ec8ea3a7038 442a2ec8ea3a7038 44687c3310cf8e89 4169039408ebc834 ac006992dbdd1088 ac006992dbdd1088 ac006992dbdd1088 ac006992dbdd1088
+175 068ff5af0208c123 068ff5af0208c123 61c7caff072ccbb3 f136adca0f224d80 04dccc8d1ba1a415 febfe1900c0e0bd4 febfe1900c0e0bd4 febfe1900c0e0bd4 febfe1900c0e0bd4
+176 eb667c29bc6cc34f eb667c29bc6cc34f 778b421da0947104 77c910e65a618fb5 11c33f14433ec741 cee9810166acd7db cee9810166acd7db cee9810166acd7db cee9810166acd7db
+177 e6b1ce5b33c903f8 e6b1ce5b33c903f8 e6b1ce5b33c903f8 7640a96e3bc785cb d36c4ee0754a3130 840fcebe574dd6af 840fcebe574dd6af 840fcebe574dd6af 840fcebe574dd6af
+178 a666e7e1851e1b66 a666e7e1851e1b66 32c5d9c4a1b7dec6 32878b3f5b422077 e39e7af30d5a3e8c ca0d904a61840936 ca0d904a61840936 ca0d904a61840936 ca0d904a61840936
+179 55be4bf3203ff7dd 55be4bf3203ff7dd f7cba45a7c87ae67 673ac36f74892854 4e65c6ab8fb4ce6c 2447e1f7be952987 2447e1f7be952987 2447e1f7be952987 2447e1f7be952987
+180 9fb3692ac64a2c12 9fb3692ac64a2c12 ef4392e570204c84 ef01c01e8ad5b235 b19c8202561f265c a0e583949719dce3 a0e583949719dce3 a0e583949719dce3 a0e583949719dce3
+181 fc15d496d0c087ac 43a1b22417991cd3 43a1b22417991cd3 d350d5111f979ae0 b6152f5d2e4e2458 1982508a1224ce0d 1982508a1224ce0d 1982508a1224ce0d 1982508a1224ce0d
+182 1ccd12903a855c03 1ccd12903a855c03 1ccd12903a855c03 1c8f406bc070a2b2 93d9665ba768522e 9a9cda7da1f45aa9 9a9cda7da1f45aa9 9a9cda7da1f45aa9 9a9cda7da1f45aa9
+183 ff61383fdf35d42c ff61383fdf35d42c a4eedb67f2a2760d 38deff5469bc7b83 18b67eac8902672f e110a2b369bd0f99 e110a2b369bd0f99 e110a2b369bd0f99 e110a2b369bd0f99
+184 08f9246aafbd9468 08f9246aafbd9468 08f9246aafbd9468 08bb769155486ad9 19ac22da3d25caef cf075fe340d0e486 cf075fe340d0e486 cf075fe340d0e486 cf075fe340d0e486
+185 a005b5895b8cb612 74d63201b47851bb 74d63201b47851bb e4275534bc76d788 0edacd383a201c51 715b24c74fe6ecfb fe883d3bcf6f08fa fe883d3bcf6f08fa fe883d3bcf6f08fa
+186 f31780c25de9ba17 f31780c25de9ba17 f31780c25de9ba17 f355d239a71c44a6 5954a5874e8c8ec7 aaac817d040073a9 aaac817d040073a9 aaac817d040073a9 aaac817d040073a9
+187 3860522ba467dd8f 3860522ba467dd8f 3860522ba467dd8f a891351eac695bbc 4ec82b0b937ff81c 811a661232c728b1 811a661232c728b1 811a661232c728b1 811a661232c728b1
+188 aeb6b60167166b51 aeb6b60167166b51 d8cbbb7458399ae9 d889e98fa2cc6458 d833eb079ba92ea5 21ae50a9b730457d ab0318cd86d2d646 ab0318cd86d2d646 ab0318cd86d2d646
+189 9b4a69c72b05cdf8 c76dad90164d9793 c76dad90164d9793 579ccaa51e4311a0 c6fd4d80573420d2 7f13c8cfe3ef5027 7f13c8cfe3ef5027 7f13c8cfe3ef5027 7f13c8cfe3ef5027
+190 9809e312aa03c9e1 9809e312aa03c9e1 9809e312aa03c9e1 984bb1e950f63750 b88b6fbf161d1583 97967945ae6bf49f 97967945ae6bf49f 97967945ae6bf49f 97967945ae6bf49f
+191 36ec90780be85242 36ec90780be85242 36ec90780be85242 a61df74d03e6d471 4e678cd00df93a95 49403df0c5229ba3 49403df0c5229ba3 49403df0c5229ba3 49403df0c5229ba3
+192 e86d97cb699e2fd3 e86d97cb699e2fd3 e86d97cb699e2fd3 e82fc530936bd162 c285d40882b9564f ddb7e62e06d51cf0 ddb7e62e06d51cf0 ddb7e62e06d51cf0 ddb7e62e06d51cf0
+193 852c627622168b99 852c627622168b99 852c627622168b99 15dd05432a180daa 4a7e9e4b5412df3f a0b93d90e4c9f81a a0b93d90e4c9f81a a0b93d90e4c9f81a a0b93d90e4c9f81a
+194 2d47377ec231d7f3 2d47377ec231d7f3 dacd07e5b739776d da8f551e4dcc89dc 309765d2440c5fc4 1ab389efa9b57726 1ab389efa9b57726 1ab389efa9b57726 1ab389efa9b57726
+195 d710de8968ac449a d710de8968ac449a d710de8968ac449a 47e1b9bc60a2c2a9 8a264ef391b15cd8 c2c4645c24a2c2ea c2c4645c24a2c2ea c2c4645c24a2c2ea c2c4645c24a2c2ea
+196 411bca5a0e978fd0 411bca5a0e978fd0 411bca5a0e978fd0 415998a1f4627161 f2a0464ec0d02d7e f7975f9570ba81f7 f7975f9570ba81f7 f7975f9570ba81f7 f7975f9570ba81f7
+197 38b80711a66fb892 38b80711a66fb892 38b80711a66fb892 a8496024ae613ea1 02f7117379d7972d 69c7bab68764de7c 69c7bab68764de7c 69c7bab68764de7c 69c7bab68764de7c
+198 0bf357f82c88bce9 0bf357f82c88bce9 a517b472d29017ae 79e43fde6a2f90e9 a8de5eef8ac6c113 77464915a62b513e 77464915a62b513e 77464915a62b513e 77464915a62b513e
+199 97fedfb644f0fc20 97fedfb644f0fc20 97fedfb644f0fc20 070fb8834cfe7a13 872d4b461594bfd4 5d8e29051d095eeb 5d8e29051d095eeb 5d8e29051d095eeb 5d8e29051d095eeb
+200 f931a6275f65c28f f931a6275f65c28f f931a6275f65c28f f973f4dca5903c3e f692e103dcbea09a aea8eb673c1b5364 1849efef031e119b 1849efef031e119b 1849efef031e119b
+201 c2c542f284b55f34 c2c542f284b55f34 c2c542f284b55f34 523425c78cbbd907 a82502348acc6b70 4267f2fcefea2921 4267f2fcefea2921 4267f2fcefea2921 4267f2fcefea2921
+202 54adae9eefaaa895 54adae9eefaaa895 54adae9eefaaa895 54effc65155f5624 cf5603fd0ce0f761 c146958e1fed6c03 c146958e1fed6c03 c146958e1fed6c03 c146958e1fed6c03
+203 0751b736d00a680d 0751b736d00a680d 0751b736d00a680d 97a0d003d804ee3e 37e37205cabe9686 ae0a0adebee48861 ae0a0adebee48861 ae0a0adebee48861 ae0a0adebee48861
+204 ba792e1a8f69a160 ba792e1a8f69a160 ecbb3914a2d6b3ef ecf96bef58234d5e f84b2e8fad2923aa 5a56a78f515fea01 5a56a78f515fea01 5a56a78f515fea01 5a56a78f515fea01
+205 5271169c5dcdec3b 5271169c5dcdec3b 5271169c5dcdec3b c28071a955c36a08 8ace24cf9fa7459a 3a557c741e61c993 3a557c741e61c993 3a557c741e61c993 3a557c741e61c993
+206 e81cc2be28d63a94 e81cc2be28d63a94 e81cc2be28d63a94 e85e9045d223c425 fc664faaa978b5bb e17d1d29315c88e2 e17d1d29315c88e2 e17d1d29315c88e2 e17d1d29315c88e2
+207 ca495aeb277eecc1 ca495aeb277eecc1 ca495aeb277eecc1 5ab83dde2f706af2 04550f582ec15202 7e15c8d8dc5670e6 7e15c8d8dc5670e6 7e15c8d8dc5670e6 7e15c8d8dc5670e6
+208 4599b5c9c2a029b6 4599b5c9c2a029b6 2353cd6952cd1f49 2ebfe2443c34e204 cbd975880d8f8756 eed029b8ca5a246b eed029b8ca5a246b eed029b8ca5a246b eed029b8ca5a246b
+209 01b017da9b91811d 01b017da9b91811d 01b017da9b91811d 914170ef939f072e 3d4d591744938a48 8cd8d0d91eb44e6a 8cd8d0d91eb44e6a 8cd8d0d91eb44e6a 8cd8d0d91eb44e6a
+210 9dea7145666e0310 9dea7145666e0310 9dea7145666e0310 9da823be9c9bfda1 616f619c15b34b4a 168b20fb1b7c6044 168b20fb1b7c6044 168b20fb1b7c6044 168b20fb1b7c6044
+211 7c4be7691b6d911d 7c4be7691b6d911d 7c4be7691b6d911d ecba805c1363172e 216b4c494aa16565 d842d5e0cc68440f d842d5e0cc68440f d842d5e0cc68440f d842d5e0cc68440f
+212 b00c530903d3e513 b00c530903d3e513 b00c530903d3e513 b04e01f2f9261ba2 2daaafab78c24eac bb9843611b1df554 bb9843611b1df554 bb9843611b1df554 bb9843611b1df554
+213 e14c4d307e0f6f8b e14c4d307e0f6f8b e14c4d307e0f6f8b 71bd2a057601e9b8 428edf5e88dc6c3b 8d5a982db532b1cb 8d5a982db532b1cb 8d5a982db532b1cb 8d5a982db532b1cb
+214 cd48089536224c6c cd48089536224c6c cd48089536224c6c cd0a5a6eccd7b2dd 8009b248bd09ee78 809fea31117ce3a8 809fea31117ce3a8 809fea31117ce3a8 809fea31117ce3a8
+215 fce496860981630d fce496860981630d fce496860981630d 6c15f1b3018fe53e d55bdde448f93b6c 2dde184b70b98dae 2dde184b70b98dae 2dde184b70b98dae 2dde184b70b98dae
+216 9ba5364dbf73756e 9ba5364dbf73756e 9ba5364dbf73756e 9be764b645868bdf 0e5a997c1d728c0d bdf55297e6f54fb9 bdf55297e6f54fb9 bdf55297e6f54fb9 bdf55297e6f54fb9
+217 07d44380bf3a457d 07d44380bf3a457d 07d44380bf3a457d 972524b5b734c34e 6d65cfd1e845116b f75bbf12b9eece90 f75bbf12b9eece90 f75bbf12b9eece90 f75bbf12b9eece90
+218 c5fef9040cfc02f3 c5fef9040cfc02f3 c5fef9040cfc02f3 c5bcabfff609fc42 f9d57c7e4b9cb61b a889cdd8e91e15aa a889cdd8e91e15aa a889cdd8e91e15aa a889cdd8e91e15aa
+219 18dbc407715c4ae0 18dbc407715c4ae0 18dbc407715c4ae0 882aa3327952ccd3 6a457ad9b7951a5c f2eedcf9515f78e5 f2eedcf9515f78e5 f2eedcf9515f78e5 f2eedcf9515f78e5
+220 a217131a9ce327eb a217131a9ce327eb a217131a9ce327eb a25541e16616d95a bb9feecebc562bcb 01b5b120cb0dbd7d 01b5b120cb0dbd7d 01b5b120cb0dbd7d 01b5b120cb0dbd7d
+221 aa24cb80b49b76e0 aa24cb80b49b76e0 aa24cb80b49b76e0 3ad5acb5bc95f0d3 34c805da4a4d234d 5ed7b90c326f45f9 5ed7b90c326f45f9 5ed7b90c326f45f9 5ed7b90c326f45f9
+222 c683da775d04d8d3 c683da775d04d8d3 c683da775d04d8d3 c6c1888ca7f12662 2f5970a2a38ba79e d5290a3d29d95079 d5290a3d29d95079 d5290a3d29d95079 d5290a3d29d95079
+223 6e92bf76be208db5 6e92bf76be208db5 6e92bf76be208db5 fe63d843b62e0b86 0d0be8484017ae31 d59a3f48bb13877e d59a3f48bb13877e d59a3f48bb13877e d59a3f48bb13877e
+224 3f9ac43f84a6981c 3f9ac43f84a6981c 3f9ac43f84a6981c 3fd896c47e5366ad 462507439f35e2d4 862ff43853551d26 862ff43853551d26 862ff43853551d26 862ff43853551d26
+225 1bbf7de9d9a0738f 1bbf7de9d9a0738f d09932f62a408b02 406855c3224e0d31 dd277448973af60b 536fc7828c42b355 536fc7828c42b355 536fc7828c42b355 536fc7828c42b355
+226 50c16a457c5402de 50c16a457c5402de 50c16a457c5402de 508338be86a1fc6f 4f1499a19fa2e8f4 f0527dbe127aacd2 f0527dbe127aacd2 f0527dbe127aacd2 f0527dbe127aacd2
+227 b9f31a23f5832d93 b9f31a23f5832d93 b9f31a23f5832d93 29027d16fd8daba0 f667d1508a0385b9 18fa14221bef2943 18fa14221bef2943 18fa14221bef2943 18fa14221bef2943
+228 0b0a560d40fa368d 0b0a560d40fa368d 0b0a560d40fa368d 0b4804f6ba0fc83c 7aa82ef4fbf97796 7535688c7ee6c6c6 7535688c7ee6c6c6 7535688c7ee6c6c6 7535688c7ee6c6c6
+229 8c4caf9c9dfd185e 8c4caf9c9dfd185e 8c4caf9c9dfd185e 1cbdc8a995f39e6d 21b3e597c21020a9 0e94dbc022d72d2f 0e94dbc022d72d2f 0e94dbc022d72d2f 0e94dbc022d72d2f
+230 fb69adb83b79806b fb69adb83b79806b fb69adb83b79806b fb2bff43c18c7eda 770bf2d64994b9b3 fc2f032f493d07fa fc2f032f493d07fa fc2f032f493d07fa fc2f032f493d07fa
+231 44b6b5ed560aec0b 44b6b5ed560aec0b 44b6b5ed560aec0b d447d2d85e046a38 6ac4f91346818c51 d014ebc93c900275 d014ebc93c900275 d014ebc93c900275 d014ebc93c900275
+232 29af5ce49de31cb3 29af5ce49de31cb3 29af5ce49de31cb3 29ed0e1f6716e202 4079320d98fa970b 887e4e03b7f1711a 887e4e03b7f1711a 887e4e03b7f1711a 887e4e03b7f1711a
+233 49fcfc463e81615d 49fcfc463e81615d 6d5c058eb06c7ab7 fdad62bbb862fc84 da02893a1e169d40 fb6e84b3ba8dcc16 fb6e84b3ba8dcc16 fb6e84b3ba8dcc16 fb6e84b3ba8dcc16
+234 9599afa4a5b8d1a5 9599afa4a5b8d1a5 9599afa4a5b8d1a5 95dbfd5f5f4d2f14 cf10e4a93d73d9ed 0cf40b34d31fc577 0cf40b34d31fc577 0cf40b34d31fc577 0cf40b34d31fc577
+235 6c766188c7cacf04 6c766188c7cacf04 6c766188c7cacf04 fc8706bdcfc44937 1522e9185e8f8caf 4d0884145ae595c3 4d0884145ae595c3 4d0884145ae595c3 4d0884145ae595c3
+236 a72037a6a66c81d1 a72037a6a66c81d1 a72037a6a66c81d1 a762655d5c997f60 9c4e9bcc3e32a670 b03fc028a3f0a212 b03fc028a3f0a212 b03fc028a3f0a212 b03fc028a3f0a212
+237 d4acc4e5dbfac3c7 d4acc4e5dbfac3c7 d4acc4e5dbfac3c7 445da3d0d3f445f4 6e4c8e6bfadf2c14 a5b06dc827bc5090 a5b06dc827bc5090 a5b06dc827bc5090 a5b06dc827bc5090
+238 e021f1bda83a3ed2 e021f1bda83a3ed2 e021f1bda83a3ed2 e063a34652cfc063 d5b1ba208a4b99e8 e983f6b51ee62257 e983f6b51ee62257 e983f6b51ee62257 e983f6b51ee62257
+239 65eb9a076538d00c 65eb9a076538d00c 65eb9a076538d00c f51afd326d36563f 2ee2f856f79e0c5a d5f281b6d49e1b6d d5f281b6d49e1b6d d5f281b6d49e1b6d d5f281b6d49e1b6d
+240 b3a7fba3642f3eb7 b3a7fba3642f3eb7 b3a7fba3642f3eb7 b3e5a9589edac006 3edd2a5401a1a0cd fa272128318d4abb fa272128318d4abb fa272128318d4abb fa272128318d4abb
+241 56cd70740a8d4d1a 56cd70740a8d4d1a 56cd70740a8d4d1a c63c17410283cb29 b540ce3d157bdd02 d693f3821958c7b9 d693f3821958c7b9 d693f3821958c7b9 d693f3821958c7b9
+242 87d6c4dfc0036da8 87d6c4dfc0036da8 87d6c4dfc0036da8 879496243af69319 f595824de1e9fdd0 0072d0e336073016 0072d0e336073016 0072d0e336073016 0072d0e336073016
+243 b5cc1e8da96776a4 b5cc1e8da96776a4 b5cc1e8da96776a4 253d79b8a169f097 afebfdac10c8b81f 9f1199c5955d7051 9f1199c5955d7051 9f1199c5955d7051 9f1199c5955d7051
+244 10f9ac9bcc09cba6 10f9ac9bcc09cba6 10f9ac9bcc09cba6 10bbfe6036fc3517 cad6ea843e75e0a7 91f8c436743fc3b9 91f8c436743fc3b9 91f8c436743fc3b9 91f8c436743fc3b9
+245 759a4be1579d59cf 759a4be1579d59cf 759a4be1579d59cf e56b2cd45f93dffc 07a26ca66615ac0c 2baf58df4189eba1 2baf58df4189eba1 2baf58df4189eba1 2baf58df4189eba1
+246 8a93cfff02725852 8a93cfff02725852 8a93cfff02725852 8ad19d04f887a6e3 ae9b5efc0211c610 85ccd5f61710ed6b 85ccd5f61710ed6b 85ccd5f61710ed6b 85ccd5f61710ed6b
+247 29e658e52073fef1 29e658e52073fef1 29e658e52073fef1 b9173fd0287d78c2 029f84973c3d80eb 8c1d611336b55ce3 8c1d611336b55ce3 8c1d611336b55ce3 8c1d611336b55ce3
+248 22b96b9c1e038731 22b96b9c1e038731 22b96b9c1e038731 22fb3967e4f67980 f872114437ae1d07 c30bb5a919df902b c30bb5a919df902b c30bb5a919df902b c30bb5a919df902b
+249 ba7186313e419e06 ba7186313e419e06 0dad537533038ca7 dbe1a1ae5b4c9275 9e7257d6f3c82a56 54a02b0e1f334379 54a02b0e1f334379 54a02b0e1f334379 54a02b0e1f334379
+250 167ecebc24005165 167ecebc24005165 167ecebc24005165 163c9c47def5afd4 f2a88a14b09b3046 341c3b0c74f7b7e4 341c3b0c74f7b7e4 341c3b0c74f7b7e4 341c3b0c74f7b7e4
+251 c6783d3240739081 c6783d3240739081 c6783d3240739081 56895a07487d16b2 34045a37907895d7 e3fab129c481b445 e3fab129c481b445 e3fab129c481b445 e3fab129c481b445
+252 2a925e7c21d8306e 2a925e7c21d8306e 2a925e7c21d8306e 2ad00c87db2dcedf 7887f7999d8bf78b 49d0b0db046b3973 49d0b0db046b3973 49d0b0db046b3973 49d0b0db046b3973
+253 e0ab88a813cf76d7 e0ab88a813cf76d7 e0ab88a813cf76d7 705aef9d1bc1f0e4 e955fbede8b4b59f 28f5820e78e09c09 28f5820e78e09c09 28f5820e78e09c09 28f5820e78e09c09
+254 e64b48591b6b599d e64b48591b6b599d e64b48591b6b599d e6091aa2e19ea72c 7ff1a5545fc826f6 686b6e3ba84a62cf 686b6e3ba84a62cf 686b6e3ba84a62cf 686b6e3ba84a62cf
+255 eb761c4939f0f513 eb761c4939f0f513 eb761c4939f0f513 7b877b7c31fe7320 0ab1ec1cf20fbc35 44d78684db33cc3e 44d78684db33cc3e 44d78684db33cc3e 44d78684db33cc3e
+256 c333c14aa56faad0 c333c14aa56faad0 c333c14aa56faad0 c37193b15f9a5461 247e4798c69de0d6 0b150d74b0827061 0b150d74b0827061 0b150d74b0827061 0b150d74b0827061
+257 53a23e88f585c756 53a23e88f585c756 07045078ff529cc7 b0c14ed96223115e 310a1bf515e947e4 dc434aff6941f86d dc434aff6941f86d dc434aff6941f86d dc434aff6941f86d
+258 fbb7599bdb38c033 fbb7599bdb38c033 fbb7599bdb38c033 fbf50b6021cd3e82 968cac181ac60852 1bab5548f0afd0e7 1bab5548f0afd0e7 1bab5548f0afd0e7 1bab5548f0afd0e7
+259 63db507d6c269282 63db507d6c269282 63db507d6c269282 f32a3748642814b1 c6893d95e4144981 7882f99faa0f1086 7882f99faa0f1086 7882f99faa0f1086 7882f99faa0f1086
+260 e0a46a9cdcf36ef7 e0a46a9cdcf36ef7 e0a46a9cdcf36ef7 e0e6386726069046 50dd2d562b457cad 96516c73e2413bd1 96516c73e2413bd1 96516c73e2413bd1 96516c73e2413bd1
+261 a8ff19f67b6501d5 a8ff19f67b6501d5 a8ff19f67b6501d5 380e7ec3736b87e6 07f330136d35e904 d27538b592c4347d d27538b592c4347d d27538b592c4347d d27538b592c4347d
+262 2c9bf425d8e74b6f 2c9bf425d8e74b6f 2c9bf425d8e74b6f 2cd9a6de2212b5de a32f4f4c67e9ccdc 344862bec8ff47e1 344862bec8ff47e1 344862bec8ff47e1 344862bec8ff47e1
+263 a991d01b6c096033 a991d01b6c096033 a991d01b6c096033 3960b72e6407e600 66990f0e897930e0 0253f725fb56fe8a 0253f725fb56fe8a 0253f725fb56fe8a 0253f725fb56fe8a
+264 1451518efbc212bf 1451518efbc212bf 1451518efbc212bf 141303750137ec0e 4094b71fceb38f06 2b9a44b1cd4d6b87 2b9a44b1cd4d6b87 2b9a44b1cd4d6b87 2b9a44b1cd4d6b87
+265 a18126aa953689d3 a18126aa953689d3 a18126aa953689d3 3170419f9d380fe0 d9e0a60eee9f25e7 07ba5c406af645bb 07ba5c406af645bb 07ba5c406af645bb 07ba5c406af645bb
+266 c7ce7b35727199c5 c7ce7b35727199c5 c7ce7b35727199c5 c78c29ce88846774 ab588ae8b7fabdc0 189d1c392b654eda 189d1c392b654eda 189d1c392b654eda 189d1c392b654eda
+267 030c4f8c2cf2b843 030c4f8c2cf2b843 030c4f8c2cf2b843 93fd28b924fc3e70 ffae86660e753d0f a73cb0d8549c0e60 a73cb0d8549c0e60 a73cb0d8549c0e60 a73cb0d8549c0e60
+268 2257f5aeb4d4e589 2257f5aeb4d4e589 2257f5aeb4d4e589 2215a7554e211b38 5068c6ea0d76264e db419c83575049fa db419c83575049fa db419c83575049fa db419c83575049fa
+269 133c03f2cb6469b3 133c03f2cb6469b3 133c03f2cb6469b3 83cd64c7c36aef80 496758c21b302a7d f6e3de77bc90e6d1 f6e3de77bc90e6d1 f6e3de77bc90e6d1 f6e3de77bc90e6d1
+270 4f6ae44e4e858c4a 4f6ae44e4e858c4a 4f6ae44e4e858c4a 4f28b6b5b47072fb 72d5bbceaa07075f 5494b62f63902794 3b3f4bbb866cb4c7 3b3f4bbb866cb4c7 3b3f4bbb866cb4c7
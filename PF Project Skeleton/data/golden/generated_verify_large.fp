@@ -0,0 +1,522 @@
+# tick spawn route counters queue move flip arrivals halt signals
+0 2cd3b0e283c7380e 2cd3b0e283c7380e 2cd3b0e283c7380e ce9d96a42d979f78 368760853facc11f b53a959b96e536c7 b53a959b96e536c7 b53a959b96e536c7 b53a959b96e536c7
+1 8bde77e661eb9cde 8bde77e661eb9cde 8bde77e661eb9cde 5265dec89b4391f0 372665f5451bb3b5 ba4ba70b91d3e581 ba4ba70b91d3e581 ba4ba70b91d3e581 ba4ba70b91d3e581
+2 4667dda935d83ba1 4667dda935d83ba1 4667dda935d83ba1 a429fbef9b889cd7 934f380b0916a925 e82d51e7d07cc39c e82d51e7d07cc39c e82d51e7d07cc39c e82d51e7d07cc39c
+3 82479b7e3979e042 82479b7e3979e042 82479b7e3979e042 5bfc3250c3d1ed6c ef7efdfc4ff81f91 544fb1e37e30c860 544fb1e37e30c860 544fb1e37e30c860 544fb1e37e30c860
+4 bdddceac95384027 bdddceac95384027 bdddceac95384027 5f93e8ea3b68e751 e2b66d66413a1037 e81c79b40fa3e447 e81c79b40fa3e447 e81c79b40fa3e447 e81c79b40fa3e447
+5 7f6dd208f733296d 7f6dd208f733296d 7f6dd208f733296d a6d67b260d9b2443 4f46314f56dab261 01a1954b168e1a93 01a1954b168e1a93 01a1954b168e1a93 01a1954b168e1a93
+6 dbed140e47dbe37e dbed140e47dbe37e dbed140e47dbe37e 39a33248e98b4408 d682e19e20ab79dd 09ed04bcf9c3c955 09ed04bcf9c3c955 09ed04bcf9c3c955 09ed04bcf9c3c955
+7 3ef69dbd03101163 3ef69dbd03101163 3ef69dbd03101163 e74d3493f9b81c4d fc79c275dec7b450 dc0f47c610ce603a dc0f47c610ce603a dc0f47c610ce603a dc0f47c610ce603a
+8 8341210d0904faa9 8341210d0904faa9 5e14e795bc607870 bc5ac1d31230df06 9f1ec732ea36a68f 9e3d3cd3b366efe8 9e3d3cd3b366efe8 9e3d3cd3b366efe8 9e3d3cd3b366efe8
+9 682f61ed2565c734 682f61ed2565c734 4343a2415c29ca21 a4557a76824a15a8 5cad31c11d46ec0b 3a15fd0c875022e7 3a15fd0c875022e7 3a15fd0c875022e7 3a15fd0c875022e7
+10 47ae886758e878a8 47ae886758e878a8 47ae886758e878a8 a5e0ae21f6b8dfde a6e96a6c6dd5bfb8 85c46b14ab57c05e 85c46b14ab57c05e 85c46b14ab57c05e 85c46b14ab57c05e
+11 16b1d0ad02354b7c 16b1d0ad02354b7c 16b1d0ad02354b7c cf0a7983f89d4652 4a4f6de125c69a21 f1dbe8fdf8bfcedf f1dbe8fdf8bfcedf f1dbe8fdf8bfcedf f1dbe8fdf8bfcedf
+12 c76ec254f80b9abb c76ec254f80b9abb debd5c5f4d43b73f 3cf37a19e3131049 509d4db18b81bd41 964c5b32ec833bce 964c5b32ec833bce 964c5b32ec833bce 964c5b32ec833bce
+13 a73659d8dcaddf9a a73659d8dcaddf9a 2ca27113c769814b 7e7a0d61ad6d8556 a10dd775fd4aa565 4b2540985118035b 4b2540985118035b 4b2540985118035b 4b2540985118035b
+14 66aa887558d3c9f3 66aa887558d3c9f3 66aa887558d3c9f3 84e4ae33f6836e85 94a99968e95d66e6 e9cff1c31fd1e324 e9cff1c31fd1e324 e9cff1c31fd1e324 e9cff1c31fd1e324
+15 e722af804d352cdb e722af804d352cdb e722af804d352cdb 3e9906aeb79d21f5 534a68c307c8634e 341c6a74c569e9e8 341c6a74c569e9e8 341c6a74c569e9e8 341c6a74c569e9e8
+16 4128a53216dd4eb7 4128a53216dd4eb7 bff30c56e7cc6bdc 163d51a7a55a485f d97e24b4ef89ab04 69e45d728e1042a5 69e45d728e1042a5 69e45d728e1042a5 69e45d728e1042a5
+17 d9a3e0e228da656d d9a3e0e228da656d 9fdf183766c298b6 78c9c000b8a1473f 9e94017d77e034c0 674bca5966b3c240 674bca5966b3c240 674bca5966b3c240 674bca5966b3c240
+18 fb5c7d5b8fac03c3 fb5c7d5b8fac03c3 fb5c7d5b8fac03c3 19125b1d21fca4b5 e3fe50acd14c676c 34f3ddfa32a61faf 34f3ddfa32a61faf 34f3ddfa32a61faf 34f3ddfa32a61faf
+19 bf90b436833ba9d4 bf90b436833ba9d4 98750be03c4e02ce 41cea2cec6e60fe0 bb021fc134869996 9b4dd820f2469f74 9b4dd820f2469f74 9b4dd820f2469f74 9b4dd820f2469f74
+20 8f3eb6ad0fd85edc 8f3eb6ad0fd85edc 9d3f9300a97fe0d0 7f71b546072f47a6 1909bb8ec1eadd48 c3374cf5032784f7 c3374cf5032784f7 c3374cf5032784f7 c3374cf5032784f7
+21 0d44cc932d207892 0d44cc932d207892 04c19c7587e91edd bbc49b6260b97bee 85e0aaa78dd5ca6f b1b2d78a87585524 b1b2d78a87585524 b1b2d78a87585524 b1b2d78a87585524
+22 98cd8f38a67b2922 98cd8f38a67b2922 98cd8f38a67b2922 7a83a97e082b8e54 70bed84a83ba55c3 c4cf670313d14225 c4cf670313d14225 c4cf670313d14225 c4cf670313d14225
+23 9c3a5c3bd3db6cb7 9c3a5c3bd3db6cb7 9c3a5c3bd3db6cb7 4581f51529736199 5cdaeb57ac3e9e69 c6c58134ef9cc8fe c6c58134ef9cc8fe c6c58134ef9cc8fe c6c58134ef9cc8fe
+24 1f32fc894df45796 1f32fc894df45796 bbdf6b3b75bbf022 c933332d8e2607c8 f43d7666346cc1da 4df84e240fba1b4e 4df84e240fba1b4e 4df84e240fba1b4e 4df84e240fba1b4e
+25 9f6ca03241c96b0b 9f6ca03241c96b0b 52b6966dbe1aadcb e91d6562313cbda5 d79a7afe89f8b80d 9b0cc95be1728fd2 9b0cc95be1728fd2 9b0cc95be1728fd2 9b0cc95be1728fd2
+26 b345e7163abe243d b345e7163abe243d b345e7163abe243d 510bc15094ee834b 0d9cfd83552d2eed efe3f72143ef4c57 efe3f72143ef4c57 efe3f72143ef4c57 efe3f72143ef4c57
+27 49fb35bb29a827f4 61a794e129b3d55e da7ed0d176e5eaa9 7a709714904caacb 4288298f777bf7d4 6aa8438fad660935 6aa8438fad660935 6aa8438fad660935 6aa8438fad660935
+28 bfc9b53aba7307a1 bfc9b53aba7307a1 036d74366c8b86cd e1235270c2db21bb b458a032b0bcd976 bc9b6b6e3c2acac9 bc9b6b6e3c2acac9 bc9b6b6e3c2acac9 bc9b6b6e3c2acac9
+29 2f120cb37be1db0d 2f120cb37be1db0d a1a2f288f6dd71c5 de4cbf0963a04d17 1dfc6a30603c017a 1b32d7cae336bfbd 1b32d7cae336bfbd 1b32d7cae336bfbd 1b32d7cae336bfbd
+30 b3862aa9f946ef36 b3862aa9f946ef36 5a8a4a9c1af964d5 b8c46cdab4a9c3a3 3bf239b937b7bb50 7cc2126b2a7199ea 7cc2126b2a7199ea 7cc2126b2a7199ea 7cc2126b2a7199ea
+31 ef949fddfd0c383e ef949fddfd0c383e ef949fddfd0c383e 362f36f307a43510 8bbb96ae8f1aebd6 9d48cac7d201f93c 9d48cac7d201f93c 9d48cac7d201f93c 9d48cac7d201f93c
+32 b3b9a12b5725f7dc 5b759734fe27d4e7 f27d1a708c8b4948 d7a6d7c4a3d21dd8 50733f67359b7e3a 815f1fcc66e865d6 815f1fcc66e865d6 815f1fcc66e865d6 815f1fcc66e865d6
+33 5b7728123b3b08e6 5b7728123b3b08e6 ad685a9d4746262f b9329ecc50084016 52a49fe988934c55 dbac9a80dce7a77d dbac9a80dce7a77d dbac9a80dce7a77d dbac9a80dce7a77d
+34 838f3fd4fe627021 838f3fd4fe627021 9a5ca1df4b2a5da5 78128799e57afad3 a3d7ae1f531effb4 d387972e31c962d4 d387972e31c962d4 d387972e31c962d4 d387972e31c962d4
+35 23c763376980faf3 23c763376980faf3 5cecfd5dc51853cd 855754733fb05ee3 8475a4546f7657f9 8a6b92759be95d53 8a6b92759be95d53 8a6b92759be95d53 8a6b92759be95d53
+36 1c56776f838a5fee 1c56776f838a5fee a5ac03bd7b6c09a6 8174411308494a91 436b8bb02554f2eb 6ad76546eae27d2f 6ad76546eae27d2f 6ad76546eae27d2f 6ad76546eae27d2f
+37 367356d66a5f1230 367356d66a5f1230 b591f0b45044997f 71e04fa5feb1147e 9df8d754deeb5819 a1cf70c3f429716f a1cf70c3f429716f a1cf70c3f429716f a1cf70c3f429716f
+38 4ef087dd51102ca7 4ef087dd51102ca7 eb87d8da32a0804f 09c9fe9c9cf02739 57f4d1c3b9632aca 2a854ca676546f72 2a854ca676546f72 2a854ca676546f72 2a854ca676546f72
+39 0df5cc4cc30605fa 0df5cc4cc30605fa 0df5cc4cc30605fa d44e656239ae08d4 a6253f6a818788d1 d56002d570dc2e27 d56002d570dc2e27 d56002d570dc2e27 d56002d570dc2e27
+40 897fbfa69289b185 897fbfa69289b185 89be9ce84cd91c76 6e81dbba8128ff83 b8ca8d2783cb89ba 319f75137ce154d4 319f75137ce154d4 319f75137ce154d4 319f75137ce154d4
+41 b3270b5b8167fca0 b3270b5b8167fca0 bd6ebf8ad80a5042 03f52d843783bfb9 dac58a4122a8e441 58d3c36017eca772 58d3c36017eca772 58d3c36017eca772 58d3c36017eca772
+42 20495fa3d0f790df 20495fa3d0f790df 686a4f7285b44f51 8a2469342be4e827 096718e740adc671 95e81a47c552799c 76216786212b5a8c 76216786212b5a8c 76216786212b5a8c
+43 2b70e660b21f35b9 2b70e660b21f35b9 0cf1cdff8fcc422f d54a64d175644f01 115dbdfddc517feb 448236b491172be2 448236b491172be2 448236b491172be2 448236b491172be2
+44 32472d4925228188 b15ea1f59e0c4fe5 4594510fd5c60639 27e41470d57d11bf d154be1e21428101 b9ef4b61f653c3c8 b9ef4b61f653c3c8 b9ef4b61f653c3c8 b9ef4b61f653c3c8
+45 83d172f2bd9c6164 83d172f2bd9c6164 71852957bebdfc81 f99a10fb9d4b89af 9b4e9fe2343222a7 7d0f016d6d9342c1 7d0f016d6d9342c1 7d0f016d6d9342c1 7d0f016d6d9342c1
+46 adecf12a1d8bd96f adecf12a1d8bd96f adecf12a1d8bd96f 4fa2d76cb3db7e19 a5935da9b7ab1c24 25502c0a2ecc6b5f 25502c0a2ecc6b5f 25502c0a2ecc6b5f 25502c0a2ecc6b5f
+47 3c6e8d4dce204bf6 3c6e8d4dce204bf6 3c6e8d4dce204bf6 e5d52463348846d8 a8035601030918ed 0ef7fc4a77511be4 2675a185777e0773 2675a185777e0773 2675a185777e0773
+48 750a8c416ced2a50 750a8c416ced2a50 9e42291ab9dc91ef 5b2662b985f07a7a 96c55a064a4511b2 00efb6c280b2f296 00efb6c280b2f296 00efb6c280b2f296 00efb6c280b2f296
+49 520bb521d072a3da c09a1806244570fa 34f9d38c2b212646 744e7d54753ff61a bb40bb5314c217d0 e8be2312d807c8fd e8be2312d807c8fd e8be2312d807c8fd e8be2312d807c8fd
+50 07e2858cb4d0390f 07e2858cb4d0390f 07e2858cb4d0390f e5aca3ca1a809e79 347ae6d0ddadda36 655f2d0ada36c2d9 655f2d0ada36c2d9 655f2d0ada36c2d9 655f2d0ada36c2d9
+51 07ce77db280891ad 12742f06932d39c9 6a9c77478ae66972 83dbf9a5db6adcbc 9941fbdb99ec1b9d 25c64d1f0b0a8687 25449a4e8dcfb0b8 25449a4e8dcfb0b8 25449a4e8dcfb0b8
+52 03c44af3a76e4565 03c44af3a76e4565 16bb3ea118b67ebc f4f518e7b6e6d9ca 5b8e697c42c414dd c12d9dced75b0e22 c12d9dced75b0e22 c12d9dced75b0e22 c12d9dced75b0e22
+53 c0e7067f6ca7a006 c0e7067f6ca7a006 b3f4bd59bad7dee4 0c76fdb51c1ac769 b3f3001c3f300d98 0f1cf0838e3aceae 0f1cf0838e3aceae 0f1cf0838e3aceae 0f1cf0838e3aceae
+54 a1e30c264e255b74 a1e30c264e255b74 946ce8702cdef528 796be4c69464d963 df899f6c62cf9148 c9733fdc0f064494 c9733fdc0f064494 c9733fdc0f064494 c9733fdc0f064494
+55 3ea5545d89883475 3ea5545d89883475 2bcdb0abcb1e7318 20e431b8d29d38e6 3fa5fe211bfe4bbe 606d4ecec0794328 606d4ecec0794328 606d4ecec0794328 606d4ecec0794328
+56 9a5d04c5c02de665 9a5d04c5c02de665 b231a233ae0b59f1 ac5535bd88387711 c5696cca7d9c8a79 2310cdc7dfd0e1a2 2310cdc7dfd0e1a2 2310cdc7dfd0e1a2 2310cdc7dfd0e1a2
+57 eb8d727d8e0f1536 d04caf091fadc805 ad17d16e9dd09942 c6ee4824bd8209e5 77eeb524acdcd0db ba90313d2a60796b ba90313d2a60796b ba90313d2a60796b ba90313d2a60796b
+58 5c7f2b2322a52683 5c7f2b2322a52683 5c7f2b2322a52683 be310d658cf581f5 b4bc76eb029d9ccb e6f10a448f2e1080 e6f10a448f2e1080 e6f10a448f2e1080 e6f10a448f2e1080
+59 f5cf28a10362589a f5cf28a10362589a f5cf28a10362589a 2c74818ff9ca55b4 6fe1513de475e41e bcd5d1b4d7b97a70 bcd5d1b4d7b97a70 bcd5d1b4d7b97a70 bcd5d1b4d7b97a70
+60 9eabfc6be5ec9e16 9eabfc6be5ec9e16 269a18a3b17a286a af6a7611d57cac9e 270191d5fbcedc78 5bec1cded4534f23 5bec1cded4534f23 5bec1cded4534f23 5bec1cded4534f23
+61 25885b7fd2ff01b7 25885b7fd2ff01b7 674cbac02f63d4e4 e0d06c6dae4ed1bc 60712256fe4ea2d6 b58f84d331d5b427 1065ecb6d481564f 1065ecb6d481564f 1065ecb6d481564f
+62 ae974ff444d0d03d ae974ff444d0d03d ae974ff444d0d03d 4cd969b2ea80774b 74dd82b0aa367980 5df9be8d71c5f64f 7250927939806ebf 7250927939806ebf 7250927939806ebf
+63 29d79d84d572cb06 29d79d84d572cb06 4d2309fc0f43bc27 d9b746e0ec0eab7f 4e487a6f25495ed5 95d8a33c2f9e3300 95d8a33c2f9e3300 95d8a33c2f9e3300 95d8a33c2f9e3300
+64 deed0d505631de9e deed0d505631de9e e1f47c12a9a9f959 9345cc2bd395be29 f99217a1c93ca89d 1d7b9dc551d9c610 1d7b9dc551d9c610 1d7b9dc551d9c610 1d7b9dc551d9c610
+65 5612dd24a1384c48 5612dd24a1384c48 3d748f798da44a36 74949cd9911a05f1 95fe72b65f339bc4 cb672ad8d3ca1b2c 3862bec41d838ef0 3862bec41d838ef0 3862bec41d838ef0
+66 02ea5100e5619cd7 02ea5100e5619cd7 beb75687fa4247b0 16d8d5cdfa009034 68ae34e57025a453 35a39e3f091ec335 35a39e3f091ec335 35a39e3f091ec335 35a39e3f091ec335
+67 5ec174dc036446a9 5ec174dc036446a9 5cf0690798625a68 854bc02962ca5746 d2211e150a878038 8028e2e9c329620e 8028e2e9c329620e 8028e2e9c329620e 8028e2e9c329620e
+68 45e9d3fb50892091 45e9d3fb50892091 e2021f9bb059df26 ac9cc413ef46d801 3caafe5fe1e1e8f9 795bb7580bbc2c59 795bb7580bbc2c59 795bb7580bbc2c59 795bb7580bbc2c59
+69 488420a2ec07c769 a32a9fee70c6f4b1 451867991f8c2c9d ff1344f209d6565e f2830fc54797ab68 6a1016e6eed19700 8f17b10793edbb8d 8f17b10793edbb8d 8f17b10793edbb8d
+70 2ac34b40a9bc1993 2ac34b40a9bc1993 8996bcadbdfb8d92 b94ab2d6f0806c34 dbfcf3d4b246c14a 25638c22b9f16f0d 25638c22b9f16f0d 25638c22b9f16f0d 25638c22b9f16f0d
+71 cb1a7cc2a74d9986 59262e8dfe6ddd16 23fefddf8c1d8a31 270e170cf074eb23 85a855434b175a98 775485d64c9d8b2d 775485d64c9d8b2d 775485d64c9d8b2d 775485d64c9d8b2d
+72 d0053d8e457d9ca4 d0053d8e457d9ca4 a6039d693e40ebc7 01431f2188f8dc55 409efd3163195893 eaea2ee0d355cbc8 eaea2ee0d355cbc8 eaea2ee0d355cbc8 eaea2ee0d355cbc8
+73 04362cbdd99d8687 04362cbdd99d8687 d17e3b6ef4e94ac4 540898e4b6473d2c 9fcac2cb3a73d399 1eb824d7962e415c 1eb824d7962e415c 1eb824d7962e415c 1eb824d7962e415c
+74 16a087cf08d422d2 16a087cf08d422d2 a22f7a42d2d47440 84cb9af0dfe8330f 0ed717008d45f5a5 ccbde458b91fc850 ccbde458b91fc850 ccbde458b91fc850 ccbde458b91fc850
+75 2702cafc15390dfb 2702cafc15390dfb c613adb4bac2e310 19dd810c583ab403 e7a3aad61ebc27c6 cc7fe886dfc6187a 973ab6b26a7a7d56 973ab6b26a7a7d56 973ab6b26a7a7d56
+76 4330460c78cbdeba 4330460c78cbdeba f14bf33d6bc4500a 04c79499f04f359f c1396e6dc3c4c67a f1580c6210ae0f90 f26c3d0fdc417c59 f26c3d0fdc417c59 f26c3d0fdc417c59
+77 ae739c991833dce7 ae739c991833dce7 8c167878f1e70d54 df0f1bb467ef6a2c 317c81cd7d8155e8 957aa30c1f9c29af d9e10714dbdd2b58 d9e10714dbdd2b58 d9e10714dbdd2b58
+78 4cf189cc9f42277e 4cf189cc9f42277e 90bc84e004b69aba 7e829ef7d9125bf9 e437e8184d40bed5 26ead70b4b4f8867 f8594ba5b808af91 f8594ba5b808af91 f8594ba5b808af91
+79 1059d568185cd11a 4b6f87ef6a0047ce b4ce2c840e4fc99e 6d7585aaf4e7c4b0 c553a6d7dd405765 be302098e2ecddac 112bd4188536f2c0 112bd4188536f2c0 112bd4188536f2c0
+80 4201ad54f730b2e6 4201ad54f730b2e6 fa4328fa3528fc51 c2caf240a75f26cb ba3e60f2f33a33df 06f7ed7b6c683696 3c6f97972993bc58 3c6f97972993bc58 3c6f97972993bc58
+81 390e49eb9bba7583 390e49eb9bba7583 ae5fbb376be7b049 61104c082d5c1708 871eedfa823e7d77 91be4495f216b894 1da21dd9fea4c0bd 1da21dd9fea4c0bd 1da21dd9fea4c0bd
+82 3b3861f19687faf0 0419844a06b5dfa6 74019c2afee5ff55 97b153972cdcf075 2dfb33f990046b36 b71552a6b6c39ee5 b71552a6b6c39ee5 b71552a6b6c39ee5 b71552a6b6c39ee5
+83 6c3ef261c126823a 6c3ef261c126823a 3d2e6cc3f1c62c60 8dcec180102025e7 ae5b934d0013fa7b d697c24c3bcb41f4 e47b1f1754b2e028 e47b1f1754b2e028 e47b1f1754b2e028
+84 55f86176ddbc5246 55f86176ddbc5246 348b84d144a56517 fa2fd32abc46fe4d c6fd430c0a1abc08 2f506b02264b2f6e 2f506b02264b2f6e 2f506b02264b2f6e 2f506b02264b2f6e
+85 a499e1e38f4439e6 a499e1e38f4439e6 59db93970a9f4dea 7b5132ba6d541bda a7e1ec042365a9b9 aa78b333b9d658b3 b3511855bd13190a b3511855bd13190a b3511855bd13190a
+86 a6508f8fd9a022e5 c6e465cb517a7505 99a2c8e6c89e8b87 8165b77257661441 b62862f8c7d341ba dbaabb493582eae9 dbaabb493582eae9 dbaabb493582eae9 dbaabb493582eae9
+87 9c4b631c28e4620e 4e9b43d1ed256859 a3298ee19efc9250 1c69fb52c0f420ac 9c385d7de80f0f3e efd31a0eff0ba627 efd31a0eff0ba627 efd31a0eff0ba627 efd31a0eff0ba627
+88 ea6ffa71fc129422 ea6ffa71fc129422 4606e513e4167a32 f3b3f849273f38b5 1bc116e11f4a2d10 c9162ac60e5ad6d1 c9162ac60e5ad6d1 c9162ac60e5ad6d1 c9162ac60e5ad6d1
+89 474726a9509c08ec 716a47c655736fa5 adbdd5abad40ffd3 e0a2a7096c232066 4b7b2bf425ed717b be44d03da861ccbc a3d80d2cf9b377c3 a3d80d2cf9b377c3 a3d80d2cf9b377c3
+90 30a29ee963e8d8e8 30a29ee963e8d8e8 2b3efe8aa9f5a547 503570d5b5d5277a ff812333ba40b7c8 20395ff312dc0477 eedcde390ee1015d eedcde390ee1015d eedcde390ee1015d
+91 699cae9971b0dfb6 aefb2a46f9a0b3a5 f5b9253332788726 72ee72fccb5dfe14 b75e969054b83f2e f17c894bfc680733 f17c894bfc680733 f17c894bfc680733 f17c894bfc680733
+92 76523edc3f45ad0f 76523edc3f45ad0f 09f18913cab84f21 e2e5c3f0ff5168fe f8657a57dfb6596b 31adb55a368da8d4 a8e5b7460f507dbf a8e5b7460f507dbf a8e5b7460f507dbf
+93 b40d4c1d492406c9 b40d4c1d492406c9 72aad5008cde38c2 9cbb5b9877af158c 0464d9d9d130d205 5ea55410ece4c76b f590cfc1e351e609 f590cfc1e351e609 f590cfc1e351e609
+94 d151008eb675e5e2 610df6562bf945be df6f3869adc38c20 3d211e2f03932b56 ff0e54c886c5a20f acec63499b421175 e344061aa8c8b4ef e344061aa8c8b4ef e344061aa8c8b4ef
+95 a924fddd56822da7 17fa75bf4316b841 0ce0ee674cb97c5a a40971cee4aba6b2 5df40e753aada446 25ca25043cffea58 93270dc3195f8199 93270dc3195f8199 93270dc3195f8199
+96 65e5d53e8bd6c0d9 65e5d53e8bd6c0d9 b2776230e27a5d29 8ce056e93a93ee30 43f73703fca251fa 2bf9230691abf377 2bf9230691abf377 2bf9230691abf377 2bf9230691abf377
+97 34130a3e3c1a0053 7de257e6e9eb0942 9636235994af5054 d35d0732447158c0 492db4ec296b68c5 4f64853cd45b58fd bb497a33760e029d bb497a33760e029d bb497a33760e029d
+98 e3f58a116cf7a4e9 02b3efc82a8134b7 68744a0ac1e0b934 cd966766a6251c1e 1f10e876b7e0a65d 8b9734981c2821b6 8b9734981c2821b6 8b9734981c2821b6 8b9734981c2821b6
+99 4cc97709d8d443ac 4cc97709d8d443ac 09ab3ff4ee03fd4f 25e1e62d9189341f e1935b802010285c 5fde044fd8077cec 735548da95422a60 735548da95422a60 735548da95422a60
+100 f188c3676711d7dd f188c3676711d7dd cf6c1d6d06ba6d66 2bdbbc6b002f56d1 0ffec6039231d2aa 295d28041c746bdc 97f33913cc4f7dcf 97f33913cc4f7dcf 97f33913cc4f7dcf
+101 ebdf044f4b2b2df4 648d5631629ca77c 2178ed28ff21d747 1dac64e0e99067ae 08e8356cf04b3a9b 0967cc413878220c ca04040b1fcfd868 ca04040b1fcfd868 ca04040b1fcfd868
+102 ba55f407d437afbd ba55f407d437afbd 098cb894497469de 5cc2d3491f01d36f b852499df3761873 0d85a73bd5c781bf 0d85a73bd5c781bf 0d85a73bd5c781bf 0d85a73bd5c781bf
+103 76c32d2ec63cf0d9 b926588142a895b8 06823a248230bbd2 4e5586568595cdf2 18338fd26041ace4 57441452f3102be4 94571a123fbcab4a 94571a123fbcab4a 94571a123fbcab4a
+104 c2f05f6ea2675809 c2f05f6ea2675809 205a6097f60b3da8 13b52479f021b7dc bc160a6661e416b4 4988950707722883 4988950707722883 4988950707722883 4988950707722883
+105 c344062205767354 c344062205767354 3a19ba6d62abdae5 2ec85baccdcb99c2 82db5fbd4ba70e35 0a4196e5533b362b 1c3b225b54dd8353 1c3b225b54dd8353 1c3b225b54dd8353
+106 7dbc3395c2df8697 7dbc3395c2df8697 dd8dbb797f14ec98 ecd1b726adf35b04 203add6af4758da6 656ff8787c987063 daf3eb5e684c5ccd daf3eb5e684c5ccd daf3eb5e684c5ccd
+107 31299c25605af752 e4ad22603736079f 8dcb4d197a1555f0 815a9f26b87e8838 28dcdd3dd182602d 1b4d6dc4cfa5b279 b43256058c734eb1 b43256058c734eb1 b43256058c734eb1
+108 84c417dd193fa92f 84c417dd193fa92f fcc7f791d968ddb0 9e61aa2d33809da3 5afd43b9811c34f1 266ba7697020fcaa 266ba7697020fcaa 266ba7697020fcaa 266ba7697020fcaa
+109 917013f3f5f9ac1e 917013f3f5f9ac1e f87480d918cab417 38603b5ecb74fcf5 480006d733049640 3e0b16a7c1e0daa0 3e0b16a7c1e0daa0 3e0b16a7c1e0daa0 3e0b16a7c1e0daa0
+110 7110e76551f65524 0ad433bd12502401 6393c8b33ac57227 c5911e1bfd637937 686ce36da8669341 9f6391b84d84e859 9f6391b84d84e859 9f6391b84d84e859 9f6391b84d84e859
+111 c896c5a1de3f7833 401614695dcd8ba4 ccf2fb77775be99a a65fb86b98ec1433 5ee714154e6458e5 c95072e331e0c6b4 57a9d1ca8fc50b30 57a9d1ca8fc50b30 57a9d1ca8fc50b30
+112 039bf5aace30620f 039bf5aace30620f c9380dd309cc9229 2d40ff9d9b73d9cb c4aae367786f5bea 14696e901b90cb98 14d1c446a31172e3 14d1c446a31172e3 14d1c446a31172e3
+113 37addeec9ae1e365 11ef21a67fb39d62 b9fc15b32efbd6a5 5100f91198baf533 dfcbeea03d928138 31b584436e6eacb5 17533bf207cf5966 17533bf207cf5966 17533bf207cf5966
+114 5825d6ce6dbc1dd2 5825d6ce6dbc1dd2 762e8cb24a760459 32a05d6f851ed1e7 d81d8bc904974bac d3e3d92e72b57baf 519a6f2cba878d45 519a6f2cba878d45 519a6f2cba878d45
+115 7d845a6481a72d3e 7d845a6481a72d3e 36f979a8fe8d498c 971eff881b34ac16 052d6ec6dd1d83bc 2c25793bd3faeea6 2c25793bd3faeea6 2c25793bd3faeea6 2c25793bd3faeea6
+116 0f46bd14b7a72b90 0f46bd14b7a72b90 a291839baad7db62 665c99cf906fcaaf a9e12f62402df683 7ab5c43404aaae16 fbfb9403ec61c7c5 fbfb9403ec61c7c5 fbfb9403ec61c7c5
+117 2b2fccdc72c5ab74 2b2fccdc72c5ab74 5a5da84006756e94 81f47e2d4177ffc9 053e3bbc87ff1033 286bb85a8ad94ac6 286bb85a8ad94ac6 286bb85a8ad94ac6 286bb85a8ad94ac6
+118 82b1c4c311945ea9 82b1c4c311945ea9 d65928b91d0934c0 5f6a818352641cb8 28284074f52ed04f 1a0b694a55ac2331 0412ee9e9ff3f7a5 0412ee9e9ff3f7a5 0412ee9e9ff3f7a5
+119 aafb209f7571795e aafb209f7571795e afe6751af3f06ec8 b0a465c92887033f e3a72134b422546f d819ea27d981ecd7 d819ea27d981ecd7 d819ea27d981ecd7 d819ea27d981ecd7
+120 22897defbaa4cb3d 22897defbaa4cb3d 1a1788e8b29e1a94 cb33b26e7c06a99f a7bc17e53c23478e 52bfa43d645f10ae 52bfa43d645f10ae 52bfa43d645f10ae 52bfa43d645f10ae
+121 f5e74f5b2d03d48e f5e74f5b2d03d48e f002aa30a96a14cc b8d881887696f180 d7d39abd24b6eb08 c00f7ad2ef58113f 2cfbc3d6a74fe732 2cfbc3d6a74fe732 2cfbc3d6a74fe732
+122 f68dca22e76d6db4 34daa651c4c4b7d2 dfb55fc0af40b9ff 89f758814e1a58cb 8fd5fc161643cc18 31c884079d24fb98 31c884079d24fb98 31c884079d24fb98 31c884079d24fb98
+123 647b6ca9fa287442 647b6ca9fa287442 e40333723dce9d32 5ace1661a1d08d9d 0a1987ee9dbdf476 d66b016555a1aac3 01b28c94088a83a8 01b28c94088a83a8 01b28c94088a83a8
+124 0772e42249bad6c6 0772e42249bad6c6 5d04e91d3e7f302e cd2b4669f44723bc 6d0633af847256a0 13c3e220a7c000d3 13c3e220a7c000d3 13c3e220a7c000d3 13c3e220a7c000d3
+125 52676509e5100397 52676509e5100397 e76eee099ee017ff 404530de4aa4c06b 30450fbe7076a811 0b1f858fdb5e6297 edb25b5cc6fba814 edb25b5cc6fba814 edb25b5cc6fba814
+126 e6ae6111b8625b00 4b39576a46b436b3 af57bcbcfd816c67 eb74489ef0e217fb 1c400c2114912a15 42183b01b68a5762 fceeabb1d79ef503 fceeabb1d79ef503 fceeabb1d79ef503
+127 00401d0d425e29ac c9f16c72ac63fc68 44b10635c75bc675 68eadb57dfd54e28 53d21a572acc518f 8de9dcc9fe51ade2 4b3ccc4eb3dadc0f 4b3ccc4eb3dadc0f 4b3ccc4eb3dadc0f
+128 e26774ef8fb26864 e2b3a9d0d025d23a b46dc489043cc25e 80fe396bf330f2d2 5158a2841ae29c7c 15dfb320057f4107 692c16da611fc4e7 692c16da611fc4e7 692c16da611fc4e7
+129 2a1562566297480d 2a1562566297480d d14dd8cc5c9f0c4e 9082243c6f605662 a8a0ef06eefeb1e2 ce6c8fc9e2535551 7560f61f50deacdb 7560f61f50deacdb 7560f61f50deacdb
+130 4c5c65bde11277be 4c5c65bde11277be 31ddbb5d64e2f9bc 6ccc5181a2a32a76 0fb6e8c1ccf80bea 3b70a18da349b3e8 bb262b8ecae943ad bb262b8ecae943ad bb262b8ecae943ad
+131 31f0ce2e823940fe 31f0ce2e823940fe e406e02f42c71e0e d552525ac74dd7d5 8acaeac7436e87f9 7993a36c01a4fa00 09c744c4d5d442b5 09c744c4d5d442b5 09c744c4d5d442b5
+132 15163ed4d0baa6ca 15163ed4d0baa6ca 986ae0a4778ba6c8 3b0a589fa0d4ed6e a8168f4850a48028 4d6a98bc9fbc81c3 bfa2ba2db43f1fff bfa2ba2db43f1fff bfa2ba2db43f1fff
+133 14e66d240844166e 14e66d240844166e 0bd09d14956d40cd 2a379a46bc9e4b04 a6a64615b25753ea 85d31c90eb10fca9 3e7c534f90fe56fc 3e7c534f90fe56fc 3e7c534f90fe56fc
+134 c0cba8d415bdb8d5 c209a3416ad671ca 3e16d8bbfaf5b9c1 bc097d7807ad20c0 17555c01967bedad 90eb0a507dae416f e25e73314ebe6e06 e25e73314ebe6e06 e25e73314ebe6e06
+135 0ce06f519d871aa1 c3cee65c0e05cf0b 6458d847033bbb8e 134e95ef06512e4d d92ab66dc5c43736 792adcc5e78e28b4 792adcc5e78e28b4 792adcc5e78e28b4 792adcc5e78e28b4
+136 93064f407262bcab 93064f407262bcab de7b00b372f8aee1 d9f35b9df36287f0 d7ddc87851e358e3 b82ca5d4bc4599c1 b82ca5d4bc4599c1 b82ca5d4bc4599c1 b82ca5d4bc4599c1
+137 539b953e1f0a9b46 539b953e1f0a9b46 3608e355445930e9 e9815d0d167facd3 8b5ae902e427d48c ce4d3f4b28b14ba3 c681a9699be54af9 c681a9699be54af9 c681a9699be54af9
+138 c200c2cd60e21423 4df9adac443190ed 3f894882c0455a87 9af08bf5fb678593 9a990cbb65d0bcde 16174463fde7c89f 16174463fde7c89f 16174463fde7c89f 16174463fde7c89f
+139 d5926030c49e7790 63ac54f79b378802 c90c924d59977228 1856975dc24bd063 fc72b27a2ab85fcd 4dd873bbb4b62569 18b4b043e0374859 18b4b043e0374859 18b4b043e0374859
+140 a28e7be087b1fd43 caba53099ec86323 f6158f13c63e37bb 3759d06bffc6da8a 02afa31d9bbb6cac 6a99008148d82659 a6ead659f7bb3a58 a6ead659f7bb3a58 a6ead659f7bb3a58
+141 df652e087fbdf4cb df652e087fbdf4cb 3d1d5a68a75f3a9e f8292a14f4b7e80c d71613bea1e30724 39febe5cae3bc8b2 39febe5cae3bc8b2 39febe5cae3bc8b2 39febe5cae3bc8b2
+142 8ffeef1f1c16798e 6d5257862c363eec acc7c59c678db6f3 2b4b452ce7002895 47872fcfa6ff7928 b7c3a23d1501dc14 b7c3a23d1501dc14 b7c3a23d1501dc14 b7c3a23d1501dc14
+143 8b83277e1ea2505c 8b83277e1ea2505c 8afc5519f9d1629c cab9af187b684aed 7f564efa9658f4de fd24802478722557 d2a14f686672b1ac d2a14f686672b1ac d2a14f686672b1ac
+144 60a60b4a02e68c7c 60a60b4a02e68c7c 194a7e9d96745728 fc3cc8f01d809ae9 33d80ffe3aa77a7c 0c9e5e82eb599ff0 00239e470ff52ca5 00239e470ff52ca5 00239e470ff52ca5
+145 a6810ace2e381232 a6810ace2e381232 5258f5d8baf23db5 9fccdc924c1f2478 5cc7fb529ade6b69 4a8e07cc094926c9 27f57d4500b8e780 27f57d4500b8e780 27f57d4500b8e780
+146 15e83a4c241ffaf2 15e83a4c241ffaf2 5e8fcc095e7c1853 60033bb3d33dddc2 2330293f11d17ea4 ed25873191ec4f6d 8e14224d3c9f4a55 8e14224d3c9f4a55 8e14224d3c9f4a55
+147 e3ff34c2f8f39ffa e3ff34c2f8f39ffa c9feff14e485f300 86922f359d871449 6de33ac856b487e4 60de9398bd784e2d 60de9398bd784e2d 60de9398bd784e2d 60de9398bd784e2d
+148 5bcdf6b4414a5954 fa3f47490f00aea2 8f22690b32588ed3 ea59692b71396c2e 5007de54758646aa 7342a703620b26a0 b2881f863a77f164 b2881f863a77f164 b2881f863a77f164
+149 3a9d8203d98556fa 6cc40718e83f9477 85de18f69eae1bc4 1c3669e6a3b51835 cd41e43703d28b38 5decb9283fd53070 b4e628ad21af5ccb b4e628ad21af5ccb b4e628ad21af5ccb
+150 49acadbfd4f538a1 49acadbfd4f538a1 ea89c0cee32ba87f fc54bbb74e8ca7ec aa20bb109cec66e7 7b75c254acdf0b9e fc6887c50cf3c56d fc6887c50cf3c56d fc6887c50cf3c56d
+151 097250bbb4c2405e c38ce9e941c6edb6 30807f7f0dec67f0 e0f1cf03aea28bb7 2bf2077aaf1d3188 0c4a163593b44863 225eb3f5c9a635f5 225eb3f5c9a635f5 225eb3f5c9a635f5
+152 25f4deb602088d64 25f4deb602088d64 17064602a93ea718 9d6e291050e9341e 648ff51b19384799 3694612fcd757da3 3694612fcd757da3 3694612fcd757da3 3694612fcd757da3
+153 4cab196f0f231b2c 4cab196f0f231b2c 9280070cd16197a2 f6b667046960bcd9 db4bf0ffef87e8e7 353b85fcbcebd675 be86ccb62ed2402e be86ccb62ed2402e be86ccb62ed2402e
+154 e559dea0981b1505 ba88cff0a1fd1c2e 2e9f77cbd2a113e5 4eccfe64efecd9c7 d083bfd667fde1d2 88b382eb1f718602 9d84a554caebbc2c 9d84a554caebbc2c 9d84a554caebbc2c
+155 1237291c7dbebaf4 4e3cdec61a2e5892 f8f7318e49804389 35afc4cf60e3aef0 156d8d8fd6b34bce 3ca0c239c4d5198d f7d374670c6be3a3 f7d374670c6be3a3 f7d374670c6be3a3
+156 8aa175f6e3fe5f22 8aa175f6e3fe5f22 8f2c18ba525331d2 6d81aacce86ccd7b fb25fdbcf9245f8a f6dc04635190ac11 f6dc04635190ac11 f6dc04635190ac11 f6dc04635190ac11
+157 c2ac3e2751474b02 c2ac3e2751474b02 54048264ac0e2b29 947e24e055f61bba b2212f3f90168029 fc2b62828b4748e4 8c837829ebcc0dda 8c837829ebcc0dda 8c837829ebcc0dda
+158 e5984bdce30f6c48 e5984bdce30f6c48 69e5658652f957bc f2c544636ea90263 17bac1e3e6385130 56f37af54d8faa49 a878c8dcd0c15d99 a878c8dcd0c15d99 a878c8dcd0c15d99
+159 5b0bbcee9935c423 2cbdc1baaad69d78 950459b163b67117 6a299c02791c9e95 aa92421a54047970 7c8f0488e25296e9 4e6b9d55bc7dc5b7 4e6b9d55bc7dc5b7 4e6b9d55bc7dc5b7
+160 a6c980066bc8ef4c a6c980066bc8ef4c dc667a65e43b7899 be45b73598f0b9e9 5a1a57c67640b514 cdc7bb64888f1a62 444f78a98f249d47 444f78a98f249d47 444f78a98f249d47
+161 cfdcb26b50b26625 bd2e1ebb66ecc6ad 7ecc58f248017643 bcfd13f4140eeef7 e14b610dde5cb65f 1877ee50a882de56 76a2d4947e698c2c 76a2d4947e698c2c 76a2d4947e698c2c
+162 cc2f65a77f4c0d43 cc2f65a77f4c0d43 599baa1f09806863 f53e5e5ade28a431 4fc284b8515925e9 a5d14b6c2f7b3ea5 28532f1b601f0db4 28532f1b601f0db4 28532f1b601f0db4
+163 22ac8a1638667af8 5e03235774082330 638881653f5458e9 b32d35fcae2d033f 22de33da20dec591 601bb85e20dae90b 1e8d9a4a500dff6c 1e8d9a4a500dff6c 1e8d9a4a500dff6c
+164 2abd3f0fd50a280b f91c1eef95ced375 0cde00ca3963a717 28de147c0e17446c 2f0ce0b5d85fcc52 8e66f2deb2950d3b 842f8384802b9c64 842f8384802b9c64 842f8384802b9c64
+165 b7ec603aa0a64af7 b7ec603aa0a64af7 2aee82b7e5121d9a 70f5867c7d56012b fef82bc5a75db6ab 047e684dccc1b35f 047e684dccc1b35f 047e684dccc1b35f 047e684dccc1b35f
+166 393a294ade3183cf 393a294ade3183cf 212c8a95fd648939 710727b2c5bbb018 70ce8cfe3a8b02b9 5fa4a65acd2e485c 73f683afa012f16a 73f683afa012f16a 73f683afa012f16a
+167 ac656e56328d2ece 49110a049635039f 914459b581efbc8b a90dc7d1638c96a9 ee95f086812217ab fa640512f0c2ef66 7e0a1fcd6ba713f7 7e0a1fcd6ba713f7 7e0a1fcd6ba713f7
+168 3b293edf56abf2a5 3b293edf56abf2a5 1689b671d75e1ff2 9cb5493773120361 0f550823445d6ee2 5cd04dbd94b3168b ce758dacd92993b1 ce758dacd92993b1 ce758dacd92993b1
+169 e059be23d9569da0 bcf232cce57a2b43 38afc8c36ed663e2 d17d5c8b368e17ec 140203e761c6d49f a71cc8fd0e030a26 a71cc8fd0e030a26 a71cc8fd0e030a26 a71cc8fd0e030a26
+170 ae21bcc35c0ac4b6 7e95aac49869f442 a6fdab90a10fdccc ff1342c99c0c6ab2 2492ca9fc2e39bc5 63d0ab75c37c0e33 c16998f9f28ca3ae c16998f9f28ca3ae c16998f9f28ca3ae
+171 c4828e6f88fbb337 a8eb5ad0fb5ec214 c9e00dd98b3239fa 9e869b3715a9dd06 4357b1aa82acb0f0 b607491bdf710fdb f75c0eb8b545c2ec f75c0eb8b545c2ec f75c0eb8b545c2ec
+172 a3709da42c28ec95 a3709da42c28ec95 75278aa1c25024f2 fca557009672979f bcff7203902dee2a 84d96f49594749cd cf26cf33b4d3af15 cf26cf33b4d3af15 cf26cf33b4d3af15
+173 0ef58a416b5b8af9 8ff4f0e435a78687 a0930b121a07337c 38cd70c0c2553009 2e005e1e357c695b 75167cf41ad3b258 48aee67859bab49f 48aee67859bab49f 48aee67859bab49f
+174 eef1f41805dfaee7 c35c3ef6d7e52949 4d46e47724c1a0b4 3ceb808e96c66f46 de10142b2fcbab7a fc5247dbd35efdd5 23fa963fe2bfdd3f 23fa963fe2bfdd3f 23fa963fe2bfdd3f
+175 e86388c56332b38e e86388c56332b38e 01597bb52f1cbcb6 4b8bd413dee4d4d1 4e7009393628af2e fa63a909a1a3aebf 9371061dedadbdfe 9371061dedadbdfe 9371061dedadbdfe
+176 326d809bf1872ba1 326d809bf1872ba1 5cf11783455574d2 e0c7cf430c4d5898 8d37b73bd5429cac c937c21b1b18c71e ae0759ef5b5dd5ba ae0759ef5b5dd5ba ae0759ef5b5dd5ba
+177 c1b1a15e7a241559 2d46cd3015d76294 9ea3aecdaf1a815b 492e4df9b7a39fae a4717a30939270cd b28ad78212321e1d 573e523d3de7141f 573e523d3de7141f 573e523d3de7141f
+178 26414166690709ed c6d825f116a3b8d6 9d8c0ed7c3601dd0 148de02306cb9db3 9b7bbb334c0979b7 8bd6a1ac81608c23 d94da1f5552aaa00 d94da1f5552aaa00 d94da1f5552aaa00
+179 d20dff14a6febf1d 0f364072518b2e26 a7c820d260878b57 65f53e1d41ff17b5 254c472b9396a421 9029681602f98fe3 4417e66fbb11ce41 4417e66fbb11ce41 4417e66fbb11ce41
+180 25cf753c1f926425 6b4e2896b0dc14fb 4e2e517e0f1ed201 ca6f8af3513fecd9 3fdf96322511d9e7 5a88ae3299ef7355 630b30a7aef64f52 630b30a7aef64f52 630b30a7aef64f52
+181 596f8b306ff7cf27 596f8b306ff7cf27 a175ad86ab83e931 747bc201afc6aa09 bcf062c17a97005b d08f42c7e397805d 9da3767559a7babf 9da3767559a7babf 9da3767559a7babf
+182 97072d562c080f7a 821e177aa38e075e 6ce7005b9cad10cc d59ef9b0bb5e03c7 fc1ef4f8f349fbf0 b7d01f0d875a9770 7d3e8ad7486f6a49 7d3e8ad7486f6a49 7d3e8ad7486f6a49
+183 6032b29d0b0fa8bc 779efd4422691cde 5be746c59d624f45 a760bb6f19cae9fb abd58f835b50e840 aee367b1295f3a32 94d1bec00ae49bc4 94d1bec00ae49bc4 94d1bec00ae49bc4
+184 f696a286bb89df3b f696a286bb89df3b c046cd7bae02ba0f 7e3909ebdaa15843 c6b40b94895b22ad 2c2b2dca68caf5da 50323553c383ad2c 50323553c383ad2c 50323553c383ad2c
+185 8018be630ca67d95 04d10af274eaa25c 8ad7a9fd31b076a9 4b7310dd26e45dd7 a391b1690db7ad2e 4ae0fdd524407389 5ad4738a021128a0 5ad4738a021128a0 5ad4738a021128a0
+186 cc57457c41e6fe6f 3cf8d701f77347c4 0bd98b28ca4664e9 7285c28252c01b8d 9484d45585e49f0b 3b08ee592ee018c9 1f4c4399e850abe9 1f4c4399e850abe9 1f4c4399e850abe9
+187 7be9c5f1485f4959 55e7d6c5a26a0af2 ae94a3462c50bf79 fa0f366c8ef2c1d8 4a1170ab20902f3c f821f8e029343487 5c21379e55c69dc5 5c21379e55c69dc5 5c21379e55c69dc5
+188 2642bbbb9623f553 2642bbbb9623f553 2fb4492dc5bf4a83 2a766307c46a7787 917a90dcd1836e49 a34435941d937161 9fe478943296f5d8 9fe478943296f5d8 9fe478943296f5d8
+189 0c63a38d7eec0a5c eb2f5b0532a383da fd5fa6c3b2233d6e d7917b0dad47abf5 7072d73a74e778f2 ad7813e565dd25f4 7bb9fbb67ace0569 7bb9fbb67ace0569 7bb9fbb67ace0569
+190 4c96c1ae5301bff5 26f9925191ad9c05 7ffcf88c4f5447c7 88b04d99d171a408 8c6431f041d2b37d aedb91356c80f421 205278a8ad55ba6e 205278a8ad55ba6e 205278a8ad55ba6e
+191 988b8b5ac1d6f5ff 988b8b5ac1d6f5ff ed4b8710c413bf89 ef2b774dbe77a800 a8c7ae9b54bd3252 9e3feec613ae8ebf 87c80947779b210f 87c80947779b210f 87c80947779b210f
+192 abf040501fe1e35e ebeca26d15fc8ba2 0f5a15b8228b2577 906ea4368a970ec3 bdc7902a9b80e132 1e7ac539c522138e 42a63e31386942e9 42a63e31386942e9 42a63e31386942e9
+193 a890dfcc41d05a92 a890dfcc41d05a92 79e3bf14465b58d8 9c06a2346b2e9c4a bfe4679352738c0d 390e4f53855768ac 336f4003f00fc0ba 336f4003f00fc0ba 336f4003f00fc0ba
+194 4012b0ced5e541ee 9e94e44df0ec29e1 d74032bcab09af54 b0c196c18790358f a11fe0533d688bfe 90d8eeff135038c3 54d77902de22cd9c 54d77902de22cd9c 54d77902de22cd9c
+195 8cec8101c6593fb2 5fd82f63f9655a30 112f3a9e5b3b8e4f 35e44442a42d086f c1f3b0b87ed6a51e 4fbd55d7fc8d4850 64c6f18e85d799fb 64c6f18e85d799fb 64c6f18e85d799fb
+196 2c4ed9841e46f38d 2c4ed9841e46f38d 56fc4f8e35444b5f 0576472bd03960a0 13b9124346d8ac31 2be8ba69d7e09a7e 705823bfff288942 705823bfff288942 705823bfff288942
+197 03f99dd948df5ac8 11f81d043fee6e69 a678b83a4e94be3f 3585ccef57a085ed 6454afae06dc5e36 61eaa17a19efc425 bfb635807e343150 bfb635807e343150 bfb635807e343150
+198 76e6ffcc8617d21f 6e880d9a196875ea 173d58b93ae2ead3 7ef380e31bbe5131 eb4b704eb963b5b0 3f32298a3648af39 f88e52bfc89d0f87 f88e52bfc89d0f87 f88e52bfc89d0f87
+199 2c93c8b22ad3d942 30e6fb0c877ffc06 b433b16fcf1f5e75 c415f24a66cfb100 cb457487172c3909 3991730bb38a03d8 7534e9aca648dd39 7534e9aca648dd39 7534e9aca648dd39
+200 02525b5ec396d826 65fa1e3300c56725 1dc2441c9379b622 07df69e37ffd3848 15bb54d3b1756076 333a07507634d766 1b2418f1b86d929d 1b2418f1b86d929d 1b2418f1b86d929d
+201 23b8437b41dd9af4 4aab79dba0c6f0d6 9baf84aafb4b1913 db931ec9d8ddc5cf 0bebe2d1eb2cfe58 e1890fd4ae3f2336 3ecf961e8ccf7f15 3ecf961e8ccf7f15 3ecf961e8ccf7f15
+202 5854d23f936de3dc 5854d23f936de3dc 50bff57c1af49398 f4f55a69f0e8e3ae 012a47efcd51f6db 714d7a10af319f15 a9e17cf664007f77 a9e17cf664007f77 a9e17cf664007f77
+203 daef369b637efadd daef369b637efadd 63f7284675ae2ff2 50352b438c815cd4 fa4a8c59d0822006 836e849dc1cc5986 aa0a8e870b446569 aa0a8e870b446569 aa0a8e870b446569
+204 b8caa59c1e11c2dc b0608b7a7b843466 76000a75b582817d 8a3739112d909a79 2c72c590a7a9fe47 7eb5d2fc5f69b562 d83fc01201289c62 d83fc01201289c62 d83fc01201289c62
+205 67610a2075de70c7 72703dd7d7bf9326 73373dc62ac3c0f5 f17c5624176834b0 f1027a4d9df5bf78 695213ff38647117 6c9acd451f772b9c 6c9acd451f772b9c 6c9acd451f772b9c
+206 62197c1b8bc1da7d 62197c1b8bc1da7d 9cd8846926a7f0a5 4b71e82cbb13fe09 cf099727cb6c3206 7eb402734c4bd8f0 cde4f731ab7aa0ae cde4f731ab7aa0ae cde4f731ab7aa0ae
+207 ad54a2543fe54b11 ad54a2543fe54b11 5c9b15efd641b48f 5b884c89be974df6 b13bd819973d8871 96a430d0ca330e1b 41e2669b7320d749 41e2669b7320d749 41e2669b7320d749
+208 da57080531e37144 42e74bffda983696 403356cdb9d57035 70eb0e6db5a78989 79a41e8a0a70f470 c783f2a8e9f88ebe 7c73cd5bfe65dd63 7c73cd5bfe65dd63 7c73cd5bfe65dd63
+209 9c7246a60a593c30 cd13a53244986b07 f02112e8c83d2ae1 aa726604fa2f16d8 8a54c9cfde09351e a67121cfafb38063 c34a152f04c4e1b9 c34a152f04c4e1b9 c34a152f04c4e1b9
+210 ffd11ee9700ff534 ffd11ee9700ff534 3427278c93e8c365 962026ab09708b59 bab5e80a581d18a3 a1f6f1192328e66c aed30489ef381d15 aed30489ef381d15 aed30489ef381d15
+211 ef12fe103521c571 277e565bbd021a56 f4f5eb84d5361d21 0db6bbe465b7cd63 1b6e2d0dbeca7907 3e0abfef13dd1f7b 6f27af5d238a835a 6f27af5d238a835a 6f27af5d238a835a
+212 1170142e01594e24 1170142e01594e24 50b6cf3108db7366 238e274a56ca83ef 29343ff8684364b8 dda5b8447716f323 7a99aefa0f599af5 7a99aefa0f599af5 7a99aefa0f599af5
+213 c890d94aa1b6dca0 c890d94aa1b6dca0 f74d2c841467fe7f fb5e7e35afd3eceb 28d58ee0c974ad16 c77dd7db09f84569 8e8a2a694ff7b56f 8e8a2a694ff7b56f 8e8a2a694ff7b56f
+214 fdc025a449a3bf7e d01f8ce82b00dcae b98b6e570539abd4 69cbc31de4a9576b 5392086bcf4c2dce c1c776188adc2191 09c4cd714df8d5d8 09c4cd714df8d5d8 09c4cd714df8d5d8
+215 b2e6c054bba5433c b2e6c054bba5433c 269b8c1f2bfbc987 8cdae4aa45292ee4 c0500cf296cc5e84 3719b7879de61d95 ac2da8e1230ab0d6 ac2da8e1230ab0d6 ac2da8e1230ab0d6
+216 342da49b9907638d a08c7b2fedaad9db d0474cba60a1b035 5f7e14679c750a0c a899cae7881e2df5 7148d4956e8a4e88 7148d4956e8a4e88 7148d4956e8a4e88 7148d4956e8a4e88
+217 a49708dc0d4affc4 1782847733d8ae2f 32ae145361172bee 1b24c5ad9338b29b e249cf8c1f761024 7af175ca34cb78bb a4a849ba31a9c2a0 a4a849ba31a9c2a0 a4a849ba31a9c2a0
+218 c6f387b45fae7194 eac5730a9d9dc5f2 19074ead6c7d4a3d bbeb821b0d85e3e7 17ccf3d731c01f87 4e2d2ef1698bc6b1 5f2409537654d928 5f2409537654d928 5f2409537654d928
+219 b39202cfbf18025e a2653869b33f12b3 2d415d9094abd5ca f0721c5bf2fd5a5b 2b7c2c9e63434d4f 830328dd875a3ed2 8a9bac03d4e2b4ba 8a9bac03d4e2b4ba 8a9bac03d4e2b4ba
+220 10c5596bfe983505 89a1fdcedf7f4410 21e30bc7208b5bf2 29a47e52a0c403dd 44b48004662c10e0 7b8b1446cb60d3db 68257ca150a39443 68257ca150a39443 68257ca150a39443
+221 66d6d1a85e67df36 6825f4599c18a79e 027e4efe8ec12833 6c9ab1db9eb0ca20 d69c77a15e62b4be da093178bd2ebf92 99e76b8bab0dd291 99e76b8bab0dd291 99e76b8bab0dd291
+222 6402d681886d9b4b 6402d681886d9b4b 0b7b0a0d5e4da047 3c9ef3a136036d53 00f01aebf3327cb3 7d771b0b5fedb462 e1404700bd57bfe7 e1404700bd57bfe7 e1404700bd57bfe7
+223 fde4e17e927632fb fde4e17e927632fb ba4b9bf03990ec7c 6af5bb1f4f2fc105 3eb614e39bb8c065 c45e668c73aec90f 9a7ea91d434a544b 9a7ea91d434a544b 9a7ea91d434a544b
+224 40b33e2ad087a32d 96a37f051213c492 2558974774309c75 f8ddcd49a943c496 eea50762ca7fd4e0 0dbeebe6f1f9cbc1 4c42ccd9de697663 4c42ccd9de697663 4c42ccd9de697663
+225 49ad660d53e15bd4 8adafe6f50ec780c e79f7c28e9729499 1af8c7a4271313e5 38b91805697973a6 cc856a5a2b89f607 845bf31a5a1750ba 845bf31a5a1750ba 845bf31a5a1750ba
+226 29a8456c032c8753 29a8456c032c8753 ac9bd1c6a0b3a30e 9a2e078f5bc5967b b569f4264f0cf1f1 0aae1c6f5b879833 884df39e4bf09783 884df39e4bf09783 884df39e4bf09783
+227 3834d19fb9bdbe66 be796ba101a5ba2e b472de8e6e14086e 81fdd9183eaf8b35 a4b86b0ecd26e917 c093cf1f504d3b5f 4910ec975a8bec9a 4910ec975a8bec9a 4910ec975a8bec9a
+228 1265c1f02208d066 16da5d41aa19edae 2aad44e363af51d6 01a53a2eb8b54cd9 bae568fe71e76125 f99015ac79649fcc d133641d8ebca9e6 d133641d8ebca9e6 d133641d8ebca9e6
+229 593745f9a16aae10 e0d2241c6c603a02 33d99b491542f8ce cc59411857eb42d3 56673958ce85fa48 40ef2138e4bcf508 ef9646f6d5a7e955 ef9646f6d5a7e955 ef9646f6d5a7e955
+230 8a9856d2870b2301 8a9856d2870b2301 ddc18c49b801ad94 b89c354a58b63161 8b85bae79bc8f80b 41a59d9eb3d09ace 1cd8c2b505b307d0 1cd8c2b505b307d0 1cd8c2b505b307d0
+231 77dd8bf23894234d d9bb3770ebb9ffa0 443f9d305b003992 1d20865efe15798c debaeb856156425b 277a2207b20c4991 2416eb6020e0fd85 2416eb6020e0fd85 2416eb6020e0fd85
+232 9f89c9e4fd230074 a00d63858e428299 3b47da8f451c50af d9a9a7e88f9f0625 0b29bd4b4100c1f5 43b1c5f1e58af840 74bc1b7e0c4c6ea0 74bc1b7e0c4c6ea0 74bc1b7e0c4c6ea0
+233 3682fd409281a267 2579020b5b190815 af5977e3a401e26d a21e45ff29a842d2 144756e0ad82d399 fe13d53cd5463cdc a3b8aa964b933ab0 a3b8aa964b933ab0 a3b8aa964b933ab0
+234 30792a4674561601 facca68848b2269a d614d3d2f494ee95 812841e9b195c65d 7787ee53d5555c9f aca56a44a9db5ed5 c56d9f5dadf94be3 c56d9f5dadf94be3 c56d9f5dadf94be3
+235 4bb2ce96fb66fb12 8754be57d9b1a63a 814c88c9c39e062d ca90b3a4bf60f630 2ed3dcd37e9926c2 0b6b5adab2ff4ae8 99ac44a7e0f44a51 99ac44a7e0f44a51 99ac44a7e0f44a51
+236 064e857afed9f11e 6b092137219103e8 80490fb925103b02 704aa1950633a183 7dc8eeb3a96d6d70 40afcd5a03b17c04 5d62e9e1c32f659a 5d62e9e1c32f659a 5d62e9e1c32f659a
+237 f5c5ef0da67edf1a 3d945cc5632e0023 0f02d1cffacd93f0 12be8370f7eac682 efd88c32fc98415b 7a73b67d24a59707 25e32797ed5d010d 25e32797ed5d010d 25e32797ed5d010d
+238 7e374e4eae48cdbe 7e374e4eae48cdbe d0f8468242168af1 9436c831524dee3d f4daf33c3e91cc2a 6a927d9983e1d796 bc9a0d5beda1f4d9 bc9a0d5beda1f4d9 bc9a0d5beda1f4d9
+239 a8867b06b7756046 a8867b06b7756046 f4fe666bfab272ec 2c6d2cbf2efee686 76bc26ff47b319b3 da6c35f6ee7fe5dd 96c81f68ee35a3cb 96c81f68ee35a3cb 96c81f68ee35a3cb
+240 2b2956342005553c 7e528c96d3e12c34 43a5542495dec9fe f34fbe7811b306d3 e219360622c539a2 3a155840e04b599c 987c8aa292dfdb85 987c8aa292dfdb85 987c8aa292dfdb85
+241 2ae3087d38f4e5a6 c5bba1a5f06be9a1 3643525109986f20 04d04910e3431a11 2c7a5c9f385bb83c 80e62fef19b54ec9 b00c6d8b295434e5 b00c6d8b295434e5 b00c6d8b295434e5
+242 b616e60ee24e6383 b616e60ee24e6383 d66a912dfa53ad73 0472da8541286693 5300a1a9604ef788 eba641707da56cc9 e4385de3d7dc4eaa e4385de3d7dc4eaa e4385de3d7dc4eaa
+243 20088cf35a0b70c0 20088cf35a0b70c0 c27206464a4d6d83 a0bc38eebaca00fe cb82badfb482f57a c2abf3bcdaf2020d 7d2d9b00248fc961 7d2d9b00248fc961 7d2d9b00248fc961
+244 1486416a70649f59 b5f17f601aec71e1 4b0edcf3617f5ea3 ce4ca2d6ca40d6e5 b89f160e61db5a5f db0c93931df761d4 94fc17f1a145ecce 94fc17f1a145ecce 94fc17f1a145ecce
+245 9a46cc110d984eef 11f47b5c67ae6c9f c03b3ac09bcbd770 3c830766c18ff8c1 0131d9d70a3ef392 936b68e3afcf55ee 81c13eb97a3d9522 81c13eb97a3d9522 81c13eb97a3d9522
+246 6a66fa9508fb9c3a d732e33fd5835f21 90a74ecb029641dc 58563f4731dc769d 4bbeafc535d5ff9b b2d92caa25998550 112cca2063fc30a4 112cca2063fc30a4 112cca2063fc30a4
+247 5477b81deecf74c6 5398d748e9c22d65 118a1634bd77eb95 4d3c5fac547f9c0e 99504d408b0575a4 9c45ffb275abb992 2eebb0e709c4687d 2eebb0e709c4687d 2eebb0e709c4687d
+248 3e3f51f9f7c94ae7 ff698cf891ad3fab 762f7c7239e41ebd 0c2f07a153d74266 21576c60f4036694 de32ea119f7674b5 3124773144d546f3 3124773144d546f3 3124773144d546f3
+249 7c19d04166d307e8 9ac59c0ff6f15593 817f1dd8dc869751 5e3eccae85b1c08a 9624546a814af692 eda460d987750861 7d18cd8137630ce9 7d18cd8137630ce9 7d18cd8137630ce9
+250 6cde1ebb1d01f1e7 6cde1ebb1d01f1e7 32f4a36f35ae7f79 18702c700c6c26de c2b8b7d487089fe0 63a1d0fd34ba231e d9781888ed5c3dea d9781888ed5c3dea d9781888ed5c3dea
+251 ede9925b1bfbaa64 754e4434b10cbc92 9b0e81dc31af8a4a 7dda914929713ff9 a953fcd1232f0534 77c2107219491c64 b7a5e0006adb3155 b7a5e0006adb3155 b7a5e0006adb3155
+252 affe9da511415983 5cc4a720701d1f08 acafc772402ec610 e4d990db10828514 de2e3ee9070723ab 65162531dd0ef500 a6c7360ab77396e9 a6c7360ab77396e9 a6c7360ab77396e9
+253 ff5dea7018789639 db97c53fbc4b80ef 7b5bfe0ac418579e 035fb19ff02a6e3d 4701fff57e4f30ef 62dfca3016ed9b74 66b0197633e9070c 66b0197633e9070c 66b0197633e9070c
+254 0dbef65468f7a5d7 5fd59737be7db0cd 55ba76391bca5f25 e4a2e7689b709b0d b34c256012ac3b4b c3c67e96b2516258 07c4f7beaf68e0a8 07c4f7beaf68e0a8 07c4f7beaf68e0a8
+255 b1467c823a526015 b1467c823a526015 29ecb4dad3df02aa 0ef289fdbe11cc06 d6092158f4cfa095 066d0f0d1ba29cfc 2a5118defe719804 2a5118defe719804 2a5118defe719804
+256 a30aed9b4b8057fd 8e2c1644ed6cf897 0d334493725c4ffe 157547e5ca973562 dcd87b7a382fb7d3 7e812d0f8c601a6a 27ecb0298d0f354f 27ecb0298d0f354f 27ecb0298d0f354f
+257 ec5edc1271599b25 dd0be315e3cedcbf 9e444d6b24646578 185674fa2d6166cd 1fbc802dcbfb0358 5428121ef27e0ab5 5428121ef27e0ab5 5428121ef27e0ab5 5428121ef27e0ab5
+258 488c9a1e83149f34 9280954b950d3879 13bcc60102e3ec92 28ef8641bdc5cb2d 413cf0305f01881b a46ea488f8e64af4 24641069e48d151e 24641069e48d151e 24641069e48d151e
+259 92c10b16690c4c07 8ea1664929f306a4 872819f275a60dc4 1f307319e4dd0e0f 0059ff84af97475e 308d647954166f4a b0211a129ad559c6 b0211a129ad559c6 b0211a129ad559c6
+260 4a2a8fd865f6fa6f 3ff9fd07a92606ce db75d5bde81f0b5d c2aacf211193bcbd c61f5e4a103b93fe 471f31c66a1aba26 b68fff259924ef28 b68fff259924ef28 b68fff259924ef28
+261 f04d90a029037479 6c15c42a3235cc2f a9e06d34d90ac0fd 2295b46a313b5e77 01ed0055f6ccef12 35e87842ee1b97c1 da4e10e5796c627d da4e10e5796c627d da4e10e5796c627d
+262 c9b7893461995027 aee9dc14ba5bfde1 593649997cd3d5b7 78bf05b628e9dbe4 28d0f7a72a969ece a53770f928b1e730 46976594ec487e49 46976594ec487e49 46976594ec487e49
+263 e1b0246e3b735819 e1b0246e3b735819 b666f8ff92813644 f366882adacae06c 7dff0fad5f79a9a5 8bd007fca8fede18 b1e3c37dbb9f16ae b1e3c37dbb9f16ae b1e3c37dbb9f16ae
+264 576f56e4a0d6d063 41d93656a521de9d 586a22b7eb38df78 017d37087c981869 094958c152667e15 e903cdfa470fd21f 7383b62c1a108151 7383b62c1a108151 7383b62c1a108151
+265 69a2af90f954b5bc 35b85734055a16c3 524b7281048750ac 4bd63b713a55f00b cb3262f65bc46305 389c9fa772c959f9 10b3fe8dedcccd98 10b3fe8dedcccd98 10b3fe8dedcccd98
+266 56cf1423e70513cf 48958dbe69b146a0 0b3b0f1e7d2349c5 5d2762b3194fd92a 579425a8c3e2f16f 8110682584f517dc 7797c593241cb0bb 7797c593241cb0bb 7797c593241cb0bb
+267 b9ea0a3b8781ef3c b9ea0a3b8781ef3c e4b79ddf26c2674b f4184e775d9b127f b7aee3097ca55a25 9fe92a0232075169 f9775f1ee51df8a8 f9775f1ee51df8a8 f9775f1ee51df8a8
+268 8a5b51ffb851ee3b 3c1196654c3a147c 2f885fb5c6f7c160 0cc5c98819c6704d 2ac447406ef613b5 89755a1574eced84 397f3565b21a2ff4 397f3565b21a2ff4 397f3565b21a2ff4
+269 6633d529498a9f10 da3515109423f16a 1c882df627814cc6 24e140b36e7ce3ec 5b240024e37457e5 438dd1f5e7f3202a b51c1c9865ce9ce0 b51c1c9865ce9ce0 b51c1c9865ce9ce0
+270 ed8f62ddcd4b608a ed8f62ddcd4b608a aa8a95ecede39f5d 8cc89d95e3ea954d 027c6a5f77a99e2d b0ca1e294dd0eee7 e98fe921f71f4535 e98fe921f71f4535 e98fe921f71f4535
+271 97db1749f908fc1e a07ef280c37849a2 b207355e312b6c71 d4b68722f8ce9c16 4101de8d577b8ccb edfea5db3d774820 f96e2538d9a75911 f96e2538d9a75911 f96e2538d9a75911
+272 dc0c0f46870ecf84 cfe48ba1009aa79c 4fb5a6c7b2210b31 fafee560bacbfe52 4315d72ad3322551 bc22ef8c60b9ac6e f22bf86b7be8c9cb f22bf86b7be8c9cb f22bf86b7be8c9cb
+273 afa61356f589db45 f40d2476e2d7207e b52933d651f72553 dffb29fc38be0359 925d326271b8054d fdf1e78dd0dea93d 4ef0735eef14bd6b 4ef0735eef14bd6b 4ef0735eef14bd6b
+274 87755335d4f0da12 52ea9ced8f0eb1a6 2af1fe9c9a52563f 74ec74e010aa4a12 a4957e4dc7447422 456d4cf8e9027f14 37625c9340412337 37625c9340412337 37625c9340412337
+275 58a95badfd42ef33 58a95badfd42ef33 a7d77fb52e947b53 2528064b1bed813f f8aff67a89c67bd2 5d68b9d8531ec8f8 e9291324cebb3b9a e9291324cebb3b9a e9291324cebb3b9a
+276 c8cfd3e37e926406 1cd785a50744546a 334d1704fda8067a d45e6f72628f41ee 318c98ccc46b1a8f 52458c3d218f85a8 0d8217de9d1b2ad0 0d8217de9d1b2ad0 0d8217de9d1b2ad0
+277 bf99f09508ad3742 b933c919bfc8ce1d a63ebcbcfe6c4f58 668c3b3bddff3c3d 87e6e60b24370808 0d1ed373822b93fe 69acfdfb06719c73 69acfdfb06719c73 69acfdfb06719c73
+278 5c8c2b38cb1d8ba3 9ac396f35a2ef611 deadc7a5035e5424 72f6bb837fa3c1d5 86a6c126b185d879 caf8743ecec19231 f6273d9dbc04cb15 f6273d9dbc04cb15 f6273d9dbc04cb15
+279 edf050b75e90744a cab6b9da64b89a78 5cafef13c10435c5 b0324ee4fc89c10d fdb2dff8d4734676 f797e46504a9e6da 554860fdc1607c09 554860fdc1607c09 554860fdc1607c09
+280 f4496792bcb6463d bbabded4e0fe26bf 8c10c4b2d5bd36b2 1853bbbacf991a66 9e62558a3740991c 3c6f6c688f6cf612 6eed8cb2b4b6f492 6eed8cb2b4b6f492 6eed8cb2b4b6f492
+281 e4ea69d42a65b74b 8c2ba8c6c056dcbc 8d8a0a5822083fde 98fa79984a6519b5 96bc9b2a5c5421df c5341cc6c29bcc3c 0202c102d5838b9d 0202c102d5838b9d 0202c102d5838b9d
+282 5e95abc8daccc471 a315175591478744 84e8f82f10206472 61bbbd8d80a9095e eb4e4da1950de5d5 197c0db3fd595dea 2424e598aec04421 2424e598aec04421 2424e598aec04421
+283 97c5a319b0e6c368 97c5a319b0e6c368 e775b3ae0146728d 43f51f30c2b15873 2dd50a883fb9a8d1 c6c895394e7a9438 eb4f986c106d731c eb4f986c106d731c eb4f986c106d731c
+284 e2a9f8407fabc152 0c8336b12daa68f7 f83ea3b4f27d4abe 2fdca572b203d3ae a69e8dee36474e7d c1d0c73b70e9c6dc cd898251ec981bc4 cd898251ec981bc4 cd898251ec981bc4
+285 8b0518aba73ad8e4 8b0518aba73ad8e4 4c7a5cdf5b313847 c396438b7d09a841 cdbeaa1ea8e85393 b77072f95370b976 b77072f95370b976 b77072f95370b976 b77072f95370b976
+286 531a968e879e34b1 911c1190dd6ee94a 2d8e73df9b4cf0e7 a2eb1fc0b0cd64e2 a047a85c84398428 fa004879fdbd0e50 519b000cfc43ee65 519b000cfc43ee65 519b000cfc43ee65
+287 b27314bbcbf884cc 1d92b7086b902833 c5cfc24b82be7e79 1c746b6578167357 b98b7eed55986669 b5425fa24edfbb0a cf0ec7cd0219a0d7 cf0ec7cd0219a0d7 cf0ec7cd0219a0d7
+288 fe2db35abe43e34c 2285487f89101546 f0c19c6c8957f2b6 36822178ecb02451 9bd1d96097ff99b5 1316fd1f8419ed70 1397051dc131f492 1397051dc131f492 1397051dc131f492
+289 8317fc02afd7bead 601bc8550c6c9c51 c0eae38b099a11ef 013b13bea0e6f975 8d3b2ec53f373c61 f868d7b7a647e067 9d00c4c0c98ab95a 9d00c4c0c98ab95a 9d00c4c0c98ab95a
+290 db8924efe9a633b3 db8924efe9a633b3 273010e686724377 fc2b00765ecfa477 682a3a85f9c33c92 c14e76ee6a2c2521 dc01f9c673aa23f1 dc01f9c673aa23f1 dc01f9c673aa23f1
+291 8ca9aedb1ca5ad0f 4ec166fb42e01209 93feb7604459103e 40262ce940f690d4 84971da400543b45 cd61e0418e009b89 90cfa433559456e6 90cfa433559456e6 90cfa433559456e6
+292 11d09e771388e961 11d09e771388e961 2f5210d5bd0d9a60 57e8024ceac447ce 107dd0d8d006c68a 7fdef2ee56a96262 03b06e38b3e03615 03b06e38b3e03615 03b06e38b3e03615
+293 8dad321b996c268e f2ee7888a72975ae 0b8154c7e8f927af bfb71311abcde452 5bab6d247e87e3be cf1f4e0631b5d295 7cc36bfaa036ee75 7cc36bfaa036ee75 7cc36bfaa036ee75
+294 bbf1e806e427a974 f0894004166e9885 35b78e6eb8087baa 332ffe370cbfa341 10c35a54e7352d0d e363ba0f70308a1a a2504e6b4a2c0c4e a2504e6b4a2c0c4e a2504e6b4a2c0c4e
+295 6a8d5d6cc118f2c9 3e41b4a4982d00b4 27f41c9fc97a1f9e ab714ae69932a812 6c0c46fb504289b0 354c23d9559f0483 26af905a411babbb 26af905a411babbb 26af905a411babbb
+296 9c6e2ecb30d368d4 dc8a96dc56bdd65c edaf6e7d09b65a6e 1f3ab1bd01a4a9b7 3e2e42d06d7d4d12 f49ce151b26d11fc 3dbc4c19a6aabd44 3dbc4c19a6aabd44 3dbc4c19a6aabd44
+297 c248ddfb4d252b3b 7dcbe3b6c88c7617 4a66afeee4b7f57f 00501854436589d5 8a0a2af2c51432f8 33d4b7a742d9d198 fe16c4dc0e140885 fe16c4dc0e140885 fe16c4dc0e140885
+298 c45db361cc19b2fe c45db361cc19b2fe 0c27f890cecf1a83 33d8a8a5e033422a 908b8c88faac1b86 d49566a2009af590 e56090b31a3b7a9c e56090b31a3b7a9c e56090b31a3b7a9c
+299 38cb89972500c15a 38cb89972500c15a 567a985e37b7097a 707553dbc0b6cc97 a8f774fdef07e64a ef967f2c6db5a911 ba31bba06f2e31c9 ba31bba06f2e31c9 ba31bba06f2e31c9
+300 8b6e8926a41fef60 3a5d898167ac1c00 66051c5453bdcd05 5de61481c5b0aa13 28a55b6bc15cf404 1ed357e97bbf363e 1ed357e97bbf363e 1ed357e97bbf363e 1ed357e97bbf363e
+301 b55bda2672d05ff4 a374fbb7f63358db 26a6587b7e2de201 82e7ff2cc33bf53a 35e12cffc6e43336 d968eb852b0eb84b 27d190e92d573c77 27d190e92d573c77 27d190e92d573c77
+302 85c3e2ac6a96893a 85c3e2ac6a96893a e5d2036c8ba94d93 ce387f1db6317d03 c22a2600e29f4f7f 904d90c5a6af303e bf11d52ddc2853df bf11d52ddc2853df bf11d52ddc2853df
+303 ef95343efdd476bc f504e5ba82ddb1b3 7b360ff65fa63679 0cbcd2b184a2b29c 7cdb1bade169d78f 39d6312a665f2fae 9ea76bad1466bf45 9ea76bad1466bf45 9ea76bad1466bf45
+304 02fc9fbf5dc79b32 02fc9fbf5dc79b32 9397ebcdd7590478 7dafabd228aede75 f1a761a6d1a0138a 8d07dbe2fba1223d b76429782ecf822b b76429782ecf822b b76429782ecf822b
+305 bb326a2cf085fd38 7e64de37b0bedb9f 62da2d5e95e9f154 8f75d6c7d46ffdd4 65d43504c94bb13a 016e4375764f1154 969c08fcf9a5d1b4 969c08fcf9a5d1b4 969c08fcf9a5d1b4
+306 e07c3f6a76d83493 e07c3f6a76d83493 c5ab95f65676bd19 27e5b3b0f8261a6f 5f859062b34f9023 d9bf4760b1fdd7ea e170a7180a1ff2ec e170a7180a1ff2ec e170a7180a1ff2ec
+307 1b146fd09d5a2156 1b146fd09d5a2156 aadbab78831f51f4 25c9edd508e1d447 fb857c5e02e1cfa1 3038ad7b71685c93 84f663336d5a75c9 84f663336d5a75c9 84f663336d5a75c9
+308 10f838c4f9792c90 0598e0de9eb64c86 ee8b75d1c151defd f39a66dfdaf46196 7dd56363cf08f94a 0fe1092934036eca edd5be780e3d39b9 edd5be780e3d39b9 edd5be780e3d39b9
+309 7dffe342a9cfe298 7151debb7c261d42 e58b891fdccaced0 7852bfa57e30633b c1dd80e3e08be23d 79bf631d926e8f5a 79bf631d926e8f5a 79bf631d926e8f5a 79bf631d926e8f5a
+310 9aeb5299aeb20869 64d8b54f068de899 b30a22cfc4d173df 34a0ea65882e6776 0fc60eb20339afad 573c5b36efb6cbd0 07a6a0f4d517a6a3 07a6a0f4d517a6a3 07a6a0f4d517a6a3
+311 afa2721185a2b3be d9ba0f150b762388 e9b35a88269fe333 a6a9bbd84fffcf32 56ddb99a439e486c 51e4e7cdfc7d4d48 51e4e7cdfc7d4d48 51e4e7cdfc7d4d48 51e4e7cdfc7d4d48
+312 dce4a4af2722f901 20210e8ff7cfb665 5bac6e2143068ade b9e24867ed562da8 b2a7786df0f0d168 437bb9032b126c90 437bb9032b126c90 437bb9032b126c90 437bb9032b126c90
+313 bf7eb744a1a0e569 bf7eb744a1a0e569 50e549bdcbe018b8 b6723d2177ce750e 4d3f5160fd0cecce 663b94094ed1da99 663b94094ed1da99 663b94094ed1da99 663b94094ed1da99
+314 dd950f8e9128c34e dd950f8e9128c34e 862644c56d350c99 7832e2a29ee6c435 077b3956aa5000df e106cbbefe8bef40 88ddd49bb705bf66 88ddd49bb705bf66 88ddd49bb705bf66
+315 15bf2bdfc56f0b86 5867843102717a3a 064ebbf4c5579e56 e4b8d56ea63f4106 6d9e9a4b9bde1f7c 8d21a1b8b794a31c 3981f10c25a12a4a 3981f10c25a12a4a 3981f10c25a12a4a
+316 4c954aa4453fc268 0ae1ccb82cb85033 6aa4c9606caaf0d4 c144f99117b58848 d2e450160b3e4884 9615c6374371ed29 9615c6374371ed29 9615c6374371ed29 9615c6374371ed29
+317 3e475e4f49172852 5fbdf56cef5d2ad5 da98e626c913f93b 03234f0833bbf415 69f5248b4df3e8a1 7396d39c8834f44d e1a6bd64024cef4d e1a6bd64024cef4d e1a6bd64024cef4d
+318 5c6c72427b83bd71 5c6c72427b83bd71 6012446c3074e237 71107e4c5709fcf1 4e1be8b13143edd9 5cc03ce8e9eb6d2f 40754138ee2488db 40754138ee2488db 40754138ee2488db
+319 d069a7d0a9ea45f6 638bc8328cb4a695 d90559c3315ecaa8 81cd7bf2a6fd9bb9 c6b9a29b7af4d400 0574c98e2f7cca08 0574c98e2f7cca08 0574c98e2f7cca08 0574c98e2f7cca08
+320 559892a150b9b1eb 6e14c6cffae55819 249936614b127d5a bf62feccf9439760 da586e33312cab8a 1e577297dcb1bb29 ed5b83ae4cd5ba41 ed5b83ae4cd5ba41 ed5b83ae4cd5ba41
+321 34f0e54e86471467 507709fe765f4072 3ed9cd88271fc193 e76264a6ddb7ccbd c9decbbd319c4e30 0b315395f067fffc 0b315395f067fffc 0b315395f067fffc 0b315395f067fffc
+322 8dc088140b69770a c940ec07cdd9e214 02cc8cea870dcea1 f33d7cbd41bbe19d 6a3d3e8b85a3ff63 d2b7a4712f4bdb1a c0e828a3d5ce7c23 c0e828a3d5ce7c23 c0e828a3d5ce7c23
+323 ceb7f545cc7d419b ceb7f545cc7d419b 63854339bbd2fdd4 c0cb1c3336e41ba8 b41fa7995e400a8d 16d3fa644ea032ea 1ec0739c6a7bf404 1ec0739c6a7bf404 1ec0739c6a7bf404
+324 72437e4877522284 72437e4877522284 fdb7b905df2385d7 a229c7736d8ad9b4 d989897f0daeb5be 7e04621dd19223d6 e3504c0438d55172 e3504c0438d55172 e3504c0438d55172
+325 f7cc1ab6cf6bc3c1 f7cc1ab6cf6bc3c1 bd02b87f1c1705c2 06aaa02f0bd7bfc8 a224f4e4f863f7d3 44560e25327b7b6d 626e730211e1c487 626e730211e1c487 626e730211e1c487
+326 f6ee8ad84e3d0bde f6ee8ad84e3d0bde a5df341b3cd25769 aa6e18e17a844ab0 53ee257d21589b99 17883b10bc43cdda 17883b10bc43cdda 17883b10bc43cdda 17883b10bc43cdda
+327 f84b29562d2e27b4 f84b29562d2e27b4 24c400fb2a155d9e ae08c2393642f6d4 e7b6fbd635ef9ba7 ea28196d6ada0606 2e71ca144ae1f5f8 2e71ca144ae1f5f8 2e71ca144ae1f5f8
+328 540f5cbb746bd682 540f5cbb746bd682 ad7827aab211dd00 321f132e544a9ebd 8e5d53ca2cf74f70 9f7f5a8fafba14c8 9f7f5a8fafba14c8 9f7f5a8fafba14c8 9f7f5a8fafba14c8
+329 c39c87527a2b1ea5 c39c87527a2b1ea5 1703bae24290b808 ceb813ccb838b526 d43c8b23ae66118a 70b2c4e346fd5cc5 70b2c4e346fd5cc5 70b2c4e346fd5cc5 70b2c4e346fd5cc5
+330 5ef8a0dfd2c3f771 85c5467be03251c5 e9ed2c5e13d24a4a 0ba30a18bd82ed3c 76a2abddd1746f8b d7107705c51cdfb6 d7107705c51cdfb6 d7107705c51cdfb6 d7107705c51cdfb6
+331 e5bbe05f71764c10 ce48caf55d5207e3 3872518a9bfb01b5 ba950d3c8940682e a5568582a700dd77 abd76373d1a620fc feefad711660d3fa feefad711660d3fa feefad711660d3fa
+332 c791b275980fba2c c791b275980fba2c 8c6c25c127cbc1ce ce5e0baa8771385c d5a7d4e3bde6415c 9943f29f353eddea 9943f29f353eddea 9943f29f353eddea 9943f29f353eddea
+333 49c1630bd96d6990 922e2f5eb2a4a4b5 08273a2d362eabda 509e58b031a3f486 fded67f7217c7710 d9795cbe0991be91 d9795cbe0991be91 d9795cbe0991be91 d9795cbe0991be91
+334 f846c4884fb90afc 389be7e1c36efec5 b81945f31312ce69 ed572e2e456774d8 4e65a39a3564d6ba da92e6347c3fbb58 da92e6347c3fbb58 da92e6347c3fbb58 da92e6347c3fbb58
+335 ed73ef8d993d1319 ed73ef8d993d1319 6718ecefd60cc08e d4f92ce4e04051a4 0126151357ec9fae 202a712483c5b861 c79078d4f0e1ed6b c79078d4f0e1ed6b c79078d4f0e1ed6b
+336 f0fa1a4daef95df2 f0fa1a4daef95df2 a240253ae4e05db2 400e037c4ab0fac4 2757d82a7fff06e2 d2cf01d6349375d6 d2cf01d6349375d6 d2cf01d6349375d6 d2cf01d6349375d6
+337 be4cf9f0067d4122 be4cf9f0067d4122 4655ed9e66038d15 8224528fc8f60014 51a70cf5e7c9d2b8 54e353138d5b5757 54e353138d5b5757 54e353138d5b5757 54e353138d5b5757
+338 9302c58bd250cb1b 9302c58bd250cb1b 682aadaf84fd1949 afda9bc1b3c224a7 181ed939a46980fe 8f2150f94a74e936 67268c0f9dc60e2b 67268c0f9dc60e2b 67268c0f9dc60e2b
+339 d114a61d3b0944c9 d114a61d3b0944c9 492f1e615ec343d7 6234f15309665aa1 9c0b4b01c7f5507e d034e4164d1fc72f d034e4164d1fc72f d034e4164d1fc72f d034e4164d1fc72f
+340 042c72cfd618e732 042c72cfd618e732 feeae8b426dd0597 523a9b3d40fb89a6 01aa9160d786e01d d8ff9ec50c360db4 d8ff9ec50c360db4 d8ff9ec50c360db4 d8ff9ec50c360db4
+341 36b9747f356ecf5a 7d418d475d97b1e1 4b60ee4f21d8ca5c 9e1cea55e2b4d2ae 9087b59344d37697 d2152e31048c938d ab74449aefde3cd9 ab74449aefde3cd9 ab74449aefde3cd9
+342 30cc109fa0df237a 9c95e98104bcc512 51fabb26b16d832d 40f88106d6109deb d536adb60feae510 ec50f5d779cfdbff ec50f5d779cfdbff ec50f5d779cfdbff ec50f5d779cfdbff
+343 3b29629bb87e5ef8 3b29629bb87e5ef8 8af000783f23b5c3 534ba956c58bb8ed de80c5938704ccff e3490945e1128e8d e3490945e1128e8d e3490945e1128e8d e3490945e1128e8d
+344 1d5d70187c236556 1d5d70187c236556 43122139a9b23c63 c065374b2416cdd7 478fca3946e711fa 65854870b56a2ffb 65854870b56a2ffb 65854870b56a2ffb 65854870b56a2ffb
+345 f4845ee31c507426 5e2529f1503ec32a 5e2529f1503ec32a 879e80dfaa96ce04 0d9a927e63e21450 9f7973462b5a55cc 50e597409ec1e076 50e597409ec1e076 50e597409ec1e076
+346 b864b9130f177ba7 bdec2193ae074ea4 0dc7906958246ce0 5fdf41db26dce60d b62de23f9f199356 f1e9e6197f7342f5 2598b086e15585c5 2598b086e15585c5 2598b086e15585c5
+347 5121c5e2460e6330 5121c5e2460e6330 f42957ce716cab6d 2d92fee08bc4a643 9900cba7a9eb29a4 df8cf02be5d35dae df8cf02be5d35dae df8cf02be5d35dae df8cf02be5d35dae
+348 490ee2c8042bfc11 490ee2c8042bfc11 73a32b8e87f0afe1 91ed0dc829a00897 34055f5488295e63 224dd0a85de04189 224dd0a85de04189 224dd0a85de04189 224dd0a85de04189
+349 9f5ea58c38fc1297 9f5ea58c38fc1297 156db557ac05b98c ccd61c7956adb4a2 807bfa317951b3b9 20de0d9f9469895d 20de0d9f9469895d 20de0d9f9469895d 20de0d9f9469895d
+350 7c00fc2fd534da1b 7c00fc2fd534da1b be48db9eee115dc1 0a511b0a289e5f9c 831d6d5979983977 779313e9d606df21 779313e9d606df21 779313e9d606df21 779313e9d606df21
+351 14fa899ea020b33f 14fa899ea020b33f b5489a8090883978 26b15fbac15c3c42 92080b1f86c684e8 101e94f8c1b1d54a 6c595abc8fa024da 6c595abc8fa024da 6c595abc8fa024da
+352 81a7a26b754924b0 81a7a26b754924b0 060ff53360ee0460 fee36e636955f2e1 1e3191ceaa02499d bedb8d720fb35455 287527670dfeafc1 287527670dfeafc1 287527670dfeafc1
+353 e364517b3fcb19cd e364517b3fcb19cd 125a4ebba03ce200 cbe1e7955a94ef2e c4f3a00f6a33c53e 9f32079a672c4da4 ba23506f09726947 ba23506f09726947 ba23506f09726947
+354 2adc69c69b655803 2adc69c69b655803 5fab5d73103dfe41 bde57b35be6d5937 4e1d492283cd59ce c1c71c10f83b0054 c1c71c10f83b0054 c1c71c10f83b0054 c1c71c10f83b0054
+355 d7443ceeeb3374be ebaa37ebf3735717 f7bf543b74e6bd02 aeb4aadf18aaf2be c679cb11282cd327 cb61aac82faac9c2 cb61aac82faac9c2 cb61aac82faac9c2 cb61aac82faac9c2
+356 52900e452fe25f97 549bdbe761ba6612 e3458ad6f5f21d72 78be427b47a3f748 c1be0632b433c1bc d57bbd95d9f73526 28d5e7754226d577 28d5e7754226d577 28d5e7754226d577
+357 ed8ab06d0a455574 ed8ab06d0a455574 66e5d35381b7cf38 553104c130be5f69 1cfdf2e0ae0b0871 5ccb81ca458039fd 15bad4743e526854 15bad4743e526854 15bad4743e526854
+358 f37efcdede11a039 f37efcdede11a039 ceee69df8c3daac9 4d85cddb31a24c8b 4d724c7f0a985546 e2bbe8ad33dd8134 a501a857695473e6 a501a857695473e6 a501a857695473e6
+359 1fb32de234c12d38 1fb32de234c12d38 39593764cd1b22b1 e0e29e4a37b32f9f 5d48f5ef5cd8bc5f 98d7af82b9e60b7d 98d7af82b9e60b7d 98d7af82b9e60b7d 98d7af82b9e60b7d
+360 5fad7b91075fe184 5fad7b91075fe184 e778afb991568389 c31b3e9e37d8350b 3a4ff07e74882d42 5aa8df542be5cb58 5aa8df542be5cb58 5aa8df542be5cb58 5aa8df542be5cb58
+361 a8aad08bc01b19f5 a8aad08bc01b19f5 8d0bfd3b8b6b26db 8da17db666a4fd63 9686a51e27e0d60a b895271573814c58 b895271573814c58 b895271573814c58 b895271573814c58
+362 bbe57fcb0db4bd73 bbe57fcb0db4bd73 bbe57fcb0db4bd73 59ab598da3e41a05 fa1ab18db2f092fa 468f7b2bba4b3d13 bfc01bd65fde5b62 bfc01bd65fde5b62 bfc01bd65fde5b62
+363 f226ec34dda20034 876a753cadb7ea4d 30fe277bc839bdbb e9458e553291b095 77faee5d4c239edd 46a2ee41278ab481 46a2ee41278ab481 46a2ee41278ab481 46a2ee41278ab481
+364 7cdf7b8f1e850b89 7cdf7b8f1e850b89 ed37276a18a8fbbe 0f79012cb6f85cc8 8602a111a8b0a4cd 6689dce296fafac4 6689dce296fafac4 6689dce296fafac4 6689dce296fafac4
+365 8c3179fdcc404da2 8c3179fdcc404da2 1c7b770f5f7311f1 2682a2de9de50d43 7709f01ac28c0ec3 88dab3d418bd545f f6795af2e2c2d358 f6795af2e2c2d358 f6795af2e2c2d358
+366 7f1565cb22798514 7f1565cb22798514 c5998fc8132784d3 10979bd7d4033773 3e22d7e152886997 b1eb4f509e51a273 edb9d706ceaa5ccf edb9d706ceaa5ccf edb9d706ceaa5ccf
+367 e7938fb7585a6df1 e7938fb7585a6df1 64e2bdf4b6e686d1 bd5914da4c4e8bff 1df501e6366e823a 54b448677ae18692 54b448677ae18692 54b448677ae18692 54b448677ae18692
+368 2df87a3c4deda3dd 2df87a3c4deda3dd 552d5f1688cc37e4 30eea75cf2cacc14 557eefb396d474e7 d70a7aa745ad4f4d d70a7aa745ad4f4d d70a7aa745ad4f4d d70a7aa745ad4f4d
+369 ce3dfe0fc32f1f12 ce3dfe0fc32f1f12 566ca05151c3c709 8fd7097fab6bca27 73d723e215ae6eff 73b1f9e79e403ef7 73b1f9e79e403ef7 73b1f9e79e403ef7 73b1f9e79e403ef7
+370 fbc2c55dfb73f16f 4839356d2735142a 08fd51cc203fd4d8 327242d0db76ccaa 2e86c2296a615c8f 8f61a65ebbf6a10e 8f61a65ebbf6a10e 8f61a65ebbf6a10e 8f61a65ebbf6a10e
+371 7d4c933219449880 7d4c933219449880 c97277bc76509514 10c9de928cf8983a 1d3266dca73e8bd6 87171238bcdb3696 87171238bcdb3696 87171238bcdb3696 87171238bcdb3696
+372 d8053881bc9584e7 d8053881bc9584e7 9d8657ec7afc2a59 8a8c9edbec21b552 aa68328910eb0e3e 46d7b1075273cce9 46d7b1075273cce9 46d7b1075273cce9 46d7b1075273cce9
+373 9cf9d7a3e5a57d32 9cf9d7a3e5a57d32 35edc03479fce84b ec56691a8354e565 8f7e61c8148643b9 4b0275130ede8187 4b0275130ede8187 4b0275130ede8187 4b0275130ede8187
+374 5b28acc9bf477439 5b28acc9bf477439 7f5504d9bc843dc9 2aeda8693f14d6f4 9cacee2db83cce90 8bc470a28f333cc7 8bc470a28f333cc7 8bc470a28f333cc7 8bc470a28f333cc7
+375 87085148b0e90b49 87085148b0e90b49 6988cb3d98d13aa5 b03362136279378b dce95149fe499331 4ad4467f3d93c51d 4ad4467f3d93c51d 4ad4467f3d93c51d 4ad4467f3d93c51d
+376 e705bb6067bedead e705bb6067bedead 581552c280c08a56 ba5b74842e902d20 04beb7dfe6eca30d 2c9c3a6f503e3070 2c9c3a6f503e3070 2c9c3a6f503e3070 2c9c3a6f503e3070
+377 bc1fd9b90cb5e4e0 bc1fd9b90cb5e4e0 64e3d353d4cf6d77 bd587a7d2e676059 c9b3dd35dd13cbe5 9cd1c0799ca47056 9cd1c0799ca47056 9cd1c0799ca47056 9cd1c0799ca47056
+378 ab250c98f3cfbe10 535d2dcd4aa9ff67 c2f3bcd350fadf0b 20bd9a95feaa787d 3ed1763294fdbc50 eac8313c4b75f174 eac8313c4b75f174 eac8313c4b75f174 eac8313c4b75f174
+379 b9020da951a4b45d b9020da951a4b45d 2b9216fecd610109 f229bfd037c90c27 a4f5da6ca5620167 5580d1d4dfbe783c 0a2090a9c3b4eb83 0a2090a9c3b4eb83 0a2090a9c3b4eb83
+380 8844c17c08caa721 1802110804aa0814 b7e7b74c7156b92d 690b725f3601a735 2a2c90d384bdb4be ce3b4cd005c7bdd6 ce3b4cd005c7bdd6 ce3b4cd005c7bdd6 ce3b4cd005c7bdd6
+381 3a52c34c08ceacdc 3a52c34c08ceacdc 1bc210942ff5f156 c279b9bad55dfc78 29aa69dcf1a6a23c 2b5068abf74820de 2b5068abf74820de 2b5068abf74820de 2b5068abf74820de
+382 77500fd5974f9ebc 77500fd5974f9ebc 8dba2c96a99e3e01 23b662ede19f490a a28e437d4f18e5ba 9683fafb0b1412f8 9683fafb0b1412f8 9683fafb0b1412f8 9683fafb0b1412f8
+383 c2fb5218210617ed c2fb5218210617ed 690c62ddccb4d4b7 ca2932aa5d420a8e 6fca1c683f09aff9 6066e4cfe37237b9 6066e4cfe37237b9 6066e4cfe37237b9 6066e4cfe37237b9
+384 6c25b9f94aa627cf 6c25b9f94aa627cf f8b9cec9a17ec9d0 1af7e88f0f2e6ea6 775617811996f120 6f4815fb7fc3c04e 6f4815fb7fc3c04e 6f4815fb7fc3c04e 6f4815fb7fc3c04e
+385 dc53e92e00de80bd f9e97c62b5006e6e bf9baedad69eb681 662007f42c36bbaf 1984918815288c84 babd51885768a587 5f56a9bc7906c10c 5f56a9bc7906c10c 5f56a9bc7906c10c
+386 83298ff2336e471a 27b45d6fe38f3e0a 5a0a3167f340d2a6 4b080b47943dcc60 55f73f6b26d7e3d6 99c4181a371d80a6 99c4181a371d80a6 99c4181a371d80a6 99c4181a371d80a6
+387 c2448fbb286342b2 c2448fbb286342b2 0901e9c4587fe149 d0ba40eaa2d7ec67 5da84a788e766c4f db471714a7ce104f db471714a7ce104f db471714a7ce104f db471714a7ce104f
+388 0c117abf4ce8a18a 0c117abf4ce8a18a 30e9aad7b75e086c 03dcc34af479f7e2 0b4ccaa0695dc717 7f1d2dfc1ff519c6 7f1d2dfc1ff519c6 7f1d2dfc1ff519c6 7f1d2dfc1ff519c6
+389 4022659bca6f71e1 4022659bca6f71e1 14b65a1f59c1f8cb a7cdead1eff1071b 96557af854315b0b ceab1514b89c81fb eb5f83ffc66779e2 eb5f83ffc66779e2 eb5f83ffc66779e2
+390 ef1b92d3461af263 ef1b92d3461af263 ef1b92d3461af263 0d55b495e84a5515 21eb2131bc73e5dd 1a1ea148d393ed98 1a1ea148d393ed98 1a1ea148d393ed98 1a1ea148d393ed98
+391 9a51bfc2d82bb226 9a51bfc2d82bb226 aa4370038eb3f614 ff8807fc9f307e9d 4bb3f554e0e0d5a3 abe7ad8c39c4cfde abe7ad8c39c4cfde abe7ad8c39c4cfde abe7ad8c39c4cfde
+392 d92652cc446ed27c d92652cc446ed27c 9cdf676eb7fdf901 13bbb77e574d2de7 7c2f1144853fbbdb 2bd2335f8e87e427 2bd2335f8e87e427 2bd2335f8e87e427 2bd2335f8e87e427
+393 065561389c289863 f7084f22a3039a49 82344e66c324f94b 5b8fe748398cf465 cfa1b5c0f70a68ac 1312ac996bc08ec8 1312ac996bc08ec8 1312ac996bc08ec8 1312ac996bc08ec8
+394 dc728cc888e195db dc728cc888e195db 806313ea8414db32 1b98db4736453108 398cfddf902cee43 9cbf79ade1f247a5 9cbf79ade1f247a5 9cbf79ade1f247a5 9cbf79ade1f247a5
+395 00d6c2fcaac1d161 00d6c2fcaac1d161 66c81dc0eeb6d221 bf73b4ee141edf0f 594234c91e330ff0 1787301d39c65c37 1787301d39c65c37 1787301d39c65c37 1787301d39c65c37
+396 856c0fe6c56b7a08 856c0fe6c56b7a08 12350328aea98595 f07b256e00f922e3 20c53e5803667f24 31a2d4f651ee7ef0 31a2d4f651ee7ef0 31a2d4f651ee7ef0 31a2d4f651ee7ef0
+397 f0798e973cce7f6b f0798e973cce7f6b 7f54b7dbaf7feae3 8b11e4f8aa6c77bb 68d0900f975ed2fd ebc1a61da1b3c4eb ebc1a61da1b3c4eb ebc1a61da1b3c4eb ebc1a61da1b3c4eb
+398 832a19aaaf6d96c8 b271316c7a6b96bd b271316c7a6b96bd 503f172ad43b31cb f1c7200c9f25726e 77199afbecf00dff 77199afbecf00dff 77199afbecf00dff 77199afbecf00dff
+399 d7732eaf05013f3a d7732eaf05013f3a 3a3c2825d68e5a0e d1ad232aaba3d641 b7a5ad107f89c2eb 28483ad34206ec60 28483ad34206ec60 28483ad34206ec60 28483ad34206ec60
+400 02c650d81fe19dc9 02c650d81fe19dc9 4981bd11d2aed50d af8a006db1c5d767 eb3376ae09799944 e1f6ea411ec108f7 e1f6ea411ec108f7 e1f6ea411ec108f7 e1f6ea411ec108f7
+401 55be43b771a3b004 55be43b771a3b004 9b659bd8e174e833 a8b14c4a507d7862 8eedd67eec5cd1de 30fa20ba10125c95 7f4f6c23dc810661 7f4f6c23dc810661 7f4f6c23dc810661
+402 21117dde2a450b47 21117dde2a450b47 f8d9e964c1bbd903 1a97cf226feb7e75 c2c9c34dbc515eb5 e6943f22fee75dea e6943f22fee75dea e6943f22fee75dea e6943f22fee75dea
+403 d0a25276c97bcba6 d0a25276c97bcba6 ad6471e0d1346ce1 74dfd8ce2b9c61cf 55be0da786425362 eb525089a087e327 eb525089a087e327 eb525089a087e327 eb525089a087e327
+404 515c5a494ab90119 515c5a494ab90119 3826157c4f1df014 da68333ae14d5762 c6d10574f741e846 132178a33799628d effc7511d8225c30 effc7511d8225c30 effc7511d8225c30
+405 9ffaf38bd61716ec 9ffaf38bd61716ec 14a0164607bc1e3b beef1d7f6a37bcbd 70878584cdede4a5 5610c2edbdafa36c 5610c2edbdafa36c 5610c2edbdafa36c 5610c2edbdafa36c
+406 4614ad6882227e17 4614ad6882227e17 4614ad6882227e17 a45a8b2e2c72d961 b5185dc9399af9a3 f1d0b95841510585 f1d0b95841510585 f1d0b95841510585 f1d0b95841510585
+407 5bc5db60a4863add 5bc5db60a4863add c18448ffe76a0386 183fe1d11dc20ea8 45c292e5f7addb8d 27d5947c5ded6b24 27d5947c5ded6b24 27d5947c5ded6b24 27d5947c5ded6b24
+408 ae30751e9cc88380 ae30751e9cc88380 a21629366cd86b6c 40580f70c288cc1a d88830ef9fa837d8 2e1413fd1b1b04b9 2e1413fd1b1b04b9 2e1413fd1b1b04b9 2e1413fd1b1b04b9
+409 7eb0549b98bd7170 7eb0549b98bd7170 d6e772ab83fa0ed2 4404ea7ba28c5e06 6ca918f22155b9ce 8aaedbffe8946078 8aaedbffe8946078 8aaedbffe8946078 8aaedbffe8946078
+410 16e2829f4a634c32 16e2829f4a634c32 675823d4b27130ee ce967e25f0e7136d 7a9597f039027227 f932971f059ec61b f932971f059ec61b f932971f059ec61b f932971f059ec61b
+411 588e61c0d7877f2c 588e61c0d7877f2c 588e61c0d7877f2c 8135c8ee2d2f7202 0ae7c6dadfc18937 45015d76143749b8 45015d76143749b8 45015d76143749b8 45015d76143749b8
+412 03c651550d2e9ec7 baa8cb8c7ec9e941 04a94135c941ec90 e6e7677367114be6 6298ce2406af726b 83ff607bb79e85b6 4fef4283bab059e5 4fef4283bab059e5 4fef4283bab059e5
+413 e6e9f5df7de6b55c e6e9f5df7de6b55c 255fe34ae690ab49 fce44a641c38a667 4a496fed5eaba599 5e86cb5e762af324 5e86cb5e762af324 5e86cb5e762af324 5e86cb5e762af324
+414 14d59c6775c8494a 14d59c6775c8494a cf00dd51658a38e5 8664f273e8cce99a b9840e7df22bf235 9feaf00f9f99a0d1 9feaf00f9f99a0d1 9feaf00f9f99a0d1 9feaf00f9f99a0d1
+415 76af74093b49f13b 9bc9ab7657284e2b 9aea2a968e353b61 99749e64ff34ced1 7a91f786abcf8da6 600a3210a4ccfa6b 600a3210a4ccfa6b 600a3210a4ccfa6b 600a3210a4ccfa6b
+416 ab680113897ca0b4 ab680113897ca0b4 ab680113897ca0b4 49262755272c07c2 36d5ecce1bfceb06 4d51620dec91ecfa 4d51620dec91ecfa 4d51620dec91ecfa 4d51620dec91ecfa
+417 de111626bf809f54 de111626bf809f54 de111626bf809f54 07aabf084528927a ed51bf7bd4eb8d40 c30bde962a430ec7 e93284feeb87a4c7 e93284feeb87a4c7 e93284feeb87a4c7
+418 a037db325ad52817 a037db325ad52817 38d12a7e2dc6c0d7 6ea7272f75dca2a6 d8f3f793514caea9 60d366ae7ea6e41b 60d366ae7ea6e41b 60d366ae7ea6e41b 60d366ae7ea6e41b
+419 34ad918d9624122c 34ad918d9624122c 34ad918d9624122c ed1638a36c8c1f02 9e30c04af00a1fb2 56fdce663c7f3b3f 56fdce663c7f3b3f 56fdce663c7f3b3f 56fdce663c7f3b3f
+420 c992fdd72ddc3326 c992fdd72ddc3326 8fdae14b43016bd0 a349df2b44a2ee8d 14eb064234bc4b18 c01e6ea444a9d485 c01e6ea444a9d485 c01e6ea444a9d485 c01e6ea444a9d485
+421 eee05d0e56eb6d43 eee05d0e56eb6d43 18efbc6021d87128 e4ea0566421fe69e 97a7f9630419b69f ec45eb62996544e3 ec45eb62996544e3 ec45eb62996544e3 ec45eb62996544e3
+422 5c6508839fb95126 5c6508839fb95126 84f82b4026a46cb0 a7d0dfed494fd1ac cc5b3d3d9babec10 08a018cdc1eb24e0 08a018cdc1eb24e0 08a018cdc1eb24e0 08a018cdc1eb24e0
+423 e0971c842ee1365c e0971c842ee1365c 37b3bc82a9014173 ee0815ac53a94c5d bee917b06f9f7c9d e7363bf08a6d77cf e7363bf08a6d77cf e7363bf08a6d77cf e7363bf08a6d77cf
+424 9a5b8acb8bc00b11 9a5b8acb8bc00b11 9a5b8acb8bc00b11 7815ac8d2590ac67 e95c7483e34a04f3 f051bc74264feb4c f051bc74264feb4c f051bc74264feb4c f051bc74264feb4c
+425 7252660ac91e815a 7252660ac91e815a 7252660ac91e815a abe9cf2433b68c74 d1ba274596e630c2 2b990b2511966d9e 2b990b2511966d9e 2b990b2511966d9e 2b990b2511966d9e
+426 4c7bb6bdfe33a4db 4c7bb6bdfe33a4db 4c7bb6bdfe33a4db ae3590fb506303ad 753ebe91d71f98c6 a37f7ef19625ff54 a74ba28798ca913b a74ba28798ca913b a74ba28798ca913b
+427 efae1f2b36b766ac efae1f2b36b766ac efae1f2b36b766ac 3615b605cc1f6b82 c165cb5ef94d59d9 3e6869cc9ed56aa8 3e6869cc9ed56aa8 3e6869cc9ed56aa8 3e6869cc9ed56aa8
+428 c2a94ea5e5698d3b c2a94ea5e5698d3b c2a94ea5e5698d3b 20e768e34b392a4d 3fb3a11f4da7b17d 69faf9870370b13d 69faf9870370b13d 69faf9870370b13d 69faf9870370b13d
+429 4c97c64335dca47b 4c97c64335dca47b ad69a891c988be34 03ce3560c88b83fd f14551043dc7df2d d9b89b04b1e198f7 d9b89b04b1e198f7 d9b89b04b1e198f7 d9b89b04b1e198f7
+430 8c4d273cde8941dd 8c4d273cde8941dd 8ba994ddfcdc6a9d 69e7b29b528ccdeb ea5a2ad88e8b78bd af02bc4248bdd6c3 af02bc4248bdd6c3 af02bc4248bdd6c3 af02bc4248bdd6c3
+431 be5b9fd5f29a49ac be5b9fd5f29a49ac 8259ec71a47e8c05 5be2455f5ed6812b 895c9ad4e9f42025 cb93fac329c4bb09 cb93fac329c4bb09 cb93fac329c4bb09 cb93fac329c4bb09
+432 983f391af28a8692 983f391af28a8692 fe21e626b6fd85d2 1c6fc06018ad22a4 f2e330d5a7ead771 4843754aeb0aa693 4843754aeb0aa693 4843754aeb0aa693 4843754aeb0aa693
+433 dbc11d44802ada88 1e902404ffeb4e8a 1e902404ffeb4e8a c72b8d2a054343a4 64ffb9c80f21b5c3 069b2ef784c9f493 fc5dd7f0603aa4e6 fc5dd7f0603aa4e6 fc5dd7f0603aa4e6
+434 dc9d91be9b081701 dc9d91be9b081701 2dce31583269ba23 cf80171e9c391d55 902549931bd8c84f 5af0ad016008ab40 5af0ad016008ab40 5af0ad016008ab40 5af0ad016008ab40
+435 4d11005356cb81d1 4d11005356cb81d1 223c88e5c420bff2 eccb876866d77c08 5941334cd8bcebfb 607ffcbf87c82ee7 607ffcbf87c82ee7 607ffcbf87c82ee7 607ffcbf87c82ee7
+436 ed35533e72f454d6 ed35533e72f454d6 a0a912fadbd014e2 77fef267285af02b 7bd286e0347a74b2 7836da2893c897f1 7836da2893c897f1 7836da2893c897f1 7836da2893c897f1
+437 a7948239124565bc a7948239124565bc a7948239124565bc 7e2f2b17e8ed6892 50c0cfdb0291c1f4 8aca2a69a2b1bfae 8aca2a69a2b1bfae 8aca2a69a2b1bfae 8aca2a69a2b1bfae
+438 84efd4e6cc592b0a 84efd4e6cc592b0a ccccc437991af484 2e82e271374a53f2 e546a3fc99a3d360 0e12453f620aa3a2 0e12453f620aa3a2 0e12453f620aa3a2 0e12453f620aa3a2
+439 0c214c61a4776619 0c214c61a4776619 0c214c61a4776619 d59ae54f5edf6b37 237246ed8f339e39 9db6de97f0d81cf9 9db6de97f0d81cf9 9db6de97f0d81cf9 9db6de97f0d81cf9
+440 b0d1d6b071e7682f b0d1d6b071e7682f 17faaa5089c3af40 f5b48c1627930836 f7a5372fea1b0cce fc9ed7c1ccb1ea69 fc9ed7c1ccb1ea69 fc9ed7c1ccb1ea69 fc9ed7c1ccb1ea69
+441 c7b8ef5dfb96c88a c7b8ef5dfb96c88a 987538ad54dc5b86 41ce9183ae7456a8 6d4469c8fef7a01d 9f2ef48f22ead32c 9f2ef48f22ead32c 9f2ef48f22ead32c 9f2ef48f22ead32c
+442 31d4bbc323d5379c 31d4bbc323d5379c 73452ef42f790603 33d1ea3bc5e0fa8d 1945f14e9aeda9bd e7b1f522c29ab8a7 e7b1f522c29ab8a7 e7b1f522c29ab8a7 e7b1f522c29ab8a7
+443 1e7c493f68167020 278d22fb6b7a408f 278d22fb6b7a408f fe368bd591d24da1 7a06f0b69855551b 21006fa5ef69fff4 21006fa5ef69fff4 21006fa5ef69fff4 21006fa5ef69fff4
+444 e1db2fdd6b5bde6c e1db2fdd6b5bde6c 16b05bc7a7408439 07b261e7c03d9aff 9bf43f035e579aa8 5f47c0458fc04797 5f47c0458fc04797 5f47c0458fc04797 5f47c0458fc04797
+445 95bc9b376d922c2e 95bc9b376d922c2e b837a7fb65a960e9 618c0ed59f016dc7 dea751ffe2f2ba25 6225025d1221ebae 2fd198b4786677b6 2fd198b4786677b6 2fd198b4786677b6
+446 908d73310a1c0b4f 908d73310a1c0b4f e8bdb536084e829e 0af39370a61e25e8 70613a04626e10c0 65f30b19304fe666 65f30b19304fe666 65f30b19304fe666 65f30b19304fe666
+447 0f678f8adcbe550f 0f678f8adcbe550f 0f678f8adcbe550f d6dc26a426165821 41f3e2436a752386 74a185eae6cf7630 74a185eae6cf7630 74a185eae6cf7630 74a185eae6cf7630
+448 72ad3d1ea3f5f876 6fdb4113f1370947 1a573452a9316415 f81912140761c363 d60c863ca56bd332 82953255194be8cd 82953255194be8cd 82953255194be8cd 82953255194be8cd
+449 a23b8172b02fe1f3 a23b8172b02fe1f3 a23b8172b02fe1f3 7b80285c4a87ecdd 7f9b23f3a9cc5d62 cd6fa71f0716b960 cd6fa71f0716b960 cd6fa71f0716b960 cd6fa71f0716b960
+450 4826bdc8f5225e00 4826bdc8f5225e00 4826bdc8f5225e00 aa689b8e5b72f976 c05228bab0624171 7fe9769ac7e96b28 7fe9769ac7e96b28 7fe9769ac7e96b28 7fe9769ac7e96b28
+451 996749feed04f320 996749feed04f320 996749feed04f320 40dce0d017acfe0e 0d53b4cc5b0a9249 04e1aed36b1af193 04e1aed36b1af193 04e1aed36b1af193 04e1aed36b1af193
+452 00af3960a2fd8c38 00af3960a2fd8c38 7f84a70a0e652506 9dca814ca0358270 4847c00823c4c5e5 0ce0f1ae590b35f6 0ce0f1ae590b35f6 0ce0f1ae590b35f6 0ce0f1ae590b35f6
+453 ab55ec50607578b0 ab55ec50607578b0 889805964701b3b6 5123acb8bda9be98 2a91fd4722db9630 bfbcdb8677878520 bfbcdb8677878520 bfbcdb8677878520 bfbcdb8677878520
+454 706f6f73e5778dd8 706f6f73e5778dd8 419867d9f610683b a3d6419f5840cf4d 2466649daeed070a c853e21c1495e934 c853e21c1495e934 c853e21c1495e934 c853e21c1495e934
+455 a2fe860bd8403f35 a2fe860bd8403f35 a2fe860bd8403f35 7b452f2522e8321b 58631a00d395302f 0430dd967deb7569 0430dd967deb7569 0430dd967deb7569 0430dd967deb7569
+456 9801cd171e62cb62 9801cd171e62cb62 9801cd171e62cb62 7a4feb51b0326c14 6482ae46174443c5 9ab2cf66ba959e35 9ab2cf66ba959e35 9ab2cf66ba959e35 9ab2cf66ba959e35
+457 a9508448665248ae a9508448665248ae 60ebdb2d3222e984 c0e59ce8d48ba9e6 5f85f7b221c4db5c eefff2c8ce006092 eefff2c8ce006092 eefff2c8ce006092 eefff2c8ce006092
+458 364a5bcbcf85b62f 51fb6f0a9445a768 51fb6f0a9445a768 b3b5494c3a15001e 445d93cc160f0c1c ae6d83267a2e0fa9 ae6d83267a2e0fa9 ae6d83267a2e0fa9 ae6d83267a2e0fa9
+459 071ac2860bceadc4 c84090c62d10d7e6 c84090c62d10d7e6 11fb39e8d7b8dac8 4e2ebd308d5e2317 4857d9ab9b80ea69 4857d9ab9b80ea69 4857d9ab9b80ea69 4857d9ab9b80ea69
+460 97e42b9be17b7fa6 97e42b9be17b7fa6 a7ac8fd9ad5e06bb 45e2a99f030ea1cd c085552b0c76712a 8a41c8d27f0d9ed5 8a41c8d27f0d9ed5 8a41c8d27f0d9ed5 8a41c8d27f0d9ed5
+461 4fe5ef682055a9ca 4fe5ef682055a9ca 4fe5ef682055a9ca 965e4646dafda4e4 3934121c3cbc050d d181da1956a2b1ca d181da1956a2b1ca d181da1956a2b1ca d181da1956a2b1ca
+462 7a8a33666c78b620 7a8a33666c78b620 7a8a33666c78b620 98c41520c2281156 654e04f74da2ef53 d832862e285c49cc d832862e285c49cc d832862e285c49cc d832862e285c49cc
+463 28f4fae6a697bc04 28f4fae6a697bc04 28f4fae6a697bc04 f14f53c85c3fb12a 3a57724aa9bdf246 bf6cc1e2690e06c2 bf6cc1e2690e06c2 bf6cc1e2690e06c2 bf6cc1e2690e06c2
+464 00840b0230bd24d3 00840b0230bd24d3 00840b0230bd24d3 e2ca2d449eed83a5 ce42250996456992 3ed64564932f1e1c c5739937df73ab36 c5739937df73ab36 c5739937df73ab36
+465 2744ce38eda7633f 2744ce38eda7633f 2744ce38eda7633f feff6716170f6e11 0def6ad5be184107 2af97f9f2ea5e611 2af97f9f2ea5e611 2af97f9f2ea5e611 2af97f9f2ea5e611
+466 8196a7d8358b0df9 8196a7d8358b0df9 e78878e471fc0eb9 05c65ea2dfaca9cf b70d0d5f43b60a13 dfcefc6b88995da0 dfcefc6b88995da0 dfcefc6b88995da0 dfcefc6b88995da0
+467 2f76ff39dc1b81ba 2f76ff39dc1b81ba 2f76ff39dc1b81ba f6cd561726b38c94 1180f69b427a3f04 add0216e76be117c add0216e76be117c add0216e76be117c add0216e76be117c
+468 160f4a730691db35 86419a3532e41a3f efe6685f8d9139d8 9211a7d52c9627b0 6ef830d043611438 fe68be34f02fdf84 fe68be34f02fdf84 fe68be34f02fdf84 fe68be34f02fdf84
+469 c5be3adcfcfe47f8 c5be3adcfcfe47f8 c5be3adcfcfe47f8 1c0593f206564ad6 b6307ebc010fb9ec 604aff8907e7c732 604aff8907e7c732 604aff8907e7c732 604aff8907e7c732
+470 2516a8169b39712a 2516a8169b39712a 2516a8169b39712a c7588e503569d65c 276d67010318eb0e 89ea9ea20fd7bcd4 89ea9ea20fd7bcd4 89ea9ea20fd7bcd4 89ea9ea20fd7bcd4
+471 21d9e008a5ada654 21d9e008a5ada654 2460772402e28993 0e97c26c31673d0d 52c73eeb99d30c4b 8d6379ddde060c51 8d6379ddde060c51 8d6379ddde060c51 8d6379ddde060c51
+472 db60d4addca3671c db60d4addca3671c db60d4addca3671c 392ef2eb72f3c06a 4e9762e4b93acc84 9a68f7b1b246bbd0 9a68f7b1b246bbd0 9a68f7b1b246bbd0 9a68f7b1b246bbd0
+473 eb6e7684eb3d6d1f eb6e7684eb3d6d1f eb6e7684eb3d6d1f 32d5dfaa11956031 cbda38b95a7b64a9 8075cf427930e750 8075cf427930e750 8075cf427930e750 8075cf427930e750
+474 d53d62ce3b2f5a0a d53d62ce3b2f5a0a fdd750a80c66ac5a e9bf965c0af90590 9eb40fd1cbd3583f 9a8db920877a939d 9a8db920877a939d 9a8db920877a939d 9a8db920877a939d
+475 977bb535c9c97ef5 977bb535c9c97ef5 977bb535c9c97ef5 4ec01c1b336173db 116a72050cad2cb3 64696bfb264d01bc 64696bfb264d01bc 64696bfb264d01bc 64696bfb264d01bc
+476 25cb7f87699688b0 25cb7f87699688b0 25cb7f87699688b0 c78559c1c7c62fc6 7bb624188c4fe55e 342e8250f70a8155 342e8250f70a8155 342e8250f70a8155 342e8250f70a8155
+477 5bbf3985fdfff74e 5bbf3985fdfff74e 5bbf3985fdfff74e 820490ab0757fa60 7c3e5bd798a5f6e2 987a045010fe7c45 987a045010fe7c45 987a045010fe7c45 987a045010fe7c45
+478 01664a2d1ba1dca9 01664a2d1ba1dca9 74ea3f6c43a7b1fb 96a4192aedf7168d 78a5d70533ca2758 4c704dfc268ebe3e 4c704dfc268ebe3e 4c704dfc268ebe3e 4c704dfc268ebe3e
+479 a2ba70fc3f1a6de2 a2ba70fc3f1a6de2 a2ba70fc3f1a6de2 7b01d9d2c5b260cc ae3b9f6fce0133b3 1709e1f53fee3b8a 1709e1f53fee3b8a 1709e1f53fee3b8a 1709e1f53fee3b8a
+480 62765a880bf090fd 62765a880bf090fd 62765a880bf090fd 80387ccea5a0378b 8a135bae9fb40220 cc27476e10bc0cf7 cc27476e10bc0cf7 cc27476e10bc0cf7 cc27476e10bc0cf7
+481 7ce7b8282daa8792 03346631bd9c8355 03346631bd9c8355 da8fcf1f47348e7b 4075b6bbdc176811 56f6653a95b8f717 56f6653a95b8f717 56f6653a95b8f717 56f6653a95b8f717
+482 aa527f82b21d8713 aa527f82b21d8713 aa527f82b21d8713 481c59c41c4d2065 1bcb0514c1e50efc 24c45b4d4b662627 24c45b4d4b662627 24c45b4d4b662627 24c45b4d4b662627
+483 059d0e19f8259bb1 059d0e19f8259bb1 059d0e19f8259bb1 dc26a737028d969f fdb1e4ce47cb7a43 74686dbb3bc88d3f 74686dbb3bc88d3f 74686dbb3bc88d3f 74686dbb3bc88d3f
+484 cc661cbfef69f8d5 cc661cbfef69f8d5 cc661cbfef69f8d5 2e283af941395fa3 adf7902e5ad09e93 c6947c45b7093cd6 c6947c45b7093cd6 c6947c45b7093cd6 c6947c45b7093cd6
+485 a979b04923cc7d53 a979b04923cc7d53 014dd8698cf8f2be 53dfb6b5eb64412f 8ed0cfe6b47596c5 77e7cd1e81e299bd 77e7cd1e81e299bd 77e7cd1e81e299bd 77e7cd1e81e299bd
+486 22edca815822cf97 22edca815822cf97 22edca815822cf97 c0a3ecc7f67268e1 c5cededaecedc6b8 83addd7aee49ae86 83addd7aee49ae86 83addd7aee49ae86 83addd7aee49ae86
+487 8fa694e28a53a1c0 8fa694e28a53a1c0 8fa694e28a53a1c0 561d3dcc70fbacee 616f44f3f7101754 9813fcd89ba9148a 9813fcd89ba9148a 9813fcd89ba9148a 9813fcd89ba9148a
+488 388e1ed4bfe03897 388e1ed4bfe03897 83575ae4e0b60760 18ac924952e7ed5a 3e108eeef98f4647 ecbeab1002a5a36a ecbeab1002a5a36a ecbeab1002a5a36a ecbeab1002a5a36a
+489 03e93ed0e800fe02 94c856310a4774ea 94c856310a4774ea 4d73ff1ff0ef79c4 e30989eb11d0a604 0e3a3fef6787c903 0e3a3fef6787c903 0e3a3fef6787c903 0e3a3fef6787c903
+490 302338065ec86cf9 302338065ec86cf9 302338065ec86cf9 d26d1e40f098cb8f e7a8dddb674fcaaa 6c8ec72964cec20b 6c8ec72964cec20b 6c8ec72964cec20b 6c8ec72964cec20b
+491 64aee8c7c37fcc74 64aee8c7c37fcc74 64aee8c7c37fcc74 bd1541e939d7c15a f665e858dcdb13d2 754b2a422b2e105b 754b2a422b2e105b 754b2a422b2e105b 754b2a422b2e105b
+492 c6ebbd1fae2ba9fd c6ebbd1fae2ba9fd c6ebbd1fae2ba9fd 24a59b59007b0e8b 955f273aec5258bc dcf35bb8b4fdd459 dcf35bb8b4fdd459 dcf35bb8b4fdd459 dcf35bb8b4fdd459
+493 9e6356f7ede5da6e 9e6356f7ede5da6e 9e6356f7ede5da6e 47d8ffd9174dd740 cb4883d50b50e6fc 85425c033b45ad16 85425c033b45ad16 85425c033b45ad16 85425c033b45ad16
+494 ac57b937348664e1 ac57b937348664e1 2d06cc9e887c3375 cf48ead8262c9403 36cfe6c6388f7cd8 71d11b71a8d9a9cd 71d11b71a8d9a9cd 71d11b71a8d9a9cd 71d11b71a8d9a9cd
+495 af5902b15eebee6b af5902b15eebee6b af5902b15eebee6b 76e2ab9fa443e345 71b988b40797b5ca ae2843eb78237a11 ae2843eb78237a11 ae2843eb78237a11 ae2843eb78237a11
+496 c337117d96234784 c337117d96234784 c337117d96234784 2179373b3873e0f2 975ec471ccd0f588 ce8f01ab85ee3f29 ce8f01ab85ee3f29 ce8f01ab85ee3f29 ce8f01ab85ee3f29
+497 3141e67cb5b43988 3141e67cb5b43988 3141e67cb5b43988 e8fa4f524f1c34a6 1629a214576017c9 4daab07a48ed5e9a 4daab07a48ed5e9a 4daab07a48ed5e9a 4daab07a48ed5e9a
+498 f82c2ffbbc0f79f3 f82c2ffbbc0f79f3 f82c2ffbbc0f79f3 1a6209bd125fde85 89a1724bcce01b87 2107e47f67dd012c efd22c10a512ce10 efd22c10a512ce10 efd22c10a512ce10
+499 d31ce11624e04df0 d31ce11624e04df0 d31ce11624e04df0 0aa74838de4840de de60b83d2eb7c3af 676a15aa76c3484f 676a15aa76c3484f 676a15aa76c3484f 676a15aa76c3484f
+500 2cc4075a2c81236f 2cc4075a2c81236f 2cc4075a2c81236f ce8a211c82d18419 3dde703349b3b09f f586902174811119 f586902174811119 f586902174811119 f586902174811119
+501 5b1e04a426113fb6 5b1e04a426113fb6 5b1e04a426113fb6 82a5ad8adcb93298 693269e41f248a9b 5da0b426f82380e5 5da0b426f82380e5 5da0b426f82380e5 5da0b426f82380e5
+502 f878ce3f5af4e641 f878ce3f5af4e641 f878ce3f5af4e641 1a36e879f4a44137 4969a5a49d9904b2 78c2ea964c44b314 78c2ea964c44b314 78c2ea964c44b314 78c2ea964c44b314
+503 ad493e0f2edb87a2 ad493e0f2edb87a2 ad493e0f2edb87a2 74f29721d4738a8c 148ba14377328487 27eb241b0e2c7360 27eb241b0e2c7360 27eb241b0e2c7360 27eb241b0e2c7360
+504 b5fa9cb35799713e b5fa9cb35799713e b5fa9cb35799713e 57b4baf5f9c9d648 cbe3262b1f8159e3 6242fcf94383902c 6242fcf94383902c 6242fcf94383902c 6242fcf94383902c
+505 9d6056bed2219c2d 9d6056bed2219c2d 9d6056bed2219c2d 44dbff9028899103 911b5af69c2b68da 50aa6a9e9c302124 50aa6a9e9c302124 50aa6a9e9c302124 50aa6a9e9c302124
+506 e262b8dfbf7d9e94 e262b8dfbf7d9e94 e262b8dfbf7d9e94 002c9e99112d39e2 e287eba63e3d692f aa3f565d4774e1f9 aa3f565d4774e1f9 aa3f565d4774e1f9 aa3f565d4774e1f9
+507 c4b435862dcb186b c4b435862dcb186b c4b435862dcb186b 1d0f9ca8d7631545 58091ba41728d174 cd007dfd994dd5e0 cd007dfd994dd5e0 cd007dfd994dd5e0 cd007dfd994dd5e0
+508 c528024016029177 c528024016029177 c528024016029177 27662406b8523601 e171a97fe275c8dc f0a62af353f389be f0a62af353f389be f0a62af353f389be f0a62af353f389be
+509 e69d330fbe426bd6 e69d330fbe426bd6 e69d330fbe426bd6 3f269a2144ea66f8 725c5127889dc064 979775a37ca8fac0 979775a37ca8fac0 979775a37ca8fac0 979775a37ca8fac0
+510 26cf62ae0ffa4a40 26cf62ae0ffa4a40 5d3d727868bd3d72 bf73543ec6ed9a04 06909dd4ba2dcb73 9d3cb8f7a1fa3350 9d3cb8f7a1fa3350 9d3cb8f7a1fa3350 9d3cb8f7a1fa3350
+511 4de29ff57e05a7a9 4de29ff57e05a7a9 4de29ff57e05a7a9 945936db84adaa87 65a2c38e4d2bd766 8b0dd0c5c920ec66 8b0dd0c5c920ec66 8b0dd0c5c920ec66 8b0dd0c5c920ec66
+512 2f2c1c1e8fcac9fa 2f2c1c1e8fcac9fa 2f2c1c1e8fcac9fa cd623a58219a6e8c 197270591131a16e af58b1f39fa35d3a af58b1f39fa35d3a af58b1f39fa35d3a af58b1f39fa35d3a
+513 ff485f8228ae5b5c ff485f8228ae5b5c ff485f8228ae5b5c 26f3f6acd2065672 ee4843dc5b19bc67 234f499628bf1eb8 234f499628bf1eb8 234f499628bf1eb8 234f499628bf1eb8
+514 9a296fb178b8dbf2 9a296fb178b8dbf2 9a296fb178b8dbf2 786749f7d6e87c84 5015852a57e5a56b da915f8ed746f2ac da915f8ed746f2ac da915f8ed746f2ac da915f8ed746f2ac
+515 fef6e7b629edebe2 fef6e7b629edebe2 fef6e7b629edebe2 274d4e98d345e6cc 4ee976486802371e e7edaecc5eb658fc e7edaecc5eb658fc e7edaecc5eb658fc e7edaecc5eb658fc
+516 fd0a191d28662130 fd0a191d28662130 fd0a191d28662130 1f443f5b86368646 102be6a430234a85 82a1f4d1c563e45c 82a1f4d1c563e45c 82a1f4d1c563e45c 82a1f4d1c563e45c
+517 1f992eaff282e2d6 1f992eaff282e2d6 1f992eaff282e2d6 c6228781082aeff8 1c4e9cd1f9fd6a56 2df7876fb0511623 2df7876fb0511623 2df7876fb0511623 2df7876fb0511623
+518 ac9068fb690a7b25 ac9068fb690a7b25 ac9068fb690a7b25 4ede4ebdc75adc53 eea6adfc0c633d6f 8281c8bb81333c0f 8281c8bb81333c0f 8281c8bb81333c0f 8281c8bb81333c0f
+519 c3c6208b682602ef c3c6208b682602ef c3c6208b682602ef 1a7d89a5928e0fc1 fa7ba6ace2a16b2e 1e6dcd9bdd47a176 1e6dcd9bdd47a176 1e6dcd9bdd47a176 1e6dcd9bdd47a176
+520 0c8d76026685d2b7 0c8d76026685d2b7 0c8d76026685d2b7 eec35044c8d575c1 477a28afe6379cf4 e09ff6afa1fb32a7 5f1d62aa44038424 5f1d62aa44038424 5f1d62aa44038424
@@ -0,0 +1,287 @@
+# tick spawn route counters queue move flip arrivals halt signals
+0 29b3565bb107fa1b 29b3565bb107fa1b 29b3565bb107fa1b 29f104a04bf204aa 2b2678aee700189e b37f92f6e339645a b37f92f6e339645a b37f92f6e339645a b37f92f6e339645a
+1 8b7b9cbbfeace618 8b7b9cbbfeace618 8b7b9cbbfeace618 1b8afb8ef6a2602b 7a723febd7c495b2 402fec98db20d12d 402fec98db20d12d 402fec98db20d12d 402fec98db20d12d
+2 5820222c9896fdbd 5820222c9896fdbd 5820222c9896fdbd 586270d76263030c 02acf6605805b3ba be5ebc9569711ffc be5ebc9569711ffc be5ebc9569711ffc be5ebc9569711ffc
+3 549acfc4bf670250 549acfc4bf670250 549acfc4bf670250 c46ba8f1b7698463 53304d5dc1cfc47c fdf759871fadbeaa fdf759871fadbeaa fdf759871fadbeaa fdf759871fadbeaa
+4 627fee45e57c8565 627fee45e57c8565 627fee45e57c8565 623dbcbe1f897bd4 d2836c908646cb04 14f0a192080b6e90 14f0a192080b6e90 14f0a192080b6e90 14f0a192080b6e90
+5 5dcf3ade6bd50c06 5dcf3ade6bd50c06 5dcf3ade6bd50c06 cd3e5deb63db8a35 7a7f83e5c1269cb9 c13e4afd555f03c9 c13e4afd555f03c9 c13e4afd555f03c9 c13e4afd555f03c9
+6 66baf24b39b758ad 66baf24b39b758ad 66baf24b39b758ad 66f8a0b0c342a61c 9becd5bd8294573d 6bb345983ffe5362 6bb345983ffe5362 6bb345983ffe5362 6bb345983ffe5362
+7 67821145d841d27c 67821145d841d27c 67821145d841d27c f7737670d04f544f 5e1b4b7e1a581d2e 0e1fa47c55936abe 0e1fa47c55936abe 0e1fa47c55936abe 0e1fa47c55936abe
+8 e8db33f9a06b3777 e8db33f9a06b3777 e8db33f9a06b3777 e89961025a9ec9c6 571dbdb0ce71f43b e29a4b5269f92e66 e29a4b5269f92e66 e29a4b5269f92e66 e29a4b5269f92e66
+9 b5c76bce4e05666a b5c76bce4e05666a 45ab184aaf63708c d55a7f7fa76df6bf a2b72aeed450ef14 59e586b693c8c80f 59e586b693c8c80f 59e586b693c8c80f 59e586b693c8c80f
+10 5e98e4439b07c5ee 5e98e4439b07c5ee e9798433c4f38055 e93bd6c83e067ee4 3bc7c5748260bba3 d235ae8eb9a2a700 d235ae8eb9a2a700 d235ae8eb9a2a700 d235ae8eb9a2a700
+11 365779c3df406e39 365779c3df406e39 365779c3df406e39 a6a61ef6d74ee80a 587666c8ad5ce3f8 297d4934c3ada3f3 297d4934c3ada3f3 297d4934c3ada3f3 297d4934c3ada3f3
+12 cf1021a558664fda cf1021a558664fda 29cef13789186f1e 31be2d2e749ca7ad 602d4b3303d1ae1f 12e487eac8025673 12e487eac8025673 12e487eac8025673 12e487eac8025673
+13 a85827a6515803f7 a85827a6515803f7 a85827a6515803f7 38a94093595685c4 f1099d298d4f0baa 88138f199c5cd849 88138f199c5cd849 88138f199c5cd849 88138f199c5cd849
+14 5c67d1cdc32a4c5d 5c67d1cdc32a4c5d eac2662845ab02ba ea8034d3bf5efc0b 39f8351b48645c79 7c0850808adb23c0 7c0850808adb23c0 7c0850808adb23c0 7c0850808adb23c0
+15 d2c612a140b7b96f d2c612a140b7b96f d2c612a140b7b96f 4237759448b93f5c 4ff99376ea9e51ea 691e7d054c8d6fac a8f874f94e08fa33 a8f874f94e08fa33 a8f874f94e08fa33
+16 0ec5990a97fd9b49 0ec5990a97fd9b49 8aa9bc4480957b6c 8aebeebf7a6085dd 923b30271b601c80 8b031a56c6602801 8b031a56c6602801 8b031a56c6602801 8b031a56c6602801
+17 7949065e14518c7b 7949065e14518c7b 7949065e14518c7b e9b8616b1c5f0a48 952f29f4a617a7d9 9baa6eac38e3899a 9baa6eac38e3899a 9baa6eac38e3899a 9baa6eac38e3899a
+18 220ddcb63f433de3 220ddcb63f433de3 c1bf9f9328add499 c1fdcd68d2582a28 20b31d65673f0800 75c6c40419706f7f 75c6c40419706f7f 75c6c40419706f7f 75c6c40419706f7f
+19 376d907dfa744e9e 376d907dfa744e9e 4ca85600bac8e36f 9e0b673cb733d9de 5b8319d1d6e66f19 38ad7d5981cb2cd5 38ad7d5981cb2cd5 38ad7d5981cb2cd5 38ad7d5981cb2cd5
+20 5a5afbc075f2fd8c 5a5afbc075f2fd8c 48b848509dfc1374 7d346ae8c2e70de0 8cb75d271fad2728 35ba49c8fd143a9d 4f7aa7a2d47a12e7 4f7aa7a2d47a12e7 4f7aa7a2d47a12e7
+21 e29a0f60441b8210 e29a0f60441b8210 06abdb571a44545f 965abc62124ad26c 901ff2f7d56cf6a0 f9470372a55a1ecd f9470372a55a1ecd f9470372a55a1ecd f9470372a55a1ecd
+22 6aae952325116bfe 6aae952325116bfe 6aae952325116bfe 6aecc7d8dfe4954f ddc215fea5bc9400 23c01cbc98dc053d 23c01cbc98dc053d 23c01cbc98dc053d 23c01cbc98dc053d
+23 9e4ab317d58ce553 9e4ab317d58ce553 9e4ab317d58ce553 0ebbd422dd826360 fc181b4e1b3d83a8 151e9450f9ac2109 151e9450f9ac2109 151e9450f9ac2109 151e9450f9ac2109
+24 0ae6c6d6c923424e 0ae6c6d6c923424e fcc917688b128d6d c43d17d60ade8182 cf301188c2ee57d0 fb47dc0cf136db53 fb47dc0cf136db53 fb47dc0cf136db53 fb47dc0cf136db53
+25 20fcd6b37c6d74ef 20fcd6b37c6d74ef f4cb24fb85841471 643a43ce8d8a9242 1273bc9dc84f98ee e2f19e8503b4c868 e2f19e8503b4c868 e2f19e8503b4c868 e2f19e8503b4c868
+26 3b74ec7bb44ccf04 3b74ec7bb44ccf04 434fc9c5d49c378c 3067968afe6357c6 f9a4bd6f2a56c6e4 cf769257edc7a286 cf769257edc7a286 cf769257edc7a286 cf769257edc7a286
+27 79e8216494091697 79e8216494091697 79e8216494091697 e91946519c0790a4 4a971f7a8d102736 d260a970bed30f87 d260a970bed30f87 d260a970bed30f87 d260a970bed30f87
+28 6f320c995e2f748a 6f320c995e2f748a 832566ad4eb809e4 83673456b44df755 ab30fc428856f030 5c4d51c7201505db 5c4d51c7201505db 5c4d51c7201505db 5c4d51c7201505db
+29 89b2d497088b1536 89b2d497088b1536 21139cb1f59a1789 b1e2fb84fd9491ba 5dda7cf3b976ff85 dfbacd7f1b14dc65 dfbacd7f1b14dc65 dfbacd7f1b14dc65 dfbacd7f1b14dc65
+30 31d5df043469bcc2 31d5df043469bcc2 da2b0940acbdad10 da695bbb564853a1 3fbd5170f4ceb1c1 697d7080c3034573 697d7080c3034573 697d7080c3034573 697d7080c3034573
+31 d1368c23ebc8a277 d1368c23ebc8a277 acbfc5c5bcae7c43 7da6b35c0ba308bb 61c74abcdf8c4256 f812ee0f03bc1ea0 f812ee0f03bc1ea0 f812ee0f03bc1ea0 f812ee0f03bc1ea0
+32 ce18ce7af15c28d3 ce18ce7af15c28d3 ce18ce7af15c28d3 ce5a9c810ba9d662 1e9bb75901e45fb8 72fe1dbcd425ff94 72fe1dbcd425ff94 72fe1dbcd425ff94 72fe1dbcd425ff94
+33 025466632f62bb80 025466632f62bb80 447511fc199eb075 e14a068ab47ed663 fc839abd298a1ec7 776a568189642bdc 776a568189642bdc 776a568189642bdc 776a568189642bdc
+34 3d8c64198640926d 3d8c64198640926d 85c8bef06ed086fd 858aec0b9425784c e4ea997cb5aaed0c 791e15dcf6b28b8e 791e15dcf6b28b8e 791e15dcf6b28b8e 791e15dcf6b28b8e
+35 a477304894491f24 a477304894491f24 ea141d2d4270831f 01b5194d21e196b7 dfe9c70c5b2c4cf4 13efaf0f7270b9a2 13efaf0f7270b9a2 13efaf0f7270b9a2 13efaf0f7270b9a2
+36 235aa57b9466f3e9 115ca0008af51a8f 115ca0008af51a8f 111ef2fb7000e43e 507a204e0ceaaf6e 0f28a6e7ddd26ed3 0f28a6e7ddd26ed3 0f28a6e7ddd26ed3 0f28a6e7ddd26ed3
+37 f8372dee1edaec6f f8372dee1edaec6f 9572be90fdc20a46 e34b97657c2c0d78 736a54f84ee6dd9a 00383a674bc911d7 c93223076629e770 c93223076629e770 c93223076629e770
+38 9093d45bc650d09c 9093d45bc650d09c 9232d5279890bb4f 927087dc626545fe b569452d73e1f96d 941f447e51348210 941f447e51348210 941f447e51348210 941f447e51348210
+39 f58dc9f3128d3230 f58dc9f3128d3230 adf9728fc6859c4f 3d0815bace8b1a7c 9f1baa24182d5fbb 729e9be97758dd26 729e9be97758dd26 729e9be97758dd26 729e9be97758dd26
+40 637e72901ba87a9f 637e72901ba87a9f 9a31f2cfb4c9795f 7dd96ccc4cec08d2 f3084ddd85b66ec6 2a30f14e4c81cfd0 2a30f14e4c81cfd0 2a30f14e4c81cfd0 2a30f14e4c81cfd0
+41 08ad81e5164f6aec 08ad81e5164f6aec 7c1560a417955918 dbfa6969f4c27b69 3bb76448aacf9eef 8dd766ad92ff0fcf 8dd766ad92ff0fcf 8dd766ad92ff0fcf 8dd766ad92ff0fcf
+42 e4dad8e175209993 e4dad8e175209993 a387459cf33693d8 a3c5176709c36d69 dcbb7fe5f9bdeee0 5b475a99f9627dd0 5b475a99f9627dd0 5b475a99f9627dd0 5b475a99f9627dd0
+43 f1a04b8b3b0283d2 f1a04b8b3b0283d2 1f4a07fcc66607e6 8ddfcbc6e9196e4d 1fa99116f2283124 fa0d50cab44772be 930c49ebaa907f23 930c49ebaa907f23 930c49ebaa907f23
+44 874a01e120791c70 874a01e120791c70 561dc7ac89aa1c3d 6391e514d6b102a9 09bbd742443d637a 17837b97b43f9b8f 17837b97b43f9b8f 17837b97b43f9b8f 17837b97b43f9b8f
+45 838993a6daf42ddc b2788f36638e22a2 8d2a1f0a8c0c3c31 6678ce5c929fcbaf 331802ea056ee7ed 368cdf17d45cf0fe 368cdf17d45cf0fe 368cdf17d45cf0fe 368cdf17d45cf0fe
+46 b9eaf809082f13aa b9eaf809082f13aa 655bef5277f59413 d28c2c1734480421 817860b170bc6e29 f2796c91a1928731 f2796c91a1928731 f2796c91a1928731 f2796c91a1928731
+47 c202a74595e4f8d9 c202a74595e4f8d9 f694bbd94d4f163c 6665dcec4541900f 0bca0f3e635f9c68 312a27002f93ff2f 312a27002f93ff2f 312a27002f93ff2f 312a27002f93ff2f
+48 21bc3c5d3139d785 21bc3c5d3139d785 f0e8c4bdaadd2557 e55171c8f2611ebf 7d6e90cddd76e45a 590c5bfc998859e4 b5f6cda48dde9730 b5f6cda48dde9730 b5f6cda48dde9730
+49 48d760c6e1c58ea4 48d760c6e1c58ea4 00cd5fe32e45f90a 903c38d6264b7f39 0f8994a38df12692 15c16da56f7f3d82 15c16da56f7f3d82 15c16da56f7f3d82 15c16da56f7f3d82
+50 d62772ad770439c4 d62772ad770439c4 e5364a1bec3726ba 6333ec7817b4b5c8 79f6f641e275b028 cfc9c5ea890ebc21 eadb3e706fead182 eadb3e706fead182 eadb3e706fead182
+51 aaac9b5c2a30ff12 aaac9b5c2a30ff12 c23c806c4733a873 c3f5d96996f989fe 2564c90e1ecfa04a a5648fa87f5201ae a5648fa87f5201ae a5648fa87f5201ae a5648fa87f5201ae
+52 45b7b77ba874e0d5 45b7b77ba874e0d5 2bb492e46bf7c4c6 50a6a34afa9da9ec 5c439648fd238416 a961d13df3297b70 bbcda512b59cad32 bbcda512b59cad32 bbcda512b59cad32
+53 1067e7c8445a578d 1067e7c8445a578d 645508ca6241b510 ad984de8b8d360e5 b977d8350b956e34 b6e268377526edc9 b6e268377526edc9 b6e268377526edc9 b6e268377526edc9
+54 9f8f392d37d4a319 b529ee3907fe85c6 cdfd0473e25d270b ea914e7494daf484 03b69c85ef61f7ff 626392c607dc9ab6 626392c607dc9ab6 626392c607dc9ab6 626392c607dc9ab6
+55 bf4be15e2d60d0b8 bf4be15e2d60d0b8 a6d9b197a4c6829c 3ffadda2b22d0e78 0548accce5e1a30b e9d2c7e4fa7950f7 e9d2c7e4fa7950f7 e9d2c7e4fa7950f7 e9d2c7e4fa7950f7
+56 c95f91d5697a9829 c95f91d5697a9829 f45de5f72f342ddc 45157f04a1622f7a 3f3fe537e98f33bb 1eef384b16519904 1eef384b16519904 1eef384b16519904 1eef384b16519904
+57 284bbf8825584eec 284bbf8825584eec 645a1de50ee6c5e5 9ea44f3c09c00e8b 412f7bd5d3bc6fbe e20406fadd307bfc 169e6a9411af68f5 169e6a9411af68f5 169e6a9411af68f5
+58 8f51ec74329dcbf8 8f51ec74329dcbf8 4d62d562f73a20d7 c8e02a18d69eac82 8d45244da236c48c 1741809668c432ed 1741809668c432ed 1741809668c432ed 1741809668c432ed
+59 12fd8245cfcf1def 12fd8245cfcf1def dc1b4c453a2c5643 2cc24db33a159d4a 4578785379a0a46f 634dfd37cb7958ed 634dfd37cb7958ed 634dfd37cb7958ed 634dfd37cb7958ed
+60 9c1fb57bf1675911 9c1fb57bf1675911 fa466887d3158f0e fa043a7c29e071bf dd5bbe597ba4655c afc3673543b70104 afc3673543b70104 afc3673543b70104 afc3673543b70104
+61 b0dd4a586221c9e9 07a1ddfd2445737d 975fe148496ac00b 615c8561596e8a84 78cc6c8870ddd356 ea4b261e53752dd8 982e5418700a7e3d 982e5418700a7e3d 982e5418700a7e3d
+62 93c24222b23d62e0 93c24222b23d62e0 d02bc9236d254a1a c85b153a90a182a9 501fe6f9f52b5122 50a200a865281213 50a200a865281213 50a200a865281213 50a200a865281213
+63 8307b6d1a8d84ae0 8307b6d1a8d84ae0 0fbd21d58eb96d05 3d7a66480aa686cb feba784f6854fb06 75818dcab5939cac 75818dcab5939cac 75818dcab5939cac 75818dcab5939cac
+64 9a820d3565946827 9a820d3565946827 0b562ada7fff0a48 0b147821850af4f9 10604be84ad8b5a9 57d001cc7e246a2c 57d001cc7e246a2c 57d001cc7e246a2c 57d001cc7e246a2c
+65 529f4d0161ae1549 529f4d0161ae1549 6e389a603c3d0bd8 4bb8996ad84564fb f70b5e0e386b8079 8a59a81f6784ba44 8a59a81f6784ba44 8a59a81f6784ba44 8a59a81f6784ba44
+66 cd07c41a33306215 cd07c41a33306215 eb9921bfa7eff5df eb962de16a898484 36575563cadfdec9 c96378a8ccef6729 c96378a8ccef6729 c96378a8ccef6729 c96378a8ccef6729
+67 e8e9087ebba5820f e8e9087ebba5820f 0683d619c4b9a583 07ad47a0f6959958 c9f4ea3dcc257768 8c03ff683d78039a 982b16857c96f508 982b16857c96f508 982b16857c96f508
+68 a748c3f2f7aaa7b9 a748c3f2f7aaa7b9 a97e26d0421d342f d52c892bfad533d3 cd21ef81bf9f74f4 18620054098d1b03 6cef335448946b8e 6cef335448946b8e 6cef335448946b8e
+69 c7178b63cdb39164 c7178b63cdb39164 f3849c9d82969c2d 77e9a36e86ab126b fdf640edeaa272ae bb21630b18b1f358 bb21630b18b1f358 bb21630b18b1f358 bb21630b18b1f358
+70 8202e4b91f9aef05 8202e4b91f9aef05 869c639ccb7d1aba 6074a6c9915e82ab ebd67f7fcfbc29ae a8a96cec5a118875 776292d5c727aa57 776292d5c727aa57 776292d5c727aa57
+71 c49d6c03ea2169a0 c49d6c03ea2169a0 2d934e161996f887 3e1170612baeea96 0c60c9060cf99456 10125832b1aa31cf 10125832b1aa31cf 10125832b1aa31cf 10125832b1aa31cf
+72 726dfae31a60230a 726dfae31a60230a aa7b9c127e9f2617 344d104de9c3b7a1 4311dfa7fdf6f247 4db47707ec00af24 4db47707ec00af24 4db47707ec00af24 4db47707ec00af24
+73 452a90b1fc607f6b 452a90b1fc607f6b 96b613ac2c35f30e e388d5090554e8ac 1a5980270e3dda4a 1f67a49f17af1809 b2113928771e6146 b2113928771e6146 b2113928771e6146
+74 f2c6dc0da7642e8a ec6fff4fc18bb0fb ae75f1815c569657 c8436a339efd3566 5721b399a349155e 2c1447caac793ae8 862fac0dd7cc788d 862fac0dd7cc788d 862fac0dd7cc788d
+75 741845974485b81a 741845974485b81a fa4b5c48d9e9cefe 6aba3b7dd1e748cd 9ba3bddd95e78ac4 43296ecf2bcab83a 43296ecf2bcab83a 43296ecf2bcab83a 43296ecf2bcab83a
+76 231765ccbc5132c8 70e5c576c801743f 97c4901b00158505 e0e2a380b1e401e7 6a4173dbded3b8ca f8864246c3ac7706 478166cfaadd7a14 478166cfaadd7a14 478166cfaadd7a14
+77 6f88ec0bb60fe7b6 6f88ec0bb60fe7b6 7537b4d519229106 f450ea63d49144b6 3078cc9fc1e975a0 b258ca8c7bdefc64 b258ca8c7bdefc64 b258ca8c7bdefc64 b258ca8c7bdefc64
+78 bfea66714d40ca51 bfea66714d40ca51 fcf9db28f04ba994 fcbb89d30abe5725 fce04d258350eab6 9cf99ee7b3252eb5 9cf99ee7b3252eb5 9cf99ee7b3252eb5 9cf99ee7b3252eb5
+79 7f1a102ff897d73e 7f1a102ff897d73e 7669f6b5bd0710c8 7521df214336291a 6a3c2198689bcd37 5b6d8f07c10f00f6 506a16348284985e 506a16348284985e 506a16348284985e
+80 6c1f2270482451ee 6c1f2270482451ee 5eb31edb95d89acc 5ef14c206f2d647d a3f8b975502e8ae1 38ed983bda0e1c63 38ed983bda0e1c63 38ed983bda0e1c63 38ed983bda0e1c63
+81 2bd79ee808e83b1b 9e4cad76cb55b24c 0a455b5481b9bc8e 8286b2838ec60cbf 5fa4e262f01118a4 543a3fbdd5472698 543a3fbdd5472698 543a3fbdd5472698 543a3fbdd5472698
+82 50348905a6bf3382 c709de626749e56e 876b26d607d24758 c2c97636d5f55939 dde779cb999af9df 9b4a7dce47e6cf24 037fef1722f77733 037fef1722f77733 037fef1722f77733
+83 08043206849b9521 0fe22e170c4f3b04 c55a7fb42b5a4fa3 852ef41c0cbda68c 83c43e5c0a3762b8 c65415772ecb0c27 32ea9697356efbc2 32ea9697356efbc2 32ea9697356efbc2
+84 d57e64a1bf70a0f1 d57e64a1bf70a0f1 b168324a1700659d b7ebd086683656be 4cedf86b1376a596 ade2990629cdb93a ade2990629cdb93a ade2990629cdb93a ade2990629cdb93a
+85 810c9eecef9685ec 810c9eecef9685ec 91d3e1555f5e5f7b e72c24914a4e7b3c 8134143e5e1d8ee9 8a3479ed2eec9099 c9569ea67285dba7 c9569ea67285dba7 c9569ea67285dba7
+86 7183eadaf0914793 a4df153759a6657d 4ee473ed45e20952 4ea62116bf17f7e3 2317bd26ace79c6c df350230b598c4ad c1f75b4df779f091 c1f75b4df779f091 c1f75b4df779f091
+87 29af6cfa753bf7c9 29af6cfa753bf7c9 aaf417f7404b091e 67f499f37ab4a708 d1833669e1cfe22a 9f1137f9e6024d33 9f1137f9e6024d33 9f1137f9e6024d33 9f1137f9e6024d33
+88 494994b96a059c93 494994b96a059c93 33e797c8c2e0c8f1 48b8f8c364192a31 533507e28a6f7cf9 4a2476bb749c97c0 0954f0c5c0a9854d 0954f0c5c0a9854d 0954f0c5c0a9854d
+89 7bf1112d32e0e3e0 7bf1112d32e0e3e0 5fee1d0ecc5f55b8 fadb926cd4ff43e3 c2456d8a0ab6d2f3 818c790f7004e257 2597531a52e399b7 2597531a52e399b7 2597531a52e399b7
+90 3a5d3666473db438 3a5d3666473db438 1956c18431d2da88 915f9a660d882d51 b613e4147958cea9 2596fe9f81695e37 3757872d5e749b61 3757872d5e749b61 3757872d5e749b61
+91 866fec14ec2f4078 866fec14ec2f4078 48f69ea01a278134 d807f99512290707 9f11dfda430bfc60 ca39d8cd176cb89e 727f96781ffaf411 727f96781ffaf411 727f96781ffaf411
+92 d149aec3e403acbd 1e7013029b2ef327 c2f7ce09a2416ab3 d2261041a05f4dd0 18078d00e5d99eab b0273c53caf14a52 ff3aa3f42473bd0b ff3aa3f42473bd0b ff3aa3f42473bd0b
+93 e95f211f6c5b8877 e95f211f6c5b8877 de1ce126101a0068 82245112f32109c0 aa290c57115f3e87 37e07ecb2473e9de e18b818ad197c39a e18b818ad197c39a e18b818ad197c39a
+94 6fa3b1ff9f2fda34 6fa3b1ff9f2fda34 a0d5e3a8873e1101 d219b5d10cef2ba3 8942fa4c48e06974 48f0a5a05783a81b 9a246f0ed760c30f 9a246f0ed760c30f 9a246f0ed760c30f
+95 e2242533e76a6700 e2242533e76a6700 38bc1a5c22984ad8 4463f18976f56a29 db9b833fd35cdfd5 a614d10e346ef7e6 a614d10e346ef7e6 a614d10e346ef7e6 a614d10e346ef7e6
+96 c69dbfede422af9c c69dbfede422af9c ac838c293b681aa2 aabc38a906c1ef95 4e0406621ccc8295 4e56883b63f9b9c3 608cfdc932fef949 608cfdc932fef949 608cfdc932fef949
+97 bcd69adef2d634b3 bcd69adef2d634b3 e060ba51522ed793 36558b036d0cb642 7cecec89078587df 466fb638e7cd86a4 466fb638e7cd86a4 466fb638e7cd86a4 466fb638e7cd86a4
+98 68d2af158930f9c2 68d2af158930f9c2 e72fcdf425078e89 e635aa15ca29d5b3 8e5a08c36ea33a04 2017840a98c88dad 9958574a7e6c8e8b 9958574a7e6c8e8b 9958574a7e6c8e8b
+99 24416e931701ff51 beb9e208983e1fe0 d39bc8348f437229 da35bc2eed679283 8d22c208c5bb6333 9d33a2ada67abef3 9d33a2ada67abef3 9d33a2ada67abef3 9d33a2ada67abef3
+100 297505fb11b79fc3 297505fb11b79fc3 2bd76297625df64d 84ada9b6c1a6fdc1 87a516dd5fa8d199 b9e830e474661d1e 5448118ade1a8f0f 5448118ade1a8f0f 5448118ade1a8f0f
+101 1e87bf699e1525b9 1e87bf699e1525b9 1045c7eb02cd0957 793cac71559272fa 442ca644a2ed0e3b c25439a7cf527586 c25439a7cf527586 c25439a7cf527586 c25439a7cf527586
+102 9a570a637538ed52 9a570a637538ed52 765e1f5a750e4bc3 a63e3a2bd65b6fc0 55467143a40187b2 f1cd5880d6660031 20a3a7ddf1c888c9 20a3a7ddf1c888c9 20a3a7ddf1c888c9
+103 20ecc3ff5510b89b 20ecc3ff5510b89b 1fa0dce6d7691e99 8f51bbd3df6798aa 5f391435b9208a43 13713601ec75981f 13713601ec75981f 13713601ec75981f 13713601ec75981f
+104 32b122634880585c 32b122634880585c 42d7193520d7f61b f9f8c7cd42c22330 2a19a088372a83bb 6ba764a13864f63b b211358f42bcb6b2 b211358f42bcb6b2 b211358f42bcb6b2
+105 9bd1f4b567d0669a 9bd1f4b567d0669a f3153294541e9cc7 8f2db8793ad2d222 3624a2009c880e67 55036f9030271965 d5843ba1ffdee603 d5843ba1ffdee603 d5843ba1ffdee603
+106 4035fe32ae31474e 4035fe32ae31474e 2cb14e0ec86fc7b3 2cf31cf5329a3902 c492dc36bf6fee05 57974a4828d2f9fe c40c943c45df399b c40c943c45df399b c40c943c45df399b
+107 65f56936e380f1c7 65f56936e380f1c7 412b1a9a7ae44bee 36cde5c6599d78fa 7d7ec57461e0f127 6fd2db4f41b3037a 3dab107b260d4bf7 3dab107b260d4bf7 3dab107b260d4bf7
+108 f92a128ff0f7a527 7701a4903bd34274 7cbc03761b90b36d cd491b8f15f6b858 2534c2fcde89c675 87a7b5038209c883 26b1638f90572aa5 26b1638f90572aa5 26b1638f90572aa5
+109 c5f52d8020741c6e a10abb02dab93094 1166302d391a67af 819757183114e19c 9972c3bb841ae447 58cf5c798fe36941 d6245be0d5d97f9b d6245be0d5d97f9b d6245be0d5d97f9b
+110 605004b559d6e589 e4e474390a5101d5 24308157a9a32779 2472d3ac5356d9c8 549bf2bd9c30e76e 5df351e7ec3d820e 41eaad2ff91bb2ca 41eaad2ff91bb2ca 41eaad2ff91bb2ca
+111 98c9cc16d6575636 98c9cc16d6575636 52237aff7ebdad73 f8f0c52eebed0700 a87832783f544fa9 52667d71d1ba1f6a 52667d71d1ba1f6a 52667d71d1ba1f6a 52667d71d1ba1f6a
+112 2e7c7b784f32281a 2e7c7b784f32281a 401df9eadd80be8f 405fab112775403e 84be177caf7b3c21 e93f18cf7d1e95a7 313788e69bcb1224 313788e69bcb1224 313788e69bcb1224
+113 7234d53e3f11f4b8 7234d53e3f11f4b8 a91fc04153fea9b5 ce1bfb6a065004a7 fd24d13ad01debba e7baf25a20030d7b a0b4f6969eb4cd62 a0b4f6969eb4cd62 a0b4f6969eb4cd62
+114 ba5884a4dc56dc0d ba5884a4dc56dc0d 7ae49e65180d30b6 7aa6cc9ee2f8ce07 bc910be85b76763e b967fc0e8197f743 b967fc0e8197f743 b967fc0e8197f743 b967fc0e8197f743
+115 ad94eb2b14d40118 ad94eb2b14d40118 d673ce9cc88ccfed 2f659d8eac1fbe20 d3b7407ae59086a9 a62df262f44d2478 a62df262f44d2478 a62df262f44d2478 a62df262f44d2478
+116 870810ada3f304ae a3ed69cb4db22052 273a33cd79d16765 1b8ddd8dfe675556 78e9182c140baa9a 66af6c02e35a8bc4 66af6c02e35a8bc4 66af6c02e35a8bc4 66af6c02e35a8bc4
+117 7059bada90db2e84 7059bada90db2e84 ff2071fac1950000 6fd116cfc99b8633 0916c6783427cbe3 494a9b6529fed99c 494a9b6529fed99c 494a9b6529fed99c 494a9b6529fed99c
+118 3996c49d7a2260ef 3996c49d7a2260ef 012b58c4ac7f1ebe e1ee70ac77b40b73 5ec34de1cece61cc 5901fe2a05fd15e1 9ae1e5e7a9f37b34 9ae1e5e7a9f37b34 9ae1e5e7a9f37b34
+119 51bc83d788864492 51bc83d788864492 882bf9254437210c 00e810f24b48913d 1c80f3d33da23f6f f1ef626401a40c09 f1ef626401a40c09 f1ef626401a40c09 f1ef626401a40c09
+120 410f8e42fc36ce35 410f8e42fc36ce35 155c4c2fdf27aee9 ebb6cfe6f401eff6 f7fc6fceba2c65f9 f7d692d9b2ad4342 91bdc56ef1123e11 91bdc56ef1123e11 91bdc56ef1123e11
+121 3d132a52b104a9e2 3d132a52b104a9e2 66c52108635cfd91 32ad8f186b711b3a 7a4ba8f936031b38 5fdcc6ce5eed728c 1bf93bb7f21be405 1bf93bb7f21be405 1bf93bb7f21be405
+122 354d73442a14d284 fa15f561e78309f4 fbc1b73753a51fb9 57053027aa30e207 2bd8e10b86849e99 73f624c0cf51f400 73f624c0cf51f400 73f624c0cf51f400 73f624c0cf51f400
+123 92943d38096a9523 92943d38096a9523 6f1dbe1fd7b16e82 25494c744349068b 33d4283f126a4aca 0b75027d340ab6b4 8872a9079332e3a9 8872a9079332e3a9 8872a9079332e3a9
+124 523086e8700e8eff 07885dbacf1bdbbd f469d8b098bca73c eaa45993cfd45934 7bc37413e30a56d0 05f497ffea022416 986aa5f2e7f88248 986aa5f2e7f88248 986aa5f2e7f88248
+125 7b06a2a697fe4d36 91ac174847939898 37d345e9174cd6a9 aea3c78ff09802b5 4193e27ec9195151 39865f9f62a8bb00 460e2984501c78bd 460e2984501c78bd 460e2984501c78bd
+126 e6dd305463791ca0 e6dd305463791ca0 8e819ceb4735da4a 46bfa0176812e2d3 68c6eb324a86d99e ab2497cbd176d02e f8e7f735547c1c2a f8e7f735547c1c2a f8e7f735547c1c2a
+127 08977177546f2f89 08977177546f2f89 d7248f33c6cf19b0 eb12741453d44323 8996c827a972d38f efe779075edc8162 b4220fec8bcdec8e b4220fec8bcdec8e b4220fec8bcdec8e
+128 594a89dafc4a5634 0b86fe18af2a1406 51c1ceadcabcfb2a 5dffbcc3aac6e2da d8341751535f7fd1 957c051bc4be8569 1fa53efcf9b93ac3 1fa53efcf9b93ac3 1fa53efcf9b93ac3
+129 78ddb98431073357 c14154abdd754dac b6b499650d67a948 36198e96572bf108 dd2b0723ea0667a8 14538a38ddfe00ea 14538a38ddfe00ea 14538a38ddfe00ea 14538a38ddfe00ea
+130 12a89839049aa2fa 68f11991dfb32a0f 8dc4d0524aa1bfb1 8d8682a9b0544100 f4f2b18ee515ce69 38e8282985ea0652 38e8282985ea0652 38e8282985ea0652 38e8282985ea0652
+131 1567382ab13f7a82 1567382ab13f7a82 c1e32820a8d7aaab 165e99ad9bcad710 73456938d6bfeee6 95711a7cc11dba4d 047920205066e4c9 047920205066e4c9 047920205066e4c9
+132 ae1e63e055daa27c ae1e63e055daa27c 8d2c7597bfa866b0 80c05abad1519bfd 0d8f848d31960390 02d713962734f3bc 4efce431adc9f635 4efce431adc9f635 4efce431adc9f635
+133 5997bca079342d32 5997bca079342d32 84a85e745774cd65 dff590f8ad39d467 5762bc77596a7dde 28079fc8633f6149 2b65e89ea0f26ed4 2b65e89ea0f26ed4 2b65e89ea0f26ed4
+134 0431a5041ff1a1b5 0431a5041ff1a1b5 0565818937563a5d 1d155d90cad2f2ee 5f0db9f538ce8c85 dac8a23560d53ac2 0df533aa9318e07f 0df533aa9318e07f 0df533aa9318e07f
+135 64e86033457ff649 c9a081631b6e9703 9cf83bd7695a7cae 39c72ca1c4ba1ab8 83a140660ef2663e 242c95e934b2d178 51ec1baa6fcb145f 51ec1baa6fcb145f 51ec1baa6fcb145f
+136 a965700d75a27563 a965700d75a27563 5ef8763888bbebfb 44e1ec6d70c1a3de 7b015c1f09c459b4 6bd4868ae16c1fb3 d105b20ab50359d1 d105b20ab50359d1 d105b20ab50359d1
+137 e565c436ef72744e a98f7e4e71d74fc8 e075829e3b2e9650 3e0e4b3479680106 9ad680c4c5a3bdb9 3ddd138a69e032fe 3ddd138a69e032fe 3ddd138a69e032fe 3ddd138a69e032fe
+138 acddb762f26aee6e 0280e29f353d5d9c b591fcb8b4459372 369dc5cd3ea1f519 4361bc25eeafc287 732344a3ec71ed66 3d14372aa07812e2 3d14372aa07812e2 3d14372aa07812e2
+139 d6fc4b225f5c43b4 d6fc4b225f5c43b4 07f7f1bdb3315b26 a8c2fdc5fd86a36d 802304996ac62b9f cacf00f117556668 1e780f73ec8570f4 1e780f73ec8570f4 1e780f73ec8570f4
+140 fa8ad285746c2f53 50a5f2661796e96c a801cd07ac5fc227 a8439ffc56aa3c96 8b8a22d09965917c 0d5724cbd6c67f68 90f517634b46a9a8 90f517634b46a9a8 90f517634b46a9a8
+141 59ca003d7340801a 59ca003d7340801a 8484453d38a737aa cbce2ce2deb8b4da aaa7643a7e2cdf96 8ca1fd1730ca5384 8ca1fd1730ca5384 8ca1fd1730ca5384 8ca1fd1730ca5384
+142 863920dfeadddbfa 797277e791dfa6c7 18fe8484b1a0335f 83c0167f0f8a929a d675ac7df25113f8 9d7467dbfb984af4 addad208f740bf94 addad208f740bf94 addad208f740bf94
+143 e3ba424635b9e0f7 e3ba424635b9e0f7 c87ae5ad1c880ca7 f737e933ab5892d2 dabdab5e5122d599 f7163d3b6c620b89 1ba07aa6660a6079 1ba07aa6660a6079 1ba07aa6660a6079
+144 e8cf8d27bfe39e61 f9a3efc06e997123 cbeb32d450ad0a73 cba9602faa58f4c2 9085f30dd1f17a80 2a3dc461746f92ae 2a3dc461746f92ae 2a3dc461746f92ae 2a3dc461746f92ae
+145 3a39c6aa6b5729de 3a39c6aa6b5729de 4e1b954d22dcfdee c6d87c9a2da34ddf 4ff632364e70d8a2 78b77c7675afccd4 f1c63de798fac3ab f1c63de798fac3ab f1c63de798fac3ab
+146 b983147323264822 b983147323264822 1364939c46c70854 1326c167bc32f6e5 fa2b1944e79254df d182d1e4eaffcd7a 2bbd6ebdd2a704c2 2bbd6ebdd2a704c2 2bbd6ebdd2a704c2
+147 3b2fad361e8a7bfb 4c7684e02b671b0d f3f78fcb8e3efd07 2bbead15cbda5c97 8cc6e1630af7c3b5 9cc6907ec9e54b24 b7a88787bf9aecb8 b7a88787bf9aecb8 b7a88787bf9aecb8
+148 7eb9d7dea8390402 b01976ba6eab2625 1e0f76c05948f629 1e4d243ba3bd0898 817da768dd1fc5b3 e7dd7eab02514ca7 2052839afa1290f3 2052839afa1290f3 2052839afa1290f3
+149 57e5a4e2d6252c23 57e5a4e2d6252c23 57e5a4e2d6252c23 c714c3d7de2baa10 233308dbddd3ef99 e337ac5643c97105 e337ac5643c97105 e337ac5643c97105 e337ac5643c97105
+150 a34182f3908a27b4 9bd49316a29a9fc7 94dee51430035c17 531e4f0a1bef36e2 4adb73b41631ba17 a947baf1bb440bec a947baf1bb440bec a947baf1bb440bec a947baf1bb440bec
+151 7e0d1f68aa107885 1ad024c6b2cf9ee3 5d735f88b2909462 5035c9b6655bf33e 3aa8d3cbb27ce05d a4382ca52baaa5a8 a4382ca52baaa5a8 a4382ca52baaa5a8 a4382ca52baaa5a8
+152 e0136061e11dfd34 5202a955ef32b9b8 aa2156ac2a38ed3e 1184aea297ff4029 4f0cc5cf16b1ddfe 4d4a3f88b73f79a3 4d4a3f88b73f79a3 4d4a3f88b73f79a3 4d4a3f88b73f79a3
+153 812d9f785a210055 812d9f785a210055 921d7e01b590dd7c 02ec1934bd9e5b4f 0cc57dd5d2908879 00db761e4ab59fa4 a97a636f377692d0 a97a636f377692d0 a97a636f377692d0
+154 cbb66e243cac35e5 cbb66e243cac35e5 d5cae5fb3e9f6bdb 11612b1fe1417e62 1b6d361fd53b6fe0 7b56646e17648361 bd96026f8dcda110 bd96026f8dcda110 bd96026f8dcda110
+155 9d681a0d36a44eb8 9d681a0d36a44eb8 19043f4321ccae9d 89f5587629c228ae 67e2152ed3a9edf9 d971f0f73a0ceb7b d971f0f73a0ceb7b d971f0f73a0ceb7b d971f0f73a0ceb7b
+156 52b59c07b8f02879 52b59c07b8f02879 5cbdd827e910dca9 a434bff67536511e 530453409a135301 767dc8e28fa3f925 2d035b6ed9277d1f 2d035b6ed9277d1f 2d035b6ed9277d1f
+157 884fdcde2f42338f 884fdcde2f42338f f07c68427f50d99a efaff285e0262455 042d784317aabd40 3410945f132adb22 d40c9dde915311de d40c9dde915311de d40c9dde915311de
+158 ca871e2943e56069 ca871e2943e56069 01a15136b00598e4 01e303cd4af06655 40ef54f8a593b440 59d11db3c15f735a 59d11db3c15f735a 59d11db3c15f735a 59d11db3c15f735a
+159 b2850d547d9555d8 b2850d547d9555d8 b2850d547d9555d8 22746a61759bd3eb 315f9c9d5cacd222 47f7a2836cf68ede 47f7a2836cf68ede 47f7a2836cf68ede 47f7a2836cf68ede
+160 01d146bfff06fcbf 01d146bfff06fcbf 857277edbaf8588a fe6046432b9235a0 bbc5df45acb5bf66 7334caaa5ab253fb 7334caaa5ab253fb 7334caaa5ab253fb 7334caaa5ab253fb
+161 df79379c9a78dae5 df79379c9a78dae5 173267588c57333f a0f779f91126bea6 a4234c5e9ccee9df bd799e77a11da8cd a6db08ba7abd370d a6db08ba7abd370d a6db08ba7abd370d
+162 3f5a55d8809da0b2 bc77c2fc94a2696b a6651219021e9a6e 93e930a15d0584fa bf91f18f74b19ac9 df586d5a8c8c1574 6faa0e82520164e4 6faa0e82520164e4 6faa0e82520164e4
+163 f01c8c26d22127bf e5ad940803c085c3 e5ad940803c085c3 755cf33d0bce03f0 5447690b5423f85d 8e331503eb7910d5 8e331503eb7910d5 8e331503eb7910d5 8e331503eb7910d5
+164 2a03ff10b6fa64e8 2a03ff10b6fa64e8 961ceb23d374e76a 965eb9d8298119db 366e752a7933a2fd f677b246fc4a2b07 00d1ee1d144b8279 00d1ee1d144b8279 00d1ee1d144b8279
+165 61c68e9a61feb182 61c68e9a61feb182 92df356eee0c03d8 324bd166ff6c3dd8 95073e3b444284d1 06814c60a97e842e 06814c60a97e842e 06814c60a97e842e 06814c60a97e842e
+166 2a1c1d4c52ac960e 2a1c1d4c52ac960e 4cc2b7366251bffd ffca6fe5c14aa32a d6e95c3526858ecd 31a7a468cbbfb495 31a7a468cbbfb495 31a7a468cbbfb495 31a7a468cbbfb495
+167 738b3beaef2af813 738b3beaef2af813 738b3beaef2af813 e37a5cdfe7247e20 c872ac87af19ce8c 8881c02664789e5a 8881c02664789e5a 8881c02664789e5a 8881c02664789e5a
+168 61126b900ae970d4 61126b900ae970d4 61126b900ae970d4 6150396bf01c8e65 df0275c51fb7595f b5d7bfc32cc1b494 b5d7bfc32cc1b494 b5d7bfc32cc1b494 b5d7bfc32cc1b494
+169 c2ac33b4ff628778 c2ac33b4ff628778 c2ac33b4ff628778 525d5481f76c014b da93d5350b6bdbc7 3e416ba06a5f8678 537b86320f3344ae 537b86320f3344ae 537b86320f3344ae
+170 e48521e2d9da6a3d e48521e2d9da6a3d d734a642372d6885 ed3d537664461552 4d39ac22280b2603 e3139dd066a799b8 e3139dd066a799b8 e3139dd066a799b8 e3139dd066a799b8
+171 e24c8b17f453cb83 e24c8b17f453cb83 e24c8b17f453cb83 72bdec22fc5d4db0 a8838d1a1a13331b 19b1397b5df1dac9 19b1397b5df1dac9 19b1397b5df1dac9 19b1397b5df1dac9
+172 1d38630ce2897fcc 1d38630ce2897fcc c823dcec8cca269f c8618e17763fd82e 83794a0bacbf634f a7d7f1cf2918e1d9 a7d7f1cf2918e1d9 a7d7f1cf2918e1d9 a7d7f1cf2918e1d9
+173 1f643ce9e8c37bef 1f643ce9e8c37bef 1f643ce9e8c37bef 8f955bdce0cdfddc a85d427f5d068c18 f69014b9f6c7d304 f69014b9f6c7d304 f69014b9f6c7d304 f69014b9f6c7d304
+174 2fdd7257b6febf23 2fdd7257b6febf23 af149e4b1b651993 ec723fd977e65f21 0a6947a5b1d6f2f0 ad8ebd12f40ef0bd ad8ebd12f40ef0bd ad8ebd12f40ef0bd ad8ebd12f40ef0bd
+175 d8ecf4f0ce1e3868 d8ecf4f0ce1e3868 d8ecf4f0ce1e3868 481d93c5c610be5b 3ef1751c9e77cd14 a693ec96048b7b1e e1a8d768e6e75586 e1a8d768e6e75586 e1a8d768e6e75586
+176 356c2a8189c059c2 356c2a8189c059c2 1e6074c5caccae32 1e22263e30395083 a6474cd00dba7166 a35f9e7f308b65dd a35f9e7f308b65dd a35f9e7f308b65dd a35f9e7f308b65dd
+177 5ba6e575c189ebfc 5ba6e575c189ebfc 5ba6e575c189ebfc cb578240c9876dcf 171d78aeb1d38fbf e09f3e72c4cfcab9 e09f3e72c4cfcab9 e09f3e72c4cfcab9 e09f3e72c4cfcab9
+178 dad2a36c9bd523da f7281d0f9e6256ba 3804c072975c313b 3487d18ffeb94437 4df6aa03e87721dc 01e7fec6578a8974 01e7fec6578a8974 01e7fec6578a8974 01e7fec6578a8974
+179 e1cb53106f89491d e1cb53106f89491d 26b14b122390cffe 604221321dd96b5b cea71e03ae8023bb dd0e754a55d3e201 2dfb027e2e0e5ed9 2dfb027e2e0e5ed9 2dfb027e2e0e5ed9
+180 1ef6f9c3737fc0fa 1ef6f9c3737fc0fa f8282951a201e03e e058f5485f85288d 17843b441b5babc8 6393bf751f5aa3c0 6393bf751f5aa3c0 6393bf751f5aa3c0 6393bf751f5aa3c0
+181 4045e4f2fc216ad0 4045e4f2fc216ad0 4045e4f2fc216ad0 d0b483c7f42fece3 5c80c2d0ac5dea23 357ec711dfbe8680 357ec711dfbe8680 357ec711dfbe8680 357ec711dfbe8680
+182 e2220c3e3843c7ec e2220c3e3843c7ec e2220c3e3843c7ec e2605ec5c2b6395d 9937e93d6fd8cc60 d68126b3dd5a54f1 d68126b3dd5a54f1 d68126b3dd5a54f1 d68126b3dd5a54f1
+183 78fb1d3ddeb1d55c 1ec127dc90cbd448 1ec127dc90cbd448 8e3040e998c5527b 7c75ed336ec9ac2e 10fed7fb24a245e1 10fed7fb24a245e1 10fed7fb24a245e1 10fed7fb24a245e1
+184 53b2b3328e3c2ed1 53b2b3328e3c2ed1 4c3eddc025727025 4c7c8f3bdf878e94 a607e003f47f1691 f77524aeec37de02 f77524aeec37de02 f77524aeec37de02 f77524aeec37de02
+185 db4038241aec2b59 db4038241aec2b59 db4038241aec2b59 4bb15f1112e2ad6a b605ff0f74437e9f 03ec65861f2ec1c2 03ec65861f2ec1c2 03ec65861f2ec1c2 03ec65861f2ec1c2
+186 74e47b9bd8b1860e 74e47b9bd8b1860e 74e47b9bd8b1860e 74a62960224478bf 0e2179e86c861172 a4ef0fd818cd595a a4ef0fd818cd595a a4ef0fd818cd595a a4ef0fd818cd595a
+187 82b7b4c2f849879e 82b7b4c2f849879e 43c420b980b00c02 d335478c88be8a31 535812f10dd741bd 85064af03323be87 85064af03323be87 85064af03323be87 85064af03323be87
+188 6d0812d08437df2f 6d0812d08437df2f 147f329d80cd39fa a2934b2c04684f62 d792f974376eccc4 7003e4ab598bb4cb 7003e4ab598bb4cb 7003e4ab598bb4cb 7003e4ab598bb4cb
+189 a40ce92f68e78666 fa088d1719914254 fa088d1719914254 6af9ea22119fc467 92f11882d639ca40 c0ffc29278c0ba81 92c219ae009f290d 92c219ae009f290d 92c219ae009f290d
+190 645eca05e6baa6b7 645eca05e6baa6b7 069f97b517af2835 06ddc54eed5ad684 5bc468e6f079b876 7ba41fbcdc6ea720 7ba41fbcdc6ea720 7ba41fbcdc6ea720 7ba41fbcdc6ea720
+191 4f922cbdf288a9cc 4f922cbdf288a9cc 4f922cbdf288a9cc df634b88fa862fff 39626496545525bc 17b9c99fd0ac34c4 17b9c99fd0ac34c4 17b9c99fd0ac34c4 17b9c99fd0ac34c4
+192 ffcaed7461263dad ffcaed7461263dad ffcaed7461263dad ff88bf8f9bd3c31c f67eda093b700c47 877bc1304c349e27 877bc1304c349e27 877bc1304c349e27 877bc1304c349e27
+193 635c2eadbafb798a 635c2eadbafb798a 635c2eadbafb798a f3ad4998b2f5ffb9 c63767d6d8efa33a 52a39e8b4ef22e8a 52a39e8b4ef22e8a 52a39e8b4ef22e8a 52a39e8b4ef22e8a
+194 cfc94daa22f1b766 cfc94daa22f1b766 4393feab8d714805 43d1ac507784b6b4 6cd2e62a2a107a94 25fcf83f4c2cc14f 25fcf83f4c2cc14f 25fcf83f4c2cc14f 25fcf83f4c2cc14f
+195 1c91cd8012626e7d 1c91cd8012626e7d 1c91cd8012626e7d 8c60aab51a6ce84e 23465d3a7a8355ce 2d42813e9da721a1 d624a65b1b439fa9 d624a65b1b439fa9 d624a65b1b439fa9
+196 a12c791e89085444 a12c791e89085444 a12c791e89085444 a16e2be573fdaaf5 e493bb8efef70f89 4c89ad2825d6f6ab 4c89ad2825d6f6ab 4c89ad2825d6f6ab 4c89ad2825d6f6ab
+197 0ba5ebb3d2ff8b1c 0ba5ebb3d2ff8b1c 9748d587ce073957 07b9b2b2c609bf64 d510a0c4b19003e2 c7ed9d29b3cdacc1 c7ed9d29b3cdacc1 c7ed9d29b3cdacc1 c7ed9d29b3cdacc1
+198 0142dfdcf10dc554 0142dfdcf10dc554 0142dfdcf10dc554 01008d270bf83be5 71e9a8e5df991584 214de271f964d848 214de271f964d848 214de271f964d848 214de271f964d848
+199 58dee2d7fa30845c 58dee2d7fa30845c 3dad1d05080dca5c f8a8c87159efb9ef 1cdeabfbb1de811a 415bf78998680ea6 415bf78998680ea6 415bf78998680ea6 415bf78998680ea6
+200 058c67679a825a97 058c67679a825a97 992eb082e294da1e 996ce279186124af cd26deeb87b7ddb6 919ef69ba5c0188d 919ef69ba5c0188d 919ef69ba5c0188d 919ef69ba5c0188d
+201 4b9d4147d8fb2994 4b9d4147d8fb2994 4b9d4147d8fb2994 db6c2672d0f5afa7 48909bdd1169b03b 5eb2cf1d4f9dfe5f 5eb2cf1d4f9dfe5f 5eb2cf1d4f9dfe5f 5eb2cf1d4f9dfe5f
+202 94dddd255fa44a45 94dddd255fa44a45 94dddd255fa44a45 949f8fdea551b4f4 51d7faa8123094bf 4547b27d5d9404c8 43aaf0fc2d8789c9 43aaf0fc2d8789c9 43aaf0fc2d8789c9
+203 a6073e7bb82b4aca a6073e7bb82b4aca a6073e7bb82b4aca 36f6594eb025ccf9 ee8597bc57e7fde6 e73d19a303b4117a e73d19a303b4117a e73d19a303b4117a e73d19a303b4117a
+204 dbbbf7d980a35887 dbbbf7d980a35887 dbbbf7d980a35887 dbf9a5227a56a636 ec1749da67625397 ab3874af3be58754 ab3874af3be58754 ab3874af3be58754 ab3874af3be58754
+205 9d2087c3b2aeb5b3 9d2087c3b2aeb5b3 9d2087c3b2aeb5b3 0dd1e0f6baa03380 7041dc7e5c3a62d0 a568f92073fc710d db06ef36f2bdaba6 db06ef36f2bdaba6 db06ef36f2bdaba6
+206 6516bfe7fd0c69b0 6516bfe7fd0c69b0 6516bfe7fd0c69b0 6554ed1c07f99701 667dc85c7ce9b4f2 f77cdb738d3c9efa f77cdb738d3c9efa f77cdb738d3c9efa f77cdb738d3c9efa
+207 66532ab2c30fa6aa 66532ab2c30fa6aa 66532ab2c30fa6aa f6a24d87cb012099 14ed4791df30f93d e2a082d47e6b21bf e2a082d47e6b21bf e2a082d47e6b21bf e2a082d47e6b21bf
+208 bd86885a8e4626a2 bd86885a8e4626a2 32ff437adf080826 32bd118125fdf697 294529ba4b26e705 3dc176b252f3a1f6 3dc176b252f3a1f6 3dc176b252f3a1f6 3dc176b252f3a1f6
+209 9c1376ecfaf9ca48 9c1376ecfaf9ca48 d8882f25af4a6600 48794810a744e033 d4b7814cdf5ba56d 9b59e3d194a9de95 9b59e3d194a9de95 9b59e3d194a9de95 9b59e3d194a9de95
+210 4d026158e154a58f 4d026158e154a58f 4d026158e154a58f 4d4033a31ba15b3e eafe3932f887d74f b067a3a9b5fd893a b067a3a9b5fd893a b067a3a9b5fd893a b067a3a9b5fd893a
+211 323738a5409d9725 323738a5409d9725 323738a5409d9725 a2c65f9048931116 df0dddcecfc7de13 f38ef4957dfc2662 f38ef4957dfc2662 f38ef4957dfc2662 f38ef4957dfc2662
+212 9f3d3d3558d3a5dc 9f3d3d3558d3a5dc 9f3d3d3558d3a5dc 9f7f6fcea2265b6d ebfd77f9d009e099 be4c28a6c6d534e4 be4c28a6c6d534e4 be4c28a6c6d534e4 be4c28a6c6d534e4
+213 665e80a5d3ace937 665e80a5d3ace937 665e80a5d3ace937 f6afe790dba26f04 bce04e7457520a7d 5f5bc81b5e96c5bb 5f5bc81b5e96c5bb 5f5bc81b5e96c5bb 5f5bc81b5e96c5bb
+214 c9564f236e753b3c c9564f236e753b3c c9564f236e753b3c c9141dd89480c58d 4c40e9e9a9bfd3d0 59f163e059f07644 59f163e059f07644 59f163e059f07644 59f163e059f07644
+215 26e7c3c83d42e2aa 26e7c3c83d42e2aa 9c77a5627940b734 a33aa9fcce902941 859f9fdea8394d4b 77f0a4ba6698893b 77f0a4ba6698893b 77f0a4ba6698893b 77f0a4ba6698893b
+216 62dd3a7af553f6a8 62dd3a7af553f6a8 62dd3a7af553f6a8 629f68810fa60819 24875ab9a3159404 630b2acd5c163c9b 630b2acd5c163c9b 630b2acd5c163c9b 630b2acd5c163c9b
+217 4eb3767783d32750 4eb3767783d32750 4eb3767783d32750 de4211428bdda163 4842461b14c6bb14 833c14d3c7720fb9 833c14d3c7720fb9 833c14d3c7720fb9 833c14d3c7720fb9
+218 01e75b4efc2b3971 01e75b4efc2b3971 01e75b4efc2b3971 01a509b506dec7c0 6f84145b380c75b8 43c8f57b1bde7e7a 43c8f57b1bde7e7a 43c8f57b1bde7e7a 43c8f57b1bde7e7a
+219 3de61f4a5b8002c5 3de61f4a5b8002c5 3de61f4a5b8002c5 ad17787f538e84f6 10abd45c377f81d9 da05e686056c166f da05e686056c166f da05e686056c166f da05e686056c166f
+220 b89e64f9408c68bc b89e64f9408c68bc b89e64f9408c68bc b8dc3602ba79960d b05d88cef40ed1a7 36ee8a1d9aa82f81 36ee8a1d9aa82f81 36ee8a1d9aa82f81 36ee8a1d9aa82f81
+221 8417d83dc45137b4 8417d83dc45137b4 8417d83dc45137b4 14e6bf08cc5fb187 0a64b46feac8ff87 849d4c28ef42b55b 849d4c28ef42b55b 849d4c28ef42b55b 849d4c28ef42b55b
+222 a6bdea9491189dce a6bdea9491189dce a6bdea9491189dce a6ffb86f6bed637f 1d7e12725b9bee12 de1e8d2138466a71 de1e8d2138466a71 de1e8d2138466a71 de1e8d2138466a71
+223 5f34cd1d80ccd2a9 5f34cd1d80ccd2a9 5f34cd1d80ccd2a9 cfc5aa2888c2549a 4445b82cae50b1c6 35e34d0060b667c7 35e34d0060b667c7 35e34d0060b667c7 35e34d0060b667c7
+224 200c445d22d908dd 200c445d22d908dd 200c445d22d908dd 204e16a6d82cf66c b2163ab5d2c52084 75c7c8f331471f3c 75c7c8f331471f3c 75c7c8f331471f3c 75c7c8f331471f3c
+225 e10ac29715b79ae2 e10ac29715b79ae2 e10ac29715b79ae2 71fba5a21db91cd1 4d6ff58b09d6e906 e5f38324f32245a4 e5f38324f32245a4 e5f38324f32245a4 e5f38324f32245a4
+226 ea252f13a6805858 ea252f13a6805858 ea252f13a6805858 ea677de85c75a6e9 b359bf034f23195d 091556e8316e41e6 1c8bb607fcc8128f 1c8bb607fcc8128f 1c8bb607fcc8128f
+227 a4b561cf9daf9e0a a4b561cf9daf9e0a a4b561cf9daf9e0a 344406fa95a11839 0566f0ea8aad090c 7a8e97b4113b5eee 7a8e97b4113b5eee 7a8e97b4113b5eee 7a8e97b4113b5eee
+228 6387e7d76e8abe61 6387e7d76e8abe61 6387e7d76e8abe61 63c5b52c947f40d0 12cb5ccf0fea0e68 e5d9ae736ec1b18b e5d9ae736ec1b18b e5d9ae736ec1b18b e5d9ae736ec1b18b
+229 7b42ec48d01dd939 7b42ec48d01dd939 c53f763406bc2292 55ce11010eb2a4a1 f0a9a57421293a03 238e6384a445963f 238e6384a445963f 238e6384a445963f 238e6384a445963f
+230 1d276eb6d6c06358 1d276eb6d6c06358 1d276eb6d6c06358 1d653c4d2c359de9 439a3f3be9eae0cd b44f48bba506e8cc 8bd600a49b5e88e6 8bd600a49b5e88e6 8bd600a49b5e88e6
+231 f9850aa7b2ab6b7c f9850aa7b2ab6b7c f9850aa7b2ab6b7c 69746d92baa5ed4f 65b47d583afed9e5 d6471696fd3b299d 708197ef06e88f2d 708197ef06e88f2d 708197ef06e88f2d
+232 bd3d38279fa2cd5e bd3d38279fa2cd5e bd3d38279fa2cd5e bd7f6adc655733ef 2355cb3ac213064f 781f10e1782a0493 781f10e1782a0493 781f10e1782a0493 781f10e1782a0493
+233 d11566bec0919408 d11566bec0919408 d11566bec0919408 41e4018bc89f123b b500061d1bd6eb3b 037887ebe6adde1b 037887ebe6adde1b 037887ebe6adde1b 037887ebe6adde1b
+234 5556fd93ba415f9c 5556fd93ba415f9c 5556fd93ba415f9c 5514af6840b4a12d 5d05684d881bb66b 0be8f8d9776ccecc 0be8f8d9776ccecc 0be8f8d9776ccecc 0be8f8d9776ccecc
+235 8df31992a187048a 8df31992a187048a 8df31992a187048a 1d027ea7a98982b9 f9c4963d7f3455d7 2e056d73b7fa5671 2e056d73b7fa5671 2e056d73b7fa5671 2e056d73b7fa5671
+236 e1631225c522c415 e1631225c522c415 e1631225c522c415 e12140de3fd73aa4 2af308c84949cd37 c66d5bb7daa97584 c66d5bb7daa97584 c66d5bb7daa97584 c66d5bb7daa97584
+237 93bcb4f2fcba612f 93bcb4f2fcba612f 93bcb4f2fcba612f 034dd3c7f4b4e71c 31cf90d646996a33 993a8c9e99686fea 993a8c9e99686fea 993a8c9e99686fea 993a8c9e99686fea
+238 25c34a4ce9b73ac6 25c34a4ce9b73ac6 25c34a4ce9b73ac6 258118b71342c477 551a9b6e849ea67a af1bb628b41147a4 af1bb628b41147a4 af1bb628b41147a4 af1bb628b41147a4
+239 9f57a8935d7c0a1e 9f57a8935d7c0a1e f405c635ebf9ce04 64f4a100e3f74837 e3c3639ec0c31522 954863e44c5191ce 954863e44c5191ce 954863e44c5191ce 954863e44c5191ce
+240 6038c7fff9b333f0 6038c7fff9b333f0 6038c7fff9b333f0 607a95040346cd41 7429d9bafca3b8c8 d66bb10156aee5a8 d66bb10156aee5a8 d66bb10156aee5a8 d66bb10156aee5a8
+241 618363cd89289856 618363cd89289856 618363cd89289856 f17204f881261e65 91179ffd52f32720 4f8e4d4205310cf7 4f8e4d4205310cf7 4f8e4d4205310cf7 4f8e4d4205310cf7
+242 0dbf0a10bf2ff1a9 0dbf0a10bf2ff1a9 0dbf0a10bf2ff1a9 0dfd58eb45da0f18 98c33e8078be84a0 beccf7dedbed70c4 beccf7dedbed70c4 beccf7dedbed70c4 beccf7dedbed70c4
+243 4c673ffca51319ef 4c673ffca51319ef 4c673ffca51319ef dc9658c9ad1d9fdc 6845b56f11fce5a9 06073ba279b9371c 06073ba279b9371c 06073ba279b9371c 06073ba279b9371c
+244 c1db050f2b007784 c1db050f2b007784 c1db050f2b007784 c19957f4d1f58935 a965c1523216f45d 76d41a33b72a0e0c 76d41a33b72a0e0c 76d41a33b72a0e0c 76d41a33b72a0e0c
+245 0e5c85e541507862 0e5c85e541507862 0e5c85e541507862 9eade2d0495efe51 4babceb68ced1e38 30685a020bcab4b6 30685a020bcab4b6 30685a020bcab4b6 30685a020bcab4b6
+246 742f461313dd1a4f 742f461313dd1a4f 742f461313dd1a4f 746d14e8e928e4fe a71ba93193483eaa f0afa1150223a624 f0afa1150223a624 f0afa1150223a624 f0afa1150223a624
+247 061319f24a081e94 061319f24a081e94 061319f24a081e94 96e27ec7420698a7 a8b59709bd3dc4f9 2d52285c831ea059 2d52285c831ea059 2d52285c831ea059 2d52285c831ea059
+248 bfb254b96562f72e bfb254b96562f72e bfb254b96562f72e bff006429f97099f 5fc74e69a23c3db9 26de3ad018491bc6 26de3ad018491bc6 26de3ad018491bc6 26de3ad018491bc6
+249 87c98c35c8829b55 87c98c35c8829b55 87c98c35c8829b55 1738eb00c08c1d66 5777d73b80d973f0 1bb0b3655b811611 1bb0b3655b811611 1bb0b3655b811611 1bb0b3655b811611
+250 04502b40a6517530 04502b40a6517530 04502b40a6517530 041279bb5ca48b81 33c71b733e92c5a8 d79bb1814cccb8f6 d79bb1814cccb8f6 d79bb1814cccb8f6 d79bb1814cccb8f6
+251 3ecd375eec414d8e 3ecd375eec414d8e 3ecd375eec414d8e ae3c506be44fcbbd e5dbcb60d483becf b0ec5c80e6c217ab b0ec5c80e6c217ab b0ec5c80e6c217ab b0ec5c80e6c217ab
+252 6ac08e09365e8d48 6ac08e09365e8d48 6ac08e09365e8d48 6a82dcf2ccab73f9 028d128ef336913e f1ccc09f60af3f54 f1ccc09f60af3f54 f1ccc09f60af3f54 f1ccc09f60af3f54
+253 ddf37e08e9718444 ddf37e08e9718444 ddf37e08e9718444 4d02193de17f0277 55bcc12fd8299813 9e31cc1cd3c12cf4 9e31cc1cd3c12cf4 9e31cc1cd3c12cf4 9e31cc1cd3c12cf4
+254 bce391785d36c91b bce391785d36c91b bce391785d36c91b bca1c383a7c337aa 9131b9d7e9b9d1db 731d177f22170e32 731d177f22170e32 731d177f22170e32 731d177f22170e32
+255 067fecf069584cbe 067fecf069584cbe 067fecf069584cbe 968e8bc56156ca8d 85b0b73c428d6725 697833b812ab7f98 697833b812ab7f98 697833b812ab7f98 697833b812ab7f98
+256 20977f5dff570787 20977f5dff570787 20977f5dff570787 20d52da605a2f936 86d2ac88973ba040 3615d863616eb17a 3615d863616eb17a 3615d863616eb17a 3615d863616eb17a
+257 4ba598a93c6636b5 4ba598a93c6636b5 4ba598a93c6636b5 db54ff9c3468b086 f8b729730e71f468 18d871877785acd1 18d871877785acd1 18d871877785acd1 18d871877785acd1
+258 56e5d8df5c35aedc 56e5d8df5c35aedc 56e5d8df5c35aedc 56a78a24a6c0506d bdcc6c2dfdb02db7 e562d12c0035a617 e562d12c0035a617 e562d12c0035a617 e562d12c0035a617
+259 8b4dfb4a830fb643 8b4dfb4a830fb643 4d866f7503381177 f1d6cf0f201a0762 7d9c1a3705706f62 5506735db82f4be0 5506735db82f4be0 5506735db82f4be0 5506735db82f4be0
+260 0e9840479113a603 0e9840479113a603 0e9840479113a603 0eda12bc6be658b2 655fd8b7ce173718 c3f5297a2e3648da c3f5297a2e3648da c3f5297a2e3648da c3f5297a2e3648da
+261 ce30e40a8fa0f53a ce30e40a8fa0f53a ce30e40a8fa0f53a 5ec1833f87ae7309 c187c4d7f816a131 b9382213774c4dd2 b9382213774c4dd2 b9382213774c4dd2 b9382213774c4dd2
+262 c09099214bcb9987 c09099214bcb9987 c09099214bcb9987 c0d2cbdab13e6736 51e3b481638915eb d9f640b27a8d9a4f d9f640b27a8d9a4f d9f640b27a8d9a4f d9f640b27a8d9a4f
+263 95b75b532d6317f6 95b75b532d6317f6 95b75b532d6317f6 05463c66256d91c5 3260c0111aa55614 2f6f9a63248f2613 2f6f9a63248f2613 2f6f9a63248f2613 2f6f9a63248f2613
+264 a651122726fb4716 a651122726fb4716 a651122726fb4716 a61340dcdc0eb9a7 991fa87d5049014d 73031dbfa0420a2d 73031dbfa0420a2d 73031dbfa0420a2d 73031dbfa0420a2d
+265 fafa1cca1b17df17 fafa1cca1b17df17 fafa1cca1b17df17 6a0b7bff13195924 f1fdd28c300b07cb 75324c8b48ccf76f 75324c8b48ccf76f 75324c8b48ccf76f 75324c8b48ccf76f
+266 95e16f615af5f936 95e16f615af5f936 95e16f615af5f936 95a33d9aa0000787 15285513dc8a2f27 4869cf38d6c6d090 4869cf38d6c6d090 4869cf38d6c6d090 4869cf38d6c6d090
+267 31d0fb5127926f33 31d0fb5127926f33 31d0fb5127926f33 a1219c642f9ce900 17b231a9835903e8 77743fa755126fd0 77743fa755126fd0 77743fa755126fd0 77743fa755126fd0
+268 e26aed04fd444ed0 e26aed04fd444ed0 929a16cb4b2e2e46 92d84430b1dbd0f7 2cc53ca17c88e78e e5e932514463a119 e5e932514463a119 e5e932514463a119 e5e932514463a119
+269 d5c590087715237f d5c590087715237f d5c590087715237f 4534f73d7f1ba54c 58732afa43ffaaf2 9ac91fb0acd12840 9ac91fb0acd12840 9ac91fb0acd12840 9ac91fb0acd12840
+270 dae429d7e564008f dae429d7e564008f dae429d7e564008f daa67b2c1f91fe3e 6fa47c2c93c91c2a 7f6842a4b2f0e930 7f6842a4b2f0e930 7f6842a4b2f0e930 7f6842a4b2f0e930
+271 8a762710216c4e4e 8a762710216c4e4e 8a762710216c4e4e 1a8740252962c87d 19cadd04cdc14ca8 2c39a9d4a151d3a1 2c39a9d4a151d3a1 2c39a9d4a151d3a1 2c39a9d4a151d3a1
+272 bcd002b6fea57bef bcd002b6fea57bef bcd002b6fea57bef bc92504d0450855e f8c4f45fa8bad18d 560d00f937ae6b82 560d00f937ae6b82 560d00f937ae6b82 560d00f937ae6b82
+273 5daeefed2795acfe 5daeefed2795acfe 5daeefed2795acfe cd5f88d82f9b2acd b80c37f18821d28a 7711cce232ab02de 7711cce232ab02de 7711cce232ab02de 7711cce232ab02de
+274 83d590446400346d 83d590446400346d 83d590446400346d 8397c2bf9ef5cadc 6994c70817bf1d12 d93378c62a6b026f d93378c62a6b026f d93378c62a6b026f d93378c62a6b026f
+275 9a926b57848da162 9a926b57848da162 9a926b57848da162 0a630c628c832751 7fe1fa43aa63ed82 3ac9270ac88bab0d 3ac9270ac88bab0d 3ac9270ac88bab0d 3ac9270ac88bab0d
+276 aabb8e63b18d6040 aabb8e63b18d6040 aabb8e63b18d6040 aaf9dc984b789ef1 2ea5190567ef4f59 b5f33dcc1b796cbb b5f33dcc1b796cbb b5f33dcc1b796cbb b5f33dcc1b796cbb
+277 0c8443201a7f25ea 0c8443201a7f25ea 0c8443201a7f25ea 9c7524151271a3d9 a8ec21d4a3b896b5 f8fbc60fe9d86777 f8fbc60fe9d86777 f8fbc60fe9d86777 f8fbc60fe9d86777
+278 ff42e4f972a36d74 ff42e4f972a36d74 ff42e4f972a36d74 ff00b602885693c5 59e23e678bda1b4d ad2427fa7f63199f ad2427fa7f63199f ad2427fa7f63199f ad2427fa7f63199f
+279 57e705689ae6f039 57e705689ae6f039 57e705689ae6f039 c716625d92e8760a 84ddd8dac1cdd2b4 1518da0603394c43 1518da0603394c43 1518da0603394c43 1518da0603394c43
+280 c6d059f0773073a5 c6d059f0773073a5 c6d059f0773073a5 c6920b0b8dc58d14 854792b1c347c603 6f32f7e127a2020d 6f32f7e127a2020d 6f32f7e127a2020d 6f32f7e127a2020d
+281 0796d90bea818f8c 0796d90bea818f8c 0796d90bea818f8c 9767be3ee28f09bf 60c177e05a2787c3 8e094b0e262e068b 8e094b0e262e068b 8e094b0e262e068b 8e094b0e262e068b
+282 3b00a477da8dad9e 3b00a477da8dad9e 3b00a477da8dad9e 3b42f68c2078532f ae5bdbc8c43ef470 5d41f023b96d6649 5d41f023b96d6649 5d41f023b96d6649 5d41f023b96d6649
+283 d9ff07ff17421187 d9ff07ff17421187 d9ff07ff17421187 490e60ca1f4c97b4 e2cb9884d2e071ad 07ee95982122a396 07ee95982122a396 07ee95982122a396 07ee95982122a396
+284 389fe7db96f4261a 389fe7db96f4261a 389fe7db96f4261a 38ddb5206c01d8ab 1d80e19e49b33b02 6befde320b2362da 6befde320b2362da 6befde320b2362da 6befde320b2362da
+285 123aa5bfa23a2fcf 123aa5bfa23a2fcf 123aa5bfa23a2fcf 82cbc28aaa34a9fc c9ba57913ed70cf5 69a7314162bb0e8c b5a2d6cd3c818853 b5a2d6cd3c818853 b5a2d6cd3c818853
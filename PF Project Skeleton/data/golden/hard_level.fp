@@ -0,0 +1,23 @@
+# tick spawn route counters queue move flip arrivals halt signals
+0 33705bd196a3a3c8 e6f33705bfa5df80 e6f33705bfa5df80 e6f33705bfa5df80 e6f33705bfa5df80 e6f33705bfa5df80 e6f33705bfa5df80 e6f33705bfa5df80 e6f33705bfa5df80
+1 dedca235ffe81b7a dedca235ffe81b7a dedca235ffe81b7a dedca235ffe81b7a dedca235ffe81b7a dedca235ffe81b7a dedca235ffe81b7a dedca235ffe81b7a dedca235ffe81b7a
+2 a11833aa967915ac a11833aa967915ac a11833aa967915ac a11833aa967915ac a11833aa967915ac a11833aa967915ac a11833aa967915ac a11833aa967915ac a11833aa967915ac
+3 4e104be84aa66280 10c5a331ed8f99de 10c5a331ed8f99de 10c5a331ed8f99de 10c5a331ed8f99de 10c5a331ed8f99de 10c5a331ed8f99de 10c5a331ed8f99de 10c5a331ed8f99de
+4 778adc31c99c25e0 778adc31c99c25e0 778adc31c99c25e0 778adc31c99c25e0 778adc31c99c25e0 778adc31c99c25e0 778adc31c99c25e0 778adc31c99c25e0 778adc31c99c25e0
+5 3fb6ad35e16067af 3fb6ad35e16067af 3fb6ad35e16067af 3fb6ad35e16067af 3fb6ad35e16067af 3fb6ad35e16067af 3fb6ad35e16067af 3fb6ad35e16067af 3fb6ad35e16067af
+6 e17a0d69e8e32fda 706bef4b83834468 706bef4b83834468 706bef4b83834468 706bef4b83834468 706bef4b83834468 706bef4b83834468 706bef4b83834468 706bef4b83834468
+7 f027e2bd7a44e9d7 f027e2bd7a44e9d7 f027e2bd7a44e9d7 f027e2bd7a44e9d7 f027e2bd7a44e9d7 f027e2bd7a44e9d7 f027e2bd7a44e9d7 f027e2bd7a44e9d7 f027e2bd7a44e9d7
+8 7ca0abebab03e722 7ca0abebab03e722 7ca0abebab03e722 7ca0abebab03e722 7ca0abebab03e722 7ca0abebab03e722 7ca0abebab03e722 7ca0abebab03e722 7ca0abebab03e722
+9 db3dc90ae78b5c89 977f80b833bb3762 977f80b833bb3762 977f80b833bb3762 977f80b833bb3762 977f80b833bb3762 977f80b833bb3762 977f80b833bb3762 977f80b833bb3762
+10 bea94bc90a95e2b7 bea94bc90a95e2b7 bea94bc90a95e2b7 bea94bc90a95e2b7 bea94bc90a95e2b7 bea94bc90a95e2b7 bea94bc90a95e2b7 bea94bc90a95e2b7 bea94bc90a95e2b7
+11 5a86e85833e8b76e 5a86e85833e8b76e 5a86e85833e8b76e 5a86e85833e8b76e 5a86e85833e8b76e 5a86e85833e8b76e 5a86e85833e8b76e 5a86e85833e8b76e 5a86e85833e8b76e
+12 61083a85f6ac6a76 fc085b995246c559 fc085b995246c559 fc085b995246c559 fc085b995246c559 fc085b995246c559 fc085b995246c559 fc085b995246c559 fc085b995246c559
+13 f99429869e4f2c88 f99429869e4f2c88 f99429869e4f2c88 f99429869e4f2c88 f99429869e4f2c88 f99429869e4f2c88 f99429869e4f2c88 f99429869e4f2c88 f99429869e4f2c88
+14 b019267c084212bc b019267c084212bc b019267c084212bc b019267c084212bc b019267c084212bc b019267c084212bc b019267c084212bc b019267c084212bc b019267c084212bc
+15 04a316cb7957278d 04a316cb7957278d 04a316cb7957278d 04a316cb7957278d f36859111c611dad f36859111c611dad f36859111c611dad f36859111c611dad f36859111c611dad
+16 ddb970ebd64de8ce 9487b38f199cedbf 9487b38f199cedbf 9487b38f199cedbf 9487b38f199cedbf 9487b38f199cedbf 9487b38f199cedbf 9487b38f199cedbf 9487b38f199cedbf
+17 868d448d76ac4b8a 868d448d76ac4b8a 868d448d76ac4b8a 868d448d76ac4b8a 868d448d76ac4b8a 868d448d76ac4b8a 868d448d76ac4b8a 868d448d76ac4b8a 868d448d76ac4b8a
+18 361986d69d48af9f 7f85b387a9a1ca4a 7f85b387a9a1ca4a 7f85b387a9a1ca4a 7f85b387a9a1ca4a 7f85b387a9a1ca4a 7f85b387a9a1ca4a 7f85b387a9a1ca4a 7f85b387a9a1ca4a
+19 5b198db584033096 5b198db584033096 5b198db584033096 5b198db584033096 5b198db584033096 5b198db584033096 5b198db584033096 5b198db584033096 5b198db584033096
+20 a88b45d50b638d59 a88b45d50b638d59 a88b45d50b638d59 a88b45d50b638d59 a88b45d50b638d59 a88b45d50b638d59 a88b45d50b638d59 a88b45d50b638d59 a88b45d50b638d59
+21 b557736c239eb34a 6298125c736f9756 6298125c736f9756 6298125c736f9756 6298125c736f9756 6298125c736f9756 6298125c736f9756 6298125c736f9756 6298125c736f9756
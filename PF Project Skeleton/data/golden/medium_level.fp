@@ -0,0 +1,17 @@
+# tick spawn route counters queue move flip arrivals halt signals
+0 97796ff1f91d6ef4 09099b55e56a7abf 09099b55e56a7abf 09099b55e56a7abf 09099b55e56a7abf 09099b55e56a7abf 09099b55e56a7abf 09099b55e56a7abf 09099b55e56a7abf
+1 31260e65a527be45 31260e65a527be45 31260e65a527be45 31260e65a527be45 31260e65a527be45 31260e65a527be45 31260e65a527be45 31260e65a527be45 31260e65a527be45
+2 4ee29ffaccb6b093 4ee29ffaccb6b093 4ee29ffaccb6b093 4ee29ffaccb6b093 4ee29ffaccb6b093 4ee29ffaccb6b093 4ee29ffaccb6b093 4ee29ffaccb6b093 4ee29ffaccb6b093
+3 1e4e9b05be331c48 59bf1d607243e909 59bf1d607243e909 59bf1d607243e909 59bf1d607243e909 59bf1d607243e909 59bf1d607243e909 59bf1d607243e909 59bf1d607243e909
+4 3ef0626056505537 3ef0626056505537 3ef0626056505537 3ef0626056505537 3ef0626056505537 3ef0626056505537 3ef0626056505537 3ef0626056505537 3ef0626056505537
+5 76cc13647eac1778 76cc13647eac1778 76cc13647eac1778 76cc13647eac1778 76cc13647eac1778 76cc13647eac1778 76cc13647eac1778 76cc13647eac1778 76cc13647eac1778
+6 812fc875be0e7062 5a2548295cc56cfa 5a2548295cc56cfa 5a2548295cc56cfa 5a2548295cc56cfa 5a2548295cc56cfa 5a2548295cc56cfa 5a2548295cc56cfa 5a2548295cc56cfa
+7 da6945dfa502c145 da6945dfa502c145 da6945dfa502c145 da6945dfa502c145 da6945dfa502c145 da6945dfa502c145 da6945dfa502c145 da6945dfa502c145 da6945dfa502c145
+8 56ee0c897445cfb0 56ee0c897445cfb0 56ee0c897445cfb0 56ee0c897445cfb0 56ee0c897445cfb0 56ee0c897445cfb0 56ee0c897445cfb0 56ee0c897445cfb0 56ee0c897445cfb0
+9 f1b26c4a03bd20f5 f1b26c4a03bd20f5 f1b26c4a03bd20f5 f1b26c4a03bd20f5 f1b26c4a03bd20f5 f1b26c4a03bd20f5 f1b26c4a03bd20f5 f1b26c4a03bd20f5 f1b26c4a03bd20f5
+10 e0fb725441361d4c 310ccccef4a18958 310ccccef4a18958 310ccccef4a18958 310ccccef4a18958 310ccccef4a18958 310ccccef4a18958 310ccccef4a18958 310ccccef4a18958
+11 d5236f5fcddcdc81 d5236f5fcddcdc81 d5236f5fcddcdc81 d5236f5fcddcdc81 d5236f5fcddcdc81 d5236f5fcddcdc81 d5236f5fcddcdc81 d5236f5fcddcdc81 d5236f5fcddcdc81
+12 d79abeed8a02426b d79abeed8a02426b d79abeed8a02426b d79abeed8a02426b d79abeed8a02426b d79abeed8a02426b d79abeed8a02426b d79abeed8a02426b d79abeed8a02426b
+13 b98288bb6ebe1f1d b98288bb6ebe1f1d b98288bb6ebe1f1d b98288bb6ebe1f1d b98288bb6ebe1f1d b98288bb6ebe1f1d b98288bb6ebe1f1d b98288bb6ebe1f1d b98288bb6ebe1f1d
+14 cc313a74e3075767 cc313a74e3075767 cc313a74e3075767 cc313a74e3075767 cc313a74e3075767 cc313a74e3075767 cc313a74e3075767 cc313a74e3075767 cc313a74e3075767
+15 bdbb58421db04807 e9e9ace5356ce0e3 e9e9ace5356ce0e3 e9e9ace5356ce0e3 e9e9ace5356ce0e3 e9e9ace5356ce0e3 e9e9ace5356ce0e3 e9e9ace5356ce0e3 e9e9ace5356ce0e3
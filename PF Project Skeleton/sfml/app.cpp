@@ -4,9 +4,17 @@
 #include "../core/grid.h"
 #include "../core/switches.h"
 #include "../core/io.h"
+#include "../core/scheduler.h"
+#include "../core/reach.h"
+#include "../core/advisor.h"
+#include "../core/heatmap.h"
+#include "../core/halt.h"
+#include "chunks.h"
 #include <SFML/Graphics.hpp>
 #include <cmath>
 #include <cstdio>
+#include <algorithm>
+#include <thread>
 
 // ============================================================================
 // APP.CPP - Implementation of SFML application (NO CLASSES)
@@ -17,6 +25,7 @@
 // ----------------------------------------------------------------------------
 static sf::RenderWindow* g_window = nullptr;
 static sf::Font g_font;
+static bool g_fontLoaded = false;
 
 // View for camera (panning/zoom)
 static sf::View g_camera;
@@ -24,6 +33,8 @@ static sf::View g_camera;
 // Simulation state
 static bool g_isPaused = false;
 static bool g_isStepMode = false;
+static bool g_isComplete = false;
+static bool g_exitRequested = false;
 
 // Mouse state
 static bool g_isDragging = false;
@@ -35,6 +46,33 @@ static float g_cellSize = 40.0f;
 static float g_gridOffsetX = 50.0f;
 static float g_gridOffsetY = 50.0f;
 
+// Train quads of the visible area, refilled every frame
+static sf::VertexArray g_trainQuads(sf::Quads);
+static int g_chunksDrawn = 0;
+
+// Congestion overlay (H), refilled every frame while on
+static bool g_heatOverlay = false;
+static sf::VertexArray g_heatQuads(sf::Quads);
+
+// Emergency halt zones (E at the hovered tile), refilled every frame while any
+static sf::VertexArray g_haltQuads(sf::Quads);
+const int GUI_HALT_TICKS = 20;
+
+// Lookahead advisor (L): restarted when the tick, switches or hovered tile change
+static bool g_advisorOn = false;
+static bool g_advisorStale = true;
+static int g_advisorTileX = -1;
+static int g_advisorTileY = -1;
+const int ADVISOR_HORIZON = 40;
+const double ADVISOR_BUDGET = 0.25;
+
+// Train colours by TRAIN_COLOR_INDEX
+static const sf::Color TRAIN_COLORS[] = {
+    sf::Color(220, 50, 50), sf::Color(50, 160, 220), sf::Color(240, 200, 40),
+    sf::Color(200, 80, 200), sf::Color(60, 200, 120), sf::Color(240, 130, 40)
+};
+static const int NUM_TRAIN_COLORS = sizeof(TRAIN_COLORS) / sizeof(TRAIN_COLORS[0]);
+
 // ----------------------------------------------------------------------------
 // INITIALIZATION
 // ----------------------------------------------------------------------------
@@ -46,6 +84,347 @@ static float g_gridOffsetY = 50.0f;
 // the main loop.
 // ----------------------------------------------------------------------------
 bool initializeApp() {
+    g_window = new sf::RenderWindow(sf::VideoMode(1280, 800), "Switchback Rails");
+    g_window->setFramerateLimit(60);
+
+    // Text is optional: without a font only the map is drawn
+    g_fontLoaded = g_font.loadFromFile("assets/font.ttf") ||
+                   g_font.loadFromFile("/usr/share/fonts/truetype/dejavu/DejaVuSans.ttf");
+
+    // Start with the whole grid in view
+    g_camera = g_window->getDefaultView();
+    g_camera.setCenter(g_gridOffsetX + gridCols * g_cellSize * 0.5f,
+                       g_gridOffsetY + gridRows * g_cellSize * 0.5f);
+    float fit = std::max((gridCols * g_cellSize + 2 * g_gridOffsetX) / g_camera.getSize().x,
+                         (gridRows * g_cellSize + 2 * g_gridOffsetY) / g_camera.getSize().y);
+    if (fit > 1.0f) g_camera.zoom(fit);
+
+    initializeChunks(g_cellSize, g_gridOffsetX, g_gridOffsetY);
+    return true;
+}
+
+// ----------------------------------------------------------------------------
+// MOUSE TO TILE
+// ----------------------------------------------------------------------------
+// Grid tile under a window pixel; returns false outside the grid.
+// ----------------------------------------------------------------------------
+static bool mouseToTile(int mouseX, int mouseY, int& x, int& y) {
+    sf::Vector2f world = g_window->mapPixelToCoords(sf::Vector2i(mouseX, mouseY), g_camera);
+    y = (int)std::floor((world.x - g_gridOffsetX) / g_cellSize);
+    x = (int)std::floor((world.y - g_gridOffsetY) / g_cellSize);
+    return isInBounds(x, y);
+}
+
+// ----------------------------------------------------------------------------
+// HANDLE EVENT
+// ----------------------------------------------------------------------------
+// Keyboard controls, tile editing, camera pan and zoom. Edits mark only the
+// chunk holding the edited tile for rebuilding.
+// ----------------------------------------------------------------------------
+static void handleEvent(const sf::Event& event) {
+    if (event.type == sf::Event::Closed) {
+        g_exitRequested = true;
+    } else if (event.type == sf::Event::KeyPressed) {
+        if (event.key.code == sf::Keyboard::Escape) g_exitRequested = true;
+        else if (event.key.code == sf::Keyboard::Space) g_isPaused = !g_isPaused;
+        else if (event.key.code == sf::Keyboard::Period) g_isStepMode = true;
+        else if (event.key.code == sf::Keyboard::Add || event.key.code == sf::Keyboard::Equal) changeSimulationSpeed(1);
+        else if (event.key.code == sf::Keyboard::Subtract || event.key.code == sf::Keyboard::Hyphen) changeSimulationSpeed(-1);
+        else if (event.key.code == sf::Keyboard::Num0) setSimulationSpeed(0.0);
+        else if (event.key.code == sf::Keyboard::Num1) setSimulationSpeed(1.0);
+        else if (event.key.code == sf::Keyboard::H) g_heatOverlay = !g_heatOverlay;
+        else if (event.key.code == sf::Keyboard::E) {
+            int x, y;
+            sf::Vector2i mouse = sf::Mouse::getPosition(*g_window);
+            if (mouseToTile(mouse.x, mouse.y, x, y) && startHaltZone(x, y, haltZoneRange, GUI_HALT_TICKS) >= 0) {
+                g_advisorStale = true;
+            }
+        }
+        else if (event.key.code == sf::Keyboard::L) {
+            g_advisorOn = !g_advisorOn;
+            g_advisorStale = true;
+            if (!g_advisorOn) cancelLookahead();
+        }
+    } else if (event.type == sf::Event::MouseButtonPressed) {
+        int x, y;
+        if (event.mouseButton.button == sf::Mouse::Middle) {
+            g_isDragging = true;
+            g_lastMouseX = event.mouseButton.x;
+            g_lastMouseY = event.mouseButton.y;
+        } else if (mouseToTile(event.mouseButton.x, event.mouseButton.y, x, y)) {
+            if (event.mouseButton.button == sf::Mouse::Left && toggleSafetyTile(x, y)) {
+                markTileDirty(x, y);
+                g_advisorStale = true;
+            } else if (event.mouseButton.button == sf::Mouse::Right && isSwitchTile(x, y)) {
+                toggleSwitchState(getSwitchIndex(getTile(x, y)));
+                markChangedSwitches();
+                g_advisorStale = true;
+            }
+        }
+    } else if (event.type == sf::Event::MouseButtonReleased) {
+        if (event.mouseButton.button == sf::Mouse::Middle) g_isDragging = false;
+    } else if (event.type == sf::Event::MouseMoved && g_isDragging) {
+        // Convert the pixel delta to world units at the current zoom
+        float scale = g_camera.getSize().x / g_window->getSize().x;
+        g_camera.move((g_lastMouseX - event.mouseMove.x) * scale,
+                      (g_lastMouseY - event.mouseMove.y) * scale);
+        g_lastMouseX = event.mouseMove.x;
+        g_lastMouseY = event.mouseMove.y;
+    } else if (event.type == sf::Event::MouseWheelScrolled) {
+        g_camera.zoom(event.mouseWheelScroll.delta > 0 ? 0.9f : 1.0f / 0.9f);
+    }
+}
+
+// ----------------------------------------------------------------------------
+// ADVANCE SIMULATION
+// ----------------------------------------------------------------------------
+static void advanceSimulation() {
+    simulateOneTick();
+    syncTrainPositions();
+    markChangedSwitches();
+    g_isComplete = isSimulationComplete();
+}
+
+// ----------------------------------------------------------------------------
+// UPDATE ADVISOR
+// ----------------------------------------------------------------------------
+// Restart the lookahead from the current state when it went stale (new tick,
+// a toggle, or a different hovered track tile as the safety candidate);
+// otherwise just collect finished children.
+// ----------------------------------------------------------------------------
+static void updateAdvisor() {
+    if (!g_advisorOn || g_isComplete) return;
+
+    int x = -1, y = -1;
+    sf::Vector2i mouse = sf::Mouse::getPosition(*g_window);
+    if (!mouseToTile(mouse.x, mouse.y, x, y) || !isTrackTile(x, y)) x = y = -1;
+    if (x != g_advisorTileX || y != g_advisorTileY) {
+        g_advisorTileX = x;
+        g_advisorTileY = y;
+        g_advisorStale = true;
+    }
+
+    if (g_advisorStale || lookaheadTick != currentTick) {
+        int workers = std::max(1, std::min(4, (int)std::thread::hardware_concurrency()));
+        startLookahead(ADVISOR_HORIZON, workers, ADVISOR_BUDGET, g_advisorTileX, g_advisorTileY);
+        g_advisorStale = false;
+    } else {
+        pollLookahead();
+    }
+}
+
+// ----------------------------------------------------------------------------
+// DRAW TRAINS
+// ----------------------------------------------------------------------------
+// Only trains on visible tiles are drawn; zoomed out, the chunk occupancy
+// quads stand in for them.
+// ----------------------------------------------------------------------------
+static void drawTrains() {
+    int firstRow, lastRow, firstCol, lastCol;
+    if (isLowDetail(*g_window, g_camera)) return;
+    if (!getVisibleTiles(g_camera, firstRow, lastRow, firstCol, lastCol)) return;
+
+    float inset = g_cellSize * 0.15f;
+    float size = g_cellSize - 2 * inset;
+    g_trainQuads.clear();
+    for (int i = 0; i < numTrains; i++) {
+        if (trains[i][TRAIN_STATE] != TRAIN_ACTIVE) continue;
+        int x = trains[i][TRAIN_X], y = trains[i][TRAIN_Y];
+        if (x < firstRow || x > lastRow || y < firstCol || y > lastCol) continue;
+
+        float left = g_gridOffsetX + y * g_cellSize + inset;
+        float top = g_gridOffsetY + x * g_cellSize + inset;
+        sf::Color color = TRAIN_COLORS[trains[i][TRAIN_COLOR_INDEX] % NUM_TRAIN_COLORS];
+        g_trainQuads.append(sf::Vertex(sf::Vector2f(left, top), color));
+        g_trainQuads.append(sf::Vertex(sf::Vector2f(left + size, top), color));
+        g_trainQuads.append(sf::Vertex(sf::Vector2f(left + size, top + size), color));
+        g_trainQuads.append(sf::Vertex(sf::Vector2f(left, top + size), color));
+    }
+    g_window->draw(g_trainQuads);
+}
+
+// ----------------------------------------------------------------------------
+// DRAW HEAT OVERLAY
+// ----------------------------------------------------------------------------
+// Translucent squares over visible tiles with congestion, coloured against
+// the most congested visible tile.
+// ----------------------------------------------------------------------------
+static void drawHeatOverlay() {
+    int firstRow, lastRow, firstCol, lastCol;
+    if (!g_heatOverlay || !getVisibleTiles(g_camera, firstRow, lastRow, firstCol, lastCol)) return;
+
+    int maxHeat = 0;
+    for (int x = firstRow; x <= lastRow; x++) {
+        for (int y = firstCol; y <= lastCol; y++) maxHeat = std::max(maxHeat, getTileCongestion(x, y));
+    }
+    if (maxHeat == 0) return;
+
+    g_heatQuads.clear();
+    for (int x = firstRow; x <= lastRow; x++) {
+        for (int y = firstCol; y <= lastCol; y++) {
+            int heat = getTileCongestion(x, y);
+            if (heat == 0) continue;
+
+            int r, g, b;
+            getHeatColor(heat, maxHeat, r, g, b);
+            sf::Color color(r, g, b, 160);
+            float left = g_gridOffsetX + y * g_cellSize;
+            float top = g_gridOffsetY + x * g_cellSize;
+            g_heatQuads.append(sf::Vertex(sf::Vector2f(left, top), color));
+            g_heatQuads.append(sf::Vertex(sf::Vector2f(left + g_cellSize, top), color));
+            g_heatQuads.append(sf::Vertex(sf::Vector2f(left + g_cellSize, top + g_cellSize), color));
+            g_heatQuads.append(sf::Vertex(sf::Vector2f(left, top + g_cellSize), color));
+        }
+    }
+    g_window->draw(g_heatQuads);
+}
+
+// ----------------------------------------------------------------------------
+// DRAW HALT ZONES
+// ----------------------------------------------------------------------------
+// Translucent red squares over visible track tiles inside a halt zone.
+// ----------------------------------------------------------------------------
+static void drawHaltZones() {
+    int firstRow, lastRow, firstCol, lastCol;
+    if (numHaltZones == 0 || !getVisibleTiles(g_camera, firstRow, lastRow, firstCol, lastCol)) return;
+
+    sf::Color color(230, 40, 40, 110);
+    g_haltQuads.clear();
+    for (int x = firstRow; x <= lastRow; x++) {
+        for (int y = firstCol; y <= lastCol; y++) {
+            if (!isHaltTile(x, y)) continue;
+            float left = g_gridOffsetX + y * g_cellSize;
+            float top = g_gridOffsetY + x * g_cellSize;
+            g_haltQuads.append(sf::Vertex(sf::Vector2f(left, top), color));
+            g_haltQuads.append(sf::Vertex(sf::Vector2f(left + g_cellSize, top), color));
+            g_haltQuads.append(sf::Vertex(sf::Vector2f(left + g_cellSize, top + g_cellSize), color));
+            g_haltQuads.append(sf::Vertex(sf::Vector2f(left, top + g_cellSize), color));
+        }
+    }
+    g_window->draw(g_haltQuads);
+}
+
+// ----------------------------------------------------------------------------
+// HOVERED TRAIN
+// ----------------------------------------------------------------------------
+// Describe the active train under the mouse and when it will arrive under
+// the current switch states; empty if there is none.
+// ----------------------------------------------------------------------------
+static void describeHoveredTrain(char* out, int size) {
+    out[0] = '\0';
+    int x, y;
+    sf::Vector2i mouse = sf::Mouse::getPosition(*g_window);
+    if (!mouseToTile(mouse.x, mouse.y, x, y)) return;
+
+    for (int i = 0; i < numTrains; i++) {
+        if (trains[i][TRAIN_STATE] != TRAIN_ACTIVE) continue;
+        if (trains[i][TRAIN_X] != x || trains[i][TRAIN_Y] != y) continue;
+
+        // Streaming schedules reuse slots, so name the train by its ID
+        int trainID = trains[i][TRAIN_ID];
+        int tiles = getTrainTilesToDestination(i);
+        if (tiles == REACH_NEVER) snprintf(out, size, " | Train %d will not arrive", trainID);
+        else snprintf(out, size, " | Train %d arrives in %d tiles", trainID, tiles);
+        return;
+    }
+}
+
+// ----------------------------------------------------------------------------
+// DRAW STATUS
+// ----------------------------------------------------------------------------
+static void drawStatus() {
+    if (!g_fontLoaded) return;
+    char speed[64];
+    if (getSimulationSpeed() > 0.0) {
+        snprintf(speed, sizeof(speed), "x%g %.1f/%.1f t/s", getSimulationSpeed(),
+                 getAchievedTickRate(), getTargetTickRate());
+    } else {
+        snprintf(speed, sizeof(speed), "max %.1f t/s", getAchievedTickRate());
+    }
+
+    char hovered[64];
+    describeHoveredTrain(hovered, sizeof(hovered));
+
+    char status[256];
+    snprintf(status, sizeof(status), "Tick %d | Delivered %d | Crashed %d | %s | Chunks %d%s%s%s",
+             currentTick, trainsDelivered, trainsCrashed, speed, g_chunksDrawn,
+             isLowDetail(*g_window, g_camera) ? " (overview)" : "", hovered,
+             g_isComplete ? " | COMPLETE" : (g_isPaused ? " | PAUSED" : ""));
+
+    sf::Text text(status, g_font, 16);
+    text.setPosition(10.0f, 8.0f);
+    text.setFillColor(sf::Color::White);
+    g_window->setView(g_window->getDefaultView());
+    g_window->draw(text);
+}
+
+// ----------------------------------------------------------------------------
+// DRAW ADVISOR
+// ----------------------------------------------------------------------------
+// One line each for "do nothing", the best candidate and the hovered safety
+// tile, under the status line.
+// ----------------------------------------------------------------------------
+static void describeCandidate(int c, char* out, int size) {
+    const int* r = lookahead[c];
+    char action[32];
+    if (r[LOOKAHEAD_ACTION] == LOOKAHEAD_SWITCH) snprintf(action, sizeof(action), "toggle switch %c", 'A' + r[LOOKAHEAD_ARG]);
+    else if (r[LOOKAHEAD_ACTION] == LOOKAHEAD_SAFETY) snprintf(action, sizeof(action), "toggle safety here");
+    else snprintf(action, sizeof(action), "do nothing");
+
+    if (r[LOOKAHEAD_STATUS] == LOOKAHEAD_DONE) {
+        snprintf(out, size, "%s: +%d delivered, +%d crashed, %d wait", action,
+                 r[LOOKAHEAD_DELIVERED], r[LOOKAHEAD_CRASHED], r[LOOKAHEAD_WAIT]);
+    } else {
+        snprintf(out, size, "%s: %s", action,
+                 r[LOOKAHEAD_STATUS] == LOOKAHEAD_TIMED_OUT ? "timed out" : "...");
+    }
+}
+
+static void drawAdvisor() {
+    if (!g_fontLoaded || !g_advisorOn || lookaheadTick < 0) return;
+
+    int done = 0;
+    for (int c = 0; c < numLookahead; c++) {
+        if (lookahead[c][LOOKAHEAD_STATUS] == LOOKAHEAD_DONE) done++;
+    }
+    char lines[4][96];
+    int numLines = 0;
+    snprintf(lines[numLines++], sizeof(lines[0]), "Next %d ticks (%d/%d evaluated)",
+             lookaheadHorizon, done, numLookahead);
+    describeCandidate(0, lines[numLines++], sizeof(lines[0]));
+    int best = getBestLookahead();
+    if (best > 0) {
+        char text[80];
+        describeCandidate(best, text, sizeof(text));
+        snprintf(lines[numLines++], sizeof(lines[0]), "Best: %s", text);
+    }
+    int safety = numLookahead - 1;
+    if (safety > 0 && safety != best && lookahead[safety][LOOKAHEAD_ACTION] == LOOKAHEAD_SAFETY) {
+        describeCandidate(safety, lines[numLines++], sizeof(lines[0]));
+    }
+
+    g_window->setView(g_window->getDefaultView());
+    for (int i = 0; i < numLines; i++) {
+        sf::Text text(lines[i], g_font, 14);
+        text.setPosition(10.0f, 30.0f + 18.0f * i);
+        text.setFillColor(sf::Color(200, 220, 255));
+        g_window->draw(text);
+    }
+}
+
+// ----------------------------------------------------------------------------
+// RENDER FRAME
+// ----------------------------------------------------------------------------
+static void renderFrame() {
+    g_window->clear(sf::Color(25, 25, 30));
+    g_window->setView(g_camera);
+    g_chunksDrawn = drawChunks(*g_window, g_camera);
+    drawHeatOverlay();
+    drawHaltZones();
+    drawTrains();
+    drawStatus();
+    drawAdvisor();
+    g_window->display();
 }
 
 // ----------------------------------------------------------------------------
@@ -54,12 +433,45 @@ bool initializeApp() {
 // This function will run the main application loop. It handles event processing,
 // simulation updates, and rendering. The loop continues while the window is open.
 // It processes SFML events (window close, keyboard input, mouse input), updates
-// the simulation at a fixed interval (2 ticks per second) when not paused,
+// the simulation on the tick scheduler (2 ticks per second times the speed
+// multiplier, several ticks per frame when behind) when not paused,
 // checks if the simulation is complete, and renders the current frame. Keyboard
-// controls: SPACE to pause/resume, PERIOD to step one tick, ESC to exit. The
-// loop exits when the window is closed or ESC is pressed.
+// controls: SPACE to pause/resume, PERIOD to step one tick, +/- to change
+// speed, 0 for maximum speed, 1 for normal speed, H for the congestion
+// overlay, L for the lookahead advisor, ESC to exit. The
+// loop exits when the window is closed or ESC is pressed; if the simulation is
+// not complete at that point it calls shutdownSimulation to save metrics.
 // ----------------------------------------------------------------------------
 void runApp() {
+    g_isComplete = false;
+
+    while (g_window->isOpen() && !g_exitRequested) {
+        sf::Event event;
+        while (g_window->pollEvent(event)) {
+            handleEvent(event);
+        }
+
+        beginSchedulerFrame();
+        if (g_isPaused || g_isComplete) {
+            holdScheduler();
+        }
+        if (!g_isComplete && g_isStepMode) {
+            advanceSimulation();
+        } else {
+            while (!g_isPaused && !g_isComplete && isTickDue()) {
+                advanceSimulation();
+            }
+        }
+        g_isStepMode = false;
+
+        updateAdvisor();
+        renderFrame();
+    }
+    cancelLookahead();
+
+    if (!g_isComplete) {
+        shutdownSimulation();
+    }
 }
 
 // ----------------------------------------------------------------------------
@@ -71,4 +483,9 @@ void runApp() {
 // proper resource cleanup.
 // ----------------------------------------------------------------------------
 void cleanupApp() {
+    if (g_window != nullptr) {
+        g_window->close();
+        delete g_window;
+        g_window = nullptr;
+    }
 }
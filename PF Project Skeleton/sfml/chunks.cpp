@@ -0,0 +1,242 @@
+#include "chunks.h"
+#include "../core/grid.h"
+#include <cmath>
+#include <algorithm>
+
+// ============================================================================
+// CHUNKS.CPP - Chunk cache, culling and low-detail drawing (NO CLASSES)
+// ============================================================================
+
+// ----------------------------------------------------------------------------
+// CHUNK STATE
+// ----------------------------------------------------------------------------
+static sf::VertexArray chunkGeometry[MAX_CHUNK_ROWS][MAX_CHUNK_COLS];
+static bool chunkDirty[MAX_CHUNK_ROWS][MAX_CHUNK_COLS];
+static int chunkTrackTiles[MAX_CHUNK_ROWS][MAX_CHUNK_COLS];   // Counted at build time
+static int chunkTrains[MAX_CHUNK_ROWS][MAX_CHUNK_COLS];       // Recounted per low-detail frame
+static int numChunkRows = 0, numChunkCols = 0;
+
+// Switch states the chunks were last built with
+static int builtSwitchState[MAX_SWITCHES];
+
+// Low-detail quads, refilled every zoomed-out frame
+static sf::VertexArray lodQuads(sf::Quads);
+
+static float chunkCellSize = 40.0f;
+static float chunkOffsetX = 0.0f;
+static float chunkOffsetY = 0.0f;
+
+// ----------------------------------------------------------------------------
+// TILE COLOURS
+// ----------------------------------------------------------------------------
+static const sf::Color TRACK_COLOR(150, 150, 150);
+static const sf::Color SPAWN_COLOR(60, 180, 75);
+static const sf::Color DEST_COLOR(70, 110, 220);
+static const sf::Color SWITCH_COLORS[2] = {sf::Color(230, 150, 40), sf::Color(170, 90, 210)};
+static const sf::Color SAFETY_COLOR(240, 220, 60, 160);
+
+// ----------------------------------------------------------------------------
+// APPEND QUAD
+// ----------------------------------------------------------------------------
+static void appendQuad(sf::VertexArray& va, sf::Vector2f a, sf::Vector2f b,
+                       sf::Vector2f c, sf::Vector2f d, sf::Color color) {
+    va.append(sf::Vertex(a, color));
+    va.append(sf::Vertex(b, color));
+    va.append(sf::Vertex(c, color));
+    va.append(sf::Vertex(d, color));
+}
+
+static void appendRect(sf::VertexArray& va, float left, float top, float width, float height, sf::Color color) {
+    appendQuad(va, sf::Vector2f(left, top), sf::Vector2f(left + width, top),
+               sf::Vector2f(left + width, top + height), sf::Vector2f(left, top + height), color);
+}
+
+// ----------------------------------------------------------------------------
+// APPEND TILE
+// ----------------------------------------------------------------------------
+// Rails are thin bars through the tile centre; stations and switches fill
+// the tile; safety tiles get a translucent overlay.
+// ----------------------------------------------------------------------------
+static void appendTile(sf::VertexArray& va, int x, int y) {
+    char tile = getTile(x, y);
+    float s = chunkCellSize;
+    float left = chunkOffsetX + y * s;
+    float top = chunkOffsetY + x * s;
+    float bar = s * 0.2f;
+    float mid = (s - bar) * 0.5f;
+
+    if (tile == '-' || tile == '=') {
+        appendRect(va, left, top + mid, s, bar, TRACK_COLOR);
+    } else if (tile == '|') {
+        appendRect(va, left + mid, top, bar, s, TRACK_COLOR);
+    } else if (tile == '+') {
+        appendRect(va, left, top + mid, s, bar, TRACK_COLOR);
+        appendRect(va, left + mid, top, bar, s, TRACK_COLOR);
+    } else if (tile == '/') {
+        appendQuad(va, sf::Vector2f(left, top + s - bar), sf::Vector2f(left + s - bar, top),
+                   sf::Vector2f(left + s, top + bar), sf::Vector2f(left + bar, top + s), TRACK_COLOR);
+    } else if (tile == '\\') {
+        appendQuad(va, sf::Vector2f(left + bar, top), sf::Vector2f(left + s, top + s - bar),
+                   sf::Vector2f(left + s - bar, top + s), sf::Vector2f(left, top + bar), TRACK_COLOR);
+    } else if (tile == 'S') {
+        appendRect(va, left, top, s, s, SPAWN_COLOR);
+    } else if (tile == 'D') {
+        appendRect(va, left, top, s, s, DEST_COLOR);
+    } else if (isSwitchTile(x, y)) {
+        int sw = getSwitchIndex(tile);
+        int state = (sw >= 0 && sw < numSwitches) ? switches[sw][SWITCH_CURRENT_STATE] : 0;
+        appendRect(va, left, top, s, s, SWITCH_COLORS[state & 1]);
+    }
+
+    if (isSafetyTile(x, y) || tile == '=') {
+        appendRect(va, left, top, s, s, SAFETY_COLOR);
+    }
+}
+
+// ----------------------------------------------------------------------------
+// BUILD CHUNK
+// ----------------------------------------------------------------------------
+// Refill the chunk's vertex array (clear() keeps its capacity).
+// ----------------------------------------------------------------------------
+static void buildChunk(int cr, int cc) {
+    sf::VertexArray& va = chunkGeometry[cr][cc];
+    va.clear();
+    va.setPrimitiveType(sf::Quads);
+
+    int tracks = 0;
+    int lastRow = std::min(gridRows, (cr + 1) * CHUNK_TILES);
+    int lastCol = std::min(gridCols, (cc + 1) * CHUNK_TILES);
+    for (int x = cr * CHUNK_TILES; x < lastRow; x++) {
+        for (int y = cc * CHUNK_TILES; y < lastCol; y++) {
+            if (!isTrackTile(x, y)) continue;
+            tracks++;
+            appendTile(va, x, y);
+        }
+    }
+    chunkTrackTiles[cr][cc] = tracks;
+    chunkDirty[cr][cc] = false;
+}
+
+// ----------------------------------------------------------------------------
+// INITIALIZE CHUNKS
+// ----------------------------------------------------------------------------
+void initializeChunks(float cellSize, float offsetX, float offsetY) {
+    chunkCellSize = cellSize;
+    chunkOffsetX = offsetX;
+    chunkOffsetY = offsetY;
+    numChunkRows = (gridRows + CHUNK_TILES - 1) / CHUNK_TILES;
+    numChunkCols = (gridCols + CHUNK_TILES - 1) / CHUNK_TILES;
+
+    for (int cr = 0; cr < numChunkRows; cr++) {
+        for (int cc = 0; cc < numChunkCols; cc++) {
+            chunkDirty[cr][cc] = true;
+        }
+    }
+    for (int sw = 0; sw < numSwitches; sw++) {
+        builtSwitchState[sw] = switches[sw][SWITCH_CURRENT_STATE];
+    }
+}
+
+// ----------------------------------------------------------------------------
+// MARK DIRTY
+// ----------------------------------------------------------------------------
+void markTileDirty(int x, int y) {
+    if (!isInBounds(x, y)) return;
+    chunkDirty[x / CHUNK_TILES][y / CHUNK_TILES] = true;
+}
+
+void markChangedSwitches() {
+    for (int sw = 0; sw < numSwitches; sw++) {
+        int state = switches[sw][SWITCH_CURRENT_STATE];
+        if (state == builtSwitchState[sw]) continue;
+        builtSwitchState[sw] = state;
+        markTileDirty(switches[sw][SWITCH_X], switches[sw][SWITCH_Y]);
+    }
+}
+
+// ----------------------------------------------------------------------------
+// VISIBLE TILES
+// ----------------------------------------------------------------------------
+bool getVisibleTiles(const sf::View& view, int& firstRow, int& lastRow, int& firstCol, int& lastCol) {
+    sf::Vector2f center = view.getCenter();
+    sf::Vector2f size = view.getSize();
+    float left = center.x - size.x * 0.5f - chunkOffsetX;
+    float top = center.y - size.y * 0.5f - chunkOffsetY;
+
+    firstCol = std::max(0, (int)std::floor(left / chunkCellSize));
+    lastCol = std::min(gridCols - 1, (int)std::floor((left + size.x) / chunkCellSize));
+    firstRow = std::max(0, (int)std::floor(top / chunkCellSize));
+    lastRow = std::min(gridRows - 1, (int)std::floor((top + size.y) / chunkCellSize));
+    return firstRow <= lastRow && firstCol <= lastCol;
+}
+
+bool isLowDetail(const sf::RenderTarget& target, const sf::View& view) {
+    float tilePixels = chunkCellSize * target.getSize().x / view.getSize().x;
+    return tilePixels < LOD_TILE_PIXELS;
+}
+
+// ----------------------------------------------------------------------------
+// OCCUPANCY COLOUR
+// ----------------------------------------------------------------------------
+// Grey brightness follows track density; trains tint the chunk red.
+// ----------------------------------------------------------------------------
+static sf::Color occupancyColor(int cr, int cc) {
+    int tracks = chunkTrackTiles[cr][cc];
+    int occupied = chunkTrains[cr][cc];
+    if (tracks == 0) return sf::Color::Transparent;
+
+    sf::Uint8 base = (sf::Uint8)(40 + 120 * tracks / (CHUNK_TILES * CHUNK_TILES));
+    if (occupied == 0) return sf::Color(base, base, base);
+    int heat = std::min(255, 120 + occupied * 15);
+    return sf::Color((sf::Uint8)heat, base / 2, base / 2);
+}
+
+// ----------------------------------------------------------------------------
+// DRAW CHUNKS
+// ----------------------------------------------------------------------------
+int drawChunks(sf::RenderTarget& target, const sf::View& view) {
+    int firstRow, lastRow, firstCol, lastCol;
+    if (!getVisibleTiles(view, firstRow, lastRow, firstCol, lastCol)) return 0;
+
+    int firstCR = firstRow / CHUNK_TILES, lastCR = lastRow / CHUNK_TILES;
+    int firstCC = firstCol / CHUNK_TILES, lastCC = lastCol / CHUNK_TILES;
+    bool lowDetail = isLowDetail(target, view);
+
+    // Dirty chunks are rebuilt when they come into view
+    for (int cr = firstCR; cr <= lastCR; cr++) {
+        for (int cc = firstCC; cc <= lastCC; cc++) {
+            if (chunkDirty[cr][cc]) buildChunk(cr, cc);
+            if (!lowDetail) target.draw(chunkGeometry[cr][cc]);
+        }
+    }
+    int drawn = (lastCR - firstCR + 1) * (lastCC - firstCC + 1);
+    if (!lowDetail) return drawn;
+
+    // Zoomed out: one quad per chunk, coloured by its active trains
+    for (int cr = firstCR; cr <= lastCR; cr++) {
+        for (int cc = firstCC; cc <= lastCC; cc++) {
+            chunkTrains[cr][cc] = 0;
+        }
+    }
+    for (int i = 0; i < numTrains; i++) {
+        if (trains[i][TRAIN_STATE] != TRAIN_ACTIVE) continue;
+        int x = trains[i][TRAIN_X], y = trains[i][TRAIN_Y];
+        int cr = x / CHUNK_TILES, cc = y / CHUNK_TILES;
+        if (cr < firstCR || cr > lastCR || cc < firstCC || cc > lastCC) continue;
+        chunkTrains[cr][cc]++;
+    }
+
+    float chunkSize = chunkCellSize * CHUNK_TILES;
+    lodQuads.clear();
+    for (int cr = firstCR; cr <= lastCR; cr++) {
+        for (int cc = firstCC; cc <= lastCC; cc++) {
+            // Edge chunks only cover the rest of the grid
+            float width = std::min(CHUNK_TILES, gridCols - cc * CHUNK_TILES) * chunkCellSize;
+            float height = std::min(CHUNK_TILES, gridRows - cr * CHUNK_TILES) * chunkCellSize;
+            appendRect(lodQuads, chunkOffsetX + cc * chunkSize, chunkOffsetY + cr * chunkSize,
+                       width, height, occupancyColor(cr, cc));
+        }
+    }
+    target.draw(lodQuads);
+    return drawn;
+}
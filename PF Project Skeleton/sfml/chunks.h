@@ -0,0 +1,58 @@
+#ifndef CHUNKS_H
+#define CHUNKS_H
+
+#include "../core/simulation_state.h"
+#include <SFML/Graphics.hpp>
+
+// ============================================================================
+// CHUNKS.H - Chunked map geometry with view culling (NO CLASSES)
+// ============================================================================
+// The map is split into CHUNK_TILES x CHUNK_TILES chunks. Each chunk keeps a
+// cached vertex array of its static tiles (track, safety tiles, switch
+// states) that is only rebuilt after a tile in it changes. Only chunks that
+// intersect the view are drawn; zoomed far out, each chunk is drawn as one
+// quad coloured by how many trains are on it.
+// ============================================================================
+
+const int CHUNK_TILES = 32;
+const int MAX_CHUNK_ROWS = (MAX_ROWS + CHUNK_TILES - 1) / CHUNK_TILES;
+const int MAX_CHUNK_COLS = (MAX_COLS + CHUNK_TILES - 1) / CHUNK_TILES;
+
+// Below this many screen pixels per tile the low-detail quads are drawn.
+const float LOD_TILE_PIXELS = 4.0f;
+
+// ----------------------------------------------------------------------------
+// SETUP
+// ----------------------------------------------------------------------------
+// Size the chunks for the loaded level and mark them all for building.
+// Tile (x, y) is drawn at (offsetX + y * cellSize, offsetY + x * cellSize).
+void initializeChunks(float cellSize, float offsetX, float offsetY);
+
+// ----------------------------------------------------------------------------
+// INVALIDATION
+// ----------------------------------------------------------------------------
+// Rebuild the chunk holding this tile before it is drawn next.
+void markTileDirty(int x, int y);
+
+// Mark the chunks of switches whose state changed since they were built
+// (deferred flips and manual toggles).
+void markChangedSwitches();
+
+// ----------------------------------------------------------------------------
+// VIEW
+// ----------------------------------------------------------------------------
+// Tile rows/columns visible in the view, clamped to the grid.
+// Returns false if no tile is visible.
+bool getVisibleTiles(const sf::View& view, int& firstRow, int& lastRow, int& firstCol, int& lastCol);
+
+// True if the view is zoomed out past LOD_TILE_PIXELS.
+bool isLowDetail(const sf::RenderTarget& target, const sf::View& view);
+
+// ----------------------------------------------------------------------------
+// DRAWING
+// ----------------------------------------------------------------------------
+// Draw the visible chunks (cached tiles, or occupancy quads when zoomed out).
+// Returns the number of chunks drawn.
+int drawChunks(sf::RenderTarget& target, const sf::View& view);
+
+#endif
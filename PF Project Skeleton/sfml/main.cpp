@@ -2,13 +2,32 @@
 #include "../core/simulation_state.h"
 #include "../core/simulation.h"
 #include "../core/io.h"
+#include "../core/scheduler.h"
+#include "../core/schedule.h"
+#include "../core/policy.h"
+#include "../core/reservations.h"
 #include <iostream>
-#include <unistd.h>
+#include <csignal>
+#include <cstdlib>
+#include <cstring>
+#include <cstdio>
 
 // ============================================================================
 // MAIN.CPP - Entry point of the application (NO CLASSES)
 // ============================================================================
 
+// Set by Ctrl+C so the loop can stop and save metrics.
+static volatile sig_atomic_t g_stopRequested = 0;
+
+// ----------------------------------------------------------------------------
+// INTERRUPT HANDLER
+// ----------------------------------------------------------------------------
+// Request a clean stop; the main loop flushes metrics before exiting.
+// ----------------------------------------------------------------------------
+static void handleInterrupt(int) {
+    g_stopRequested = 1;
+}
+
 // ----------------------------------------------------------------------------
 // MAIN ENTRY POINT
 // ----------------------------------------------------------------------------
@@ -25,12 +44,58 @@ int main(int argc, char* argv[]) {
     
     // Check command line arguments
     if (argc < 2) {
-        std::cerr << "Usage: " << argv[0] << " <level_file.lvl>" << std::endl;
+        std::cerr << "Usage: " << argv[0] << " <level_file.lvl> [--threads N | --route-threads N]"
+                  << " [--reserve H] [--log off|events|changes|full] [--speed X|max]"
+                  << " [--schedule level|FILE|-] [--policy counters|adaptive]"
+                  << " [--fused | --bitboard | --segments] [--gui]" << std::endl;
         std::cerr << "Example: " << argv[0] << " data/levels/easy_level.lvl" << std::endl;
         return 1;
     }
     
     std::string levelFile = argv[1];
+    bool useGui = false;
+    double speed = 1.0;
+    std::string scheduleSource;
+    std::string policyName;
+    
+    // Optional: spatially partitioned tick, work-stealing route phase,
+    // reservation look-ahead, log level, speed multiplier, streaming schedule,
+    // switch policy (overrides the level's POLICY: section)
+    for (int i = 2; i + 1 < argc; i++) {
+        if (strcmp(argv[i], "--threads") == 0) {
+            tickThreads = atoi(argv[i + 1]);
+            partitionedTick = tickThreads > 1;
+        } else if (strcmp(argv[i], "--route-threads") == 0) {
+            tickThreads = atoi(argv[i + 1]);
+            parallelRoutes = tickThreads > 1;
+        } else if (strcmp(argv[i], "--reserve") == 0) {
+            reserveHorizon = atoi(argv[i + 1]);
+        } else if (strcmp(argv[i], "--log") == 0) {
+            if (strcmp(argv[i + 1], "off") == 0) logLevel = LOG_OFF;
+            else if (strcmp(argv[i + 1], "events") == 0) logLevel = LOG_EVENTS;
+            else if (strcmp(argv[i + 1], "changes") == 0) logLevel = LOG_CHANGES;
+            else logLevel = LOG_FULL;
+        } else if (strcmp(argv[i], "--speed") == 0) {
+            speed = (strcmp(argv[i + 1], "max") == 0) ? 0.0 : atof(argv[i + 1]);
+        } else if (strcmp(argv[i], "--schedule") == 0) {
+            scheduleSource = argv[i + 1];
+            streamingSchedule = true;
+        } else if (strcmp(argv[i], "--policy") == 0) {
+            policyName = argv[i + 1];
+        }
+    }
+    for (int i = 2; i < argc; i++) {
+        if (strcmp(argv[i], "--gui") == 0) useGui = true;
+        if (strcmp(argv[i], "--fused") == 0) fusedTick = true;
+        if (strcmp(argv[i], "--bitboard") == 0) bitboardTick = true;
+        if (strcmp(argv[i], "--segments") == 0) segmentTick = true;
+    }
+    
+    // Negative horizons would disable the engines without planning anything
+    if (reserveHorizon < 0 || reserveHorizon > MAX_RESERVE_HORIZON) {
+        std::cerr << "Error: --reserve must be 0-" << MAX_RESERVE_HORIZON << ", got " << reserveHorizon << std::endl;
+        return 1;
+    }
     
     // Initialize simulation system
     initializeSimulation();
@@ -42,17 +107,59 @@ int main(int argc, char* argv[]) {
         return 1;
     }
     
+    if (streamingSchedule && !openTrainSchedule(scheduleSource, levelFile)) {
+        return 1;
+    }
+    
+    if (!policyName.empty() && !parseSwitchPolicy(policyName, switchPolicy)) {
+        std::cerr << "Error: Unknown switch policy: " << policyName << std::endl;
+        return 1;
+    }
+    
     std::cout << "\nLevel loaded successfully!" << std::endl;
+    
+    // SFML window: the app runs the ticks and saves metrics on exit
+    if (useGui) {
+        printGridEnabled = false;
+        initializeScheduler(speed);
+        if (!initializeApp()) {
+            std::cerr << "Error: Failed to initialize SFML window" << std::endl;
+            return 1;
+        }
+        runApp();
+        cleanupApp();
+        std::cout << "\n=== SIMULATION ENDED ===" << std::endl;
+        return 0;
+    }
+    
     std::cout << "Starting simulation..." << std::endl;
     std::cout << "Press Ctrl+C to stop the simulation.\n" << std::endl;
     
-    // Run the simulation loop
-    while (!isSimulationComplete()) {
-        simulateOneTick();
+    signal(SIGINT, handleInterrupt);
+    
+    // Run the simulation loop at the scheduled tick rate (several ticks per
+    // wake-up when behind)
+    initializeScheduler(speed);
+    bool complete = isSimulationComplete();
+    while (!g_stopRequested && !complete) {
+        waitForNextTick();
+        beginSchedulerFrame();
+        while (!g_stopRequested && !complete && isTickDue()) {
+            simulateOneTick();
+            complete = isSimulationComplete();
+        }
         
-        // Add a small delay to make output readable
-        // In a real implementation, this could be controlled by SFML or user input
-        usleep(100000); // 0.1 second delay
+        if (printGridEnabled && getSimulationSpeed() > 0.0) {
+            printf("Speed x%g | %.2f of %.2f ticks/s\n", getSimulationSpeed(),
+                   getAchievedTickRate(), getTargetTickRate());
+        } else if (printGridEnabled) {
+            printf("Speed max | %.2f ticks/s\n", getAchievedTickRate());
+        }
+    }
+    
+    if (g_stopRequested) {
+        std::cout << "\nStopped at tick " << currentTick << ", saving metrics..." << std::endl;
+        shutdownSimulation();
     }
     
     std::cout << "\n=== SIMULATION ENDED ===" << std::endl;
@@ -0,0 +1,141 @@
+#include "../core/simulation_state.h"
+#include "../core/simulation.h"
+#include "../core/io.h"
+#include "../core/partition.h"
+#include <iostream>
+#include <iomanip>
+#include <new>
+#include <cstdlib>
+
+// ============================================================================
+// ALLOC_CHECK.CPP - No heap allocation inside simulateOneTick()
+// ============================================================================
+// Usage: alloc_check <level.lvl> [more levels...]
+//
+// Replaces the global operator new with a counting version, runs every level
+// with CSV logging on under the phased engine, work-stealing routes, the
+// partitioned engine and the fused, bitboard and segment ticks, and fails if
+// any tick after the warm-up allocates. The segment tick logs changes only,
+// since full logging keeps every train awake.
+// Warm-up ticks may allocate (worker threads and strips start lazily).
+// ============================================================================
+
+// Ticks run before counting starts.
+const int WARMUP_TICKS = 2;
+
+// Most ticks checked per run.
+const int CHECK_TICKS = 2000;
+
+static bool countingAllocations = false;
+static long allocationCount = 0;
+
+// ----------------------------------------------------------------------------
+// COUNTING OPERATOR NEW / DELETE
+// ----------------------------------------------------------------------------
+void* operator new(std::size_t size) {
+    if (countingAllocations) allocationCount++;
+    void* block = malloc(size ? size : 1);
+    if (!block) throw std::bad_alloc();
+    return block;
+}
+
+void* operator new[](std::size_t size) {
+    return operator new(size);
+}
+
+void* operator new(std::size_t size, const std::nothrow_t&) noexcept {
+    if (countingAllocations) allocationCount++;
+    return malloc(size ? size : 1);
+}
+
+void* operator new[](std::size_t size, const std::nothrow_t& tag) noexcept {
+    return operator new(size, tag);
+}
+
+void operator delete(void* block) noexcept {
+    free(block);
+}
+
+void operator delete[](void* block) noexcept {
+    free(block);
+}
+
+void operator delete(void* block, std::size_t) noexcept {
+    free(block);
+}
+
+void operator delete[](void* block, std::size_t) noexcept {
+    free(block);
+}
+
+// ----------------------------------------------------------------------------
+// ANY TRAINS LEFT (without isSimulationComplete, which writes reports)
+// ----------------------------------------------------------------------------
+static bool hasTrainsLeft() {
+    for (int i = 0; i < numTrains; i++) {
+        if (trains[i][TRAIN_STATE] == TRAIN_SCHEDULED || trains[i][TRAIN_STATE] == TRAIN_ACTIVE) return true;
+    }
+    return false;
+}
+
+// ----------------------------------------------------------------------------
+// CHECK ONE CONFIGURATION
+// ----------------------------------------------------------------------------
+// Returns the allocations counted after warm-up; ticks checked via out param.
+// ----------------------------------------------------------------------------
+static long checkLevel(const char* levelFile, int engine, int& ticksChecked) {
+    initializeSimulation();
+    printGridEnabled = false;
+    logLevel = (engine == 5) ? LOG_CHANGES : LOG_FULL;
+    if (!loadLevelFile(levelFile)) exit(1);
+
+    partitionedTick = (engine == 2);
+    parallelRoutes = (engine == 1);
+    fusedTick = (engine == 3);
+    bitboardTick = (engine == 4);
+    segmentTick = (engine == 5);
+    tickThreads = 2;
+
+    for (int t = 0; t < WARMUP_TICKS; t++) simulateOneTick();
+
+    allocationCount = 0;
+    ticksChecked = 0;
+    while (ticksChecked < CHECK_TICKS && hasTrainsLeft()) {
+        countingAllocations = true;
+        simulateOneTick();
+        countingAllocations = false;
+        ticksChecked++;
+    }
+
+    shutdownPartitionedTick();
+    return allocationCount;
+}
+
+// ----------------------------------------------------------------------------
+// MAIN
+// ----------------------------------------------------------------------------
+int main(int argc, char* argv[]) {
+    if (argc < 2) {
+        std::cerr << "Usage: " << argv[0] << " <level.lvl> [more levels...]" << std::endl;
+        return 1;
+    }
+
+    const char* engineNames[6] = {"phased", "routes-ws", "partitioned", "fused", "bitboard", "segments"};
+    bool allClean = true;
+
+    std::cout << std::left << std::setw(40) << "Level" << std::setw(14) << "Engine"
+              << std::setw(10) << "Ticks" << "Allocations" << std::endl;
+    for (int arg = 1; arg < argc; arg++) {
+        for (int engine = 0; engine < 6; engine++) {
+            int ticksChecked = 0;
+            long count = checkLevel(argv[arg], engine, ticksChecked);
+            allClean = allClean && (count == 0);
+
+            std::cout << std::setw(40) << argv[arg] << std::setw(14) << engineNames[engine]
+                      << std::setw(10) << ticksChecked << count << (count ? "  FAIL" : "") << std::endl;
+        }
+    }
+
+    std::cout << (allClean ? "No allocations inside simulateOneTick()" : "simulateOneTick() allocated") << std::endl;
+    return allClean ? 0 : 1;
+}
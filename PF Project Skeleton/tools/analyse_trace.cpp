@@ -0,0 +1,702 @@
+#include "../core/simulation_state.h"
+#include <iostream>
+#include <iomanip>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <string>
+#include <vector>
+#include <thread>
+#include <algorithm>
+
+// ============================================================================
+// ANALYSE_TRACE.CPP - Streaming summary of trace.csv, switches.csv, signals.csv
+// ============================================================================
+// Usage: analyse_trace [dir] [threads] [topN]
+//
+// Reads dir/trace.csv, dir/switches.csv and dir/signals.csv (default dir =
+// out) once each and prints:
+//   - trip and wait times of delivered trains (mean, p50/p90/p99/max) and
+//     the topN slowest trains
+//   - per switch: flips, flips per 100 ticks and ticks spent in each state
+//   - per signal: share of ticks RED, YELLOW and GREEN
+//   - the topN tiles where trains waited or crashed most
+//
+// Works on --log full and --log changes files. With --log events there are
+// no move rows, so only trips and crashes are reported. "Wait" is ticks a
+// train did not move between its spawn and its end (trains.csv WaitTicks
+// also counts ticks a train yielded at a conflict but still moved).
+//
+// trace.csv and signals.csv are split into line-aligned byte ranges, one
+// per thread. Each range keeps a partial record only for trains seen in it
+// that did not both spawn and end in it (at most the trains alive at its two
+// ends), and the ranges are merged in file order. Memory depends on the
+// grid, MAX_TRAINS and the thread count, not on the length of the files.
+// ============================================================================
+
+const int MAX_CHUNKS = 16;
+const int MERGED = MAX_CHUNKS;              // Index of the merged tables
+const int READ_BUFFER_SIZE = 1 << 20;
+const int MIN_CHUNK_BYTES = 1 << 20;        // Smaller files use fewer threads
+const int HIST_SIZE = 4096;                 // Last bucket = overflow
+const int MAX_TOP = 100;
+
+// Row states (trace.csv names; END ends a --log changes file)
+enum RowState { ROW_SPAWNED, ROW_MOVING, ROW_CRASHED, ROW_DELIVERED, ROW_WAIT, ROW_END, ROW_BAD };
+
+// ----------------------------------------------------------------------------
+// TRAIN RECORDS (open-addressing table per chunk, keyed by train ID)
+// ----------------------------------------------------------------------------
+// Record data: 0=ID (-1 = empty slot), 1=spawn tick (-1 = not seen),
+// 2=end tick (-1 = not seen), 3=outcome row state, 4=first row tick,
+// 5-8=last row tick/state/x/y, 9=wait ticks between its rows
+const int REC_ID = 0;
+const int REC_SPAWN = 1;
+const int REC_END = 2;
+const int REC_OUTCOME = 3;
+const int REC_FIRST_TICK = 4;
+const int REC_LAST_TICK = 5;
+const int REC_LAST_STATE = 6;
+const int REC_LAST_X = 7;
+const int REC_LAST_Y = 8;
+const int REC_WAIT = 9;
+const int REC_FIELDS = 10;
+const int TABLE_SIZE = MAX_TRAINS * 4;      // Power of two, at most half full
+
+static int records[MAX_CHUNKS + 1][TABLE_SIZE][REC_FIELDS];
+
+// ----------------------------------------------------------------------------
+// PER-CHUNK TOTALS (index MERGED holds the merged result)
+// ----------------------------------------------------------------------------
+// Trips and waits of delivered trains
+static int tripHist[MAX_CHUNKS + 1][HIST_SIZE + 1];
+static int waitHist[MAX_CHUNKS + 1][HIST_SIZE + 1];
+static long long tripSum[MAX_CHUNKS + 1], waitSum[MAX_CHUNKS + 1];
+static int maxTrip[MAX_CHUNKS + 1], maxWait[MAX_CHUNKS + 1];
+static int delivered[MAX_CHUNKS + 1], crashed[MAX_CHUNKS + 1], unknownSpawn[MAX_CHUNKS + 1];
+static long long moveRows[MAX_CHUNKS + 1];
+static int maxTick[MAX_CHUNKS + 1], endTick[MAX_CHUNKS + 1];
+static int maxRow[MAX_CHUNKS + 1], maxCol[MAX_CHUNKS + 1];
+
+// Slowest delivered trains: 0=train ID, 1=trip, 2=wait (sorted, slowest first)
+static int slowest[MAX_CHUNKS + 1][MAX_TOP][3];
+static int numSlowest[MAX_CHUNKS + 1];
+
+// Wait ticks and crashes per tile
+static int tileWait[MAX_CHUNKS + 1][MAX_ROWS][MAX_COLS];
+static int tileCrash[MAX_CHUNKS + 1][MAX_ROWS][MAX_COLS];
+
+// Signals per switch: first/last row tick and colour, ticks per colour
+// (colour 0=GREEN, 1=YELLOW, 2=RED)
+const int NUM_COLORS = 3;
+static const char* COLOR_NAMES[NUM_COLORS] = {"GREEN", "YELLOW", "RED"};
+static int sigFirstTick[MAX_CHUNKS + 1][MAX_SWITCHES], sigFirstColor[MAX_CHUNKS + 1][MAX_SWITCHES];
+static int sigLastTick[MAX_CHUNKS + 1][MAX_SWITCHES], sigLastColor[MAX_CHUNKS + 1][MAX_SWITCHES];
+static long long sigTicks[MAX_CHUNKS + 1][MAX_SWITCHES][NUM_COLORS];
+
+static bool changesLog = false;             // Files were written with --log changes
+static int topN = 10;
+
+// ----------------------------------------------------------------------------
+// PARSING HELPERS
+// ----------------------------------------------------------------------------
+static int parseInt(const char*& p) {
+    bool negative = (*p == '-');
+    if (negative) p++;
+    int value = 0;
+    while (*p >= '0' && *p <= '9') value = value * 10 + (*p++ - '0');
+    if (*p == ',') p++;
+    return negative ? -value : value;
+}
+
+static int parseRowState(const char* p) {
+    switch (p[0]) {
+        case 'S': return ROW_SPAWNED;
+        case 'M': return ROW_MOVING;
+        case 'C': return ROW_CRASHED;
+        case 'D': return ROW_DELIVERED;
+        case 'W': return ROW_WAIT;
+        case 'E': return ROW_END;
+        default: return ROW_BAD;
+    }
+}
+
+static int parseColor(const char* p) {
+    if (p[0] == 'G') return 0;
+    if (p[0] == 'Y') return 1;
+    if (p[0] == 'R') return 2;
+    return -1;
+}
+
+// ----------------------------------------------------------------------------
+// CHUNKED LINE READER
+// ----------------------------------------------------------------------------
+// Calls handle(chunk, line) for every line that starts in [begin, end),
+// skipping the header. Lines are NUL-terminated in place.
+// ----------------------------------------------------------------------------
+static void forEachLine(const std::string& path, long begin, long end, int chunk,
+                        void (*handle)(int, const char*)) {
+    FILE* file = fopen(path.c_str(), "rb");
+    if (file == nullptr) return;
+
+    // Start at the first line beginning at or after begin
+    long position = (begin > 0) ? begin - 1 : 0;
+    fseek(file, position, SEEK_SET);
+    std::vector<char> buffer(READ_BUFFER_SIZE + 1);
+    bool skipping = true;           // Header, or the line straddling begin
+    int held = 0;
+
+    while (true) {
+        int got = (int)fread(buffer.data() + held, 1, READ_BUFFER_SIZE - held, file);
+        int size = held + got;
+        if (size == 0) break;
+
+        int lineStart = 0;
+        for (int i = 0; i < size; i++) {
+            if (buffer[i] != '\n') continue;
+            buffer[i] = '\0';
+            long lineOffset = position + lineStart;
+            if (skipping) {
+                skipping = false;
+            } else {
+                if (lineOffset >= end) {
+                    fclose(file);
+                    return;
+                }
+                handle(chunk, buffer.data() + lineStart);
+            }
+            lineStart = i + 1;
+        }
+
+        // Keep the unfinished line for the next read
+        held = size - lineStart;
+        if (got == 0) {
+            if (held > 0 && !skipping && position + lineStart < end) {
+                buffer[size] = '\0';
+                handle(chunk, buffer.data() + lineStart);
+            }
+            break;
+        }
+        memmove(buffer.data(), buffer.data() + lineStart, held);
+        position += lineStart;
+    }
+    fclose(file);
+}
+
+static long getFileSize(const std::string& path) {
+    FILE* file = fopen(path.c_str(), "rb");
+    if (file == nullptr) return -1;
+    fseek(file, 0, SEEK_END);
+    long size = ftell(file);
+    fclose(file);
+    return size;
+}
+
+// Chunks to split the file into (0 if the file is missing).
+static int getChunkCount(const std::string& path, int threads) {
+    long size = getFileSize(path);
+    if (size < 0) return 0;
+    return (int)std::max(1L, std::min((long)threads, size / MIN_CHUNK_BYTES));
+}
+
+// Run handle over the file in `chunks` byte ranges, one thread each.
+static void scanFile(const std::string& path, int chunks, void (*handle)(int, const char*)) {
+    long size = getFileSize(path);
+    std::vector<std::thread> workers;
+    for (int c = 0; c < chunks; c++) {
+        long begin = size * c / chunks;
+        long end = size * (c + 1) / chunks;
+        workers.push_back(std::thread(forEachLine, path, begin, end, c, handle));
+    }
+    for (size_t w = 0; w < workers.size(); w++) workers[w].join();
+}
+
+// ----------------------------------------------------------------------------
+// TRAIN TABLE
+// ----------------------------------------------------------------------------
+static int hashSlot(int id) {
+    return (int)(((unsigned int)id * 2654435761u) & (TABLE_SIZE - 1));
+}
+
+static int* findRecord(int table, int id) {
+    for (int s = hashSlot(id);; s = (s + 1) & (TABLE_SIZE - 1)) {
+        int* rec = records[table][s];
+        if (rec[REC_ID] == id) return rec;
+        if (rec[REC_ID] == -1) return nullptr;
+    }
+}
+
+static int* insertRecord(int table, int id) {
+    int s = hashSlot(id);
+    while (records[table][s][REC_ID] != -1) s = (s + 1) & (TABLE_SIZE - 1);
+    int* rec = records[table][s];
+    rec[REC_ID] = id;
+    rec[REC_SPAWN] = -1;
+    rec[REC_END] = -1;
+    rec[REC_OUTCOME] = -1;
+    rec[REC_FIRST_TICK] = -1;
+    rec[REC_LAST_TICK] = -1;
+    rec[REC_WAIT] = 0;
+    return rec;
+}
+
+// Linear probing: shift later entries of the run back into the gap.
+static void eraseRecord(int table, int* rec) {
+    int gap = (int)((rec - records[table][0]) / REC_FIELDS);
+    int s = gap;
+    while (true) {
+        s = (s + 1) & (TABLE_SIZE - 1);
+        int* next = records[table][s];
+        if (next[REC_ID] == -1) break;
+        int home = hashSlot(next[REC_ID]);
+        bool movable = (gap <= s) ? (home <= gap || home > s) : (home <= gap && home > s);
+        if (movable) {
+            memcpy(records[table][gap], next, sizeof(records[table][gap]));
+            gap = s;
+        }
+    }
+    records[table][gap][REC_ID] = -1;
+}
+
+static void clearTable(int table) {
+    for (int s = 0; s < TABLE_SIZE; s++) records[table][s][REC_ID] = -1;
+}
+
+// ----------------------------------------------------------------------------
+// TRAIN RESULTS
+// ----------------------------------------------------------------------------
+// Wait ticks between two rows of the same train: with --log full a train
+// has a row in every tick it moves, with --log changes it waits from a WAIT
+// row until its next row.
+static int waitBetween(int lastTick, int lastState, int tick) {
+    if (changesLog) return (lastState == ROW_WAIT) ? tick - lastTick : 0;
+    return std::max(0, tick - lastTick - 1);
+}
+
+// Longer trip first, then lower train ID (so the list is the same for
+// any number of chunks).
+static bool isSlower(int id, int trip, const int* other) {
+    return trip > other[1] || (trip == other[1] && id < other[0]);
+}
+
+static void noteSlowTrain(int t, int id, int trip, int wait) {
+    int n = numSlowest[t];
+    if (n == topN && !isSlower(id, trip, slowest[t][n - 1])) return;
+    int at = std::min(n, topN - 1);
+    while (at > 0 && isSlower(id, trip, slowest[t][at - 1])) {
+        if (at < topN) memcpy(slowest[t][at], slowest[t][at - 1], sizeof(slowest[t][at]));
+        at--;
+    }
+    slowest[t][at][0] = id;
+    slowest[t][at][1] = trip;
+    slowest[t][at][2] = wait;
+    if (n < topN) numSlowest[t]++;
+}
+
+static void finishTrain(int t, const int* rec) {
+    if (rec[REC_OUTCOME] == ROW_CRASHED) {
+        crashed[t]++;
+        tileCrash[t][rec[REC_LAST_X]][rec[REC_LAST_Y]]++;
+        return;
+    }
+    if (rec[REC_SPAWN] < 0) {
+        unknownSpawn[t]++;
+        return;
+    }
+    int trip = rec[REC_END] - rec[REC_SPAWN];
+    int wait = rec[REC_WAIT];
+    delivered[t]++;
+    tripHist[t][std::min(trip, HIST_SIZE)]++;
+    waitHist[t][std::min(wait, HIST_SIZE)]++;
+    tripSum[t] += trip;
+    waitSum[t] += wait;
+    maxTrip[t] = std::max(maxTrip[t], trip);
+    maxWait[t] = std::max(maxWait[t], wait);
+    noteSlowTrain(t, rec[REC_ID], trip, wait);
+}
+
+// ----------------------------------------------------------------------------
+// TRACE ROW (runs in the chunk's thread)
+// ----------------------------------------------------------------------------
+static void handleTraceLine(int c, const char* line) {
+    const char* p = line;
+    int tick = parseInt(p);
+    int id = parseInt(p);
+    int x = parseInt(p);
+    int y = parseInt(p);
+    parseInt(p);                    // Direction
+    int state = parseRowState(p);
+    if (state == ROW_BAD) return;
+
+    maxTick[c] = std::max(maxTick[c], tick);
+    if (state == ROW_END) {
+        endTick[c] = tick;
+        return;
+    }
+    if (x < 0 || y < 0 || x >= MAX_ROWS || y >= MAX_COLS) return;
+    maxRow[c] = std::max(maxRow[c], x);
+    maxCol[c] = std::max(maxCol[c], y);
+    if (state == ROW_MOVING || state == ROW_WAIT) moveRows[c]++;
+
+    // A collision logs the CRASHED row of each train once per train it hit
+    int* rec = findRecord(c, id);
+    if (rec != nullptr && rec[REC_END] >= 0) return;
+    if (rec == nullptr) {
+        rec = insertRecord(c, id);
+        rec[REC_FIRST_TICK] = tick;
+    } else {
+        int wait = waitBetween(rec[REC_LAST_TICK], rec[REC_LAST_STATE], tick);
+        rec[REC_WAIT] += wait;
+        tileWait[c][rec[REC_LAST_X]][rec[REC_LAST_Y]] += wait;
+    }
+
+    if (state == ROW_SPAWNED) rec[REC_SPAWN] = tick;
+    if (state == ROW_DELIVERED || state == ROW_CRASHED) {
+        rec[REC_END] = tick;
+        rec[REC_OUTCOME] = state;
+    }
+    rec[REC_LAST_TICK] = tick;
+    rec[REC_LAST_STATE] = state;
+    rec[REC_LAST_X] = x;
+    rec[REC_LAST_Y] = y;
+
+    // Spawned and ended in this chunk: nothing left to merge
+    if (rec[REC_END] >= 0 && rec[REC_SPAWN] >= 0) {
+        finishTrain(c, rec);
+        eraseRecord(c, rec);
+    }
+}
+
+// ----------------------------------------------------------------------------
+// MERGE TRACE CHUNKS (file order)
+// ----------------------------------------------------------------------------
+static void mergeTraceChunk(int c) {
+    for (int s = 0; s < TABLE_SIZE; s++) {
+        const int* rec = records[c][s];
+        if (rec[REC_ID] == -1) continue;
+
+        // Only an end row, for a train that already ended: a repeated
+        // CRASHED row (see handleTraceLine())
+        int* merged = findRecord(MERGED, rec[REC_ID]);
+        if (merged == nullptr && rec[REC_SPAWN] < 0 && rec[REC_FIRST_TICK] == rec[REC_END]) continue;
+        if (merged == nullptr) {
+            merged = insertRecord(MERGED, rec[REC_ID]);
+            memcpy(merged, rec, sizeof(records[c][s]));
+        } else {
+            int wait = waitBetween(merged[REC_LAST_TICK], merged[REC_LAST_STATE], rec[REC_FIRST_TICK]);
+            tileWait[MERGED][merged[REC_LAST_X]][merged[REC_LAST_Y]] += wait;
+            merged[REC_WAIT] += wait + rec[REC_WAIT];
+            merged[REC_END] = rec[REC_END];
+            merged[REC_OUTCOME] = rec[REC_OUTCOME];
+            memcpy(merged + REC_LAST_TICK, rec + REC_LAST_TICK, 4 * sizeof(int));
+        }
+        if (merged[REC_END] >= 0) {
+            finishTrain(MERGED, merged);
+            eraseRecord(MERGED, merged);
+        }
+    }
+
+    // Additive totals
+    for (int b = 0; b <= HIST_SIZE; b++) {
+        tripHist[MERGED][b] += tripHist[c][b];
+        waitHist[MERGED][b] += waitHist[c][b];
+    }
+    tripSum[MERGED] += tripSum[c];
+    waitSum[MERGED] += waitSum[c];
+    maxTrip[MERGED] = std::max(maxTrip[MERGED], maxTrip[c]);
+    maxWait[MERGED] = std::max(maxWait[MERGED], maxWait[c]);
+    delivered[MERGED] += delivered[c];
+    crashed[MERGED] += crashed[c];
+    unknownSpawn[MERGED] += unknownSpawn[c];
+    moveRows[MERGED] += moveRows[c];
+    maxTick[MERGED] = std::max(maxTick[MERGED], maxTick[c]);
+    endTick[MERGED] = std::max(endTick[MERGED], endTick[c]);
+    maxRow[MERGED] = std::max(maxRow[MERGED], maxRow[c]);
+    maxCol[MERGED] = std::max(maxCol[MERGED], maxCol[c]);
+    for (int n = 0; n < numSlowest[c]; n++) {
+        noteSlowTrain(MERGED, slowest[c][n][0], slowest[c][n][1], slowest[c][n][2]);
+    }
+    for (int x = 0; x <= maxRow[c]; x++) {
+        for (int y = 0; y <= maxCol[c]; y++) {
+            tileWait[MERGED][x][y] += tileWait[c][x][y];
+            tileCrash[MERGED][x][y] += tileCrash[c][x][y];
+        }
+    }
+}
+
+// ----------------------------------------------------------------------------
+// SIGNAL ROW (runs in the chunk's thread)
+// ----------------------------------------------------------------------------
+static void handleSignalLine(int c, const char* line) {
+    const char* p = line;
+    int tick = parseInt(p);
+    int sw = *p - 'A';
+    p += 2;
+    maxTick[c] = std::max(maxTick[c], tick);
+    if (sw < 0 || sw >= MAX_SWITCHES) {
+        if (p[-1] == ',' && parseRowState(p) == ROW_END) endTick[c] = std::max(endTick[c], tick);
+        return;
+    }
+    int color = parseColor(p);
+    if (color < 0) return;
+
+    if (sigFirstTick[c][sw] < 0) {
+        sigFirstTick[c][sw] = tick;
+        sigFirstColor[c][sw] = color;
+    } else {
+        sigTicks[c][sw][sigLastColor[c][sw]] += tick - sigLastTick[c][sw];
+    }
+    sigLastTick[c][sw] = tick;
+    sigLastColor[c][sw] = color;
+}
+
+static void mergeSignalChunk(int c) {
+    for (int sw = 0; sw < MAX_SWITCHES; sw++) {
+        if (sigFirstTick[c][sw] < 0) continue;
+        if (sigFirstTick[MERGED][sw] < 0) {
+            sigFirstTick[MERGED][sw] = sigFirstTick[c][sw];
+            sigFirstColor[MERGED][sw] = sigFirstColor[c][sw];
+        } else {
+            sigTicks[MERGED][sw][sigLastColor[MERGED][sw]] += sigFirstTick[c][sw] - sigLastTick[MERGED][sw];
+        }
+        for (int k = 0; k < NUM_COLORS; k++) sigTicks[MERGED][sw][k] += sigTicks[c][sw][k];
+        sigLastTick[MERGED][sw] = sigLastTick[c][sw];
+        sigLastColor[MERGED][sw] = sigLastColor[c][sw];
+    }
+    maxTick[MERGED] = std::max(maxTick[MERGED], maxTick[c]);
+    endTick[MERGED] = std::max(endTick[MERGED], endTick[c]);
+}
+
+// ----------------------------------------------------------------------------
+// RESET CHUNK STATE
+// ----------------------------------------------------------------------------
+static void resetChunks(int chunks) {
+    for (int c = 0; c < chunks; c++) {
+        for (int sw = 0; sw < MAX_SWITCHES; sw++) {
+            sigFirstTick[c][sw] = -1;
+            for (int k = 0; k < NUM_COLORS; k++) sigTicks[c][sw][k] = 0;
+        }
+        maxTick[c] = endTick[c] = maxRow[c] = maxCol[c] = -1;
+    }
+}
+
+// ----------------------------------------------------------------------------
+// LAST LINE HAS AN END ROW (file written with --log changes)
+// ----------------------------------------------------------------------------
+static bool endsWithEndRow(const std::string& path) {
+    FILE* file = fopen(path.c_str(), "rb");
+    if (file == nullptr) return false;
+    char tail[64] = {0};
+    fseek(file, 0, SEEK_END);
+    long size = ftell(file);
+    long start = std::max(0L, size - (long)sizeof(tail) + 1);
+    fseek(file, start, SEEK_SET);
+    size_t got = fread(tail, 1, sizeof(tail) - 1, file);
+    fclose(file);
+    tail[got] = '\0';
+    return strstr(tail, ",END") != nullptr;
+}
+
+// ----------------------------------------------------------------------------
+// REPORT HELPERS
+// ----------------------------------------------------------------------------
+// Nearest-rank percentile; the overflow bucket reports the max.
+static int getPercentile(const int* hist, int count, int percent, int maxValue) {
+    int rank = (int)(((long long)count * percent + 99) / 100);
+    int seen = 0;
+    for (int b = 0; b < HIST_SIZE; b++) {
+        seen += hist[b];
+        if (seen >= rank) return b;
+    }
+    return maxValue;
+}
+
+static void printDistribution(const char* name, const int* hist, long long sum, int maxValue) {
+    int count = delivered[MERGED];
+    std::cout << std::left << std::setw(8) << name << std::right << std::fixed << std::setprecision(1)
+              << std::setw(10) << (double)sum / count << std::setw(8) << getPercentile(hist, count, 50, maxValue)
+              << std::setw(8) << getPercentile(hist, count, 90, maxValue)
+              << std::setw(8) << getPercentile(hist, count, 99, maxValue) << std::setw(8) << maxValue << std::endl;
+}
+
+// ----------------------------------------------------------------------------
+// SWITCHES (flips only, so read in one pass on this thread)
+// ----------------------------------------------------------------------------
+static void reportSwitches(const std::string& path, int runTicks) {
+    FILE* file = fopen(path.c_str(), "rb");
+    if (file == nullptr) return;
+
+    // Per switch: flips, current state name, tick it was entered, ticks
+    // per state name (the state before the first flip is the other one)
+    int flips[MAX_SWITCHES] = {0};
+    std::string stateName[MAX_SWITCHES][2];
+    long long stateTicks[MAX_SWITCHES][2] = {{0}};
+    int current[MAX_SWITCHES], since[MAX_SWITCHES];
+    for (int sw = 0; sw < MAX_SWITCHES; sw++) current[sw] = -1;
+
+    char line[256];
+    bool header = true;
+    while (fgets(line, sizeof(line), file) != nullptr) {
+        if (header) {
+            header = false;
+            continue;
+        }
+        const char* p = line;
+        int tick = parseInt(p);
+        int sw = *p - 'A';
+        if (sw < 0 || sw >= MAX_SWITCHES) continue;
+        const char* state = strrchr(line, ',');
+        if (state == nullptr) continue;
+        std::string name(state + 1, strcspn(state + 1, "\r\n"));
+
+        int index = (stateName[sw][0] == name) ? 0 : 1;
+        if (stateName[sw][0].empty() && current[sw] < 0) {
+            index = 0;
+            stateName[sw][0] = name;
+        } else if (index == 1 && stateName[sw][1].empty()) {
+            stateName[sw][1] = name;
+        }
+        if (current[sw] < 0) {
+            stateTicks[sw][1 - index] += tick;
+        } else {
+            stateTicks[sw][current[sw]] += tick - since[sw];
+        }
+        current[sw] = index;
+        since[sw] = tick;
+        flips[sw]++;
+    }
+    fclose(file);
+
+    std::cout << "\n--- Switches (" << runTicks << " ticks) ---" << std::endl;
+    std::cout << std::left << std::setw(8) << "Switch" << std::right << std::setw(8) << "Flips"
+              << std::setw(12) << "Per 100t" << "   Ticks per state" << std::endl;
+    for (int sw = 0; sw < MAX_SWITCHES; sw++) {
+        if (flips[sw] == 0) continue;
+        stateTicks[sw][current[sw]] += runTicks - since[sw];
+        std::cout << std::left << std::setw(8) << (char)('A' + sw) << std::right << std::setw(8) << flips[sw]
+                  << std::setw(12) << std::fixed << std::setprecision(2) << 100.0 * flips[sw] / std::max(1, runTicks) << "   ";
+        for (int k = 0; k < 2; k++) {
+            std::cout << (stateName[sw][k].empty() ? std::string("(other)") : stateName[sw][k]) << " "
+                      << stateTicks[sw][k] << (k == 0 ? ", " : "");
+        }
+        std::cout << std::endl;
+    }
+}
+
+// ----------------------------------------------------------------------------
+// MAIN
+// ----------------------------------------------------------------------------
+int main(int argc, char* argv[]) {
+    std::string dir = (argc > 1) ? argv[1] : "out";
+    int threads = (argc > 2) ? atoi(argv[2]) : (int)std::thread::hardware_concurrency();
+    topN = (argc > 3) ? atoi(argv[3]) : 10;
+    threads = std::max(1, std::min(threads, MAX_CHUNKS));
+    topN = std::max(1, std::min(topN, MAX_TOP));
+
+    std::string tracePath = dir + "/trace.csv";
+    if (getFileSize(tracePath) < 0) {
+        std::cerr << "Usage: " << argv[0] << " [dir] [threads] [topN]   (no " << tracePath << ")" << std::endl;
+        return 1;
+    }
+    changesLog = endsWithEndRow(tracePath);
+
+    // trace.csv
+    int chunks = getChunkCount(tracePath, threads);
+    resetChunks(MERGED + 1);
+    for (int c = 0; c < chunks; c++) clearTable(c);
+    clearTable(MERGED);
+    scanFile(tracePath, chunks, handleTraceLine);
+    for (int c = 0; c < chunks; c++) mergeTraceChunk(c);
+    int stillActive = 0;
+    for (int s = 0; s < TABLE_SIZE; s++) {
+        if (records[MERGED][s][REC_ID] != -1) stillActive++;
+    }
+
+    // signals.csv (reuses the per-chunk slots)
+    int signalChunks = getChunkCount(dir + "/signals.csv", threads);
+    resetChunks(signalChunks);
+    scanFile(dir + "/signals.csv", signalChunks, handleSignalLine);
+    for (int c = 0; c < signalChunks; c++) mergeSignalChunk(c);
+
+    int lastTick = (endTick[MERGED] >= 0) ? endTick[MERGED] : maxTick[MERGED];
+    int runTicks = lastTick + 1;
+    bool haveMoves = moveRows[MERGED] > 0;
+
+    std::cout << "\n=== TRACE SUMMARY: " << dir << " ===" << std::endl;
+    std::cout << "Log: " << (changesLog ? "changes" : (haveMoves ? "full" : "events")) << ", " << runTicks
+              << " ticks, " << chunks << " chunk(s)" << std::endl;
+    std::cout << "Delivered: " << delivered[MERGED] << "  Crashed: " << crashed[MERGED]
+              << "  Still active: " << stillActive;
+    if (unknownSpawn[MERGED] > 0) std::cout << "  Delivered without a spawn row: " << unknownSpawn[MERGED];
+    std::cout << std::endl;
+
+    // Trains
+    if (delivered[MERGED] > 0) {
+        std::cout << "\n--- Delivered trains (ticks) ---" << std::endl;
+        std::cout << std::left << std::setw(8) << "" << std::right << std::setw(10) << "Mean" << std::setw(8) << "p50"
+                  << std::setw(8) << "p90" << std::setw(8) << "p99" << std::setw(8) << "Max" << std::endl;
+        printDistribution("Trip", tripHist[MERGED], tripSum[MERGED], maxTrip[MERGED]);
+        if (haveMoves) printDistribution("Wait", waitHist[MERGED], waitSum[MERGED], maxWait[MERGED]);
+
+        std::cout << "\nSlowest " << numSlowest[MERGED] << ": ";
+        for (int n = 0; n < numSlowest[MERGED]; n++) {
+            std::cout << (n ? ", " : "") << "#" << slowest[MERGED][n][0] << " " << slowest[MERGED][n][1] << "t";
+            if (haveMoves) std::cout << " (wait " << slowest[MERGED][n][2] << ")";
+        }
+        std::cout << std::endl;
+    }
+
+    // Switches
+    reportSwitches(dir + "/switches.csv", runTicks);
+
+    // Signals (not logged with --log events)
+    bool haveSignals = false;
+    for (int sw = 0; sw < MAX_SWITCHES; sw++) haveSignals = haveSignals || sigFirstTick[MERGED][sw] >= 0;
+    if (haveSignals) {
+        std::cout << "\n--- Signals (share of ticks) ---" << std::endl;
+        std::cout << std::left << std::setw(8) << "Switch" << std::right;
+        for (int k = NUM_COLORS - 1; k >= 0; k--) std::cout << std::setw(10) << COLOR_NAMES[k];
+        std::cout << std::endl;
+        for (int sw = 0; sw < MAX_SWITCHES; sw++) {
+            if (sigFirstTick[MERGED][sw] < 0) continue;
+            sigTicks[MERGED][sw][sigLastColor[MERGED][sw]] += runTicks - sigLastTick[MERGED][sw];
+            long long total = runTicks - sigFirstTick[MERGED][sw];
+            std::cout << std::left << std::setw(8) << (char)('A' + sw) << std::right << std::setprecision(1);
+            for (int k = NUM_COLORS - 1; k >= 0; k--) {
+                std::cout << std::setw(9) << 100.0 * sigTicks[MERGED][sw][k] / std::max(1LL, total) << "%";
+            }
+            std::cout << std::endl;
+        }
+    }
+
+    // Congestion points: bounded selection over the tiles seen
+    std::cout << "\n--- Top " << topN << " congestion points ---" << std::endl;
+    std::cout << std::left << std::setw(12) << "Tile" << std::right << std::setw(10)
+              << (haveMoves ? "WaitTicks" : "") << std::setw(10) << "Crashes" << std::endl;
+    int top[MAX_TOP][3];
+    int numTop = 0;
+    for (int x = 0; x <= maxRow[MERGED]; x++) {
+        for (int y = 0; y <= maxCol[MERGED]; y++) {
+            int score = (haveMoves ? tileWait[MERGED][x][y] : 0) + tileCrash[MERGED][x][y];
+            if (score == 0 || (numTop == topN && score <= top[numTop - 1][2])) continue;
+            int at = std::min(numTop, topN - 1);
+            while (at > 0 && top[at - 1][2] < score) {
+                if (at < topN) memcpy(top[at], top[at - 1], sizeof(top[at]));
+                at--;
+            }
+            top[at][0] = x;
+            top[at][1] = y;
+            top[at][2] = score;
+            if (numTop < topN) numTop++;
+        }
+    }
+    for (int n = 0; n < numTop; n++) {
+        int x = top[n][0], y = top[n][1];
+        std::string tile = std::to_string(x) + "," + std::to_string(y);
+        std::cout << std::left << std::setw(12) << tile << std::right << std::setw(10);
+        if (haveMoves) std::cout << tileWait[MERGED][x][y];
+        else std::cout << "";
+        std::cout << std::setw(10) << tileCrash[MERGED][x][y] << std::endl;
+    }
+    return 0;
+}
@@ -0,0 +1,125 @@
+#include "../core/simulation_state.h"
+#include "../core/simulation.h"
+#include "../core/io.h"
+#include <iostream>
+#include <iomanip>
+#include <chrono>
+#include <cstdlib>
+
+// ============================================================================
+// BENCH_KERNELS.CPP - Specialised vs generic fused tick kernels
+// ============================================================================
+// Usage: bench_kernels <level.lvl> [ticks] [repeats]
+//
+// Runs the level headless with the fused tick once per weather (NORMAL,
+// RAIN, FOG) and switch-mode mix (all PER_DIR, all GLOBAL, alternating),
+// overriding the level's own settings after loading. Each configuration is
+// run with the generic kernel (weather and modes read per train / switch)
+// and with the kernel specialised for it; the best of [repeats] runs is
+// reported, and both must end in the same state.
+// ============================================================================
+
+const int NUM_BENCH_WEATHERS = 3;
+const int NUM_BENCH_MIXES = 3;
+
+static const char* WEATHER_NAMES[NUM_BENCH_WEATHERS] = {"NORMAL", "RAIN", "FOG"};
+static const char* MIX_NAMES[NUM_BENCH_MIXES] = {"PER_DIR", "GLOBAL", "mixed"};
+
+// ----------------------------------------------------------------------------
+// STATE CHECKSUM (FNV-1a over trains, switches and counters)
+// ----------------------------------------------------------------------------
+static unsigned long long checksumState() {
+    unsigned long long hash = 1469598103934665603ULL;
+    for (int i = 0; i < numTrains; i++) {
+        for (int f = 0; f < TRAIN_FIELDS; f++) {
+            hash = (hash ^ (unsigned int)trains[i][f]) * 1099511628211ULL;
+        }
+    }
+    for (int i = 0; i < numSwitches; i++) {
+        for (int f = 0; f < SWITCH_FIELDS; f++) {
+            hash = (hash ^ (unsigned int)switches[i][f]) * 1099511628211ULL;
+        }
+    }
+    hash = (hash ^ (unsigned int)switchFlips) * 1099511628211ULL;
+    hash = (hash ^ (unsigned int)totalWaitTicks) * 1099511628211ULL;
+    return hash;
+}
+
+// ----------------------------------------------------------------------------
+// RUN ONE CONFIGURATION
+// ----------------------------------------------------------------------------
+// Returns seconds taken; the final state checksum via out param.
+// ----------------------------------------------------------------------------
+static double runLevel(const char* levelFile, int ticks, int weatherIndex, int mix,
+                       bool specialised, unsigned long long& checksum) {
+    initializeSimulation();
+    logLevel = LOG_OFF;
+    printGridEnabled = false;
+    if (!loadLevelFile(levelFile)) exit(1);
+
+    weather = (WeatherType)weatherIndex;
+    for (int i = 0; i < numSwitches; i++) {
+        bool perDir = (mix == 0) || (mix == 2 && i % 2 == 0);
+        switches[i][SWITCH_MODE] = perDir ? PER_DIR : GLOBAL;
+    }
+    fusedTick = true;
+    specialisedKernels = specialised;
+
+    std::chrono::steady_clock::time_point start = std::chrono::steady_clock::now();
+    for (int t = 0; t < ticks; t++) simulateOneTick();
+    std::chrono::duration<double> elapsed = std::chrono::steady_clock::now() - start;
+
+    checksum = checksumState();
+    return elapsed.count();
+}
+
+static double bestOf(int repeats, const char* levelFile, int ticks, int weatherIndex, int mix,
+                     bool specialised, unsigned long long& checksum) {
+    double best = 0.0;
+    for (int r = 0; r < repeats; r++) {
+        double seconds = runLevel(levelFile, ticks, weatherIndex, mix, specialised, checksum);
+        if (r == 0 || seconds < best) best = seconds;
+    }
+    return best;
+}
+
+// ----------------------------------------------------------------------------
+// MAIN
+// ----------------------------------------------------------------------------
+int main(int argc, char* argv[]) {
+    if (argc < 2) {
+        std::cerr << "Usage: " << argv[0] << " <level.lvl> [ticks] [repeats]" << std::endl;
+        return 1;
+    }
+
+    int ticks = (argc > 2) ? atoi(argv[2]) : 200;
+    int repeats = (argc > 3) ? atoi(argv[3]) : 3;
+    if (repeats < 1) repeats = 1;
+
+    bool allMatch = true;
+    bool printedHeader = false;
+    for (int w = 0; w < NUM_BENCH_WEATHERS; w++) {
+        for (int mix = 0; mix < NUM_BENCH_MIXES; mix++) {
+            unsigned long long generic = 0, specialised = 0;
+            double genericTime = bestOf(repeats, argv[1], ticks, w, mix, false, generic);
+            double specialisedTime = bestOf(repeats, argv[1], ticks, w, mix, true, specialised);
+            bool match = (generic == specialised);
+            allMatch = allMatch && match;
+
+            if (!printedHeader) {
+                std::cout << "\n=== KERNEL BENCHMARK: " << levelName << " ===" << std::endl;
+                std::cout << ticks << " ticks, best of " << repeats << ", " << numSwitches << " switches" << std::endl;
+                std::cout << std::left << std::setw(10) << "Weather" << std::setw(10) << "Switches"
+                          << std::setw(14) << "Generic t/s" << std::setw(18) << "Specialised t/s"
+                          << std::setw(10) << "Speedup" << "State" << std::endl;
+                printedHeader = true;
+            }
+            std::cout << std::setw(10) << WEATHER_NAMES[w] << std::setw(10) << MIX_NAMES[mix]
+                      << std::setw(14) << ticks / genericTime << std::setw(18) << ticks / specialisedTime
+                      << std::setw(10) << genericTime / specialisedTime
+                      << (match ? "identical" : "MISMATCH") << std::endl;
+        }
+    }
+
+    return allMatch ? 0 : 1;
+}
@@ -0,0 +1,75 @@
+#include "../core/simulation_state.h"
+#include "../core/rng.h"
+#include <iostream>
+#include <iomanip>
+#include <chrono>
+#include <random>
+#include <cstdlib>
+
+// ============================================================================
+// BENCH_RNG.CPP - Counter-based RNG vs std::mt19937
+// ============================================================================
+// Usage: bench_rng [ticks] [trains]
+//
+// Draws one value in [0, 3) per train per tick (the RAIN slowdown pattern)
+// with rngRange() and with a shared std::mt19937, reports draws per second,
+// and checks that the counter-based draws do not depend on visiting order.
+// ============================================================================
+
+// ----------------------------------------------------------------------------
+// COUNTER-BASED DRAWS (trains visited forwards or backwards)
+// ----------------------------------------------------------------------------
+static unsigned long long drawCounter(int ticks, int numDraws, bool reverse) {
+    unsigned long long sum = 0;
+    for (int tick = 0; tick < ticks; tick++) {
+        for (int n = 0; n < numDraws; n++) {
+            int id = reverse ? numDraws - 1 - n : n;
+            // Weight by id so a reordered sequence would change the sum
+            sum += (unsigned long long)rngRange(RNG_STREAM_RAIN, tick, id, RAIN_MAX_HOLD + 1) * (id + 1);
+        }
+    }
+    return sum;
+}
+
+// ----------------------------------------------------------------------------
+// MERSENNE TWISTER DRAWS (one shared generator, fixed order)
+// ----------------------------------------------------------------------------
+static unsigned long long drawTwister(int ticks, int numDraws) {
+    std::mt19937 generator((unsigned int)seed);
+    unsigned long long sum = 0;
+    for (int tick = 0; tick < ticks; tick++) {
+        for (int n = 0; n < numDraws; n++) {
+            sum += (unsigned long long)(generator() % (RAIN_MAX_HOLD + 1)) * (n + 1);
+        }
+    }
+    return sum;
+}
+
+// ----------------------------------------------------------------------------
+// MAIN
+// ----------------------------------------------------------------------------
+int main(int argc, char* argv[]) {
+    int ticks = (argc > 1) ? atoi(argv[1]) : 1000;
+    int numDraws = (argc > 2) ? atoi(argv[2]) : 16384;
+    seed = 12345;
+    double draws = (double)ticks * numDraws;
+
+    std::chrono::steady_clock::time_point start = std::chrono::steady_clock::now();
+    unsigned long long forward = drawCounter(ticks, numDraws, false);
+    std::chrono::duration<double> counterTime = std::chrono::steady_clock::now() - start;
+
+    start = std::chrono::steady_clock::now();
+    unsigned long long twister = drawTwister(ticks, numDraws);
+    std::chrono::duration<double> twisterTime = std::chrono::steady_clock::now() - start;
+
+    unsigned long long backward = drawCounter(ticks, numDraws, true);
+
+    std::cout << "\n=== RNG BENCHMARK: " << ticks << " ticks x " << numDraws << " trains ===" << std::endl;
+    std::cout << std::left << std::setw(16) << "Generator" << std::setw(16) << "Mdraws/sec" << "Checksum" << std::endl;
+    std::cout << std::setw(16) << "counter" << std::setw(16) << draws / counterTime.count() / 1e6 << forward << std::endl;
+    std::cout << std::setw(16) << "mt19937" << std::setw(16) << draws / twisterTime.count() / 1e6 << twister << std::endl;
+    std::cout << "Counter draws in reverse train order: "
+              << (backward == forward ? "identical" : "MISMATCH") << std::endl;
+
+    return (backward == forward) ? 0 : 1;
+}
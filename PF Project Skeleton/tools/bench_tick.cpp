@@ -0,0 +1,212 @@
+#include "../core/simulation_state.h"
+#include "../core/simulation.h"
+#include "../core/io.h"
+#include "../core/partition.h"
+#include <iostream>
+#include <iomanip>
+#include <chrono>
+#include <thread>
+#include <cstdlib>
+#include <cstring>
+#ifdef __linux__
+#include <linux/perf_event.h>
+#include <sys/ioctl.h>
+#include <sys/syscall.h>
+#include <unistd.h>
+#endif
+
+// ============================================================================
+// BENCH_TICK.CPP - Tick throughput of the phased vs parallel engines
+// ============================================================================
+// Usage: bench_tick <level.lvl> [ticks] [maxThreads]
+//
+// Runs the level headless (no grid printing, no CSV logging) once with the
+// phased engine and the fused, bitboard and segment ticks, then with
+// work-stealing routes and with the partitioned engine on 1, 2, 4, ...
+// threads, and checks that every run ends in the same state. On Linux, cache misses per tick are read from the
+// hardware counters (n/a if perf events are not available).
+// ============================================================================
+
+// Engine configurations
+const int BENCH_PHASED = 0;
+const int BENCH_ROUTES = 1;
+const int BENCH_PARTITIONED = 2;
+const int BENCH_FUSED = 3;
+const int BENCH_BITBOARD = 4;
+const int BENCH_SEGMENTS = 5;
+
+// ----------------------------------------------------------------------------
+// CACHE MISS COUNTER (Linux perf events, user space, includes worker threads
+// started after it is opened). Returns -1 if unavailable.
+// ----------------------------------------------------------------------------
+static int openCacheMissCounter() {
+#ifdef __linux__
+    perf_event_attr attr;
+    memset(&attr, 0, sizeof(attr));
+    attr.type = PERF_TYPE_HARDWARE;
+    attr.size = sizeof(attr);
+    attr.config = PERF_COUNT_HW_CACHE_MISSES;
+    attr.disabled = 1;
+    attr.inherit = 1;
+    attr.exclude_kernel = 1;
+    attr.exclude_hv = 1;
+    return (int)syscall(__NR_perf_event_open, &attr, 0, -1, -1, 0);
+#else
+    return -1;
+#endif
+}
+
+// Count only while enabled (simulateOneTick), not the bookkeeping between.
+static void enableCacheMissCounter(int fd, bool enable) {
+#ifdef __linux__
+    if (fd >= 0) ioctl(fd, enable ? PERF_EVENT_IOC_ENABLE : PERF_EVENT_IOC_DISABLE, 0);
+#else
+    (void)fd;
+    (void)enable;
+#endif
+}
+
+static long long closeCacheMissCounter(int fd) {
+    long long misses = -1;
+#ifdef __linux__
+    if (fd < 0) return -1;
+    if (read(fd, &misses, sizeof(misses)) != (ssize_t)sizeof(misses)) misses = -1;
+    close(fd);
+#else
+    (void)fd;
+#endif
+    return misses;
+}
+
+// ----------------------------------------------------------------------------
+// STATE CHECKSUM (FNV-1a over trains, switches and counters)
+// ----------------------------------------------------------------------------
+static unsigned long long checksumState() {
+    unsigned long long hash = 1469598103934665603ULL;
+    for (int i = 0; i < numTrains; i++) {
+        for (int f = 0; f < TRAIN_FIELDS; f++) {
+            hash = (hash ^ (unsigned int)trains[i][f]) * 1099511628211ULL;
+        }
+    }
+    for (int i = 0; i < numSwitches; i++) {
+        for (int f = 0; f < SWITCH_FIELDS; f++) {
+            hash = (hash ^ (unsigned int)switches[i][f]) * 1099511628211ULL;
+        }
+    }
+    hash = (hash ^ (unsigned int)switchFlips) * 1099511628211ULL;
+    hash = (hash ^ (unsigned int)totalWaitTicks) * 1099511628211ULL;
+    return hash;
+}
+
+// ----------------------------------------------------------------------------
+// RUN ONE CONFIGURATION
+// ----------------------------------------------------------------------------
+// Returns seconds taken; checksum, peak active trains and cache misses per
+// tick (-1 = not measured) via out params.
+// ----------------------------------------------------------------------------
+static double runLevel(const char* levelFile, int ticks, int engine, int threads,
+                       unsigned long long& checksum, int& peakActive, double& missesPerTick) {
+    initializeSimulation();
+    logLevel = LOG_OFF;
+    printGridEnabled = false;
+    if (!loadLevelFile(levelFile)) exit(1);
+
+    partitionedTick = (engine == BENCH_PARTITIONED);
+    parallelRoutes = (engine == BENCH_ROUTES);
+    fusedTick = (engine == BENCH_FUSED);
+    bitboardTick = (engine == BENCH_BITBOARD);
+    segmentTick = (engine == BENCH_SEGMENTS);
+    tickThreads = threads;
+    peakActive = 0;
+
+    int missCounter = openCacheMissCounter();
+    std::chrono::steady_clock::time_point start = std::chrono::steady_clock::now();
+    for (int t = 0; t < ticks; t++) {
+        enableCacheMissCounter(missCounter, true);
+        simulateOneTick();
+        enableCacheMissCounter(missCounter, false);
+
+        int active = 0;
+        for (int i = 0; i < numTrains; i++) {
+            if (trains[i][TRAIN_STATE] == TRAIN_ACTIVE) active++;
+        }
+        if (active > peakActive) peakActive = active;
+    }
+    std::chrono::duration<double> elapsed = std::chrono::steady_clock::now() - start;
+
+    long long misses = closeCacheMissCounter(missCounter);
+    missesPerTick = (misses >= 0 && ticks > 0) ? (double)misses / ticks : -1.0;
+    syncTrainPositions();
+    checksum = checksumState();
+    shutdownPartitionedTick();
+    return elapsed.count();
+}
+
+// ----------------------------------------------------------------------------
+// RESULT ROW
+// ----------------------------------------------------------------------------
+static void printRow(const char* engine, int threads, double ticksPerSec, double speedup,
+                     double missesPerTick, const char* state) {
+    std::cout << std::setw(14) << engine << std::setw(10) << threads
+              << std::setw(14) << ticksPerSec << std::setw(10) << speedup << std::setw(14);
+    if (missesPerTick >= 0) std::cout << (long long)missesPerTick;
+    else std::cout << "n/a";
+    std::cout << state << std::endl;
+}
+
+// ----------------------------------------------------------------------------
+// MAIN
+// ----------------------------------------------------------------------------
+int main(int argc, char* argv[]) {
+    if (argc < 2) {
+        std::cerr << "Usage: " << argv[0] << " <level.lvl> [ticks] [maxThreads]" << std::endl;
+        return 1;
+    }
+
+    int ticks = (argc > 2) ? atoi(argv[2]) : 200;
+    int maxThreads = (argc > 3) ? atoi(argv[3]) : (int)std::thread::hardware_concurrency();
+    if (maxThreads < 1) maxThreads = 1;
+
+    unsigned long long reference = 0;
+    int peakActive = 0;
+    double missesPerTick = -1.0;
+    double serialTime = runLevel(argv[1], ticks, BENCH_PHASED, 1, reference, peakActive, missesPerTick);
+
+    std::cout << "\n=== TICK BENCHMARK: " << levelName << " ===" << std::endl;
+    std::cout << ticks << " ticks, peak " << peakActive << " active trains" << std::endl;
+    std::cout << std::left << std::setw(14) << "Engine" << std::setw(10) << "Threads"
+              << std::setw(14) << "Ticks/sec" << std::setw(10) << "Speedup"
+              << std::setw(14) << "Misses/tick" << "State" << std::endl;
+    printRow("phased", 1, ticks / serialTime, 1.0, missesPerTick, "reference");
+
+    bool allMatch = true;
+    unsigned long long checksum = 0;
+    double seconds = runLevel(argv[1], ticks, BENCH_FUSED, 1, checksum, peakActive, missesPerTick);
+    allMatch = (checksum == reference);
+    printRow("fused", 1, ticks / seconds, serialTime / seconds, missesPerTick,
+             allMatch ? "identical" : "MISMATCH");
+
+    seconds = runLevel(argv[1], ticks, BENCH_BITBOARD, 1, checksum, peakActive, missesPerTick);
+    allMatch = allMatch && (checksum == reference);
+    printRow("bitboard", 1, ticks / seconds, serialTime / seconds, missesPerTick,
+             checksum == reference ? "identical" : "MISMATCH");
+
+    seconds = runLevel(argv[1], ticks, BENCH_SEGMENTS, 1, checksum, peakActive, missesPerTick);
+    allMatch = allMatch && (checksum == reference);
+    printRow("segments", 1, ticks / seconds, serialTime / seconds, missesPerTick,
+             checksum == reference ? "identical" : "MISMATCH");
+
+    const char* engineNames[3] = {"phased", "routes-ws", "partitioned"};
+    for (int engine = BENCH_ROUTES; engine <= BENCH_PARTITIONED; engine++) {
+        for (int threads = 1; threads <= maxThreads; threads = (threads * 2 > maxThreads && threads < maxThreads) ? maxThreads : threads * 2) {
+            seconds = runLevel(argv[1], ticks, engine, threads, checksum, peakActive, missesPerTick);
+            bool match = (checksum == reference);
+            allMatch = allMatch && match;
+
+            printRow(engineNames[engine], threads, ticks / seconds, serialTime / seconds, missesPerTick,
+                     match ? "identical" : "MISMATCH");
+        }
+    }
+
+    return allMatch ? 0 : 1;
+}
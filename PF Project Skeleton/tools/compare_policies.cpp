@@ -0,0 +1,111 @@
+#include "../core/simulation_state.h"
+#include "../core/simulation.h"
+#include "../core/io.h"
+#include "../core/policy.h"
+#include <iostream>
+#include <iomanip>
+#include <sstream>
+#include <cstdlib>
+
+// ============================================================================
+// COMPARE_POLICIES.CPP - Switch control policies side by side
+// ============================================================================
+// Usage: compare_policies <level.lvl> [more levels...]
+//
+// Runs every level headless with the fused tick once per switch policy
+// (policy.h), overriding the level's POLICY: section, and prints the ticks
+// until every train was delivered or crashed, deliveries, crashes, wait
+// ticks and flips. Totals over all levels follow; a run still going after
+// MAX_COMPARE_TICKS is cut off there (marked with *).
+// ============================================================================
+
+const int MAX_COMPARE_TICKS = 20000;
+
+// Result fields: 0=ticks, 1=delivered, 2=crashed, 3=waitTicks, 4=flips
+const int RESULT_TICKS = 0;
+const int RESULT_DELIVERED = 1;
+const int RESULT_CRASHED = 2;
+const int RESULT_WAIT = 3;
+const int RESULT_FLIPS = 4;
+const int RESULT_FIELDS = 5;
+
+// ----------------------------------------------------------------------------
+// ANY TRAINS LEFT (without isSimulationComplete, which writes reports)
+// ----------------------------------------------------------------------------
+static bool hasTrainsLeft() {
+    for (int i = 0; i < numTrains; i++) {
+        if (trains[i][TRAIN_STATE] == TRAIN_SCHEDULED || trains[i][TRAIN_STATE] == TRAIN_ACTIVE) return true;
+    }
+    return false;
+}
+
+// ----------------------------------------------------------------------------
+// RUN LEVEL under one policy; returns false if it hit the tick cap
+// ----------------------------------------------------------------------------
+static bool runLevel(const char* levelFile, SwitchPolicy policy, int* result) {
+    initializeSimulation();
+    printGridEnabled = false;
+    logLevel = LOG_OFF;
+    heatmapEnabled = false;
+    fusedTick = true;
+    if (!loadLevelFile(levelFile)) exit(1);
+    switchPolicy = policy;
+
+    while (currentTick < MAX_COMPARE_TICKS && hasTrainsLeft()) {
+        simulateOneTick();
+    }
+
+    result[RESULT_TICKS] = currentTick;
+    result[RESULT_DELIVERED] = trainsDelivered;
+    result[RESULT_CRASHED] = trainsCrashed;
+    result[RESULT_WAIT] = totalWaitTicks;
+    result[RESULT_FLIPS] = switchFlips;
+    return !hasTrainsLeft();
+}
+
+static void printRow(std::ostream& out, const std::string& level, const char* policy, const int* result,
+                     bool finished) {
+    out << std::left << std::setw(40) << level << std::setw(10) << policy << std::right
+        << std::setw(8) << result[RESULT_TICKS] << (finished ? " " : "*")
+        << std::setw(10) << result[RESULT_DELIVERED] << std::setw(9) << result[RESULT_CRASHED]
+        << std::setw(11) << result[RESULT_WAIT] << std::setw(8) << result[RESULT_FLIPS] << std::endl;
+}
+
+// ----------------------------------------------------------------------------
+// MAIN
+// ----------------------------------------------------------------------------
+int main(int argc, char* argv[]) {
+    if (argc < 2) {
+        std::cerr << "Usage: " << argv[0] << " <level.lvl> [more levels...]" << std::endl;
+        return 1;
+    }
+
+    int results[NUM_SWITCH_POLICIES][RESULT_FIELDS];
+    int totals[NUM_SWITCH_POLICIES][RESULT_FIELDS] = {};
+    bool finished[NUM_SWITCH_POLICIES];
+    bool allFinished[NUM_SWITCH_POLICIES];
+    for (int p = 0; p < NUM_SWITCH_POLICIES; p++) allFinished[p] = true;
+
+    // Runs print "Simulation initialized" lines, so the table comes after
+    std::ostringstream table;
+
+    for (int arg = 1; arg < argc; arg++) {
+        for (int p = 0; p < NUM_SWITCH_POLICIES; p++) {
+            finished[p] = runLevel(argv[arg], (SwitchPolicy)p, results[p]);
+            allFinished[p] = allFinished[p] && finished[p];
+            for (int f = 0; f < RESULT_FIELDS; f++) totals[p][f] += results[p][f];
+        }
+        for (int p = 0; p < NUM_SWITCH_POLICIES; p++) {
+            printRow(table, argv[arg], switchPolicyNames[p], results[p], finished[p]);
+        }
+    }
+
+    std::cout << std::left << std::setw(40) << "Level" << std::setw(10) << "Policy" << std::right
+              << std::setw(9) << "Ticks" << std::setw(10) << "Delivered" << std::setw(9) << "Crashed"
+              << std::setw(11) << "WaitTicks" << std::setw(8) << "Flips" << std::endl;
+    std::cout << table.str();
+    for (int p = 0; p < NUM_SWITCH_POLICIES; p++) {
+        printRow(std::cout, "Total", switchPolicyNames[p], totals[p], allFinished[p]);
+    }
+    return 0;
+}
@@ -0,0 +1,88 @@
+#include "../core/simulation_state.h"
+#include "../core/simulation.h"
+#include "../core/io.h"
+#include <iostream>
+#include <iomanip>
+#include <fstream>
+#include <sstream>
+#include <string>
+#include <cstdio>
+#include <cstdlib>
+
+// ============================================================================
+// EXPAND_CHECK.CPP - expand_log output against a --log full run
+// ============================================================================
+// Usage: expand_check <level.lvl> [more levels...]
+//
+// Runs every level headless with --log full and keeps its trace.csv,
+// signals.csv and switches.csv in out/full, runs it again with --log changes,
+// then runs the README command (tools/expand_log <level> out out/expanded)
+// and fails unless each expanded file equals the full one byte for byte.
+// Needs tools/expand_log built next to this tool.
+// ============================================================================
+
+// Most ticks per run (the shipped levels finish long before).
+const int MAX_CHECK_TICKS = 20000;
+
+static const char* logNames[] = {"trace.csv", "signals.csv", "switches.csv"};
+const int NUM_LOG_FILES = 3;
+
+// ----------------------------------------------------------------------------
+// RUN LEVEL with one log level, as the headless main loop does
+// ----------------------------------------------------------------------------
+static void runLevel(const char* levelFile, LogLevel level) {
+    initializeSimulation();
+    printGridEnabled = false;
+    logLevel = level;
+    if (!loadLevelFile(levelFile)) exit(1);
+
+    while (!isSimulationComplete() && currentTick < MAX_CHECK_TICKS) {
+        simulateOneTick();
+    }
+}
+
+static std::string readFile(const std::string& path) {
+    std::ifstream in(path.c_str());
+    std::ostringstream text;
+    text << in.rdbuf();
+    return text.str();
+}
+
+// ----------------------------------------------------------------------------
+// MAIN
+// ----------------------------------------------------------------------------
+int main(int argc, char* argv[]) {
+    if (argc < 2) {
+        std::cerr << "Usage: " << argv[0] << " <level.lvl> [more levels...]" << std::endl;
+        return 1;
+    }
+
+    bool allMatch = true;
+    std::ostringstream table;   // Runs print their own lines, so the table comes after
+
+    for (int arg = 1; arg < argc; arg++) {
+        runLevel(argv[arg], LOG_FULL);
+        system("mkdir -p out/full");
+        for (int f = 0; f < NUM_LOG_FILES; f++) {
+            std::string name = logNames[f];
+            std::rename(("out/" + name).c_str(), ("out/full/" + name).c_str());
+        }
+
+        runLevel(argv[arg], LOG_CHANGES);
+        std::string command = std::string("./tools/expand_log \"") + argv[arg] + "\" out out/expanded > /dev/null";
+        bool expanded = (system(command.c_str()) == 0);
+
+        for (int f = 0; f < NUM_LOG_FILES; f++) {
+            std::string name = logNames[f];
+            std::string full = readFile("out/full/" + name);
+            bool match = expanded && !full.empty() && full == readFile("out/expanded/" + name);
+            allMatch = allMatch && match;
+            table << std::left << std::setw(40) << argv[arg] << std::setw(14) << name
+                  << (match ? "OK" : "FAIL") << std::endl;
+        }
+    }
+
+    std::cout << table.str();
+    std::cout << (allMatch ? "Expanded logs match --log full" : "Expanded logs differ from --log full") << std::endl;
+    return allMatch ? 0 : 1;
+}
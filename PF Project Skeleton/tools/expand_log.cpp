@@ -0,0 +1,269 @@
+#include "../core/simulation_state.h"
+#include "../core/simulation.h"
+#include "../core/io.h"
+#include "../core/grid.h"
+#include "../core/halt.h"
+#include <iostream>
+#include <fstream>
+#include <sstream>
+#include <string>
+#include <cstdlib>
+#include <algorithm>
+
+// ============================================================================
+// EXPAND_LOG.CPP - Rebuild full trace/signal logs from changes-only logs
+// ============================================================================
+// Usage: expand_log <level.lvl> [inDir] [outDir]
+//
+// Reads inDir/trace.csv and inDir/signals.csv written with --log changes
+// (default inDir = out, outDir = out/expanded) and writes the files the
+// same run would have written with --log full:
+//   - a train with no row in a tick moved one tile in its logged direction,
+//     unless its last row was WAIT
+//   - MOVING rows of a tick are ordered like the engine's move order
+//     (distance to destination descending, then train ID), which needs the
+//     level for the destinations
+//   - a signal keeps its last logged colour until the END row
+// switches.csv is the same at both levels and is copied.
+// ============================================================================
+
+// Row states in the input (TraceState codes plus the END marker)
+const int ROW_END = -1;
+
+// Rows of the tick being expanded: 0=trainID, 1=x, 2=y, 3=direction, 4=state
+const int ROW_TRAIN = 0;
+const int ROW_X = 1;
+const int ROW_Y = 2;
+const int ROW_DIR = 3;
+const int ROW_STATE = 4;
+const int ROW_FIELDS = 5;
+const int MAX_TICK_ROWS = MAX_TRAINS * 4;
+
+static int tickRows[MAX_TICK_ROWS][ROW_FIELDS];
+static int numTickRows = 0;
+
+// Expanded train state (indexed by train ID)
+static bool trainActive[MAX_TRAINS];
+static bool trainWaiting[MAX_TRAINS];
+static int trainX[MAX_TRAINS], trainY[MAX_TRAINS], trainDir[MAX_TRAINS];
+static int trainRowTick[MAX_TRAINS];   // Last tick with a MOVING/WAIT/CRASHED row
+
+static int moveOrder[MAX_TRAINS];
+
+static const char* stateNames[] = {"SPAWNED", "MOVING", "CRASHED", "DELIVERED", "WAIT"};
+
+// ----------------------------------------------------------------------------
+// PARSE STATE NAME
+// ----------------------------------------------------------------------------
+static int parseState(const std::string& name) {
+    for (int s = TRACE_SPAWNED; s <= TRACE_WAITING; s++) {
+        if (name == stateNames[s]) return s;
+    }
+    return ROW_END;
+}
+
+// ----------------------------------------------------------------------------
+// MOVE ORDER: distance to destination descending, then train ID
+// ----------------------------------------------------------------------------
+static int destinationDistance(int id) {
+    return abs(trainX[id] - trains[id][TRAIN_DEST_X]) + abs(trainY[id] - trains[id][TRAIN_DEST_Y]);
+}
+
+static bool moveBefore(int a, int b) {
+    int distA = destinationDistance(a), distB = destinationDistance(b);
+    if (distA != distB) return distA > distB;
+    return a < b;
+}
+
+// ----------------------------------------------------------------------------
+// WRITE TRACE ROW
+// ----------------------------------------------------------------------------
+static void writeRow(std::ofstream& out, int tick, int id, int x, int y, int dir, int state) {
+    out << tick << "," << id << "," << x << "," << y << "," << dir << "," << stateNames[state] << "\n";
+}
+
+// ----------------------------------------------------------------------------
+// EXPAND ONE TICK OF THE TRACE
+// ----------------------------------------------------------------------------
+// Spawn/crash rows first (as logged), then all moves in move order, then
+// deliveries (as logged) - the same order the engine writes them in.
+// ----------------------------------------------------------------------------
+static void expandTraceTick(std::ofstream& out, int tick) {
+    for (int r = 0; r < numTickRows; r++) {
+        int* row = tickRows[r];
+        int id = row[ROW_TRAIN];
+
+        if (row[ROW_STATE] == TRACE_SPAWNED) {
+            trainActive[id] = true;
+            trainWaiting[id] = false;
+            trainX[id] = row[ROW_X];
+            trainY[id] = row[ROW_Y];
+            trainDir[id] = row[ROW_DIR];
+            writeRow(out, tick, id, row[ROW_X], row[ROW_Y], row[ROW_DIR], TRACE_SPAWNED);
+        } else if (row[ROW_STATE] == TRACE_CRASHED) {
+            trainActive[id] = false;
+            trainRowTick[id] = tick;
+            writeRow(out, tick, id, row[ROW_X], row[ROW_Y], row[ROW_DIR], TRACE_CRASHED);
+        } else if (row[ROW_STATE] == TRACE_MOVING || row[ROW_STATE] == TRACE_WAITING) {
+            trainWaiting[id] = (row[ROW_STATE] == TRACE_WAITING);
+            trainX[id] = row[ROW_X];
+            trainY[id] = row[ROW_Y];
+            trainDir[id] = row[ROW_DIR];
+            trainRowTick[id] = tick;
+        }
+    }
+
+    // Logged moves, plus one tile in the same direction for trains with no row
+    int numMoves = 0;
+    for (int id = 0; id < numTrains; id++) {
+        if (!trainActive[id] || trainWaiting[id]) continue;
+        if (trainRowTick[id] != tick) {
+            trainX[id] += dx[trainDir[id]];
+            trainY[id] += dy[trainDir[id]];
+        }
+        moveOrder[numMoves++] = id;
+    }
+    std::sort(moveOrder, moveOrder + numMoves, moveBefore);
+    for (int m = 0; m < numMoves; m++) {
+        int id = moveOrder[m];
+        writeRow(out, tick, id, trainX[id], trainY[id], trainDir[id], TRACE_MOVING);
+    }
+
+    for (int r = 0; r < numTickRows; r++) {
+        int* row = tickRows[r];
+        if (row[ROW_STATE] != TRACE_DELIVERED) continue;
+        trainActive[row[ROW_TRAIN]] = false;
+        writeRow(out, tick, row[ROW_TRAIN], row[ROW_X], row[ROW_Y], row[ROW_DIR], TRACE_DELIVERED);
+    }
+    numTickRows = 0;
+}
+
+// ----------------------------------------------------------------------------
+// EXPAND TRACE
+// ----------------------------------------------------------------------------
+static bool expandTrace(const std::string& inFile, const std::string& outFile) {
+    std::ifstream in(inFile.c_str());
+    std::ofstream out(outFile.c_str());
+    if (!in.is_open() || !out.is_open()) return false;
+
+    for (int id = 0; id < MAX_TRAINS; id++) {
+        trainActive[id] = false;
+        trainWaiting[id] = false;
+        trainRowTick[id] = -1;
+    }
+
+    std::string line;
+    std::getline(in, line);
+    out << line << "\n";
+
+    int tick = -1;   // Tick whose rows are being collected
+    while (std::getline(in, line)) {
+        if (line.empty()) continue;
+        for (size_t c = 0; c < line.size(); c++) {
+            if (line[c] == ',') line[c] = ' ';
+        }
+        std::istringstream iss(line);
+        int rowTick, id, x, y, dir;
+        std::string stateName;
+        iss >> rowTick >> id >> x >> y >> dir >> stateName;
+
+        // Finish the collected tick and any ticks without rows in between
+        if (tick >= 0) {
+            while (tick < rowTick) expandTraceTick(out, tick++);
+        }
+        tick = rowTick;
+
+        int state = parseState(stateName);
+        if (state == ROW_END) break;
+        if (numTickRows >= MAX_TICK_ROWS || id < 0 || id >= numTrains) continue;
+
+        int* row = tickRows[numTickRows++];
+        row[ROW_TRAIN] = id;
+        row[ROW_X] = x;
+        row[ROW_Y] = y;
+        row[ROW_DIR] = dir;
+        row[ROW_STATE] = state;
+    }
+    if (tick >= 0) expandTraceTick(out, tick);
+    return true;
+}
+
+// ----------------------------------------------------------------------------
+// EXPAND SIGNALS
+// ----------------------------------------------------------------------------
+// Every tick lists the level's switches (switch order) with their colour, the
+// same set updateSignalLights() logs. Colours are keyed by the logged letter;
+// unused switch slots all log letter 0 at tile (0,0) and share one colour.
+// ----------------------------------------------------------------------------
+static void writeSignalTicks(std::ofstream& out, const std::string* colors, int from, int to) {
+    for (int t = from; t <= to; t++) {
+        for (int sw = 0; sw < numSwitches; sw++) {
+            if (!isInBounds(switches[sw][SWITCH_X], switches[sw][SWITCH_Y])) continue;
+            unsigned char letter = (unsigned char)switches[sw][SWITCH_LETTER];
+            if (!colors[letter].empty()) out << t << "," << (char)letter << "," << colors[letter] << "\n";
+        }
+    }
+}
+
+static bool expandSignals(const std::string& inFile, const std::string& outFile) {
+    std::ifstream in(inFile.c_str());
+    std::ofstream out(outFile.c_str());
+    if (!in.is_open() || !out.is_open()) return false;
+
+    std::string colors[256];
+    std::string line;
+    std::getline(in, line);
+    out << line << "\n";
+
+    int tick = -1;   // Tick whose changes are being collected
+    while (std::getline(in, line)) {
+        if (line.empty()) continue;
+        std::replace(line.begin(), line.end(), ',', ' ');
+        std::istringstream iss(line);
+        int rowTick;
+        std::string letter, color;
+        iss >> rowTick >> letter >> color;
+
+        // The collected tick and unchanged ticks before this row are complete
+        if (tick >= 0 && rowTick > tick) writeSignalTicks(out, colors, tick, rowTick - 1);
+        tick = rowTick;
+
+        if (color == "END") break;
+        if (!letter.empty()) colors[(unsigned char)letter[0]] = color;
+    }
+    if (tick >= 0) writeSignalTicks(out, colors, tick, tick);
+    return true;
+}
+
+// ----------------------------------------------------------------------------
+// MAIN
+// ----------------------------------------------------------------------------
+int main(int argc, char* argv[]) {
+    if (argc < 2) {
+        std::cerr << "Usage: " << argv[0] << " <level.lvl> [inDir] [outDir]" << std::endl;
+        return 1;
+    }
+
+    std::string inDir = (argc > 2) ? argv[2] : "out";
+    std::string outDir = (argc > 3) ? argv[3] : "out/expanded";
+
+    // Only the level is needed; initializeSimulation() would truncate the
+    // logs in out/, which are usually the input
+    initializeSimulationState();
+    resetHaltZones();
+    if (!loadLevelFile(argv[1])) return 1;
+    system(("mkdir -p \"" + outDir + "\"").c_str());
+
+    if (!expandTrace(inDir + "/trace.csv", outDir + "/trace.csv") ||
+        !expandSignals(inDir + "/signals.csv", outDir + "/signals.csv")) {
+        std::cerr << "Error: Could not read " << inDir << " or write " << outDir << std::endl;
+        return 1;
+    }
+
+    std::ifstream switchesIn((inDir + "/switches.csv").c_str());
+    std::ofstream switchesOut((outDir + "/switches.csv").c_str());
+    switchesOut << switchesIn.rdbuf();
+
+    std::cout << "Expanded logs written to " << outDir << std::endl;
+    return 0;
+}
@@ -0,0 +1,144 @@
+#include <iostream>
+#include <fstream>
+#include <string>
+#include <cstdlib>
+#include <vector>
+#include <algorithm>
+
+// ============================================================================
+// GEN_LEVEL.CPP - Generate large grid networks for stress tests (NO CLASSES)
+// ============================================================================
+// Usage: gen_level <out.lvl> <rows> <cols> <trains> [seed]
+//
+// Layout: horizontal lines S===...===D every 3 rows, vertical lines every 8
+// columns joined by crossings (+), some crossings replaced by switches, and
+// vertical lines ending in D below the last horizontal line. Trains leave the
+// S tiles heading RIGHT, a few ticks apart per line, and are listed in
+// spawn-tick order. Half head for their own line's D, the others for a
+// random D below the vertical lines (D tiles are numbered row by row).
+// ============================================================================
+
+const int GEN_MAX_ROWS = 512;
+const int GEN_MAX_COLS = 512;
+
+static char level[GEN_MAX_ROWS][GEN_MAX_COLS + 1];
+
+// Switch letters (S and D are reserved for spawn/destination tiles)
+static const char SWITCH_LETTERS[] = "ABCEFGHIJKLMNOPQRTUVWXYZ";
+static const int NUM_SWITCH_LETTERS = 24;
+
+// ----------------------------------------------------------------------------
+// SMALL DETERMINISTIC RANDOM NUMBER GENERATOR (LCG)
+// ----------------------------------------------------------------------------
+static unsigned int genState = 1;
+
+static int nextRandom(int range) {
+    genState = genState * 1103515245u + 12345u;
+    return (int)((genState >> 16) % (unsigned int)range);
+}
+
+// ----------------------------------------------------------------------------
+// MAIN
+// ----------------------------------------------------------------------------
+int main(int argc, char* argv[]) {
+    if (argc < 5) {
+        std::cerr << "Usage: " << argv[0] << " <out.lvl> <rows> <cols> <trains> [seed]" << std::endl;
+        return 1;
+    }
+
+    std::string outFile = argv[1];
+    int rows = atoi(argv[2]);
+    int cols = atoi(argv[3]);
+    int numTrains = atoi(argv[4]);
+    int seed = (argc > 5) ? atoi(argv[5]) : 1;
+    genState = (unsigned int)seed;
+
+    if (rows < 8 || cols < 16 || rows > GEN_MAX_ROWS || cols > GEN_MAX_COLS) {
+        std::cerr << "Error: rows must be 8-" << GEN_MAX_ROWS << ", cols 16-" << GEN_MAX_COLS << std::endl;
+        return 1;
+    }
+
+    for (int r = 0; r < rows; r++) {
+        for (int c = 0; c < cols; c++) level[r][c] = ' ';
+        level[r][cols] = '\0';
+    }
+
+    // Horizontal lines every 3 rows, leaving 3 rows at the bottom
+    int lineRows[GEN_MAX_ROWS];
+    int numLines = 0;
+    for (int r = 1; r + 3 < rows; r += 3) {
+        lineRows[numLines++] = r;
+        level[r][2] = 'S';
+        for (int c = 3; c < cols - 3; c++) level[r][c] = '=';
+        level[r][cols - 3] = 'D';
+    }
+
+    // Vertical lines every 8 columns between the first and last lines
+    bool usedLetter[26] = {false};
+    int lastLine = lineRows[numLines - 1];
+    int numVerticals = 0;
+    for (int c = 10; c < cols - 4; c += 8) {
+        numVerticals++;
+        for (int r = lineRows[0]; r <= lastLine + 2; r++) {
+            if (level[r][c] == '=') {
+                // Roughly one crossing in six becomes a switch
+                if (nextRandom(6) == 0) {
+                    char letter = SWITCH_LETTERS[nextRandom(NUM_SWITCH_LETTERS)];
+                    level[r][c] = letter;
+                    usedLetter[letter - 'A'] = true;
+                } else {
+                    level[r][c] = '+';
+                }
+            } else {
+                level[r][c] = '|';
+            }
+        }
+        level[lastLine + 2][c] = 'D';
+    }
+
+    std::ofstream out(outFile.c_str());
+    if (!out.is_open()) {
+        std::cerr << "Error: Could not write " << outFile << std::endl;
+        return 1;
+    }
+
+    out << "NAME:\nGenerated " << rows << "x" << cols << " network (" << numTrains << " trains, seed " << seed << ")\n\n";
+    out << "ROWS:\n" << rows << "\n\n";
+    out << "COLS:\n" << cols << "\n\n";
+    out << "SEED:\n" << seed << "\n\n";
+    out << "WEATHER:\nNORMAL\n\n";
+
+    out << "MAP:\n";
+    for (int r = 0; r < rows; r++) out << level[r] << "\n";
+    out << "\n";
+
+    out << "SWITCHES:\n";
+    for (int s = 0; s < 26; s++) {
+        if (!usedLetter[s]) continue;
+        int k = 2 + nextRandom(4);
+        out << (char)('A' + s) << " " << (nextRandom(4) == 0 ? "GLOBAL" : "PER_DIR") << " 0 "
+            << k << " " << k << " " << k << " " << k << " STRAIGHT TURN\n";
+    }
+    out << "\n";
+
+    // Trains: round-robin over lines, 4 ticks apart on the same line, written
+    // in spawn-tick order so the section can be streamed (--schedule level)
+    std::vector<int> trainTick(numTrains), trainRow(numTrains), trainColor(numTrains), order(numTrains);
+    for (int t = 0; t < numTrains; t++) {
+        trainTick[t] = (t / numLines) * 4 + nextRandom(2);
+        trainRow[t] = lineRows[t % numLines];
+        trainColor[t] = (nextRandom(2) == 0) ? t % numLines : numLines + nextRandom(numVerticals);
+        order[t] = t;
+    }
+    std::stable_sort(order.begin(), order.end(), [&](int a, int b) { return trainTick[a] < trainTick[b]; });
+
+    out << "TRAINS:\n";
+    for (int n = 0; n < numTrains; n++) {
+        int t = order[n];
+        out << trainTick[t] << " " << trainRow[t] << " 2 1 " << trainColor[t] << "\n";
+    }
+
+    out.close();
+    std::cout << "Wrote " << outFile << " (" << numLines << " lines, " << numTrains << " trains)" << std::endl;
+    return 0;
+}
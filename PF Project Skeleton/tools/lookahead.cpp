@@ -0,0 +1,114 @@
+#include "../core/simulation_state.h"
+#include "../core/simulation.h"
+#include "../core/io.h"
+#include "../core/advisor.h"
+#include <iostream>
+#include <iomanip>
+#include <chrono>
+#include <thread>
+#include <cstdlib>
+#include <unistd.h>
+
+// ============================================================================
+// LOOKAHEAD.CPP - Headless what-if table from the lookahead advisor
+// ============================================================================
+// Usage: lookahead <level.lvl> [tick] [horizon] [workers] [budgetMs]
+//
+// Runs the level headless to [tick], evaluates every candidate action over
+// the next [horizon] ticks in forked children (advisor.h) and prints the
+// predicted deliveries, crashes and wait ticks per candidate. Then it runs
+// the real simulation for [horizon] ticks and fails if the "do nothing"
+// prediction differs from what actually happened.
+// ============================================================================
+
+// ----------------------------------------------------------------------------
+// CANDIDATE NAME
+// ----------------------------------------------------------------------------
+static std::string describeCandidate(int c) {
+    int arg = lookahead[c][LOOKAHEAD_ARG];
+    switch (lookahead[c][LOOKAHEAD_ACTION]) {
+        case LOOKAHEAD_SWITCH:
+            return std::string("toggle switch ") + (char)('A' + arg);
+        case LOOKAHEAD_SAFETY:
+            return "toggle safety " + std::to_string(arg / MAX_COLS) + "," + std::to_string(arg % MAX_COLS);
+        default:
+            return "do nothing";
+    }
+}
+
+// ----------------------------------------------------------------------------
+// FINISHED TRAINS by state (as the advisor's children count them)
+// ----------------------------------------------------------------------------
+static void countFinishedTrains(int& delivered, int& crashed) {
+    delivered = crashed = 0;
+    for (int i = 0; i < numTrains; i++) {
+        if (trains[i][TRAIN_STATE] == TRAIN_DELIVERED) delivered++;
+        else if (trains[i][TRAIN_STATE] == TRAIN_CRASHED) crashed++;
+    }
+}
+
+// ----------------------------------------------------------------------------
+// MAIN
+// ----------------------------------------------------------------------------
+int main(int argc, char* argv[]) {
+    if (argc < 2) {
+        std::cerr << "Usage: " << argv[0] << " <level.lvl> [tick] [horizon] [workers] [budgetMs]" << std::endl;
+        return 1;
+    }
+
+    int startTick = (argc > 2) ? atoi(argv[2]) : 5;
+    int horizon = (argc > 3) ? atoi(argv[3]) : 40;
+    int workers = (argc > 4) ? atoi(argv[4]) : (int)std::thread::hardware_concurrency();
+    double budget = ((argc > 5) ? atoi(argv[5]) : 5000) / 1000.0;
+
+    initializeSimulation();
+    logLevel = LOG_OFF;
+    printGridEnabled = false;
+    if (!loadLevelFile(argv[1])) return 1;
+    prepareLevelData();
+    while (currentTick < startTick) simulateOneTick();
+
+    // Safety-tile candidate: the first spawn point's tile
+    int safetyX = (numSpawnPoints > 0) ? spawnPoints[0][SPAWN_X] : -1;
+    int safetyY = (numSpawnPoints > 0) ? spawnPoints[0][SPAWN_Y] : -1;
+
+    std::chrono::steady_clock::time_point start = std::chrono::steady_clock::now();
+    startLookahead(horizon, workers, budget, safetyX, safetyY);
+    while (!pollLookahead()) usleep(1000);
+    std::chrono::duration<double> elapsed = std::chrono::steady_clock::now() - start;
+
+    std::cout << "\n=== LOOKAHEAD: " << levelName << " ===" << std::endl;
+    std::cout << "From tick " << lookaheadTick << ", " << horizon << " ticks, " << numLookahead
+              << " candidates in " << elapsed.count() * 1000.0 << " ms" << std::endl;
+    std::cout << std::left << std::setw(24) << "Candidate" << std::setw(12) << "Delivered"
+              << std::setw(10) << "Crashed" << std::setw(8) << "Wait" << std::endl;
+
+    int best = getBestLookahead();
+    for (int c = 0; c < numLookahead; c++) {
+        std::cout << std::setw(24) << describeCandidate(c);
+        if (lookahead[c][LOOKAHEAD_STATUS] == LOOKAHEAD_DONE) {
+            std::cout << std::setw(12) << lookahead[c][LOOKAHEAD_DELIVERED]
+                      << std::setw(10) << lookahead[c][LOOKAHEAD_CRASHED]
+                      << std::setw(8) << lookahead[c][LOOKAHEAD_WAIT] << (c == best ? "best" : "");
+        } else {
+            std::cout << "timed out";
+        }
+        std::cout << std::endl;
+    }
+
+    // Check "do nothing" against the real run
+    if (lookahead[0][LOOKAHEAD_STATUS] != LOOKAHEAD_DONE) {
+        std::cout << "\"do nothing\" timed out; prediction not checked" << std::endl;
+        return 1;
+    }
+    int delivered, crashed, deliveredAfter, crashedAfter;
+    countFinishedTrains(delivered, crashed);
+    int waitTicks = totalWaitTicks;
+    for (int t = 0; t < horizon; t++) simulateOneTick();
+    countFinishedTrains(deliveredAfter, crashedAfter);
+    bool match = (deliveredAfter - delivered == lookahead[0][LOOKAHEAD_DELIVERED] &&
+                  crashedAfter - crashed == lookahead[0][LOOKAHEAD_CRASHED] &&
+                  totalWaitTicks - waitTicks == lookahead[0][LOOKAHEAD_WAIT]);
+    std::cout << "\"do nothing\" prediction " << (match ? "matches the real run" : "MISMATCH") << std::endl;
+    return match ? 0 : 1;
+}
@@ -0,0 +1,337 @@
+#include "../core/simulation_state.h"
+#include "../core/simulation.h"
+#include "../core/io.h"
+#include "../core/reach.h"
+#include "../core/policy.h"
+#include <iostream>
+#include <fstream>
+#include <string>
+#include <cstdlib>
+#include <algorithm>
+#include <thread>
+#include <unistd.h>
+#include <sys/wait.h>
+
+// ============================================================================
+// OPTIMISE_SWITCHES.CPP - Search switch K-values and initial states
+// ============================================================================
+// Usage: optimise_switches <level.lvl> [generations] [out.lvl]
+//
+// Treats each switch's initial state and K0..K3 as the search space and runs
+// a (1+lambda) evolutionary search: every generation mutates the best
+// candidate lambda times and evaluates the mutants as headless simulations
+// in forked child processes, one per core. A candidate is better if it
+// delivers more trains, then if it needs fewer ticks, then fewer wait ticks.
+// Runs that can no longer beat the best are stopped early.
+// The best settings are written to out.lvl (default: the input file) by
+// rewriting only its SWITCHES section. Levels under POLICY ADAPTIVE are
+// refused, since that policy ignores the K-values.
+// ============================================================================
+
+// Candidate parameters per switch: 0=initState, 1-4=K0..K3
+const int PARAM_INIT = 0;
+const int PARAM_K0 = 1;
+const int PARAM_FIELDS = 5;
+
+const int MAX_K = 8;
+const int MAX_LAMBDA = 64;
+
+// Result fields: 0=delivered, 1=ticks, 2=waitTicks, 3=stoppedEarly
+const int RESULT_DELIVERED = 0;
+const int RESULT_TICKS = 1;
+const int RESULT_WAIT = 2;
+const int RESULT_STOPPED = 3;
+const int RESULT_FIELDS = 4;
+
+// Switches listed in the SWITCHES section (the only ones we tune)
+static int tunable[MAX_SWITCHES];
+static int numTunable = 0;
+
+static int bestParams[MAX_SWITCHES][PARAM_FIELDS];
+static int bestResult[RESULT_FIELDS];
+static int candidateParams[MAX_LAMBDA][MAX_SWITCHES][PARAM_FIELDS];
+static int candidateResult[MAX_LAMBDA][RESULT_FIELDS];
+
+static int maxTicks = 0;
+
+// ----------------------------------------------------------------------------
+// SMALL DETERMINISTIC RANDOM NUMBER GENERATOR (LCG)
+// ----------------------------------------------------------------------------
+static unsigned int searchState = 1;
+
+static int nextRandom(int range) {
+    searchState = searchState * 1103515245u + 12345u;
+    return (int)((searchState >> 16) % (unsigned int)range);
+}
+
+// ----------------------------------------------------------------------------
+// COMPARE RESULTS: true if a is better than b
+// ----------------------------------------------------------------------------
+static bool isBetter(const int* a, const int* b) {
+    if (a[RESULT_STOPPED] != b[RESULT_STOPPED]) return !a[RESULT_STOPPED];
+    if (a[RESULT_DELIVERED] != b[RESULT_DELIVERED]) return a[RESULT_DELIVERED] > b[RESULT_DELIVERED];
+    if (a[RESULT_TICKS] != b[RESULT_TICKS]) return a[RESULT_TICKS] < b[RESULT_TICKS];
+    return a[RESULT_WAIT] < b[RESULT_WAIT];
+}
+
+// ----------------------------------------------------------------------------
+// APPLY PARAMETERS to the (freshly forked) switch state
+// ----------------------------------------------------------------------------
+static void applyParams(int params[MAX_SWITCHES][PARAM_FIELDS]) {
+    for (int t = 0; t < numTunable; t++) {
+        int sw = tunable[t];
+        switches[sw][SWITCH_INIT_STATE] = params[sw][PARAM_INIT];
+        switches[sw][SWITCH_CURRENT_STATE] = params[sw][PARAM_INIT];
+        for (int d = 0; d < 4; d++) {
+            switches[sw][SWITCH_K0 + d] = params[sw][PARAM_K0 + d];
+        }
+    }
+    // States were set directly, not flipped
+    resetReachCache();
+}
+
+// ----------------------------------------------------------------------------
+// RUN CANDIDATE (child process)
+// ----------------------------------------------------------------------------
+// Simulate until done, the tick cap, or the run cannot beat the bound.
+// ----------------------------------------------------------------------------
+static void runCandidate(int params[MAX_SWITCHES][PARAM_FIELDS], const int* bound, int* result) {
+    applyParams(params);
+
+    result[RESULT_STOPPED] = 0;
+    while (true) {
+        int scheduled = 0, active = 0, delivered = 0, crashed = 0;
+        for (int i = 0; i < numTrains; i++) {
+            switch (trains[i][TRAIN_STATE]) {
+                case TRAIN_SCHEDULED: scheduled++; break;
+                case TRAIN_ACTIVE: active++; break;
+                case TRAIN_DELIVERED: delivered++; break;
+                case TRAIN_CRASHED: crashed++; break;
+            }
+        }
+        result[RESULT_DELIVERED] = delivered;
+        result[RESULT_TICKS] = currentTick;
+        result[RESULT_WAIT] = totalWaitTicks;
+
+        if (scheduled == 0 && active == 0) return;
+
+        // Hopeless: cannot deliver as many, or already slower at best equal
+        int reachable = numTrains - crashed;
+        bool boundValid = !bound[RESULT_STOPPED];
+        if (boundValid && (reachable < bound[RESULT_DELIVERED] ||
+                           (reachable == bound[RESULT_DELIVERED] && currentTick > bound[RESULT_TICKS]))) {
+            result[RESULT_STOPPED] = 1;
+            return;
+        }
+        if (currentTick >= maxTicks) {
+            result[RESULT_STOPPED] = 1;
+            return;
+        }
+
+        simulateOneTick();
+    }
+}
+
+// ----------------------------------------------------------------------------
+// EVALUATE CANDIDATES in parallel child processes
+// ----------------------------------------------------------------------------
+// The parent never simulates, so every child forks from the loaded level and
+// shares its pages until it writes them.
+// ----------------------------------------------------------------------------
+static void evaluateCandidates(int count, int workers) {
+    int next = 0;
+    while (next < count) {
+        int batch = std::min(workers, count - next);
+        int pipes[MAX_LAMBDA];
+        pid_t children[MAX_LAMBDA];
+
+        for (int b = 0; b < batch; b++) {
+            int fds[2];
+            if (pipe(fds) != 0) {
+                std::cerr << "Error: pipe failed" << std::endl;
+                exit(1);
+            }
+            children[b] = fork();
+            if (children[b] == 0) {
+                close(fds[0]);
+                int result[RESULT_FIELDS];
+                runCandidate(candidateParams[next + b], bestResult, result);
+                ssize_t written = write(fds[1], result, sizeof(result));
+                _exit(written == (ssize_t)sizeof(result) ? 0 : 1);
+            }
+            close(fds[1]);
+            pipes[b] = fds[0];
+        }
+
+        for (int b = 0; b < batch; b++) {
+            int* result = candidateResult[next + b];
+            if (read(pipes[b], result, sizeof(int) * RESULT_FIELDS) != (ssize_t)(sizeof(int) * RESULT_FIELDS)) {
+                result[RESULT_STOPPED] = 1;
+            }
+            close(pipes[b]);
+            waitpid(children[b], nullptr, 0);
+        }
+        next += batch;
+    }
+}
+
+// ----------------------------------------------------------------------------
+// MUTATE: copy the best and change 1-3 parameters
+// ----------------------------------------------------------------------------
+static void mutateCandidate(int candidate) {
+    for (int sw = 0; sw < MAX_SWITCHES; sw++) {
+        for (int p = 0; p < PARAM_FIELDS; p++) {
+            candidateParams[candidate][sw][p] = bestParams[sw][p];
+        }
+    }
+
+    int changes = 1 + nextRandom(3);
+    for (int c = 0; c < changes; c++) {
+        int sw = tunable[nextRandom(numTunable)];
+        int* params = candidateParams[candidate][sw];
+        int kind = nextRandom(3);
+
+        if (kind == 0) {
+            params[PARAM_INIT] = 1 - params[PARAM_INIT];
+        } else if (kind == 1) {
+            // GLOBAL switches only use K0
+            int d = (switches[sw][SWITCH_MODE] == GLOBAL) ? 0 : nextRandom(4);
+            params[PARAM_K0 + d] = 1 + nextRandom(MAX_K);
+        } else {
+            int step = nextRandom(2) ? 1 : -1;
+            for (int d = 0; d < 4; d++) {
+                params[PARAM_K0 + d] = std::max(1, std::min(MAX_K, params[PARAM_K0 + d] + step));
+            }
+        }
+    }
+}
+
+// ----------------------------------------------------------------------------
+// WRITE LEVEL: copy the input, replacing the SWITCHES section
+// ----------------------------------------------------------------------------
+static bool writeLevelWithSwitches(const std::string& inFile, const std::string& outFile) {
+    std::ifstream in(inFile.c_str());
+    if (!in.is_open()) return false;
+
+    std::string text, line;
+    bool inSwitches = false;
+    while (std::getline(in, line)) {
+        if (inSwitches) {
+            // Old switch lines (and blank lines) are dropped up to the next section
+            if (!isLevelSectionHeader(line)) continue;
+            inSwitches = false;
+            text += "\n";
+        }
+
+        text += line + "\n";
+        if (line.find("SWITCHES:") == 0) {
+            inSwitches = true;
+            for (int t = 0; t < numTunable; t++) {
+                int sw = tunable[t];
+                text += std::string(1, (char)('A' + sw)) + " " +
+                        (switches[sw][SWITCH_MODE] == PER_DIR ? "PER_DIR" : "GLOBAL") + " " +
+                        std::to_string(bestParams[sw][PARAM_INIT]);
+                for (int d = 0; d < 4; d++) text += " " + std::to_string(bestParams[sw][PARAM_K0 + d]);
+                text += " " + switchStateNames[sw][0] + " " + switchStateNames[sw][1] + "\n";
+            }
+        }
+    }
+    in.close();
+
+    std::ofstream out(outFile.c_str());
+    if (!out.is_open()) return false;
+    out << text;
+    return true;
+}
+
+// ----------------------------------------------------------------------------
+// MAIN
+// ----------------------------------------------------------------------------
+int main(int argc, char* argv[]) {
+    if (argc < 2) {
+        std::cerr << "Usage: " << argv[0] << " <level.lvl> [generations] [out.lvl]" << std::endl;
+        return 1;
+    }
+
+    std::string levelFile = argv[1];
+    int generations = (argc > 2) ? atoi(argv[2]) : 20;
+    std::string outFile = (argc > 3) ? argv[3] : levelFile;
+    int workers = std::max(1, (int)std::thread::hardware_concurrency());
+    int lambda = std::min(MAX_LAMBDA, std::max(8, workers * 2));
+
+    initializeSimulation();
+    logLevel = LOG_OFF;
+    printGridEnabled = false;
+    if (!loadLevelFile(levelFile)) return 1;
+    prepareLevelData();
+    searchState = (unsigned int)seed;
+
+    for (int sw = 0; sw < numSwitches; sw++) {
+        if (switchStateNames[sw][0].empty()) continue;
+        tunable[numTunable++] = sw;
+        bestParams[sw][PARAM_INIT] = switches[sw][SWITCH_INIT_STATE];
+        for (int d = 0; d < 4; d++) bestParams[sw][PARAM_K0 + d] = switches[sw][SWITCH_K0 + d];
+    }
+    if (numTunable == 0) {
+        std::cerr << "Error: level has no SWITCHES entries to tune" << std::endl;
+        return 1;
+    }
+    if (switchPolicy != SWITCH_POLICY_COUNTERS) {
+        std::cerr << "Error: K-values have no effect under POLICY " << switchPolicyNames[switchPolicy]
+                  << "; nothing to tune" << std::endl;
+        return 1;
+    }
+
+    // Baseline: the level as written (no early stop, generous tick cap)
+    maxTicks = 100000;
+    bestResult[RESULT_STOPPED] = 1;
+    for (int sw = 0; sw < MAX_SWITCHES; sw++) {
+        for (int p = 0; p < PARAM_FIELDS; p++) candidateParams[0][sw][p] = bestParams[sw][p];
+    }
+    evaluateCandidates(1, 1);
+    for (int r = 0; r < RESULT_FIELDS; r++) bestResult[r] = candidateResult[0][r];
+    int baseline[RESULT_FIELDS];
+    for (int r = 0; r < RESULT_FIELDS; r++) baseline[r] = bestResult[r];
+    maxTicks = bestResult[RESULT_TICKS] * 2 + 50;
+
+    std::cout << "Level: " << levelName << " (" << numTunable << " switches, " << workers << " workers, lambda "
+              << lambda << ")" << std::endl;
+    std::cout << "Baseline: delivered " << baseline[RESULT_DELIVERED] << "/" << numTrains << ", ticks "
+              << baseline[RESULT_TICKS] << ", wait " << baseline[RESULT_WAIT] << std::endl;
+
+    for (int g = 0; g < generations; g++) {
+        for (int c = 0; c < lambda; c++) mutateCandidate(c);
+        evaluateCandidates(lambda, workers);
+
+        int stopped = 0;
+        int bestCandidate = -1;
+        for (int c = 0; c < lambda; c++) {
+            if (candidateResult[c][RESULT_STOPPED]) stopped++;
+            if (isBetter(candidateResult[c], bestCandidate < 0 ? bestResult : candidateResult[bestCandidate])) {
+                bestCandidate = c;
+            }
+        }
+
+        if (bestCandidate >= 0) {
+            for (int sw = 0; sw < MAX_SWITCHES; sw++) {
+                for (int p = 0; p < PARAM_FIELDS; p++) bestParams[sw][p] = candidateParams[bestCandidate][sw][p];
+            }
+            for (int r = 0; r < RESULT_FIELDS; r++) bestResult[r] = candidateResult[bestCandidate][r];
+        }
+
+        std::cout << "Generation " << g + 1 << ": best delivered " << bestResult[RESULT_DELIVERED]
+                  << ", ticks " << bestResult[RESULT_TICKS] << ", wait " << bestResult[RESULT_WAIT]
+                  << " (" << stopped << "/" << lambda << " runs stopped early)" << std::endl;
+    }
+
+    if (!isBetter(bestResult, baseline)) {
+        std::cout << "No improvement found; " << outFile << " not written." << std::endl;
+        return 0;
+    }
+    if (!writeLevelWithSwitches(levelFile, outFile)) {
+        std::cerr << "Error: Could not write " << outFile << std::endl;
+        return 1;
+    }
+    std::cout << "Best switch settings written to " << outFile << std::endl;
+    return 0;
+}
@@ -0,0 +1,136 @@
+#include "../core/simulation_state.h"
+#include "../core/simulation.h"
+#include "../core/io.h"
+#include "../core/grid.h"
+#include "../core/switches.h"
+#include "../core/reach.h"
+#include <iostream>
+#include <iomanip>
+#include <cstdlib>
+
+// ============================================================================
+// REACH_CHECK.CPP - Reachability cache against the tile-by-tile walk
+// ============================================================================
+// Usage: reach_check <level.lvl> [more levels...]
+//
+// Runs every level with the phased engine and, after every tick, toggles one
+// pseudo-randomly chosen switch (so cached answers keep being invalidated
+// between the engine's own flips) and compares queryReach() with
+// walkTilesToDestination() for every active train, and from a sample of the
+// switch tiles in all four directions to every destination. Fails on any
+// mismatch.
+// ============================================================================
+
+// Most ticks checked per level.
+const int MAX_CHECK_TICKS = 2000;
+
+// Each switch tile is checked on one tick in SWITCH_SAMPLE (walks that circle
+// run 4 x rows x cols tiles, so checking every tile every tick is slow).
+const int SWITCH_SAMPLE = 8;
+
+// ----------------------------------------------------------------------------
+// SMALL DETERMINISTIC RANDOM NUMBER GENERATOR (LCG, as in gen_level)
+// ----------------------------------------------------------------------------
+static unsigned int checkState = 1;
+
+static int nextRandom(int range) {
+    checkState = checkState * 1103515245u + 12345u;
+    return (int)((checkState >> 16) % (unsigned int)range);
+}
+
+// ----------------------------------------------------------------------------
+// ANY TRAINS LEFT (without isSimulationComplete, which writes reports)
+// ----------------------------------------------------------------------------
+static bool hasTrainsLeft() {
+    for (int i = 0; i < numTrains; i++) {
+        if (trains[i][TRAIN_STATE] == TRAIN_SCHEDULED || trains[i][TRAIN_STATE] == TRAIN_ACTIVE) return true;
+    }
+    return false;
+}
+
+// ----------------------------------------------------------------------------
+// COMPARE ONE QUERY; returns true if the cache and the walk agree
+// ----------------------------------------------------------------------------
+static bool compareQuery(int x, int y, int dir, int destX, int destY) {
+    int nextExit;
+    int cached = queryReach(x, y, dir, destX, destY, nextExit);
+    int walked = walkTilesToDestination(x, y, dir, destX, destY);
+    if (cached == walked) return true;
+
+    std::cout << "  tick " << currentTick << ": (" << x << "," << y << ") dir " << dir << " to (" << destX
+              << "," << destY << "): cache " << cached << ", walk " << walked << std::endl;
+    return false;
+}
+
+// ----------------------------------------------------------------------------
+// CHECK LEVEL
+// ----------------------------------------------------------------------------
+// Returns the mismatches found; ticks and queries via out params.
+// ----------------------------------------------------------------------------
+static long checkLevel(const char* levelFile, int& ticksChecked, long& queries) {
+    initializeSimulation();
+    printGridEnabled = false;
+    logLevel = LOG_OFF;
+    heatmapEnabled = false;
+    if (!loadLevelFile(levelFile)) exit(1);
+    checkState = 1;
+
+    long mismatches = 0;
+    queries = 0;
+    ticksChecked = 0;
+    while (ticksChecked < MAX_CHECK_TICKS && hasTrainsLeft()) {
+        simulateOneTick();
+        ticksChecked++;
+        if (numSwitches > 0) toggleSwitchState(nextRandom(numSwitches));
+
+        for (int i = 0; i < numTrains; i++) {
+            if (trains[i][TRAIN_STATE] != TRAIN_ACTIVE) continue;
+            queries++;
+            if (!compareQuery(trains[i][TRAIN_X], trains[i][TRAIN_Y], trains[i][TRAIN_DIRECTION],
+                              trains[i][TRAIN_DEST_X], trains[i][TRAIN_DEST_Y])) {
+                mismatches++;
+            }
+        }
+
+        for (int x = 0; x < gridRows; x++) {
+            for (int y = 0; y < gridCols; y++) {
+                if (!isSwitchTile(x, y) || nextRandom(SWITCH_SAMPLE) != 0) continue;
+                for (int dir = 0; dir < 4; dir++) {
+                    for (int d = 0; d < numDestinationPoints; d++) {
+                        queries++;
+                        if (!compareQuery(x, y, dir, destinationPoints[d][DEST_X], destinationPoints[d][DEST_Y])) {
+                            mismatches++;
+                        }
+                    }
+                }
+            }
+        }
+    }
+    return mismatches;
+}
+
+// ----------------------------------------------------------------------------
+// MAIN
+// ----------------------------------------------------------------------------
+int main(int argc, char* argv[]) {
+    if (argc < 2) {
+        std::cerr << "Usage: " << argv[0] << " <level.lvl> [more levels...]" << std::endl;
+        return 1;
+    }
+
+    bool allMatch = true;
+    std::cout << std::left << std::setw(40) << "Level" << std::setw(10) << "Ticks" << std::setw(12) << "Queries"
+              << "Mismatches" << std::endl;
+    for (int arg = 1; arg < argc; arg++) {
+        int ticksChecked = 0;
+        long queries = 0;
+        long mismatches = checkLevel(argv[arg], ticksChecked, queries);
+        allMatch = allMatch && (mismatches == 0);
+
+        std::cout << std::setw(40) << argv[arg] << std::setw(10) << ticksChecked << std::setw(12) << queries
+                  << mismatches << (mismatches ? "  FAIL" : "") << std::endl;
+    }
+
+    std::cout << (allMatch ? "Reach cache matches the walk" : "Reach cache differs from the walk") << std::endl;
+    return allMatch ? 0 : 1;
+}
@@ -0,0 +1,198 @@
+#include "../core/simulation_state.h"
+#include "../core/simulation.h"
+#include "../core/io.h"
+#include "../core/partition.h"
+#include "../core/fingerprint.h"
+#include <iostream>
+#include <iomanip>
+#include <fstream>
+#include <string>
+#include <cstdlib>
+#include <cstring>
+
+// ============================================================================
+// VERIFY.CPP - Golden fingerprint determinism check
+// ============================================================================
+// Usage: verify [--update] <goldenDir> <level.lvl> [more levels...]
+//
+// Runs every level and compares the state fingerprint after every phase of
+// every tick with goldenDir/<level name>.fp, reporting the first tick and
+// phase that differ. Each level is run with the phased engine,
+// work-stealing routes (both checked phase by phase), the partitioned engine,
+// the fused, bitboard and segment ticks (checked at the end of each tick).
+// --update rewrites the goldens from the phased engine instead.
+// ============================================================================
+
+// Engine configurations
+const int VERIFY_PHASED = 0;
+const int VERIFY_ROUTES = 1;
+const int VERIFY_PARTITIONED = 2;
+const int VERIFY_FUSED = 3;
+const int VERIFY_BITBOARD = 4;
+const int VERIFY_SEGMENTS = 5;
+const int NUM_VERIFY_ENGINES = 6;
+
+// Most ticks recorded per run.
+const int MAX_VERIFY_TICKS = 20000;
+
+// Fingerprints of a run and of the golden: [tick][phase]
+static unsigned long long runPrints[MAX_VERIFY_TICKS][NUM_TICK_PHASES];
+static unsigned long long goldenPrints[MAX_VERIFY_TICKS][NUM_TICK_PHASES];
+
+// ----------------------------------------------------------------------------
+// ANY TRAINS LEFT (without isSimulationComplete, which writes reports)
+// ----------------------------------------------------------------------------
+static bool hasTrainsLeft() {
+    for (int i = 0; i < numTrains; i++) {
+        if (trains[i][TRAIN_STATE] == TRAIN_SCHEDULED || trains[i][TRAIN_STATE] == TRAIN_ACTIVE) return true;
+    }
+    return false;
+}
+
+// ----------------------------------------------------------------------------
+// RUN LEVEL
+// ----------------------------------------------------------------------------
+// Records runPrints for one engine; returns the number of ticks run.
+// ----------------------------------------------------------------------------
+static int runLevel(const char* levelFile, int engine) {
+    initializeSimulation();
+    printGridEnabled = false;
+    logLevel = LOG_OFF;
+    fingerprintEnabled = true;
+    if (!loadLevelFile(levelFile)) exit(1);
+
+    partitionedTick = (engine == VERIFY_PARTITIONED);
+    parallelRoutes = (engine == VERIFY_ROUTES);
+    fusedTick = (engine == VERIFY_FUSED);
+    bitboardTick = (engine == VERIFY_BITBOARD);
+    segmentTick = (engine == VERIFY_SEGMENTS);
+    tickThreads = 3;
+
+    int ticks = 0;
+    while (ticks < MAX_VERIFY_TICKS && hasTrainsLeft()) {
+        simulateOneTick();
+        for (int p = 0; p < NUM_TICK_PHASES; p++) {
+            runPrints[ticks][p] = getPhaseFingerprint((TickPhase)p);
+        }
+        ticks++;
+    }
+
+    shutdownPartitionedTick();
+    return ticks;
+}
+
+// ----------------------------------------------------------------------------
+// GOLDEN FILES
+// ----------------------------------------------------------------------------
+// One line per tick: the tick, then one hex fingerprint per phase.
+// ----------------------------------------------------------------------------
+static std::string goldenPath(const std::string& goldenDir, const std::string& levelFile) {
+    std::string name = levelFile.substr(levelFile.find_last_of('/') + 1);
+    name = name.substr(0, name.find_last_of('.'));
+    return goldenDir + "/" + name + ".fp";
+}
+
+static bool writeGolden(const std::string& path, int ticks) {
+    std::ofstream out(path.c_str());
+    if (!out.is_open()) return false;
+    out << "# tick";
+    for (int p = 0; p < NUM_TICK_PHASES; p++) out << " " << tickPhaseNames[p];
+    out << "\n" << std::hex << std::setfill('0');
+    for (int t = 0; t < ticks; t++) {
+        out << std::dec << t << std::hex;
+        for (int p = 0; p < NUM_TICK_PHASES; p++) out << " " << std::setw(16) << runPrints[t][p];
+        out << "\n";
+    }
+    return true;
+}
+
+// Returns the golden's tick count, or -1 if it cannot be read.
+static int readGolden(const std::string& path) {
+    std::ifstream in(path.c_str());
+    if (!in.is_open()) return -1;
+
+    std::string header;
+    std::getline(in, header);
+    int ticks = 0, tick;
+    while (ticks < MAX_VERIFY_TICKS && in >> std::dec >> tick) {
+        for (int p = 0; p < NUM_TICK_PHASES; p++) in >> std::hex >> goldenPrints[ticks][p];
+        ticks++;
+    }
+    return ticks;
+}
+
+// ----------------------------------------------------------------------------
+// COMPARE RUN WITH GOLDEN
+// ----------------------------------------------------------------------------
+// Prints the first difference; endOfTickOnly compares PHASE_SIGNALS only.
+// ----------------------------------------------------------------------------
+static bool compareRun(int runTicks, int goldenTicks, bool endOfTickOnly) {
+    int ticks = runTicks < goldenTicks ? runTicks : goldenTicks;
+    for (int t = 0; t < ticks; t++) {
+        for (int p = endOfTickOnly ? PHASE_SIGNALS : 0; p < NUM_TICK_PHASES; p++) {
+            if (runPrints[t][p] == goldenPrints[t][p]) continue;
+            std::cout << "DIVERGED at tick " << t << ", phase " << tickPhaseNames[p]
+                      << (endOfTickOnly ? " (end of tick)" : "") << std::hex
+                      << ": expected " << goldenPrints[t][p] << ", got " << runPrints[t][p]
+                      << std::dec << std::endl;
+            return false;
+        }
+    }
+    if (runTicks != goldenTicks) {
+        std::cout << "DIVERGED: ran " << runTicks << " ticks, golden has " << goldenTicks << std::endl;
+        return false;
+    }
+    std::cout << "OK" << std::endl;
+    return true;
+}
+
+// ----------------------------------------------------------------------------
+// MAIN
+// ----------------------------------------------------------------------------
+int main(int argc, char* argv[]) {
+    int arg = 1;
+    bool update = false;
+    if (arg < argc && strcmp(argv[arg], "--update") == 0) {
+        update = true;
+        arg++;
+    }
+    if (argc - arg < 2) {
+        std::cerr << "Usage: " << argv[0] << " [--update] <goldenDir> <level.lvl> [more levels...]" << std::endl;
+        return 1;
+    }
+
+    std::string goldenDir = argv[arg++];
+    const char* engineNames[NUM_VERIFY_ENGINES] = {"phased", "routes-ws", "partitioned", "fused", "bitboard",
+                                                   "segments"};
+    bool allMatch = true;
+
+    for (; arg < argc; arg++) {
+        std::string path = goldenPath(goldenDir, argv[arg]);
+
+        if (update) {
+            int ticks = runLevel(argv[arg], VERIFY_PHASED);
+            if (!writeGolden(path, ticks)) {
+                std::cerr << "Error: Could not write " << path << std::endl;
+                return 1;
+            }
+            std::cout << "Wrote " << path << " (" << ticks << " ticks)" << std::endl;
+            continue;
+        }
+
+        int goldenTicks = readGolden(path);
+        if (goldenTicks < 0) {
+            std::cout << std::left << std::setw(40) << argv[arg] << "missing golden " << path << std::endl;
+            allMatch = false;
+            continue;
+        }
+        for (int engine = 0; engine < NUM_VERIFY_ENGINES; engine++) {
+            int ticks = runLevel(argv[arg], engine);
+            std::cout << std::left << std::setw(40) << argv[arg] << std::setw(14) << engineNames[engine];
+            bool endOfTickOnly = (engine >= VERIFY_PARTITIONED);
+            allMatch = compareRun(ticks, goldenTicks, endOfTickOnly) && allMatch;
+        }
+    }
+
+    if (!update) std::cout << (allMatch ? "All fingerprints match" : "Fingerprints differ") << std::endl;
+    return allMatch ? 0 : 1;
+}